@@ -0,0 +1,40 @@
+diff --git a/chrome/browser/browseros/core/browseros_activity.cc b/chrome/browser/browseros/core/browseros_activity.cc
+new file mode 100644
+index 0000000000000..6429bc7a9c327
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_activity.cc
+@@ -0,0 +1,34 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_activity.h"
++
++#include <utility>
++
++#include "base/no_destructor.h"
++
++namespace browseros {
++
++namespace {
++
++using McpRequestCallbackList =
++    base::RepeatingCallbackList<void(content::BrowserContext*)>;
++
++McpRequestCallbackList& GetMcpRequestCallbacks() {
++  static base::NoDestructor<McpRequestCallbackList> callbacks;
++  return *callbacks;
++}
++
++}  // namespace
++
++base::CallbackListSubscription SubscribeToMcpRequests(
++    McpRequestCallback callback) {
++  return GetMcpRequestCallbacks().Add(std::move(callback));
++}
++
++void NotifyMcpRequest(content::BrowserContext* target) {
++  GetMcpRequestCallbacks().Notify(target);
++}
++
++}  // namespace browseros
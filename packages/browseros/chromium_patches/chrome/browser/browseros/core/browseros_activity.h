@@ -0,0 +1,41 @@
+diff --git a/chrome/browser/browseros/core/browseros_activity.h b/chrome/browser/browseros/core/browseros_activity.h
+new file mode 100644
+index 0000000000000..7545829bb169e
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_activity.h
+@@ -0,0 +1,35 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_ACTIVITY_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_ACTIVITY_H_
++
++#include "base/callback_list.h"
++#include "base/functional/callback.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++// Signal that an MCP client is talking to BrowserOS. The server proxy
++// reports each request it accepts, with the profile the sidecar acts on, so
++// that the per-profile listener for that profile (the extension worker
++// keepalive) can wake agent extensions before the sidecar calls into them,
++// without the server depending on the extensions code.
++//
++// UI thread only.
++using McpRequestCallback =
++    base::RepeatingCallback<void(content::BrowserContext* target)>;
++base::CallbackListSubscription SubscribeToMcpRequests(
++    McpRequestCallback callback);
++
++// Runs every callback registered with SubscribeToMcpRequests() with
++// |target|. Listeners ignore requests for other profiles.
++void NotifyMcpRequest(content::BrowserContext* target);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_ACTIVITY_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_prefs.h b/chrome/browser/browseros/core/browseros_prefs.h
 new file mode 100644
-index 0000000000000..3d2c46562d783
+index 0000000000000..0e66d8b508c74
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_prefs.h
-@@ -0,0 +1,65 @@
+@@ -0,0 +1,70 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -42,6 +42,11 @@ index 0000000000000..3d2c46562d783
 +// String containing the default provider ID for BrowserOS
 +inline constexpr char kDefaultProviderId[] = "browseros.default_provider_id";
 +
++// Automation prefs
++// Dictionary: per-origin record of which click/type/clear strategies worked,
++// kept by the browserOS extension API. Shown in chrome://prefs-internals.
++inline constexpr char kActionStrategies[] = "browseros.action_strategies";
++
 +}  // namespace prefs
 +
 +// Registers BrowserOS profile preferences.
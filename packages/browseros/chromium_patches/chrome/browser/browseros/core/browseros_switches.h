@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_switches.h b/chrome/browser/browseros/core/browseros_switches.h
 new file mode 100644
-index 0000000000000..dcd8b3ae307f2
+index 0000000000000..c3865335135cb
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_switches.h
-@@ -0,0 +1,86 @@
+@@ -0,0 +1,136 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -36,6 +36,15 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the CDP (Chrome DevTools Protocol) port.
 +inline constexpr char kCDPPort[] = "browseros-cdp-port";
 +
++// Also serves CDP on a Unix domain socket that only the current user can
++// connect to (POSIX only). Takes a path, or no value for cdp.sock in the
++// server's execution directory. The server is told via --cdp-socket.
++inline constexpr char kCDPSocket[] = "browseros-cdp-socket";
++
++// Hands the server a connected CDP socket it inherits as --cdp-fd, so it
++// drives the browser without a port or a connect (POSIX only).
++inline constexpr char kCDPPipe[] = "browseros-cdp-pipe";
++
 +// Overrides the stable MCP proxy port (what external clients connect to).
 +inline constexpr char kProxyPort[] = "browseros-proxy-port";
 +
@@ -48,6 +57,30 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the Extension server port.
 +inline constexpr char kExtensionPort[] = "browseros-extension-port";
 +
++// Namespaces the server lock/state files and port block so several BrowserOS
++// instances on one host each run their own server. Takes a literal name, or
++// "user-data-dir" / "profile" to derive one from the launch configuration.
++inline constexpr char kInstanceNamespace[] = "browseros-instance-namespace";
++
++// Overrides the host-wide instance registry file (default:
++// ~/.browseros/instances.json).
++inline constexpr char kInstanceRegistry[] = "browseros-instance-registry";
++
++// Interval in milliseconds between server heartbeats (default 1000). 0
++// disables the heartbeat and falls back to the 30 second HTTP health check.
++inline constexpr char kServerHeartbeatInterval[] =
++    "browseros-server-heartbeat-interval-ms";
++
++// Milliseconds a heartbeat may take before it counts as missed (default 500).
++inline constexpr char kServerHeartbeatDeadline[] =
++    "browseros-server-heartbeat-deadline-ms";
++
++// Caps the server's memory in megabytes (Linux cgroup v2 only).
++inline constexpr char kServerMemoryLimit[] = "browseros-server-memory-limit-mb";
++
++// Caps the server's CPU as a percentage of one core (Linux cgroup v2 only).
++inline constexpr char kServerCpuLimit[] = "browseros-server-cpu-limit-percent";
++
 +// === Extension Switches ===
 +
 +// Disables BrowserOS managed extensions.
@@ -56,6 +89,17 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the extensions config URL.
 +inline constexpr char kExtensionsUrl[] = "browseros-extensions-url";
 +
++// Installs BrowserOS extensions from the bundled CRX files on first run
++// instead of fetching them from the config server.
++inline constexpr char kEnableBundledExtensions[] =
++    "browseros-enable-bundled-extensions";
++
++// Seconds BrowserOS extension service workers are kept alive after the last
++// MCP request, DevTools session or agent call (default 300). 0 keeps them
++// alive permanently.
++inline constexpr char kExtensionWorkerIdleTimeout[] =
++    "browseros-extension-worker-idle-seconds";
++
 +// === URL Override Switches ===
 +
 +// Disables chrome://browseros/* URL overrides.
@@ -82,6 +126,12 @@ index 0000000000000..dcd8b3ae307f2
 +// Enables verbose Sparkle logging.
 +inline constexpr char kSparkleVerbose[] = "sparkle-verbose";
 +
++// === Metrics Switches ===
++
++// Overrides the endpoint metrics batches are posted to, e.g. a local server
++// when testing upload and retry behavior.
++inline constexpr char kMetricsEndpoint[] = "browseros-metrics-endpoint";
++
 +// === Misc Switches ===
 +
 +// Indicates this is the first run of BrowserOS.
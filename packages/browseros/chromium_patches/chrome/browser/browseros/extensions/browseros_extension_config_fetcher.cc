@@ -0,0 +1,357 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.cc b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.cc
+new file mode 100644
+index 0000000000000..fb075a91fcd2f
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.cc
+@@ -0,0 +1,351 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h"
++
++#include <utility>
++
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/path_service.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/net/system_network_context_manager.h"
++#include "chrome/common/chrome_paths.h"
++#include "net/base/load_flags.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr base::FilePath::CharType kCacheFileName[] =
++    FILE_PATH_LITERAL("browseros_extensions_config.json");
++
++constexpr char kCacheUrlKey[] = "url";
++constexpr char kCacheEtagKey[] = "etag";
++constexpr char kCacheLastModifiedKey[] = "last_modified";
++constexpr char kCacheExtensionsKey[] = "extensions";
++
++constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
++    net::DefineNetworkTrafficAnnotation("browseros_extension_config", R"(
++        semantics {
++          sender: "BrowserOS Extension Installer"
++          description:
++            "Fetches JSON configuration specifying which extensions should "
++            "be installed and maintained for BrowserOS users. Requests are "
++            "conditional on the previously fetched copy."
++          trigger:
++            "Browser startup when no bundled extensions are available, and "
++            "periodic maintenance (every 15 minutes, shared by all "
++            "profiles)."
++          data: "No user data. GET request only."
++          destination: OTHER
++          destination_other: "BrowserOS configuration server."
++        }
++        policy {
++          cookies_allowed: NO
++          setting: "Controlled via command-line flags or enterprise policies."
++          policy_exception_justification: "BrowserOS feature."
++        })");
++
++}  // namespace
++
++BrowserOSExtensionConfigFetcher::Result::Result() = default;
++BrowserOSExtensionConfigFetcher::Result::~Result() = default;
++BrowserOSExtensionConfigFetcher::Result::Result(Result&&) = default;
++BrowserOSExtensionConfigFetcher::Result&
++BrowserOSExtensionConfigFetcher::Result::operator=(Result&&) = default;
++
++BrowserOSExtensionConfigFetcher::CachedConfig::CachedConfig() = default;
++BrowserOSExtensionConfigFetcher::CachedConfig::~CachedConfig() = default;
++BrowserOSExtensionConfigFetcher::CachedConfig::CachedConfig(CachedConfig&&) =
++    default;
++BrowserOSExtensionConfigFetcher::CachedConfig&
++BrowserOSExtensionConfigFetcher::CachedConfig::operator=(CachedConfig&&) =
++    default;
++
++// static
++BrowserOSExtensionConfigFetcher*
++BrowserOSExtensionConfigFetcher::GetInstance() {
++  static base::NoDestructor<BrowserOSExtensionConfigFetcher> instance(
++      nullptr, [] {
++        base::FilePath user_data_dir;
++        if (!base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
++          LOG(WARNING) << "browseros: No user data dir, config not cached";
++          return base::FilePath();
++        }
++        return user_data_dir.Append(kCacheFileName);
++      }());
++  return instance.get();
++}
++
++BrowserOSExtensionConfigFetcher::BrowserOSExtensionConfigFetcher(
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++    base::FilePath cache_path)
++    : url_loader_factory_(std::move(url_loader_factory)),
++      cache_path_(std::move(cache_path)),
++      cache_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {}
++
++BrowserOSExtensionConfigFetcher::~BrowserOSExtensionConfigFetcher() = default;
++
++void BrowserOSExtensionConfigFetcher::Fetch(const GURL& url,
++                                            FetchCallback callback) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  if (cache_ && cache_->url == url && !cache_->fetched_at.is_null() &&
++      base::TimeTicks::Now() - cache_->fetched_at < kFreshness) {
++    VLOG(1) << "browseros: Serving extensions config fetched "
++            << (base::TimeTicks::Now() - cache_->fetched_at).InSeconds()
++            << "s ago";
++    Result result;
++    result.source = Source::kMemory;
++    result.extensions = cache_->extensions.Clone();
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(std::move(callback), std::move(result)));
++    return;
++  }
++
++  waiters_.emplace_back(url, std::move(callback));
++
++  if (!cache_read_) {
++    if (!cache_read_pending_) {
++      cache_read_pending_ = true;
++      cache_task_runner_->PostTaskAndReplyWithResult(
++          FROM_HERE, base::BindOnce(&ReadCache, cache_path_),
++          base::BindOnce(&BrowserOSExtensionConfigFetcher::OnCacheRead,
++                         weak_ptr_factory_.GetWeakPtr()));
++    }
++    return;
++  }
++  MaybeStartRequest();
++}
++
++// static
++std::optional<base::Value::Dict> BrowserOSExtensionConfigFetcher::ParseConfig(
++    const std::string& json) {
++  std::optional<base::Value::Dict> parsed = base::JSONReader::ReadDict(json);
++  if (!parsed) {
++    LOG(ERROR) << "browseros: Invalid config JSON";
++    return std::nullopt;
++  }
++
++  base::Value::Dict* extensions = parsed->FindDict("extensions");
++  if (!extensions) {
++    LOG(ERROR) << "browseros: No 'extensions' key in config";
++    return std::nullopt;
++  }
++  return std::move(*extensions);
++}
++
++// static
++std::optional<BrowserOSExtensionConfigFetcher::CachedConfig>
++BrowserOSExtensionConfigFetcher::ReadCache(const base::FilePath& path) {
++  std::string contents;
++  if (path.empty() ||
++      !base::ReadFileToStringWithMaxSize(path, &contents,
++                                         2 * kMaxConfigBytes)) {
++    return std::nullopt;
++  }
++
++  std::optional<base::Value::Dict> dict = base::JSONReader::ReadDict(contents);
++  if (!dict) {
++    return std::nullopt;
++  }
++  const std::string* url = dict->FindString(kCacheUrlKey);
++  base::Value::Dict* extensions = dict->FindDict(kCacheExtensionsKey);
++  if (!url || !extensions) {
++    return std::nullopt;
++  }
++
++  CachedConfig cache;
++  cache.url = GURL(*url);
++  if (const std::string* etag = dict->FindString(kCacheEtagKey)) {
++    cache.etag = *etag;
++  }
++  if (const std::string* last_modified =
++          dict->FindString(kCacheLastModifiedKey)) {
++    cache.last_modified = *last_modified;
++  }
++  cache.extensions = std::move(*extensions);
++  return cache;
++}
++
++// static
++void BrowserOSExtensionConfigFetcher::WriteCache(const base::FilePath& path,
++                                                 std::string contents) {
++  if (!base::ImportantFileWriter::WriteFileAtomically(path, contents)) {
++    LOG(WARNING) << "browseros: Failed to cache extensions config";
++  }
++}
++
++void BrowserOSExtensionConfigFetcher::OnCacheRead(
++    std::optional<CachedConfig> cache) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  cache_read_ = true;
++  cache_read_pending_ = false;
++  if (cache) {
++    VLOG(1) << "browseros: Loaded cached extensions config for "
++            << cache->url.spec();
++    cache_ = std::move(cache);
++  }
++  MaybeStartRequest();
++}
++
++void BrowserOSExtensionConfigFetcher::MaybeStartRequest() {
++  if (loader_ || waiters_.empty()) {
++    return;
++  }
++
++  in_flight_url_ = waiters_.front().first;
++  if (!in_flight_url_.is_valid()) {
++    LOG(ERROR) << "browseros: Invalid config URL";
++    RespondToWaiters(in_flight_url_, Source::kNone);
++    MaybeStartRequest();
++    return;
++  }
++
++  if (!url_loader_factory_) {
++    url_loader_factory_ = g_browser_process->system_network_context_manager()
++                              ->GetSharedURLLoaderFactory();
++  }
++
++  auto request = std::make_unique<network::ResourceRequest>();
++  request->url = in_flight_url_;
++  request->method = "GET";
++  // Revalidation is done here against the on-disk copy; keep the HTTP cache
++  // out of it.
++  request->load_flags = net::LOAD_DISABLE_CACHE;
++  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  if (cache_ && cache_->url == in_flight_url_) {
++    if (!cache_->etag.empty()) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
++                                 cache_->etag);
++    }
++    if (!cache_->last_modified.empty()) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
++                                 cache_->last_modified);
++    }
++  }
++
++  LOG(INFO) << "browseros: Fetching config from " << in_flight_url_.spec();
++
++  loader_ =
++      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
++  // 304 is not a 2xx; let it through instead of failing the load.
++  loader_->SetAllowHttpErrorResults(true);
++  loader_->DownloadToString(
++      url_loader_factory_.get(),
++      base::BindOnce(&BrowserOSExtensionConfigFetcher::OnResponse,
++                     weak_ptr_factory_.GetWeakPtr()),
++      kMaxConfigBytes);
++}
++
++void BrowserOSExtensionConfigFetcher::OnResponse(
++    std::unique_ptr<std::string> response_body) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  int net_error = loader_->NetError();
++  scoped_refptr<net::HttpResponseHeaders> headers;
++  if (loader_->ResponseInfo()) {
++    headers = loader_->ResponseInfo()->headers;
++  }
++  loader_.reset();
++
++  const GURL url = std::move(in_flight_url_);
++  in_flight_url_ = GURL();
++  const bool have_cache = cache_ && cache_->url == url;
++  const int response_code = headers ? headers->response_code() : 0;
++
++  if (response_code == net::HTTP_NOT_MODIFIED && have_cache) {
++    VLOG(1) << "browseros: Extensions config not modified";
++    cache_->fetched_at = base::TimeTicks::Now();
++    RespondToWaiters(url, Source::kNotModified);
++    MaybeStartRequest();
++    return;
++  }
++
++  if (response_code == net::HTTP_OK && response_body) {
++    if (std::optional<base::Value::Dict> extensions =
++            ParseConfig(*response_body)) {
++      CachedConfig cache;
++      cache.url = url;
++      cache.etag = headers->GetNormalizedHeader("ETag").value_or(
++          std::string());
++      cache.last_modified =
++          headers->GetNormalizedHeader("Last-Modified").value_or(
++              std::string());
++      cache.extensions = std::move(*extensions);
++      cache.fetched_at = base::TimeTicks::Now();
++
++      if (!cache_path_.empty()) {
++        base::Value::Dict stored;
++        stored.Set(kCacheUrlKey, url.spec());
++        stored.Set(kCacheEtagKey, cache.etag);
++        stored.Set(kCacheLastModifiedKey, cache.last_modified);
++        stored.Set(kCacheExtensionsKey, cache.extensions.Clone());
++        std::optional<std::string> contents = base::WriteJson(stored);
++        if (contents) {
++          cache_task_runner_->PostTask(
++              FROM_HERE,
++              base::BindOnce(&WriteCache, cache_path_, std::move(*contents)));
++        }
++      }
++
++      cache_ = std::move(cache);
++      RespondToWaiters(url, Source::kNetwork);
++      MaybeStartRequest();
++      return;
++    }
++  }
++
++  LOG(WARNING) << "browseros: Failed to fetch extensions config ("
++               << (response_code ? base::NumberToString(response_code)
++                                 : net::ErrorToShortString(net_error))
++               << ")" << (have_cache ? ", using cached copy" : "");
++  RespondToWaiters(url, have_cache ? Source::kDiskFallback : Source::kNone);
++  MaybeStartRequest();
++}
++
++void BrowserOSExtensionConfigFetcher::RespondToWaiters(const GURL& url,
++                                                       Source source) {
++  // Pull the matching waiters out first: callbacks may call Fetch() again.
++  std::vector<FetchCallback> callbacks;
++  for (auto it = waiters_.begin(); it != waiters_.end();) {
++    if (it->first == url) {
++      callbacks.push_back(std::move(it->second));
++      it = waiters_.erase(it);
++    } else {
++      ++it;
++    }
++  }
++
++  for (FetchCallback& callback : callbacks) {
++    Result result;
++    result.source = source;
++    if (source != Source::kNone) {
++      result.extensions = cache_->extensions.Clone();
++    }
++    std::move(callback).Run(std::move(result));
++  }
++}
++
++}  // namespace browseros
@@ -0,0 +1,142 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h
+new file mode 100644
+index 0000000000000..4bf9d61ef2443
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h
+@@ -0,0 +1,136 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_CONFIG_FETCHER_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_CONFIG_FETCHER_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "url/gurl.h"
++
++namespace base {
++class SequencedTaskRunner;
++}  // namespace base
++
++namespace network {
++class SharedURLLoaderFactory;
++class SimpleURLLoader;
++}  // namespace network
++
++namespace browseros {
++
++// Fetches the BrowserOS extensions config once for all profiles.
++//
++// Requests carry If-None-Match / If-Modified-Since from a copy cached on
++// disk, bodies are capped at kMaxConfigBytes, and concurrent Fetch() calls
++// for the same URL share one request. A result younger than kFreshness is
++// returned without a request, so the maintenance cycles of several profiles
++// cost one round trip. When the request fails, the cached copy is returned.
++//
++// Lives on the UI thread.
++class BrowserOSExtensionConfigFetcher {
++ public:
++  enum class Source {
++    kNone,          // Fetch failed and nothing is cached.
++    kNetwork,       // Fresh 200 response.
++    kNotModified,   // 304; the cached copy is current.
++    kMemory,        // Served from a result younger than kFreshness.
++    kDiskFallback,  // Fetch failed; serving the last cached copy.
++  };
++
++  struct Result {
++    Result();
++    ~Result();
++    Result(Result&&);
++    Result& operator=(Result&&);
++
++    Source source = Source::kNone;
++    // The config's "extensions" dict; empty when |source| is kNone.
++    base::Value::Dict extensions;
++  };
++
++  using FetchCallback = base::OnceCallback<void(Result result)>;
++
++  static constexpr size_t kMaxConfigBytes = 1024 * 1024;
++  static constexpr base::TimeDelta kFreshness = base::Minutes(5);
++
++  // Returns the process-wide fetcher, which uses the system network context
++  // and caches under the user data directory.
++  static BrowserOSExtensionConfigFetcher* GetInstance();
++
++  // |url_loader_factory| may be null, in which case the system network
++  // context's factory is used on first fetch.
++  BrowserOSExtensionConfigFetcher(
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++      base::FilePath cache_path);
++  ~BrowserOSExtensionConfigFetcher();
++
++  BrowserOSExtensionConfigFetcher(const BrowserOSExtensionConfigFetcher&) =
++      delete;
++  BrowserOSExtensionConfigFetcher& operator=(
++      const BrowserOSExtensionConfigFetcher&) = delete;
++
++  // Fetches the config at |url| and runs |callback| asynchronously.
++  void Fetch(const GURL& url, FetchCallback callback);
++
++  // Parses a config body and returns its "extensions" dict, or nullopt if
++  // the body is malformed.
++  static std::optional<base::Value::Dict> ParseConfig(const std::string& json);
++
++ private:
++  // The last successfully fetched config and its validators.
++  struct CachedConfig {
++    CachedConfig();
++    ~CachedConfig();
++    CachedConfig(CachedConfig&&);
++    CachedConfig& operator=(CachedConfig&&);
++
++    GURL url;
++    std::string etag;
++    std::string last_modified;
++    base::Value::Dict extensions;
++    // Null for a copy loaded from disk.
++    base::TimeTicks fetched_at;
++  };
++
++  static std::optional<CachedConfig> ReadCache(const base::FilePath& path);
++  static void WriteCache(const base::FilePath& path, std::string contents);
++
++  void OnCacheRead(std::optional<CachedConfig> cache);
++  void MaybeStartRequest();
++  void OnResponse(std::unique_ptr<std::string> response_body);
++  void RespondToWaiters(const GURL& url, Source source);
++
++  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  const base::FilePath cache_path_;
++  scoped_refptr<base::SequencedTaskRunner> cache_task_runner_;
++
++  bool cache_read_ = false;
++  bool cache_read_pending_ = false;
++  std::optional<CachedConfig> cache_;
++
++  std::unique_ptr<network::SimpleURLLoader> loader_;
++  GURL in_flight_url_;
++  std::vector<std::pair<GURL, FetchCallback>> waiters_;
++
++  SEQUENCE_CHECKER(sequence_checker_);
++
++  base::WeakPtrFactory<BrowserOSExtensionConfigFetcher> weak_ptr_factory_{
++      this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_CONFIG_FETCHER_H_
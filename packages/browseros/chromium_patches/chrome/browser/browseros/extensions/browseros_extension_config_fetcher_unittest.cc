@@ -0,0 +1,245 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_extension_config_fetcher_unittest.cc b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher_unittest.cc
+new file mode 100644
+index 0000000000000..ecfc648ba1989
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_extension_config_fetcher_unittest.cc
+@@ -0,0 +1,239 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h"
++
++#include <memory>
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/test/task_environment.h"
++#include "base/test/test_future.h"
++#include "base/values.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/url_loader_completion_status.h"
++#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "services/network/test/test_utils.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++using Result = BrowserOSExtensionConfigFetcher::Result;
++using Source = BrowserOSExtensionConfigFetcher::Source;
++
++constexpr char kConfigUrl[] = "https://config.browseros.test/extensions.json";
++constexpr char kConfigV1[] =
++    R"({"extensions": {"abc": {"external_version": "1.0"}}})";
++constexpr char kConfigV2[] =
++    R"({"extensions": {"abc": {"external_version": "2.0"}}})";
++
++std::string VersionOf(const Result& result) {
++  const std::string* version =
++      result.extensions.FindStringByDottedPath("abc.external_version");
++  return version ? *version : std::string();
++}
++
++class BrowserOSExtensionConfigFetcherTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    cache_path_ = temp_dir_.GetPath().AppendASCII("config.json");
++    fetcher_ = CreateFetcher();
++  }
++
++  // A fetcher as a new browser session would create it, sharing the cache
++  // file with earlier ones.
++  std::unique_ptr<BrowserOSExtensionConfigFetcher> CreateFetcher() {
++    return std::make_unique<BrowserOSExtensionConfigFetcher>(
++        base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
++            &test_url_loader_factory_),
++        cache_path_);
++  }
++
++  // Starts a fetch and runs until it either completes or waits on the
++  // network.
++  void StartFetch(base::test::TestFuture<Result>& future) {
++    fetcher_->Fetch(GURL(kConfigUrl), future.GetCallback());
++    task_environment_.RunUntilIdle();
++  }
++
++  // The If-None-Match header of the one pending request.
++  std::string PendingIfNoneMatch() {
++    EXPECT_EQ(1, test_url_loader_factory_.NumPending());
++    if (test_url_loader_factory_.NumPending() != 1) {
++      return std::string();
++    }
++    return (*test_url_loader_factory_.pending_requests())[0]
++        .request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch)
++        .value_or(std::string());
++  }
++
++  // Answers the pending request and runs until its callbacks and the cache
++  // write are done.
++  void Respond(net::HttpStatusCode status,
++               const std::string& body,
++               const std::string& etag = std::string()) {
++    auto head = network::CreateURLResponseHead(status);
++    if (!etag.empty()) {
++      head->headers->AddHeader("ETag", etag);
++    }
++    EXPECT_TRUE(test_url_loader_factory_.SimulateResponseForPendingRequest(
++        GURL(kConfigUrl), network::URLLoaderCompletionStatus(net::OK),
++        std::move(head), body));
++    task_environment_.RunUntilIdle();
++  }
++
++  void FailPendingRequest() {
++    EXPECT_TRUE(test_url_loader_factory_.SimulateResponseForPendingRequest(
++        GURL(kConfigUrl),
++        network::URLLoaderCompletionStatus(net::ERR_CONNECTION_REFUSED),
++        network::mojom::URLResponseHead::New(), std::string()));
++    task_environment_.RunUntilIdle();
++  }
++
++  // Fetches v1 with ETag "v1", leaving it in memory and on disk.
++  void PrimeCache() {
++    base::test::TestFuture<Result> future;
++    StartFetch(future);
++    Respond(net::HTTP_OK, kConfigV1, "\"v1\"");
++    ASSERT_EQ(Source::kNetwork, future.Get().source);
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  base::ScopedTempDir temp_dir_;
++  base::FilePath cache_path_;
++  network::TestURLLoaderFactory test_url_loader_factory_;
++  std::unique_ptr<BrowserOSExtensionConfigFetcher> fetcher_;
++};
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, OkResponseIsServedAndCached) {
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  EXPECT_EQ("", PendingIfNoneMatch());
++
++  Respond(net::HTTP_OK, kConfigV1, "\"v1\"");
++
++  Result result = future.Take();
++  EXPECT_EQ(Source::kNetwork, result.source);
++  EXPECT_EQ("1.0", VersionOf(result));
++  EXPECT_TRUE(base::PathExists(cache_path_));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, FreshResultSkipsTheNetwork) {
++  PrimeCache();
++
++  task_environment_.FastForwardBy(BrowserOSExtensionConfigFetcher::kFreshness -
++                                  base::Seconds(1));
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++  EXPECT_EQ(Source::kMemory, future.Get().source);
++  EXPECT_EQ("1.0", VersionOf(future.Get()));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, NotModifiedServesCachedCopy) {
++  PrimeCache();
++  task_environment_.FastForwardBy(BrowserOSExtensionConfigFetcher::kFreshness);
++
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  EXPECT_EQ("\"v1\"", PendingIfNoneMatch());
++  Respond(net::HTTP_NOT_MODIFIED, std::string());
++
++  EXPECT_EQ(Source::kNotModified, future.Get().source);
++  EXPECT_EQ("1.0", VersionOf(future.Get()));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, ChangedConfigReplacesCache) {
++  PrimeCache();
++  task_environment_.FastForwardBy(BrowserOSExtensionConfigFetcher::kFreshness);
++
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  Respond(net::HTTP_OK, kConfigV2, "\"v2\"");
++  EXPECT_EQ("2.0", VersionOf(future.Get()));
++
++  // A new session revalidates against the copy that replaced v1.
++  fetcher_ = CreateFetcher();
++  base::test::TestFuture<Result> next;
++  StartFetch(next);
++  EXPECT_EQ("\"v2\"", PendingIfNoneMatch());
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, ErrorFallsBackToDiskCopy) {
++  PrimeCache();
++
++  // A new session has only the disk copy; it revalidates against it and
++  // serves it when the request fails.
++  fetcher_ = CreateFetcher();
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  EXPECT_EQ("\"v1\"", PendingIfNoneMatch());
++  Respond(net::HTTP_INTERNAL_SERVER_ERROR, "oops");
++
++  EXPECT_EQ(Source::kDiskFallback, future.Get().source);
++  EXPECT_EQ("1.0", VersionOf(future.Get()));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, NetworkErrorFallsBackToDiskCopy) {
++  PrimeCache();
++
++  fetcher_ = CreateFetcher();
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  FailPendingRequest();
++
++  EXPECT_EQ(Source::kDiskFallback, future.Get().source);
++  EXPECT_EQ("1.0", VersionOf(future.Get()));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, ErrorWithoutCacheReturnsNone) {
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  FailPendingRequest();
++
++  EXPECT_EQ(Source::kNone, future.Get().source);
++  EXPECT_TRUE(future.Get().extensions.empty());
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, MalformedBodyIsAnError) {
++  PrimeCache();
++  task_environment_.FastForwardBy(BrowserOSExtensionConfigFetcher::kFreshness);
++
++  base::test::TestFuture<Result> future;
++  StartFetch(future);
++  Respond(net::HTTP_OK, R"({"not_extensions": {}})");
++
++  EXPECT_EQ(Source::kDiskFallback, future.Get().source);
++  EXPECT_EQ("1.0", VersionOf(future.Get()));
++}
++
++TEST_F(BrowserOSExtensionConfigFetcherTest, ConcurrentFetchesShareARequest) {
++  base::test::TestFuture<Result> first;
++  base::test::TestFuture<Result> second;
++  fetcher_->Fetch(GURL(kConfigUrl), first.GetCallback());
++  fetcher_->Fetch(GURL(kConfigUrl), second.GetCallback());
++  task_environment_.RunUntilIdle();
++
++  EXPECT_EQ(1, test_url_loader_factory_.NumPending());
++  Respond(net::HTTP_OK, kConfigV1, "\"v1\"");
++
++  EXPECT_EQ(Source::kNetwork, first.Get().source);
++  EXPECT_EQ(Source::kNetwork, second.Get().source);
++  EXPECT_EQ("1.0", VersionOf(second.Get()));
++  EXPECT_EQ(0, test_url_loader_factory_.NumPending());
++}
++
++}  // namespace
++}  // namespace browseros
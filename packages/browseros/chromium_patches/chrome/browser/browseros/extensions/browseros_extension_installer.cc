@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.cc b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
 new file mode 100644
-index 0000000000000..e84ab10537ec4
+index 0000000000000..74e4667281495
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
-@@ -0,0 +1,338 @@
+@@ -0,0 +1,280 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..e84ab10537ec4
 +
 +#include <utility>
 +
++#include "base/command_line.h"
 +#include "base/feature_list.h"
 +#include "base/files/file_util.h"
 +#include "base/json/json_reader.h"
@@ -20,39 +21,13 @@ index 0000000000000..e84ab10537ec4
 +#include "base/task/thread_pool.h"
 +#include "chrome/browser/browser_features.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/common/chrome_paths.h"
-+#include "content/public/browser/storage_partition.h"
-+#include "net/base/load_flags.h"
-+#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
 +
 +namespace browseros {
 +
-+namespace {
-+
-+constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
-+    net::DefineNetworkTrafficAnnotation("browseros_extension_install", R"(
-+        semantics {
-+          sender: "BrowserOS Extension Installer"
-+          description:
-+            "Fetches JSON configuration specifying which extensions should "
-+            "be installed for BrowserOS users."
-+          trigger: "Browser startup when no bundled extensions available."
-+          data: "No user data. GET request only."
-+          destination: OTHER
-+          destination_other: "BrowserOS configuration server."
-+        }
-+        policy {
-+          cookies_allowed: NO
-+          setting: "Controlled via command-line flags or enterprise policies."
-+          policy_exception_justification: "BrowserOS feature."
-+        })");
-+
-+}  // namespace
-+
 +InstallResult::InstallResult() = default;
 +InstallResult::~InstallResult() = default;
 +InstallResult::InstallResult(InstallResult&&) = default;
@@ -75,13 +50,14 @@ index 0000000000000..e84ab10537ec4
 +
 +  LOG(INFO) << "browseros: Starting extension installation";
 +
-+  // TODO(nikhil): Re-enable bundled extension loading once OTA update flow is
-+  // fully validated. Remote install is now fast with InstallPendingNow fix.
-+#if 0
-+  if (TryLoadFromBundled()) {
++  // TODO(nikhil): Enable bundled extension loading by default once OTA
++  // update flow is fully validated. Remote install is now fast with
++  // InstallPendingNow fix.
++  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
++          kEnableBundledExtensions) &&
++      TryLoadFromBundled()) {
 +    return;
 +  }
-+#endif
 +
 +  FetchFromRemote();
 +}
@@ -212,36 +188,22 @@ index 0000000000000..e84ab10537ec4
 +    return;
 +  }
 +
-+  LOG(INFO) << "browseros: Fetching config from " << config_url_.spec();
-+
-+  if (!url_loader_factory_) {
-+    url_loader_factory_ = profile_->GetDefaultStoragePartition()
-+                              ->GetURLLoaderFactoryForBrowserProcess();
-+  }
-+
-+  auto request = std::make_unique<network::ResourceRequest>();
-+  request->url = config_url_;
-+  request->method = "GET";
-+  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
-+
-+  url_loader_ =
-+      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
-+
-+  url_loader_->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-+      url_loader_factory_.get(),
++  BrowserOSExtensionConfigFetcher::GetInstance()->Fetch(
++      config_url_,
 +      base::BindOnce(&BrowserOSExtensionInstaller::OnRemoteFetchComplete,
 +                     weak_ptr_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSExtensionInstaller::OnRemoteFetchComplete(
-+    std::unique_ptr<std::string> response_body) {
-+  if (!response_body) {
++    BrowserOSExtensionConfigFetcher::Result fetched) {
++  if (fetched.source == BrowserOSExtensionConfigFetcher::Source::kNone) {
 +    LOG(ERROR) << "browseros: Failed to fetch config";
 +    Complete(InstallResult());
 +    return;
 +  }
 +
-+  base::Value::Dict extensions_config = ParseConfigJson(*response_body);
++  // A cached copy is still a valid install list when offline.
++  base::Value::Dict extensions_config = std::move(fetched.extensions);
 +
 +  if (extensions_config.empty()) {
 +    Complete(InstallResult());
@@ -315,26 +277,6 @@ index 0000000000000..e84ab10537ec4
 +  Complete(std::move(result));
 +}
 +
-+base::Value::Dict BrowserOSExtensionInstaller::ParseConfigJson(
-+    const std::string& json_content) {
-+  std::optional<base::Value> parsed = base::JSONReader::Read(json_content);
-+
-+  if (!parsed || !parsed->is_dict()) {
-+    LOG(ERROR) << "browseros: Invalid config JSON";
-+    return base::Value::Dict();
-+  }
-+
-+  const base::Value::Dict* extensions =
-+      parsed->GetDict().FindDict("extensions");
-+
-+  if (!extensions) {
-+    LOG(ERROR) << "browseros: No 'extensions' key in config";
-+    return base::Value::Dict();
-+  }
-+
-+  return extensions->Clone();
-+}
-+
 +void BrowserOSExtensionInstaller::Complete(InstallResult result) {
 +  if (callback_) {
 +    std::move(callback_).Run(std::move(result));
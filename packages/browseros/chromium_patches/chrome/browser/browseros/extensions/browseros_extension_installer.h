@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.h b/chrome/browser/browseros/extensions/browseros_extension_installer.h
 new file mode 100644
-index 0000000000000..7502da6d31ff5
+index 0000000000000..de92295645a7b
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.h
-@@ -0,0 +1,99 @@
+@@ -0,0 +1,88 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,16 +18,11 @@ index 0000000000000..7502da6d31ff5
 +#include "base/files/file_path.h"
 +#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
-+#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/values.h"
++#include "chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h"
 +#include "url/gurl.h"
 +
-+namespace network {
-+class SharedURLLoaderFactory;
-+class SimpleURLLoader;
-+}  // namespace network
-+
 +class Profile;
 +
 +namespace browseros {
@@ -77,14 +72,11 @@ index 0000000000000..7502da6d31ff5
 +  void OnBundledLoadComplete(const base::FilePath& bundled_path,
 +                             base::Value::Dict prefs);
 +
-+  // Fetches config from remote URL.
++  // Fetches config from remote URL via the shared config fetcher.
 +  void FetchFromRemote();
 +
 +  // Called when remote fetch completes.
-+  void OnRemoteFetchComplete(std::unique_ptr<std::string> response_body);
-+
-+  // Parses config JSON and returns extensions dict.
-+  base::Value::Dict ParseConfigJson(const std::string& json_content);
++  void OnRemoteFetchComplete(BrowserOSExtensionConfigFetcher::Result fetched);
 +
 +  // Completes the installation with the given result.
 +  void Complete(InstallResult result);
@@ -94,9 +86,6 @@ index 0000000000000..7502da6d31ff5
 +  InstallCompleteCallback callback_;
 +  std::set<std::string> extension_ids_;
 +
-+  std::unique_ptr<network::SimpleURLLoader> url_loader_;
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
-+
 +  base::WeakPtrFactory<BrowserOSExtensionInstaller> weak_ptr_factory_{this};
 +};
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.cc b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
 new file mode 100644
-index 0000000000000..52703e88e7478
+index 0000000000000..7addf6c843c04
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
-@@ -0,0 +1,212 @@
+@@ -0,0 +1,315 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,24 +14,78 @@ index 0000000000000..52703e88e7478
 +
 +#include "base/feature_list.h"
 +#include "base/logging.h"
++#include "base/scoped_observation.h"
 +#include "base/task/single_thread_task_runner.h"
 +#include "chrome/browser/browser_features.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/extensions/updater/extension_updater.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "extensions/browser/extension_registry.h"
++#include "extensions/browser/extension_registry_observer.h"
 +#include "extensions/browser/pending_extension_manager.h"
 +#include "extensions/common/extension.h"
 +#include "extensions/common/mojom/manifest.mojom-shared.h"
 +
 +namespace browseros {
 +
-+namespace {
++// Reports how long each tracked extension took from loader start to its
++// first install.
++class BrowserOSExtensionLoader::InstallTimer
++    : public extensions::ExtensionRegistryObserver {
++ public:
++  InstallTimer(Profile* profile,
++               std::set<std::string> pending_ids,
++               base::TimeTicks start_time,
++               bool from_bundled)
++      : pending_ids_(std::move(pending_ids)),
++        start_time_(start_time),
++        from_bundled_(from_bundled) {
++    observation_.Observe(extensions::ExtensionRegistry::Get(profile));
++  }
++
++  InstallTimer(const InstallTimer&) = delete;
++  InstallTimer& operator=(const InstallTimer&) = delete;
++
++  ~InstallTimer() override = default;
++
++ private:
++  // extensions::ExtensionRegistryObserver:
++  void OnExtensionInstalled(content::BrowserContext* browser_context,
++                            const extensions::Extension* extension,
++                            bool is_update) override {
++    if (!pending_ids_.erase(extension->id())) {
++      return;
++    }
++
++    base::TimeDelta elapsed = base::TimeTicks::Now() - start_time_;
++    LOG(INFO) << "browseros: Installed " << extension->id() << " "
++              << elapsed.InMilliseconds() << "ms after loader start";
++    browseros_metrics::BrowserOSMetrics::Log(
++        "ota.extension.first_install",
++        {{"extension_id", base::Value(extension->id())},
++         {"source", base::Value(from_bundled_ ? "bundled" : "remote")},
++         {"duration_ms",
++          base::Value(static_cast<int>(elapsed.InMilliseconds()))}});
++
++    if (pending_ids_.empty()) {
++      observation_.Reset();
++    }
++  }
++
++  void OnShutdown(extensions::ExtensionRegistry* registry) override {
++    observation_.Reset();
++  }
 +
-+constexpr base::TimeDelta kImmediateInstallDelay = base::Seconds(2);
++  std::set<std::string> pending_ids_;
++  const base::TimeTicks start_time_;
++  const bool from_bundled_;
 +
-+}  // namespace
++  base::ScopedObservation<extensions::ExtensionRegistry,
++                          extensions::ExtensionRegistryObserver>
++      observation_{this};
++};
 +
 +BrowserOSExtensionLoader::BrowserOSExtensionLoader(Profile* profile)
 +    : profile_(profile) {
@@ -62,9 +116,11 @@ index 0000000000000..52703e88e7478
 +
 +void BrowserOSExtensionLoader::StartLoading() {
 +  LOG(INFO) << "browseros: Extension loader starting";
++  load_start_time_ = base::TimeTicks::Now();
 +
 +  installer_ = std::make_unique<BrowserOSExtensionInstaller>(profile_);
 +  maintainer_ = std::make_unique<BrowserOSExtensionMaintainer>(profile_);
++  worker_keepalive_ = std::make_unique<BrowserOSWorkerKeepalive>(profile_);
 +
 +  installer_->StartInstallation(
 +      config_url_,
@@ -88,6 +144,7 @@ index 0000000000000..52703e88e7478
 +  // try to claim them via kExternalPref.
 +  AdjustPrefsForExistingInstalls(result.prefs);
 +
++  StartInstallTimer(result.from_bundled);
 +  LoadFinished(std::move(result.prefs));
 +  OnStartupComplete(result.from_bundled);
 +}
@@ -101,12 +158,14 @@ index 0000000000000..52703e88e7478
 +            << ")";
 +
 +  if (!from_bundled) {
-+    // Pass config clone directly - clearer ownership than relying on member state
-+    base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
++    // Pass config clone directly - clearer ownership than relying on member
++    // state. Posted, not delayed: LoadFinished() has already registered the
++    // pending installs, and the agent extension should start downloading
++    // before the first window needs it.
++    base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
 +        FROM_HERE,
 +        base::BindOnce(&BrowserOSExtensionLoader::TriggerImmediateInstallation,
-+                       weak_ptr_factory_.GetWeakPtr(), last_config_.Clone()),
-+        kImmediateInstallDelay);
++                       weak_ptr_factory_.GetWeakPtr(), last_config_.Clone()));
 +  }
 +
 +  // Maintainer owns the config now
@@ -162,14 +221,58 @@ index 0000000000000..52703e88e7478
 +
 +  extensions::ExtensionUpdater* updater =
 +      extensions::ExtensionUpdater::Get(profile_);
-+  if (updater) {
-+    extensions::ExtensionUpdater::CheckParams params;
-+    params.ids = std::list<extensions::ExtensionId>(extension_ids_.begin(),
-+                                                     extension_ids_.end());
-+    params.install_immediately = true;
-+    params.fetch_priority = extensions::DownloadFetchPriority::kForeground;
-+    updater->InstallPendingNow(std::move(params));
++  if (!updater) {
++    return;
 +  }
++
++  std::list<extensions::ExtensionId> ids(extension_ids_.begin(),
++                                         extension_ids_.end());
++
++  // The agent is what the first window needs. A batch of its own keeps its
++  // manifest fetch and download from queueing behind the other extensions.
++  if (std::erase(ids, kAgentV2ExtensionId) > 0) {
++    extensions::ExtensionUpdater::CheckParams agent_params;
++    agent_params.ids = {kAgentV2ExtensionId};
++    agent_params.install_immediately = true;
++    agent_params.fetch_priority =
++        extensions::DownloadFetchPriority::kForeground;
++    updater->InstallPendingNow(std::move(agent_params));
++  }
++
++  if (ids.empty()) {
++    return;
++  }
++
++  extensions::ExtensionUpdater::CheckParams params;
++  params.ids = std::move(ids);
++  params.install_immediately = true;
++  params.fetch_priority = extensions::DownloadFetchPriority::kForeground;
++  updater->InstallPendingNow(std::move(params));
++}
++
++void BrowserOSExtensionLoader::StartInstallTimer(bool from_bundled) {
++  if (!profile_) {
++    return;
++  }
++
++  extensions::ExtensionRegistry* registry =
++      extensions::ExtensionRegistry::Get(profile_);
++  if (!registry) {
++    return;
++  }
++
++  std::set<std::string> pending_ids;
++  for (const std::string& id : extension_ids_) {
++    if (!registry->GetInstalledExtension(id)) {
++      pending_ids.insert(id);
++    }
++  }
++  if (pending_ids.empty()) {
++    return;
++  }
++
++  install_timer_ = std::make_unique<InstallTimer>(
++      profile_, std::move(pending_ids), load_start_time_, from_bundled);
 +}
 +
 +void BrowserOSExtensionLoader::AdjustPrefsForExistingInstalls(
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.h b/chrome/browser/browseros/extensions/browseros_extension_loader.h
 new file mode 100644
-index 0000000000000..c0b26b369ad07
+index 0000000000000..e3ce2d2b4cd3e
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.h
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,96 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,8 +17,10 @@ index 0000000000000..c0b26b369ad07
 +
 +#include "base/files/file_path.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "chrome/browser/browseros/extensions/browseros_extension_installer.h"
 +#include "chrome/browser/browseros/extensions/browseros_extension_maintainer.h"
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive.h"
 +#include "chrome/browser/extensions/external_loader.h"
 +#include "url/gurl.h"
 +
@@ -33,6 +35,9 @@ index 0000000000000..c0b26b369ad07
 +//   2. POST-STARTUP: Both paths converge to start maintenance
 +//   3. MAINTENANCE: Periodic tasks via Maintainer
 +//
++// Throughout, WorkerKeepalive keeps the extensions' service workers alive
++// while BrowserOS is in use and lets them sleep when idle.
++//
 +// After startup, extensions receive updates via their manifest.json update_url,
 +// triggered by ForceUpdateCheck() during maintenance.
 +class BrowserOSExtensionLoader : public extensions::ExternalLoader {
@@ -61,16 +66,24 @@ index 0000000000000..c0b26b369ad07
 +  // Convergence point for both startup paths.
 +  void OnStartupComplete(bool from_bundled);
 +
-+  // Triggers immediate download for remote-loaded extensions.
++  // Triggers immediate download for remote-loaded extensions, the agent
++  // extension in its own batch ahead of the rest.
 +  void TriggerImmediateInstallation(base::Value::Dict config);
 +
++  // Starts timing the first install of tracked extensions that are not
++  // installed yet.
++  void StartInstallTimer(bool from_bundled);
++
 +  // Adjusts prefs to match existing install locations. Extensions installed via
 +  // kExternalPrefDownload must be claimed via external_update_url to avoid
 +  // orphan detection when bundled prefs use external_crx.
 +  void AdjustPrefsForExistingInstalls(base::Value::Dict& prefs);
 +
++  class InstallTimer;
++
 +  raw_ptr<Profile> profile_;
 +  GURL config_url_;
++  base::TimeTicks load_start_time_;
 +  base::FilePath bundled_crx_base_path_;
 +
 +  std::set<std::string> extension_ids_;
@@ -78,6 +91,8 @@ index 0000000000000..c0b26b369ad07
 +
 +  std::unique_ptr<BrowserOSExtensionInstaller> installer_;
 +  std::unique_ptr<BrowserOSExtensionMaintainer> maintainer_;
++  std::unique_ptr<BrowserOSWorkerKeepalive> worker_keepalive_;
++  std::unique_ptr<InstallTimer> install_timer_;
 +
 +  base::WeakPtrFactory<BrowserOSExtensionLoader> weak_ptr_factory_{this};
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
 new file mode 100644
-index 0000000000000..fec50b08b130c
+index 0000000000000..87837d1adea45
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
-@@ -0,0 +1,381 @@
+@@ -0,0 +1,390 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,7 +12,6 @@ index 0000000000000..fec50b08b130c
 +
 +#include <utility>
 +
-+#include "base/json/json_reader.h"
 +#include "base/logging.h"
 +#include "base/task/single_thread_task_runner.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
@@ -21,7 +20,6 @@ index 0000000000000..fec50b08b130c
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/extensions/updater/extension_updater.h"
 +#include "chrome/browser/profiles/profile.h"
-+#include "content/public/browser/storage_partition.h"
 +#include "extensions/browser/disable_reason.h"
 +#include "extensions/browser/extension_prefs.h"
 +#include "extensions/browser/extension_registrar.h"
@@ -30,10 +28,6 @@ index 0000000000000..fec50b08b130c
 +#include "extensions/browser/uninstall_reason.h"
 +#include "extensions/common/extension.h"
 +#include "extensions/common/mojom/manifest.mojom-shared.h"
-+#include "net/base/load_flags.h"
-+#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
 +
 +namespace browseros {
 +
@@ -42,23 +36,6 @@ index 0000000000000..fec50b08b130c
 +constexpr base::TimeDelta kMaintenanceInterval = base::Minutes(15);
 +constexpr base::TimeDelta kInitialMaintenanceDelay = base::Seconds(60);
 +
-+constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
-+    net::DefineNetworkTrafficAnnotation("browseros_extension_maintenance", R"(
-+        semantics {
-+          sender: "BrowserOS Extension Maintainer"
-+          description:
-+            "Fetches JSON configuration for BrowserOS extension maintenance."
-+          trigger: "Periodic maintenance cycle (every 15 minutes)."
-+          data: "No user data. GET request only."
-+          destination: OTHER
-+          destination_other: "BrowserOS configuration server."
-+        }
-+        policy {
-+          cookies_allowed: NO
-+          setting: "Controlled via command-line flags or enterprise policies."
-+          policy_exception_justification: "BrowserOS feature."
-+        })");
-+
 +}  // namespace
 +
 +BrowserOSExtensionMaintainer::BrowserOSExtensionMaintainer(Profile* profile)
@@ -102,67 +79,98 @@ index 0000000000000..fec50b08b130c
 +    return;
 +  }
 +
-+  if (!url_loader_factory_) {
-+    url_loader_factory_ = profile_->GetDefaultStoragePartition()
-+                              ->GetURLLoaderFactoryForBrowserProcess();
-+  }
-+
-+  auto request = std::make_unique<network::ResourceRequest>();
-+  request->url = config_url_;
-+  request->method = "GET";
-+  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
-+
-+  auto loader =
-+      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
-+
-+  auto* loader_ptr = loader.get();
-+  loader_ptr->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-+      url_loader_factory_.get(),
++  // Shared across profiles: one conditional request serves every
++  // maintainer whose cycle falls within the fetcher's freshness window.
++  BrowserOSExtensionConfigFetcher::GetInstance()->Fetch(
++      config_url_,
 +      base::BindOnce(&BrowserOSExtensionMaintainer::OnConfigFetched,
-+                     weak_ptr_factory_.GetWeakPtr(), std::move(loader)));
++                     weak_ptr_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSExtensionMaintainer::OnConfigFetched(
-+    std::unique_ptr<network::SimpleURLLoader> loader,
-+    std::unique_ptr<std::string> response_body) {
-+  if (response_body) {
-+    base::Value::Dict config = ParseConfigJson(*response_body);
-+    if (!config.empty()) {
-+      last_config_ = std::move(config);
-+
-+      for (const auto [id, _] : last_config_) {
-+        extension_ids_.insert(id);
-+      }
++    BrowserOSExtensionConfigFetcher::Result fetched) {
++  bool config_changed = false;
++  if (fetched.source == BrowserOSExtensionConfigFetcher::Source::kNone) {
++    LOG(WARNING) << "browseros: Failed to fetch maintenance config";
++  } else if (!fetched.extensions.empty() &&
++             fetched.extensions != last_config_) {
++    config_changed = true;
++    last_config_ = std::move(fetched.extensions);
 +
-+      LOG(INFO) << "browseros: Updated config with " << last_config_.size()
-+                << " extensions";
++    for (const auto [id, _] : last_config_) {
++      extension_ids_.insert(id);
 +    }
-+  } else {
-+    LOG(WARNING) << "browseros: Failed to fetch maintenance config";
++
++    LOG(INFO) << "browseros: Updated config with " << last_config_.size()
++              << " extensions";
++  }
++
++  std::optional<std::string> fingerprint = ComputeHealthyStateFingerprint();
++  switch (DecideCycleAction(config_changed, fingerprint,
++                            last_healthy_fingerprint_,
++                            base::TimeTicks::Now() -
++                                last_forced_update_check_)) {
++    case CycleAction::kRunTasks:
++      ExecuteMaintenanceTasks();
++      break;
++    case CycleAction::kForceUpdateCheckOnly:
++      ForceUpdateCheck();
++      [[fallthrough]];
++    case CycleAction::kSkip:
++      VLOG(1) << "browseros: Config and extensions unchanged, skipping "
++                 "maintenance tasks";
++      break;
 +  }
++  last_healthy_fingerprint_ = std::move(fingerprint);
 +
-+  ExecuteMaintenanceTasks();
 +  ScheduleNextMaintenance();
 +}
 +
-+base::Value::Dict BrowserOSExtensionMaintainer::ParseConfigJson(
-+    const std::string& json_content) {
-+  std::optional<base::Value> parsed = base::JSONReader::Read(json_content);
++// static
++BrowserOSExtensionMaintainer::CycleAction
++BrowserOSExtensionMaintainer::DecideCycleAction(
++    bool config_changed,
++    const std::optional<std::string>& fingerprint,
++    const std::optional<std::string>& last_healthy_fingerprint,
++    base::TimeDelta since_forced_update_check) {
++  if (config_changed || !fingerprint ||
++      fingerprint != last_healthy_fingerprint) {
++    return CycleAction::kRunTasks;
++  }
++  return since_forced_update_check >= kForcedUpdateCheckInterval
++             ? CycleAction::kForceUpdateCheckOnly
++             : CycleAction::kSkip;
++}
 +
-+  if (!parsed || !parsed->is_dict()) {
-+    LOG(ERROR) << "browseros: Invalid config JSON";
-+    return base::Value::Dict();
++std::optional<std::string>
++BrowserOSExtensionMaintainer::ComputeHealthyStateFingerprint() {
++  if (!profile_ || last_config_.empty()) {
++    return std::nullopt;
 +  }
 +
-+  const base::Value::Dict* extensions =
-+      parsed->GetDict().FindDict("extensions");
++  extensions::ExtensionRegistry* registry =
++      extensions::ExtensionRegistry::Get(profile_);
++  if (!registry) {
++    return std::nullopt;
++  }
 +
-+  if (!extensions) {
-+    LOG(ERROR) << "browseros: No 'extensions' key in config";
-+    return base::Value::Dict();
++  // Deprecated extensions still installed need uninstalling.
++  for (const std::string& id : GetBrowserOSExtensionIds()) {
++    if (!last_config_.contains(id) && registry->GetInstalledExtension(id)) {
++      return std::nullopt;
++    }
 +  }
 +
-+  return extensions->Clone();
++  std::string fingerprint;
++  for (const std::string& id : extension_ids_) {
++    const extensions::Extension* extension =
++        registry->enabled_extensions().GetByID(id);
++    if (!extension) {
++      return std::nullopt;
++    }
++    fingerprint += id + "@" + extension->VersionString() + ";";
++  }
++  return fingerprint;
 +}
 +
 +void BrowserOSExtensionMaintainer::ExecuteMaintenanceTasks() {
@@ -320,6 +328,7 @@ index 0000000000000..fec50b08b130c
 +
 +  LOG(INFO) << "browseros: Forcing update check for " << extension_ids_.size()
 +            << " extensions";
++  last_forced_update_check_ = base::TimeTicks::Now();
 +
 +  extensions::ExtensionUpdater::CheckParams params;
 +  params.ids = std::list<extensions::ExtensionId>(extension_ids_.begin(),
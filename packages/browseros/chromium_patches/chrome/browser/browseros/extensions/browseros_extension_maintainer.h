@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.h b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
 new file mode 100644
-index 0000000000000..e7e228e6fd71e
+index 0000000000000..c5ed4de777317
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
-@@ -0,0 +1,83 @@
+@@ -0,0 +1,103 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,30 +11,38 @@ index 0000000000000..e7e228e6fd71e
 +#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_MAINTAINER_H_
 +#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_MAINTAINER_H_
 +
-+#include <memory>
++#include <optional>
 +#include <set>
 +#include <string>
 +
 +#include "base/memory/raw_ptr.h"
-+#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "base/values.h"
++#include "chrome/browser/browseros/extensions/browseros_extension_config_fetcher.h"
 +#include "url/gurl.h"
 +
-+namespace network {
-+class SharedURLLoaderFactory;
-+class SimpleURLLoader;
-+}  // namespace network
-+
 +class Profile;
 +
 +namespace browseros {
 +
 +// Handles periodic maintenance of BrowserOS extensions.
 +// Tasks: uninstall deprecated, reinstall missing, re-enable disabled,
-+// force update check, log health metrics.
++// force update check, log health metrics. A cycle whose config and
++// installed-extension set match the previous healthy cycle skips the tasks,
++// except for a forced update check at most every kForcedUpdateCheckInterval.
 +class BrowserOSExtensionMaintainer {
 + public:
++  enum class CycleAction {
++    kRunTasks,
++    kSkip,
++    // Skip the tasks but still nudge ExtensionUpdater.
++    kForceUpdateCheckOnly,
++  };
++
++  // ExtensionUpdater checks on its own schedule too; this only tightens it.
++  static constexpr base::TimeDelta kForcedUpdateCheckInterval = base::Hours(1);
++
 +  explicit BrowserOSExtensionMaintainer(Profile* profile);
 +  ~BrowserOSExtensionMaintainer();
 +
@@ -50,16 +58,26 @@ index 0000000000000..e7e228e6fd71e
 +  // Updates the set of tracked extension IDs.
 +  void UpdateExtensionIds(std::set<std::string> ids);
 +
++  // Decides what a cycle does. Tasks are skipped only when the config did
++  // not change and the healthy-state |fingerprint| matches the last healthy
++  // cycle's; a null fingerprint always runs them.
++  static CycleAction DecideCycleAction(
++      bool config_changed,
++      const std::optional<std::string>& fingerprint,
++      const std::optional<std::string>& last_healthy_fingerprint,
++      base::TimeDelta since_forced_update_check);
++
 + private:
 +  // Fetches remote config and runs maintenance.
 +  void RunMaintenanceCycle();
 +
 +  // Called when config fetch completes.
-+  void OnConfigFetched(std::unique_ptr<network::SimpleURLLoader> loader,
-+                       std::unique_ptr<std::string> response_body);
++  void OnConfigFetched(BrowserOSExtensionConfigFetcher::Result fetched);
 +
-+  // Parses config JSON and returns extensions dict.
-+  base::Value::Dict ParseConfigJson(const std::string& json_content);
++  // Returns the ids and versions of the tracked extensions, or nullopt if
++  // any maintenance task has work to do (an extension is missing or not
++  // enabled, or a deprecated one is still installed).
++  std::optional<std::string> ComputeHealthyStateFingerprint();
 +
 +  // Executes all maintenance tasks.
 +  void ExecuteMaintenanceTasks();
@@ -79,7 +97,9 @@ index 0000000000000..e7e228e6fd71e
 +  std::set<std::string> extension_ids_;
 +  base::Value::Dict last_config_;
 +
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  // Fingerprint of the last cycle that found everything healthy.
++  std::optional<std::string> last_healthy_fingerprint_;
++  base::TimeTicks last_forced_update_check_;
 +
 +  base::WeakPtrFactory<BrowserOSExtensionMaintainer> weak_ptr_factory_{this};
 +};
@@ -0,0 +1,67 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer_unittest.cc b/chrome/browser/browseros/extensions/browseros_extension_maintainer_unittest.cc
+new file mode 100644
+index 0000000000000..9610007565210
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer_unittest.cc
+@@ -0,0 +1,61 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_extension_maintainer.h"
++
++#include <optional>
++#include <string>
++
++#include "base/time/time.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++using CycleAction = BrowserOSExtensionMaintainer::CycleAction;
++
++constexpr char kHealthy[] = "abc@1.0;def@2.0;";
++constexpr base::TimeDelta kRecently = base::Minutes(15);
++constexpr base::TimeDelta kLongAgo =
++    BrowserOSExtensionMaintainer::kForcedUpdateCheckInterval;
++
++CycleAction Decide(bool config_changed,
++                   std::optional<std::string> fingerprint,
++                   std::optional<std::string> last_healthy_fingerprint,
++                   base::TimeDelta since_forced_update_check = kRecently) {
++  return BrowserOSExtensionMaintainer::DecideCycleAction(
++      config_changed, fingerprint, last_healthy_fingerprint,
++      since_forced_update_check);
++}
++
++TEST(BrowserOSExtensionMaintainerTest, UnchangedHealthyCycleIsSkipped) {
++  EXPECT_EQ(CycleAction::kSkip, Decide(false, kHealthy, kHealthy));
++}
++
++TEST(BrowserOSExtensionMaintainerTest, SkippedCycleStillForcesUpdateCheck) {
++  EXPECT_EQ(CycleAction::kForceUpdateCheckOnly,
++            Decide(false, kHealthy, kHealthy, kLongAgo));
++}
++
++TEST(BrowserOSExtensionMaintainerTest, ConfigChangeRunsTasks) {
++  EXPECT_EQ(CycleAction::kRunTasks, Decide(true, kHealthy, kHealthy));
++}
++
++TEST(BrowserOSExtensionMaintainerTest, UnhealthyStateRunsTasks) {
++  // Something is missing, disabled or deprecated-but-installed.
++  EXPECT_EQ(CycleAction::kRunTasks, Decide(false, std::nullopt, std::nullopt));
++  EXPECT_EQ(CycleAction::kRunTasks, Decide(false, std::nullopt, kHealthy));
++}
++
++TEST(BrowserOSExtensionMaintainerTest, FirstHealthyCycleRunsTasks) {
++  EXPECT_EQ(CycleAction::kRunTasks, Decide(false, kHealthy, std::nullopt));
++}
++
++TEST(BrowserOSExtensionMaintainerTest, VersionChangeRunsTasks) {
++  EXPECT_EQ(CycleAction::kRunTasks,
++            Decide(false, "abc@1.1;def@2.0;", kHealthy));
++}
++
++}  // namespace
++}  // namespace browseros
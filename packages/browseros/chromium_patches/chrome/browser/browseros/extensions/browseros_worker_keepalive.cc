@@ -0,0 +1,369 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc b/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc
+new file mode 100644
+index 0000000000000..7d46ab558e006
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc
+@@ -0,0 +1,363 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive.h"
++
++#include <string>
++#include <vector>
++
++#include "base/command_line.h"
++#include "base/functional/bind.h"
++#include "base/functional/callback_helpers.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/notreached.h"
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/browseros/core/browseros_activity.h"
++#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/devtools/devtools_window.h"
++#include "chrome/browser/profiles/profile.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/service_worker_context.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/activity.h"
++#include "extensions/browser/extension_registry.h"
++#include "extensions/browser/extension_util.h"
++#include "extensions/common/extension.h"
++#include "extensions/common/manifest_handlers/background_info.h"
++#include "third_party/blink/public/common/storage_key/storage_key.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kKeepaliveExtraData[] = "browseros_adaptive_keepalive";
++
++base::TimeDelta GetIdleTimeout() {
++  const base::CommandLine* command_line =
++      base::CommandLine::ForCurrentProcess();
++  if (!command_line->HasSwitch(kExtensionWorkerIdleTimeout)) {
++    return BrowserOSWorkerKeepalive::kDefaultIdleTimeout;
++  }
++
++  int seconds = 0;
++  if (!base::StringToInt(
++          command_line->GetSwitchValueASCII(kExtensionWorkerIdleTimeout),
++          &seconds) ||
++      seconds < 0) {
++    LOG(WARNING) << "browseros: Invalid --" << kExtensionWorkerIdleTimeout
++                 << ", using the default";
++    return BrowserOSWorkerKeepalive::kDefaultIdleTimeout;
++  }
++  return base::Seconds(seconds);
++}
++
++std::vector<BrowserOSWorkerKeepalive*>& GetInstances() {
++  static base::NoDestructor<std::vector<BrowserOSWorkerKeepalive*>> instances;
++  return *instances;
++}
++
++}  // namespace
++
++BrowserOSWorkerKeepalive::WorkerState::WorkerState() = default;
++BrowserOSWorkerKeepalive::WorkerState::~WorkerState() = default;
++BrowserOSWorkerKeepalive::WorkerState::WorkerState(const WorkerState&) =
++    default;
++BrowserOSWorkerKeepalive::WorkerState&
++BrowserOSWorkerKeepalive::WorkerState::operator=(const WorkerState&) = default;
++
++BrowserOSWorkerKeepalive::BrowserOSWorkerKeepalive(Profile* profile)
++    : profile_(profile), idle_timeout_(GetIdleTimeout()) {
++  GetInstances().push_back(this);
++
++  extensions::ProcessManager* process_manager =
++      extensions::ProcessManager::Get(profile_);
++  process_manager_observation_.Observe(process_manager);
++  content::DevToolsAgentHost::AddObserver(this);
++  mcp_request_subscription_ = SubscribeToMcpRequests(base::BindRepeating(
++      &BrowserOSWorkerKeepalive::OnMcpRequest, base::Unretained(this)));
++
++  // Adopt workers that started before us; they get one idle period.
++  for (const std::string& id : GetBrowserOSExtensionIds()) {
++    for (const extensions::WorkerId& worker_id :
++         process_manager->GetServiceWorkersForExtension(id)) {
++      workers_[id].worker_id = worker_id;
++    }
++  }
++  OnActivity(Activity::kAgentCall, /*wake=*/false);
++
++  LOG(INFO) << "browseros: Extension worker idle timeout "
++            << idle_timeout_.InSeconds() << "s";
++}
++
++BrowserOSWorkerKeepalive::~BrowserOSWorkerKeepalive() {
++  content::DevToolsAgentHost::RemoveObserver(this);
++  std::erase(GetInstances(), this);
++
++  for (auto& [id, state] : workers_) {
++    ReleaseKeepalive(state);
++  }
++}
++
++// static
++void BrowserOSWorkerKeepalive::NotifyAgentActivity(
++    content::BrowserContext* browser_context) {
++  Profile* profile =
++      Profile::FromBrowserContext(browser_context)->GetOriginalProfile();
++  for (BrowserOSWorkerKeepalive* instance : GetInstances()) {
++    if (instance->profile_ == profile) {
++      instance->OnActivity(Activity::kAgentCall, /*wake=*/false);
++    }
++  }
++}
++
++// static
++const char* BrowserOSWorkerKeepalive::ActivityToString(Activity activity) {
++  switch (activity) {
++    case Activity::kMcpRequest:
++      return "mcp";
++    case Activity::kDevToolsSession:
++      return "devtools";
++    case Activity::kAgentCall:
++      return "agent";
++  }
++  NOTREACHED();
++}
++
++void BrowserOSWorkerKeepalive::OnActivity(Activity activity, bool wake) {
++  if (!process_manager_observation_.IsObserving()) {
++    return;
++  }
++
++  if (!idle_timeout_.is_zero()) {
++    idle_timer_.Start(FROM_HERE, idle_timeout_,
++                      base::BindOnce(&BrowserOSWorkerKeepalive::OnIdleTimeout,
++                                     base::Unretained(this)));
++  }
++
++  for (auto& [id, state] : workers_) {
++    if (state.worker_id) {
++      AcquireKeepalive(state);
++    }
++  }
++
++  if (!wake) {
++    return;
++  }
++  for (const std::string& id : GetBrowserOSExtensionIds()) {
++    auto it = workers_.find(id);
++    if (it != workers_.end() &&
++        (it->second.worker_id || !it->second.wake_requested.is_null())) {
++      continue;
++    }
++    WakeWorker(id, activity);
++  }
++}
++
++void BrowserOSWorkerKeepalive::OnMcpRequest(content::BrowserContext* target) {
++  if (!target ||
++      Profile::FromBrowserContext(target)->GetOriginalProfile() != profile_) {
++    return;
++  }
++  OnActivity(Activity::kMcpRequest, /*wake=*/true);
++}
++
++bool BrowserOSWorkerKeepalive::IsCdpSessionForProfile(
++    content::DevToolsAgentHost* agent_host) const {
++  // Browser-wide targets have no context. A CDP client only reaches this
++  // profile's extensions through its page and worker targets, which do.
++  content::BrowserContext* context = agent_host->GetBrowserContext();
++  if (!context ||
++      Profile::FromBrowserContext(context)->GetOriginalProfile() != profile_) {
++    return false;
++  }
++  // The user's DevTools window is a client too, but not an agent's.
++  content::WebContents* web_contents = agent_host->GetWebContents();
++  return !web_contents ||
++         !DevToolsWindow::GetInstanceForInspectedWebContents(web_contents);
++}
++
++void BrowserOSWorkerKeepalive::OnIdleTimeout() {
++  // The timer restarts when the last session detaches.
++  if (!cdp_sessions_.empty()) {
++    return;
++  }
++
++  int released = 0;
++  for (auto& [id, state] : workers_) {
++    if (state.keepalive) {
++      ReleaseKeepalive(state);
++      ++released;
++    }
++  }
++  if (released > 0) {
++    LOG(INFO) << "browseros: Released " << released
++              << " idle extension worker keepalive(s)";
++  }
++}
++
++void BrowserOSWorkerKeepalive::AcquireKeepalive(WorkerState& state) {
++  if (state.keepalive || !state.worker_id ||
++      !process_manager_observation_.IsObserving()) {
++    return;
++  }
++  state.keepalive =
++      process_manager_observation_.GetSource()
++          ->IncrementServiceWorkerKeepaliveCount(
++              *state.worker_id,
++              content::ServiceWorkerExternalRequestTimeoutType::kDoesNotTimeout,
++              extensions::Activity::PROCESS_MANAGER, kKeepaliveExtraData);
++  VLOG(1) << "browseros: Holding keepalive for extension "
++          << state.worker_id->extension_id;
++}
++
++void BrowserOSWorkerKeepalive::ReleaseKeepalive(WorkerState& state) {
++  if (!state.keepalive) {
++    return;
++  }
++  if (state.worker_id && process_manager_observation_.IsObserving()) {
++    process_manager_observation_.GetSource()
++        ->DecrementServiceWorkerKeepaliveCount(
++            *state.worker_id, *state.keepalive,
++            extensions::Activity::PROCESS_MANAGER, kKeepaliveExtraData);
++    VLOG(1) << "browseros: Released keepalive for extension "
++            << state.worker_id->extension_id;
++  }
++  state.keepalive.reset();
++}
++
++void BrowserOSWorkerKeepalive::WakeWorker(
++    const extensions::ExtensionId& extension_id,
++    Activity activity) {
++  const extensions::Extension* extension =
++      extensions::ExtensionRegistry::Get(profile_)
++          ->enabled_extensions()
++          .GetByID(extension_id);
++  if (!extension ||
++      !extensions::BackgroundInfo::IsServiceWorkerBased(extension)) {
++    return;
++  }
++
++  content::ServiceWorkerContext* context =
++      extensions::util::GetServiceWorkerContextForExtensionId(extension_id,
++                                                              profile_);
++  if (!context) {
++    return;
++  }
++
++  WorkerState& state = workers_[extension_id];
++  state.wake_requested = base::TimeTicks::Now();
++  state.wake_activity = activity;
++
++  VLOG(1) << "browseros: Waking worker for extension " << extension_id
++          << " on " << ActivityToString(activity);
++  context->StartWorkerForScope(
++      extension->url(),
++      blink::StorageKey::CreateFirstParty(extension->origin()),
++      base::DoNothing(),
++      base::BindOnce(&BrowserOSWorkerKeepalive::OnWakeFailed,
++                     weak_ptr_factory_.GetWeakPtr(), extension_id));
++}
++
++void BrowserOSWorkerKeepalive::OnWakeFailed(
++    const extensions::ExtensionId& extension_id,
++    blink::ServiceWorkerStatusCode status) {
++  LOG(WARNING) << "browseros: Failed to wake worker for extension "
++               << extension_id << ": "
++               << blink::ServiceWorkerStatusToString(status);
++  auto it = workers_.find(extension_id);
++  if (it != workers_.end()) {
++    it->second.wake_requested = base::TimeTicks();
++  }
++}
++
++bool BrowserOSWorkerKeepalive::IsActive() const {
++  return idle_timeout_.is_zero() || !cdp_sessions_.empty() ||
++         idle_timer_.IsRunning();
++}
++
++void BrowserOSWorkerKeepalive::OnStartedTrackingServiceWorkerInstance(
++    const extensions::WorkerId& worker_id) {
++  if (!IsBrowserOSExtension(worker_id.extension_id)) {
++    return;
++  }
++
++  WorkerState& state = workers_[worker_id.extension_id];
++  state.worker_id = worker_id;
++
++  base::TimeTicks now = base::TimeTicks::Now();
++  if (!state.wake_requested.is_null() || !state.stopped_at.is_null()) {
++    base::Value::Dict properties;
++    properties.Set("extension_id", worker_id.extension_id);
++    // A worker we did not wake was started by Chrome for an event.
++    properties.Set("trigger", state.wake_requested.is_null()
++                                  ? "event"
++                                  : ActivityToString(state.wake_activity));
++    if (!state.wake_requested.is_null()) {
++      properties.Set("latency_ms", static_cast<int>(
++                                       (now - state.wake_requested)
++                                           .InMilliseconds()));
++    }
++    if (!state.stopped_at.is_null()) {
++      properties.Set("asleep_s",
++                     static_cast<int>((now - state.stopped_at).InSeconds()));
++    }
++    browseros_metrics::BrowserOSMetrics::Log("extension.worker.wake",
++                                             std::move(properties));
++  }
++  state.wake_requested = base::TimeTicks();
++  state.stopped_at = base::TimeTicks();
++
++  if (IsActive()) {
++    AcquireKeepalive(state);
++  }
++}
++
++void BrowserOSWorkerKeepalive::OnStoppedTrackingServiceWorkerInstance(
++    const extensions::WorkerId& worker_id) {
++  auto it = workers_.find(worker_id.extension_id);
++  if (it == workers_.end() || it->second.worker_id != worker_id) {
++    return;
++  }
++
++  // ProcessManager drops the worker's keepalives along with it.
++  WorkerState& state = it->second;
++  state.worker_id.reset();
++  state.keepalive.reset();
++  state.stopped_at = base::TimeTicks::Now();
++  VLOG(1) << "browseros: Worker stopped for extension "
++          << worker_id.extension_id;
++}
++
++void BrowserOSWorkerKeepalive::OnProcessManagerShutdown(
++    extensions::ProcessManager* manager) {
++  process_manager_observation_.Reset();
++  idle_timer_.Stop();
++  workers_.clear();
++}
++
++void BrowserOSWorkerKeepalive::DevToolsAgentHostAttached(
++    content::DevToolsAgentHost* agent_host) {
++  if (!IsCdpSessionForProfile(agent_host)) {
++    return;
++  }
++  cdp_sessions_.insert(agent_host->GetId());
++  OnActivity(Activity::kDevToolsSession, /*wake=*/true);
++}
++
++void BrowserOSWorkerKeepalive::DevToolsAgentHostDetached(
++    content::DevToolsAgentHost* agent_host) {
++  // Matched by id, as the host may have lost its context by now.
++  if (cdp_sessions_.erase(agent_host->GetId()) == 0) {
++    return;
++  }
++  if (cdp_sessions_.empty()) {
++    // Start the idle period from the end of the session.
++    OnActivity(Activity::kDevToolsSession, /*wake=*/false);
++  }
++}
++
++}  // namespace browseros
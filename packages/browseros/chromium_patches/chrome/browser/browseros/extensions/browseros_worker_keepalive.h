@@ -0,0 +1,149 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive.h b/chrome/browser/browseros/extensions/browseros_worker_keepalive.h
+new file mode 100644
+index 0000000000000..a0bb817233c51
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive.h
+@@ -0,0 +1,143 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
++
++#include <map>
++#include <optional>
++#include <set>
++#include <string>
++
++#include "base/callback_list.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/scoped_observation.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/uuid.h"
++#include "content/public/browser/devtools_agent_host_observer.h"
++#include "extensions/browser/process_manager.h"
++#include "extensions/browser/process_manager_observer.h"
++#include "extensions/common/extension_id.h"
++#include "third_party/blink/public/common/service_worker/service_worker_status_code.h"
++
++class Profile;
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++// Keeps the service workers of BrowserOS extensions alive only while they
++// are in use, instead of pinning them (and their renderer) for the life of
++// the profile.
++//
++// A worker holds a non-expiring keepalive while a CDP client has a session on
++// one of this profile's targets, and for an idle period
++// (kExtensionWorkerIdleTimeout, default kDefaultIdleTimeout) after the last
++// MCP request for this profile or agent call. Sessions of the user's own
++// DevTools windows and of other profiles' targets do not count. After that
++// the keepalive is dropped and Chrome's normal idle termination applies. An
++// MCP request or CDP attach wakes a stopped worker right away, so the first
++// call does not pay for the worker start.
++//
++// Logs "extension.worker.wake" with the wake latency and how long the worker
++// slept, which together weigh the memory freed against the cost of waking.
++class BrowserOSWorkerKeepalive : public extensions::ProcessManagerObserver,
++                                 public content::DevToolsAgentHostObserver {
++ public:
++  static constexpr base::TimeDelta kDefaultIdleTimeout = base::Minutes(5);
++
++  explicit BrowserOSWorkerKeepalive(Profile* profile);
++  ~BrowserOSWorkerKeepalive() override;
++
++  BrowserOSWorkerKeepalive(const BrowserOSWorkerKeepalive&) = delete;
++  BrowserOSWorkerKeepalive& operator=(const BrowserOSWorkerKeepalive&) =
++      delete;
++
++  // Records a browserOS API call made in |browser_context|, extending the
++  // idle period of that profile's workers.
++  static void NotifyAgentActivity(content::BrowserContext* browser_context);
++
++ private:
++  enum class Activity {
++    kMcpRequest,
++    kDevToolsSession,
++    kAgentCall,
++  };
++
++  struct WorkerState {
++    WorkerState();
++    ~WorkerState();
++    WorkerState(const WorkerState&);
++    WorkerState& operator=(const WorkerState&);
++
++    std::optional<extensions::WorkerId> worker_id;
++    std::optional<base::Uuid> keepalive;
++    // Set while a wake we requested is pending.
++    base::TimeTicks wake_requested;
++    Activity wake_activity = Activity::kMcpRequest;
++    // When the worker last stopped; null while it runs.
++    base::TimeTicks stopped_at;
++  };
++
++  static const char* ActivityToString(Activity activity);
++
++  // Holds keepalives on running workers, wakes stopped ones if |wake|, and
++  // restarts the idle period.
++  void OnActivity(Activity activity, bool wake);
++
++  void OnMcpRequest(content::BrowserContext* target);
++
++  // Whether a session on |agent_host| is a CDP client working on this
++  // profile, as opposed to a DevTools window or another profile's target.
++  bool IsCdpSessionForProfile(content::DevToolsAgentHost* agent_host) const;
++
++  // Drops every keepalive unless a CDP session is attached.
++  void OnIdleTimeout();
++
++  void AcquireKeepalive(WorkerState& state);
++  void ReleaseKeepalive(WorkerState& state);
++  void WakeWorker(const extensions::ExtensionId& extension_id,
++                  Activity activity);
++  void OnWakeFailed(const extensions::ExtensionId& extension_id,
++                    blink::ServiceWorkerStatusCode status);
++
++  // Whether keepalives should currently be held.
++  bool IsActive() const;
++
++  // extensions::ProcessManagerObserver:
++  void OnStartedTrackingServiceWorkerInstance(
++      const extensions::WorkerId& worker_id) override;
++  void OnStoppedTrackingServiceWorkerInstance(
++      const extensions::WorkerId& worker_id) override;
++  void OnProcessManagerShutdown(extensions::ProcessManager* manager) override;
++
++  // content::DevToolsAgentHostObserver:
++  void DevToolsAgentHostAttached(
++      content::DevToolsAgentHost* agent_host) override;
++  void DevToolsAgentHostDetached(
++      content::DevToolsAgentHost* agent_host) override;
++
++  raw_ptr<Profile> profile_;
++  const base::TimeDelta idle_timeout_;
++
++  std::map<extensions::ExtensionId, WorkerState> workers_;
++  // Ids of the agent hosts with a CDP session counted for this profile.
++  std::set<std::string> cdp_sessions_;
++  base::OneShotTimer idle_timer_;
++
++  base::CallbackListSubscription mcp_request_subscription_;
++  base::ScopedObservation<extensions::ProcessManager,
++                          extensions::ProcessManagerObserver>
++      process_manager_observation_{this};
++
++  base::WeakPtrFactory<BrowserOSWorkerKeepalive> weak_ptr_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics.h b/chrome/browser/browseros/metrics/browseros_metrics.h
 new file mode 100644
-index 0000000000000..6da70921b619a
+index 0000000000000..78aca6c143179
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics.h
-@@ -0,0 +1,40 @@
+@@ -0,0 +1,42 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -20,6 +20,8 @@ index 0000000000000..6da70921b619a
 +
 +// Simple static API for logging BrowserOS metrics.
 +// Usage: BrowserOSMetrics::Log("event.name");
++// Each call builds a dict and, off the UI thread, posts a task. Hot paths
++// should use BrowserOSMetricsRecorder instead.
 +class BrowserOSMetrics {
 + public:
 +  // Log an event with no properties
@@ -0,0 +1,225 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_recorder.cc b/chrome/browser/browseros/metrics/browseros_metrics_recorder.cc
+new file mode 100644
+index 0000000000000..6aefc28c8741c
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_recorder.cc
+@@ -0,0 +1,219 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_recorder.h"
++
++#include <algorithm>
++#include <limits>
++#include <tuple>
++#include <utility>
++
++#include "base/check_op.h"
++#include "base/logging.h"
++#include "base/notreached.h"
++#include "base/rand_util.h"
++
++namespace browseros_metrics {
++
++namespace {
++
++constexpr char kDroppedEventName[] = "metrics.recorder.dropped";
++
++}  // namespace
++
++base::Value MetricField::ToValue() const {
++  switch (type_) {
++    case Type::kBool:
++      return base::Value(value_.b);
++    case Type::kInt:
++      // base::Value only holds 32-bit integers.
++      if (value_.i >= std::numeric_limits<int>::min() &&
++          value_.i <= std::numeric_limits<int>::max()) {
++        return base::Value(static_cast<int>(value_.i));
++      }
++      return base::Value(static_cast<double>(value_.i));
++    case Type::kDouble:
++      return base::Value(value_.d);
++  }
++  NOTREACHED();
++}
++
++// =============================================================================
++// RecordRing
++// =============================================================================
++
++BrowserOSMetricsRecorder::RecordRing::RecordRing() = default;
++BrowserOSMetricsRecorder::RecordRing::~RecordRing() = default;
++
++bool BrowserOSMetricsRecorder::RecordRing::Push(const Entry& entry) {
++  uint32_t head = head_.load(std::memory_order_relaxed);
++  uint32_t tail = tail_.load(std::memory_order_acquire);
++  if (head - tail >= kRingCapacity) {
++    dropped_.fetch_add(1, std::memory_order_relaxed);
++    return false;
++  }
++  slots_[head % kRingCapacity] = entry;
++  head_.store(head + 1, std::memory_order_release);
++  return true;
++}
++
++void BrowserOSMetricsRecorder::RecordRing::DrainTo(
++    base::FunctionRef<void(const Entry&)> consumer) {
++  uint32_t tail = tail_.load(std::memory_order_relaxed);
++  uint32_t head = head_.load(std::memory_order_acquire);
++  for (; tail != head; ++tail) {
++    consumer(slots_[tail % kRingCapacity]);
++  }
++  tail_.store(tail, std::memory_order_release);
++}
++
++// =============================================================================
++// BrowserOSMetricsRecorder
++// =============================================================================
++
++// static
++BrowserOSMetricsRecorder& BrowserOSMetricsRecorder::Get() {
++  static base::NoDestructor<BrowserOSMetricsRecorder> instance;
++  return *instance;
++}
++
++BrowserOSMetricsRecorder::BrowserOSMetricsRecorder() = default;
++BrowserOSMetricsRecorder::~BrowserOSMetricsRecorder() = default;
++
++MetricEventId BrowserOSMetricsRecorder::RegisterEvent(
++    const std::string& name,
++    std::initializer_list<const char*> field_names,
++    double sample_rate) {
++  CHECK_LE(field_names.size(), kMaxFields) << name;
++  sample_rate = std::clamp(sample_rate, 0.0, 1.0);
++
++  base::AutoLock lock(descriptors_lock_);
++  for (size_t i = 0; i < descriptors_.size(); ++i) {
++    if (descriptors_[i].name == name) {
++      return static_cast<MetricEventId>(i);
++    }
++  }
++  CHECK_LT(descriptors_.size(), kMaxEvents) << "Too many metric events";
++
++  EventDescriptor descriptor;
++  descriptor.name = name;
++  descriptor.sample_rate = sample_rate;
++  for (const char* field_name : field_names) {
++    descriptor.field_names.emplace_back(field_name);
++  }
++  MetricEventId id = static_cast<MetricEventId>(descriptors_.size());
++  descriptors_.push_back(std::move(descriptor));
++  sample_rates_[id].store(sample_rate, std::memory_order_release);
++  return id;
++}
++
++void BrowserOSMetricsRecorder::Record(
++    MetricEventId event,
++    std::initializer_list<MetricField> fields) {
++  if (event >= kMaxEvents) {
++    return;
++  }
++  double sample_rate = sample_rates_[event].load(std::memory_order_acquire);
++  if (sample_rate <= 0.0) {
++    return;
++  }
++  if (sample_rate < 1.0 &&
++      !base::MetricsSubSampler().ShouldSample(sample_rate)) {
++    return;
++  }
++
++  Entry entry;
++  entry.recorded_at = base::Time::Now();
++  entry.event = event;
++  entry.field_count =
++      static_cast<uint8_t>(std::min(fields.size(), kMaxFields));
++  std::copy_n(fields.begin(), entry.field_count, entry.fields.begin());
++  GetRingForCurrentThread()->Push(entry);
++}
++
++void BrowserOSMetricsRecorder::Drain(DrainCallback callback) {
++  base::AutoLock drain_lock(drain_lock_);
++
++  // Rings are only removed below, under |drain_lock_|, so the raw pointers
++  // stay valid without holding |rings_lock_| while draining.
++  std::vector<RecordRing*> rings;
++  {
++    base::AutoLock lock(rings_lock_);
++    for (const auto& ring : rings_) {
++      rings.push_back(ring.get());
++    }
++  }
++
++  std::vector<Entry> entries;
++  std::vector<RecordRing*> orphaned;
++  size_t dropped = 0;
++  for (RecordRing* ring : rings) {
++    // An orphaned ring gets no more records, so it is empty afterwards.
++    if (ring->orphaned()) {
++      orphaned.push_back(ring);
++    }
++    ring->DrainTo([&entries](const Entry& entry) { entries.push_back(entry); });
++    dropped += ring->TakeDropped();
++  }
++
++  if (!orphaned.empty()) {
++    base::AutoLock lock(rings_lock_);
++    std::erase_if(rings_, [&orphaned](const std::unique_ptr<RecordRing>& ring) {
++      return std::ranges::find(orphaned, ring.get()) != orphaned.end();
++    });
++  }
++
++  // Resolve names under the lock, but run |callback| without it so it may
++  // record or register events itself.
++  std::vector<std::tuple<std::string, base::Value::Dict, base::Time>> events;
++  events.reserve(entries.size());
++  {
++    base::AutoLock lock(descriptors_lock_);
++    for (const Entry& entry : entries) {
++      const EventDescriptor& descriptor = descriptors_[entry.event];
++      base::Value::Dict properties;
++      for (size_t i = 0;
++           i < entry.field_count && i < descriptor.field_names.size(); ++i) {
++        properties.Set(descriptor.field_names[i], entry.fields[i].ToValue());
++      }
++      if (descriptor.sample_rate < 1.0) {
++        properties.Set("sample_rate", descriptor.sample_rate);
++      }
++      events.emplace_back(descriptor.name, std::move(properties),
++                          entry.recorded_at);
++    }
++  }
++
++  for (auto& [name, properties, recorded_at] : events) {
++    callback(name, std::move(properties), recorded_at);
++  }
++
++  if (dropped > 0) {
++    VLOG(1) << "browseros: Metrics recorder dropped " << dropped
++            << " records";
++    base::Value::Dict properties;
++    properties.Set("count", static_cast<int>(std::min<size_t>(
++                                dropped, std::numeric_limits<int>::max())));
++    callback(kDroppedEventName, std::move(properties), base::Time::Now());
++  }
++}
++
++BrowserOSMetricsRecorder::RecordRing*
++BrowserOSMetricsRecorder::GetRingForCurrentThread() {
++  if (RingHandle* handle = ring_handle_.Get()) {
++    return handle->ring();
++  }
++
++  // First record on this thread: the only time Record() takes a lock.
++  auto ring = std::make_unique<RecordRing>();
++  RecordRing* raw_ring = ring.get();
++  {
++    base::AutoLock lock(rings_lock_);
++    rings_.push_back(std::move(ring));
++  }
++  ring_handle_.Set(std::make_unique<RingHandle>(raw_ring));
++  return raw_ring;
++}
++
++}  // namespace browseros_metrics
@@ -0,0 +1,192 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_recorder.h b/chrome/browser/browseros/metrics/browseros_metrics_recorder.h
+new file mode 100644
+index 0000000000000..db5e6525a13ba
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_recorder.h
+@@ -0,0 +1,186 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_RECORDER_H_
++#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_RECORDER_H_
++
++#include <stddef.h>
++#include <stdint.h>
++
++#include <array>
++#include <atomic>
++#include <initializer_list>
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/functional/function_ref.h"
++#include "base/memory/raw_ptr.h"
++#include "base/no_destructor.h"
++#include "base/synchronization/lock.h"
++#include "base/thread_annotations.h"
++#include "base/threading/thread_local.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros_metrics {
++
++// Id of an event registered with BrowserOSMetricsRecorder::RegisterEvent().
++using MetricEventId = uint16_t;
++
++// A typed event field. Only fixed-size values are supported so that
++// recording never allocates.
++class MetricField {
++ public:
++  enum class Type : uint8_t { kBool, kInt, kDouble };
++
++  // NOLINTNEXTLINE(google-explicit-constructor)
++  MetricField(bool value) : type_(Type::kBool) { value_.b = value; }
++  // NOLINTNEXTLINE(google-explicit-constructor)
++  MetricField(int value) : type_(Type::kInt) { value_.i = value; }
++  // NOLINTNEXTLINE(google-explicit-constructor)
++  MetricField(int64_t value) : type_(Type::kInt) { value_.i = value; }
++  // NOLINTNEXTLINE(google-explicit-constructor)
++  MetricField(double value) : type_(Type::kDouble) { value_.d = value; }
++  MetricField() : MetricField(false) {}
++
++  base::Value ToValue() const;
++
++ private:
++  Type type_;
++  union {
++    bool b;
++    int64_t i;
++    double d;
++  } value_;
++};
++
++// Low-overhead, any-thread front end for BrowserOS metrics.
++//
++// Events are registered once with their field names, typically into a
++// function-local static, and then recorded with positional typed fields:
++//
++//   static const MetricEventId kEvent =
++//       BrowserOSMetricsRecorder::Get().RegisterEvent(
++//           "server.heartbeat.failed", {"deadline_ms", "timed_out"});
++//   BrowserOSMetricsRecorder::Get().Record(kEvent, {deadline_ms, timed_out});
++//
++// Record() copies a fixed-size record into a ring buffer owned by the
++// calling thread: no lock, allocation or task post. One timer on the UI
++// thread, shared by all BrowserOSMetricsServices, drains all buffers and
++// turns records into regular events. When a buffer is full the record is
++// dropped and counted; the count is reported as a
++// "metrics.recorder.dropped" event.
++//
++// Use BrowserOSMetrics::Log() for rare events with dynamic names or string
++// properties.
++class BrowserOSMetricsRecorder {
++ public:
++  static constexpr size_t kMaxEvents = 1024;
++  static constexpr size_t kMaxFields = 4;
++  static constexpr size_t kRingCapacity = 256;
++
++  // Receives each drained event with its properties and the time it was
++  // recorded.
++  using DrainCallback = base::FunctionRef<
++      void(const std::string& name, base::Value::Dict properties,
++           base::Time recorded_at)>;
++
++  static BrowserOSMetricsRecorder& Get();
++
++  BrowserOSMetricsRecorder(const BrowserOSMetricsRecorder&) = delete;
++  BrowserOSMetricsRecorder& operator=(const BrowserOSMetricsRecorder&) =
++      delete;
++
++  // Registers |name| with up to kMaxFields field names and returns its id.
++  // Registering the same name again returns the existing id; at most
++  // kMaxEvents names can be registered. |sample_rate| (0.0 to 1.0] is
++  // applied on every Record() call, and drained events of a sampled event
++  // carry it as a "sample_rate" property, as BrowserOSMetrics::Log() events
++  // do. Takes a lock; call once per event, not per record.
++  MetricEventId RegisterEvent(const std::string& name,
++                              std::initializer_list<const char*> field_names,
++                              double sample_rate = 1.0);
++
++  // Records |event| with |fields| in the order given at registration.
++  // Callable from any thread.
++  void Record(MetricEventId event, std::initializer_list<MetricField> fields);
++
++  // Moves every buffered record into |callback|. Buffers of threads that
++  // have exited are freed once empty.
++  void Drain(DrainCallback callback);
++
++ private:
++  friend class base::NoDestructor<BrowserOSMetricsRecorder>;
++
++  struct EventDescriptor {
++    std::string name;
++    std::vector<std::string> field_names;
++    double sample_rate = 1.0;
++  };
++
++  struct Entry {
++    base::Time recorded_at;
++    MetricEventId event = 0;
++    uint8_t field_count = 0;
++    std::array<MetricField, kMaxFields> fields;
++  };
++
++  // Single-producer (owning thread), single-consumer (Drain) ring.
++  class RecordRing {
++   public:
++    RecordRing();
++    ~RecordRing();
++
++    bool Push(const Entry& entry);
++    void DrainTo(base::FunctionRef<void(const Entry&)> consumer);
++    size_t TakeDropped() { return dropped_.exchange(0); }
++
++    void set_orphaned() { orphaned_.store(true, std::memory_order_release); }
++    bool orphaned() const { return orphaned_.load(std::memory_order_acquire); }
++
++   private:
++    std::array<Entry, kRingCapacity> slots_;
++    std::atomic<uint32_t> head_{0};
++    std::atomic<uint32_t> tail_{0};
++    std::atomic<size_t> dropped_{0};
++    std::atomic<bool> orphaned_{false};
++  };
++
++  // Thread-local handle; marks the ring orphaned when its thread exits so
++  // Drain() can free it after draining what is left.
++  class RingHandle {
++   public:
++    explicit RingHandle(RecordRing* ring) : ring_(ring) {}
++    ~RingHandle() { ring_->set_orphaned(); }
++    RecordRing* ring() const { return ring_; }
++
++   private:
++    const raw_ptr<RecordRing> ring_;
++  };
++
++  BrowserOSMetricsRecorder();
++  ~BrowserOSMetricsRecorder();
++
++  RecordRing* GetRingForCurrentThread();
++
++  base::Lock descriptors_lock_;
++  std::vector<EventDescriptor> descriptors_ GUARDED_BY(descriptors_lock_);
++
++  // Sample rates indexed by event id, readable without the lock. Unused ids
++  // stay at 0, so recording them is a no-op.
++  std::array<std::atomic<double>, kMaxEvents> sample_rates_{};
++
++  base::Lock rings_lock_;
++  std::vector<std::unique_ptr<RecordRing>> rings_ GUARDED_BY(rings_lock_);
++
++  // Serializes consumers.
++  base::Lock drain_lock_;
++
++  base::ThreadLocalOwnedPointer<RingHandle> ring_handle_;
++};
++
++}  // namespace browseros_metrics
++
++#endif  // CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_RECORDER_H_
@@ -0,0 +1,141 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_recorder_unittest.cc b/chrome/browser/browseros/metrics/browseros_metrics_recorder_unittest.cc
+new file mode 100644
+index 0000000000000..c2f0813408897
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_recorder_unittest.cc
+@@ -0,0 +1,135 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_recorder.h"
++
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/threading/thread.h"
++#include "base/values.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros_metrics {
++namespace {
++
++struct DrainedEvent {
++  std::string name;
++  base::Value::Dict properties;
++};
++
++// The recorder is process-wide, so each test uses its own event names and
++// starts from an empty buffer.
++class BrowserOSMetricsRecorderTest : public testing::Test {
++ protected:
++  void SetUp() override { Drain(); }
++
++  BrowserOSMetricsRecorder& recorder() {
++    return BrowserOSMetricsRecorder::Get();
++  }
++
++  std::vector<DrainedEvent> Drain() {
++    std::vector<DrainedEvent> events;
++    recorder().Drain([&events](const std::string& name,
++                               base::Value::Dict properties, base::Time) {
++      events.push_back({name, std::move(properties)});
++    });
++    return events;
++  }
++};
++
++TEST_F(BrowserOSMetricsRecorderTest, RecordsTypedFieldsInOrder) {
++  MetricEventId id = recorder().RegisterEvent(
++      "test.recorder.typed", {"flag", "count", "ratio"});
++  recorder().Record(id, {true, 42, 0.5});
++
++  std::vector<DrainedEvent> events = Drain();
++  ASSERT_EQ(1u, events.size());
++  EXPECT_EQ("test.recorder.typed", events[0].name);
++  EXPECT_EQ(true, events[0].properties.FindBool("flag"));
++  EXPECT_EQ(42, events[0].properties.FindInt("count"));
++  EXPECT_EQ(0.5, events[0].properties.FindDouble("ratio"));
++  EXPECT_FALSE(events[0].properties.Find("sample_rate"));
++
++  EXPECT_TRUE(Drain().empty());
++}
++
++TEST_F(BrowserOSMetricsRecorderTest, RegisteringTwiceReturnsSameId) {
++  MetricEventId first = recorder().RegisterEvent("test.recorder.twice", {});
++  MetricEventId second = recorder().RegisterEvent("test.recorder.twice", {});
++  EXPECT_EQ(first, second);
++  EXPECT_NE(first, recorder().RegisterEvent("test.recorder.other", {}));
++}
++
++TEST_F(BrowserOSMetricsRecorderTest, ZeroSampleRateRecordsNothing) {
++  MetricEventId id = recorder().RegisterEvent("test.recorder.unsampled",
++                                              {"value"}, /*sample_rate=*/0.0);
++  for (int i = 0; i < 10; ++i) {
++    recorder().Record(id, {i});
++  }
++  EXPECT_TRUE(Drain().empty());
++}
++
++TEST_F(BrowserOSMetricsRecorderTest, SampledEventsCarrySampleRate) {
++  constexpr int kRecords = 200;
++  MetricEventId id = recorder().RegisterEvent("test.recorder.sampled",
++                                              {"value"}, /*sample_rate=*/0.5);
++  for (int i = 0; i < kRecords; ++i) {
++    recorder().Record(id, {i});
++  }
++
++  // Each record is kept with probability 0.5; all or none of 200 is
++  // vanishingly unlikely.
++  std::vector<DrainedEvent> events = Drain();
++  EXPECT_GT(events.size(), 0u);
++  EXPECT_LT(events.size(), static_cast<size_t>(kRecords));
++  for (const DrainedEvent& event : events) {
++    EXPECT_EQ(0.5, event.properties.FindDouble("sample_rate"));
++  }
++}
++
++TEST_F(BrowserOSMetricsRecorderTest, DrainsRecordsFromExitedThreads) {
++  constexpr int kThreads = 4;
++  constexpr int kRecordsPerThread = 100;
++  MetricEventId id =
++      recorder().RegisterEvent("test.recorder.threads", {"thread", "index"});
++
++  for (int t = 0; t < kThreads; ++t) {
++    base::Thread thread("RecorderTestThread");
++    ASSERT_TRUE(thread.Start());
++    thread.task_runner()->PostTask(
++        FROM_HERE, base::BindOnce(
++                       [](MetricEventId id, int t) {
++                         for (int i = 0; i < kRecordsPerThread; ++i) {
++                           BrowserOSMetricsRecorder::Get().Record(id, {t, i});
++                         }
++                       },
++                       id, t));
++    thread.Stop();
++  }
++
++  std::vector<DrainedEvent> events = Drain();
++  EXPECT_EQ(static_cast<size_t>(kThreads * kRecordsPerThread), events.size());
++  EXPECT_TRUE(Drain().empty());
++}
++
++TEST_F(BrowserOSMetricsRecorderTest, FullRingDropsAndReportsCount) {
++  constexpr int kOverflow = 10;
++  MetricEventId id = recorder().RegisterEvent("test.recorder.full", {"index"});
++  for (size_t i = 0; i < BrowserOSMetricsRecorder::kRingCapacity + kOverflow;
++       ++i) {
++    recorder().Record(id, {static_cast<int>(i)});
++  }
++
++  std::vector<DrainedEvent> events = Drain();
++  ASSERT_EQ(BrowserOSMetricsRecorder::kRingCapacity + 1, events.size());
++  const DrainedEvent& dropped = events.back();
++  EXPECT_EQ("metrics.recorder.dropped", dropped.name);
++  EXPECT_EQ(kOverflow, dropped.properties.FindInt("count"));
++}
++
++}  // namespace
++}  // namespace browseros_metrics
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.cc b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
 new file mode 100644
-index 0000000000000..8c8c588df4481
+index 0000000000000..b7121bcfca105
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,234 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,23 +12,24 @@ index 0000000000000..8c8c588df4481
 +
 +#include <memory>
 +#include <string>
++#include <vector>
 +
-+#include "base/uuid.h"
-+#include "base/json/json_writer.h"
++#include "base/command_line.h"
++#include "base/i18n/time_formatting.h"
 +#include "base/logging.h"
-+#include "base/strings/string_number_conversions.h"
++#include "base/memory/raw_ptr.h"
++#include "base/no_destructor.h"
 +#include "base/system/sys_info.h"
 +#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/uuid.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics_recorder.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics_uploader.h"
 +#include "chrome/common/pref_names.h"
 +#include "components/prefs/pref_service.h"
 +#include "components/version_info/version_info.h"
-+#include "net/base/load_flags.h"
-+#include "net/http/http_status_code.h"
-+#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
 +#include "services/network/public/cpp/shared_url_loader_factory.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
-+#include "services/network/public/mojom/url_response_head.mojom.h"
 +
 +namespace browseros_metrics {
 +
@@ -41,54 +42,100 @@ index 0000000000000..8c8c588df4481
 +
 +// PostHog API configuration
 +constexpr char kPostHogApiKey[] = "phc_PRrpVnBMVJgUumvaXzUnwKZ1dDs3L8MSICLhTdnc8jC";
-+constexpr char kPostHogEndpoint[] = "https://us.i.posthog.com/i/v0/e/";
-+constexpr size_t kMaxUploadSize = 256 * 1024;  // 256KB max upload size
-+
-+constexpr net::NetworkTrafficAnnotationTag kBrowserOSMetricsTrafficAnnotation =
-+    net::DefineNetworkTrafficAnnotation("browseros_metrics", R"(
-+        semantics {
-+          sender: "BrowserOS Metrics"
-+          description:
-+            "Sends anonymous usage metrics to PostHog for BrowserOS features. "
-+            "This helps improve the browser by understanding how features are "
-+            "used. No personally identifiable information is collected."
-+          trigger:
-+            "Triggered when BrowserOS features are used, such as extension "
-+            "actions or settings changes."
-+          data:
-+            "Event name, timestamp, anonymous client ID, browser version, "
-+            "OS information, and feature-specific properties without PII."
-+          destination: OTHER
-+          destination_other:
-+            "PostHog analytics service at us.i.posthog.com"
-+        }
-+        policy {
-+          cookies_allowed: NO
-+          setting:
-+            "This feature cannot be disabled through settings. Events are "
-+            "sent anonymously without user identification."
-+          policy_exception_justification:
-+            "Not implemented. Analytics are anonymous and help improve "
-+            "the browser experience."
-+        })");
++constexpr char kPostHogBatchEndpoint[] = "https://us.i.posthog.com/batch/";
++
++// Returns the batch endpoint, which --browseros-metrics-endpoint can point
++// at a local stand-in server.
++GURL GetBatchEndpoint() {
++  const base::CommandLine* command_line =
++      base::CommandLine::ForCurrentProcess();
++  if (command_line->HasSwitch(browseros::kMetricsEndpoint)) {
++    GURL endpoint(
++        command_line->GetSwitchValueASCII(browseros::kMetricsEndpoint));
++    if (endpoint.is_valid() && endpoint.SchemeIsHTTPOrHTTPS()) {
++      return endpoint;
++    }
++    LOG(WARNING) << "browseros: Ignoring invalid metrics endpoint override";
++  }
++  return GURL(kPostHogBatchEndpoint);
++}
 +
 +}  // namespace
 +
++// Drains BrowserOSMetricsRecorder for the whole browser process on one timer.
++// The recorder is process-wide, so each record must be reported exactly once
++// and not by whichever profile's service happens to drain first. Records
++// describe the browser rather than a profile, so they go to the service of
++// the oldest live profile; every event carries install_id regardless.
++class RecorderDrainer {
++ public:
++  static RecorderDrainer& Get() {
++    static base::NoDestructor<RecorderDrainer> instance;
++    return *instance;
++  }
++
++  void AddService(BrowserOSMetricsService* service) {
++    services_.push_back(service);
++    if (!timer_.IsRunning()) {
++      timer_.Start(FROM_HERE, BrowserOSMetricsService::kRecorderDrainInterval,
++                   this, &RecorderDrainer::Drain);
++    }
++  }
++
++  void RemoveService(BrowserOSMetricsService* service) {
++    // The reporting service drains once more before it goes, so records are
++    // not left for a service that may never come.
++    if (!services_.empty() && services_.front() == service) {
++      Drain();
++    }
++    std::erase(services_, service);
++    if (services_.empty()) {
++      timer_.Stop();
++    }
++  }
++
++ private:
++  friend class base::NoDestructor<RecorderDrainer>;
++
++  RecorderDrainer() = default;
++
++  void Drain() {
++    if (services_.empty()) {
++      return;
++    }
++    BrowserOSMetricsService* service = services_.front();
++    BrowserOSMetricsRecorder::Get().Drain(
++        [service](const std::string& name, base::Value::Dict properties,
++                  base::Time recorded_at) {
++          service->CaptureEventAt(name, std::move(properties), recorded_at);
++        });
++  }
++
++  std::vector<raw_ptr<BrowserOSMetricsService>> services_;
++  base::RepeatingTimer timer_;
++};
++
 +BrowserOSMetricsService::BrowserOSMetricsService(
 +    PrefService* pref_service,
 +    PrefService* local_state_prefs,
-+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
-+    : pref_service_(pref_service),
-+      local_state_prefs_(local_state_prefs),
-+      url_loader_factory_(std::move(url_loader_factory)) {
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++    const base::FilePath& spool_dir)
++    : pref_service_(pref_service), local_state_prefs_(local_state_prefs) {
 +  CHECK(pref_service_);
 +  CHECK(local_state_prefs_);
-+  CHECK(url_loader_factory_);
++  CHECK(url_loader_factory);
 +  InitializeClientId();
 +  InitializeInstallId();
++  uploader_ = std::make_unique<BrowserOSMetricsUploader>(
++      std::move(url_loader_factory), GetBatchEndpoint(), kPostHogApiKey,
++      spool_dir);
++  RecorderDrainer::Get().AddService(this);
 +}
 +
-+BrowserOSMetricsService::~BrowserOSMetricsService() = default;
++BrowserOSMetricsService::~BrowserOSMetricsService() {
++  // No-op after Shutdown().
++  RecorderDrainer::Get().RemoveService(this);
++}
 +
 +void BrowserOSMetricsService::CaptureEvent(const std::string& event_name,
 +                                            base::Value::Dict properties) {
@@ -98,12 +145,24 @@ index 0000000000000..8c8c588df4481
 +  }
 +
 +  VLOG(1) << "browseros: Capturing event: " << event_name;
++  CaptureEventAt(event_name, std::move(properties), base::Time::Now());
++}
 +
++void BrowserOSMetricsService::CaptureEventAt(const std::string& event_name,
++                                             base::Value::Dict properties,
++                                             base::Time timestamp) {
 +  // Add default properties
 +  AddDefaultProperties(properties);
 +
-+  // Send to PostHog
-+  SendEventToPostHog(event_name, std::move(properties));
++  // Batches are uploaded later, so record the capture time. The uuid lets
++  // PostHog deduplicate a batch that is resent after an ambiguous failure.
++  base::Value::Dict event;
++  event.Set("event", "browseros.native." + event_name);
++  event.Set("distinct_id", client_id_);
++  event.Set("properties", std::move(properties));
++  event.Set("timestamp", base::TimeFormatAsIso8601(timestamp));
++  event.Set("uuid", base::Uuid::GenerateRandomV4().AsLowercaseString());
++  uploader_->Enqueue(std::move(event));
 +}
 +
 +std::string BrowserOSMetricsService::GetClientId() const {
@@ -115,7 +174,9 @@ index 0000000000000..8c8c588df4481
 +}
 +
 +void BrowserOSMetricsService::Shutdown() {
-+  // Cancel any pending network requests
++  RecorderDrainer::Get().RemoveService(this);
++  // No time is left to upload; keep unsent events for the next session.
++  uploader_->FlushToDisk();
 +  weak_factory_.InvalidateWeakPtrs();
 +}
 +
@@ -157,64 +218,6 @@ index 0000000000000..8c8c588df4481
 +  VLOG(1) << "browseros: Metrics install ID: " << install_id_;
 +}
 +
-+void BrowserOSMetricsService::SendEventToPostHog(
-+    const std::string& event_name,
-+    base::Value::Dict properties) {
-+  // Build the request payload
-+  base::Value::Dict payload;
-+  payload.Set("api_key", kPostHogApiKey);
-+  payload.Set("event", "browseros.native." + event_name);
-+  payload.Set("distinct_id", client_id_);
-+  payload.Set("properties", std::move(properties));
-+
-+  // Convert to JSON
-+  std::string json_payload;
-+  if (!base::JSONWriter::Write(payload, &json_payload)) {
-+    LOG(ERROR) << "browseros: Failed to serialize metrics payload";
-+    return;
-+  }
-+
-+  // Create the request
-+  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = GURL(kPostHogEndpoint);
-+  resource_request->method = "POST";
-+  resource_request->load_flags = net::LOAD_DISABLE_CACHE;
-+  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
-+
-+  // Create the URL loader
-+  auto url_loader = network::SimpleURLLoader::Create(
-+      std::move(resource_request), kBrowserOSMetricsTrafficAnnotation);
-+  url_loader->SetAllowHttpErrorResults(true);
-+  url_loader->AttachStringForUpload(json_payload, "application/json");
-+
-+  // Send the request
-+  network::SimpleURLLoader* loader_ptr = url_loader.get();
-+  loader_ptr->DownloadToString(
-+      url_loader_factory_.get(),
-+      base::BindOnce(&BrowserOSMetricsService::OnPostHogResponse,
-+                     weak_factory_.GetWeakPtr(), std::move(url_loader)),
-+      kMaxUploadSize);
-+}
-+
-+void BrowserOSMetricsService::OnPostHogResponse(
-+    std::unique_ptr<network::SimpleURLLoader> loader,
-+    std::unique_ptr<std::string> response_body) {
-+  int response_code = 0;
-+  if (loader->ResponseInfo() && loader->ResponseInfo()->headers) {
-+    response_code = loader->ResponseInfo()->headers->response_code();
-+  }
-+
-+  if (response_code == net::HTTP_OK) {
-+    VLOG(2) << "browseros: Metrics event sent successfully";
-+  } else {
-+    LOG(WARNING) << "browseros: Failed to send metrics event. Response code: "
-+                 << response_code;
-+    if (response_body && !response_body->empty()) {
-+      LOG(WARNING) << "browseros: Error response: " << *response_body;
-+    }
-+  }
-+}
-+
 +void BrowserOSMetricsService::AddDefaultProperties(
 +    base::Value::Dict& properties) {
 +  // Add browser version
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.h b/chrome/browser/browseros/metrics/browseros_metrics_service.h
 new file mode 100644
-index 0000000000000..2157d1eb1698e
+index 0000000000000..6937f933742af
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.h
-@@ -0,0 +1,95 @@
+@@ -0,0 +1,103 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,11 +14,12 @@ index 0000000000000..2157d1eb1698e
 +#include <memory>
 +#include <string>
 +
++#include "base/files/file_path.h"
 +#include "base/functional/callback.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "base/values.h"
 +#include "components/keyed_service/core/keyed_service.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
 +#include "url/gurl.h"
 +
 +class PrefService;
@@ -29,15 +30,20 @@ index 0000000000000..2157d1eb1698e
 +
 +namespace browseros_metrics {
 +
++class BrowserOSMetricsUploader;
++class RecorderDrainer;
++
 +// Service for capturing and sending analytics events to PostHog.
 +// This service manages a stable client ID (per-profile) and install ID
-+// (per-installation) and sends events to the PostHog API.
++// (per-installation) and hands events to a BrowserOSMetricsUploader, which
++// batches them, spools unsent batches under |spool_dir| and retries.
 +class BrowserOSMetricsService : public KeyedService {
 + public:
-+  explicit BrowserOSMetricsService(
++  BrowserOSMetricsService(
 +      PrefService* pref_service,
 +      PrefService* local_state_prefs,
-+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++      const base::FilePath& spool_dir);
 +
 +  BrowserOSMetricsService(const BrowserOSMetricsService&) = delete;
 +  BrowserOSMetricsService& operator=(const BrowserOSMetricsService&) = delete;
@@ -59,21 +65,23 @@ index 0000000000000..2157d1eb1698e
 +  // KeyedService:
 +  void Shutdown() override;
 +
++  // How often records from BrowserOSMetricsRecorder are turned into events.
++  static constexpr base::TimeDelta kRecorderDrainInterval = base::Seconds(10);
++
 + private:
++  friend class RecorderDrainer;
++
++  // Builds the PostHog event and hands it to the uploader.
++  void CaptureEventAt(const std::string& event_name,
++                      base::Value::Dict properties,
++                      base::Time timestamp);
++
 +  // Initializes or retrieves the stable client ID from profile preferences.
 +  void InitializeClientId();
 +
 +  // Initializes or retrieves the stable install ID from local state.
 +  void InitializeInstallId();
 +
-+  // Sends the event to PostHog API.
-+  void SendEventToPostHog(const std::string& event_name,
-+                          base::Value::Dict properties);
-+
-+  // Handles the response from PostHog API.
-+  void OnPostHogResponse(std::unique_ptr<network::SimpleURLLoader> loader,
-+                         std::unique_ptr<std::string> response_body);
-+
 +  // Adds default properties to the event.
 +  void AddDefaultProperties(base::Value::Dict& properties);
 +
@@ -83,8 +91,8 @@ index 0000000000000..2157d1eb1698e
 +  // PrefService for storing the stable install ID (local state).
 +  raw_ptr<PrefService> local_state_prefs_;
 +
-+  // Factory for creating URL loaders.
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  // Batches, spools and uploads events.
++  std::unique_ptr<BrowserOSMetricsUploader> uploader_;
 +
 +  // Stable client ID for this profile.
 +  std::string client_id_;
@@ -0,0 +1,374 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_uploader.cc b/chrome/browser/browseros/metrics/browseros_metrics_uploader.cc
+new file mode 100644
+index 0000000000000..ce9d0cfb26ac4
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_uploader.cc
+@@ -0,0 +1,368 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_uploader.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/files/file_enumerator.h"
++#include "base/files/file_util.h"
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "base/uuid.h"
++#include "net/base/load_flags.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++
++namespace browseros_metrics {
++
++namespace {
++
++constexpr size_t kMaxResponseSize = 64 * 1024;
++
++// A single spooled batch is at most kMaxBatchEvents events; anything larger
++// on disk is corrupt.
++constexpr int64_t kMaxSpoolFileSize = 1024 * 1024;
++
++constexpr base::FilePath::CharType kSpoolFileExtension[] =
++    FILE_PATH_LITERAL(".json");
++
++constexpr net::NetworkTrafficAnnotationTag kBrowserOSMetricsTrafficAnnotation =
++    net::DefineNetworkTrafficAnnotation("browseros_metrics", R"(
++        semantics {
++          sender: "BrowserOS Metrics"
++          description:
++            "Sends anonymous usage metrics to PostHog for BrowserOS features. "
++            "This helps improve the browser by understanding how features are "
++            "used. No personally identifiable information is collected."
++          trigger:
++            "Triggered when BrowserOS features are used, such as extension "
++            "actions or settings changes. Events are batched and sent at most "
++            "every 30 seconds, or retried later if sending failed."
++          data:
++            "Event name, timestamp, anonymous client ID, browser version, "
++            "OS information, and feature-specific properties without PII."
++          destination: OTHER
++          destination_other:
++            "PostHog analytics service at us.i.posthog.com"
++        }
++        policy {
++          cookies_allowed: NO
++          setting:
++            "This feature cannot be disabled through settings. Events are "
++            "sent anonymously without user identification."
++          policy_exception_justification:
++            "Not implemented. Analytics are anonymous and help improve "
++            "the browser experience."
++        })");
++
++// Spool files sort oldest first by name.
++std::vector<base::FilePath> ListSpoolFiles(const base::FilePath& dir) {
++  std::vector<base::FilePath> files;
++  base::FileEnumerator enumerator(dir, /*recursive=*/false,
++                                  base::FileEnumerator::FILES,
++                                  FILE_PATH_LITERAL("*.json"));
++  for (base::FilePath path = enumerator.Next(); !path.empty();
++       path = enumerator.Next()) {
++    files.push_back(path);
++  }
++  std::ranges::sort(files);
++  return files;
++}
++
++void WriteSpoolFile(const base::FilePath& dir,
++                    const std::string& body,
++                    size_t max_spool_bytes) {
++  if (!base::CreateDirectory(dir)) {
++    LOG(WARNING) << "browseros: Cannot create metrics spool " << dir;
++    return;
++  }
++
++  std::string name = base::StringPrintf(
++      "%020lld-%s", static_cast<long long>(
++                        base::Time::Now().InMillisecondsSinceUnixEpoch()),
++      base::Uuid::GenerateRandomV4().AsLowercaseString().c_str());
++  base::FilePath path =
++      dir.AppendASCII(name).AddExtension(kSpoolFileExtension);
++  if (!base::WriteFile(path, body)) {
++    LOG(WARNING) << "browseros: Failed to spool metrics batch";
++    return;
++  }
++
++  // Keep the newest batches within the byte budget.
++  std::vector<base::FilePath> files = ListSpoolFiles(dir);
++  int64_t total = 0;
++  std::vector<int64_t> sizes;
++  for (const base::FilePath& file : files) {
++    sizes.push_back(base::GetFileSize(file).value_or(0));
++    total += sizes.back();
++  }
++  for (size_t i = 0;
++       i + 1 < files.size() && total > static_cast<int64_t>(max_spool_bytes);
++       ++i) {
++    base::DeleteFile(files[i]);
++    total -= sizes[i];
++    VLOG(1) << "browseros: Dropped oldest spooled metrics batch";
++  }
++}
++
++std::optional<BrowserOSMetricsUploader::SpooledBatch> ReadOldestSpoolFile(
++    const base::FilePath& dir) {
++  for (const base::FilePath& path : ListSpoolFiles(dir)) {
++    std::string body;
++    if (base::ReadFileToStringWithMaxSize(path, &body, kMaxSpoolFileSize)) {
++      return BrowserOSMetricsUploader::SpooledBatch{path, std::move(body)};
++    }
++    base::DeleteFile(path);
++  }
++  return std::nullopt;
++}
++
++bool IsRetryable(int net_error, int response_code) {
++  if (net_error != net::OK && response_code == 0) {
++    return true;
++  }
++  return response_code == net::HTTP_TOO_MANY_REQUESTS || response_code >= 500;
++}
++
++}  // namespace
++
++// static
++const net::BackoffEntry::Policy BrowserOSMetricsUploader::kRetryPolicy = {
++    .num_errors_to_ignore = 0,
++    .initial_delay_ms = 30 * 1000,
++    .multiply_factor = 2.0,
++    .jitter_factor = 0.2,
++    .maximum_backoff_ms = 60 * 60 * 1000,
++    .entry_lifetime_ms = -1,
++    .always_use_initial_delay = false,
++};
++
++BrowserOSMetricsUploader::BrowserOSMetricsUploader(
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++    GURL endpoint,
++    std::string api_key,
++    base::FilePath spool_dir,
++    size_t max_spool_bytes)
++    : url_loader_factory_(std::move(url_loader_factory)),
++      endpoint_(std::move(endpoint)),
++      api_key_(std::move(api_key)),
++      spool_dir_(std::move(spool_dir)),
++      max_spool_bytes_(max_spool_bytes),
++      spool_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
++      backoff_(&kRetryPolicy) {
++  // Replay anything spooled by a previous session on the first tick.
++  ScheduleFlush();
++}
++
++BrowserOSMetricsUploader::~BrowserOSMetricsUploader() = default;
++
++void BrowserOSMetricsUploader::Enqueue(base::Value::Dict event) {
++  queue_.push_back(std::move(event));
++
++  if (queue_.size() < kMaxBatchEvents) {
++    ScheduleFlush();
++    return;
++  }
++
++  // While uploads are backing off, move full batches to disk instead of
++  // growing the in-memory queue.
++  if (retry_timer_.IsRunning()) {
++    SpoolBatch(TakeBatch(kMaxBatchEvents));
++    return;
++  }
++  Flush();
++}
++
++void BrowserOSMetricsUploader::Flush() {
++  flush_timer_.Stop();
++  if (loader_ || retry_timer_.IsRunning()) {
++    return;
++  }
++
++  if (queue_.empty()) {
++    ReplaySpool();
++    return;
++  }
++  StartUpload(TakeBatch(kMaxBatchEvents), base::FilePath());
++}
++
++void BrowserOSMetricsUploader::FlushToDisk() {
++  flush_timer_.Stop();
++  retry_timer_.Stop();
++
++  if (loader_) {
++    loader_.reset();
++    // A replayed spool file is still on disk.
++    if (in_flight_spool_file_.empty()) {
++      SpoolBatch(std::move(in_flight_body_));
++    }
++    in_flight_body_.clear();
++    in_flight_spool_file_.clear();
++  }
++
++  while (!queue_.empty()) {
++    SpoolBatch(TakeBatch(kMaxBatchEvents));
++  }
++  weak_factory_.InvalidateWeakPtrs();
++}
++
++std::string BrowserOSMetricsUploader::TakeBatch(size_t max_events) {
++  base::Value::List batch;
++  while (!queue_.empty() && batch.size() < max_events) {
++    batch.Append(std::move(queue_.front()));
++    queue_.pop_front();
++  }
++
++  base::Value::Dict payload;
++  payload.Set("api_key", api_key_);
++  payload.Set("batch", std::move(batch));
++
++  std::string body;
++  if (!base::JSONWriter::Write(payload, &body)) {
++    LOG(ERROR) << "browseros: Failed to serialize metrics batch";
++    body.clear();
++  }
++  return body;
++}
++
++void BrowserOSMetricsUploader::StartUpload(std::string body,
++                                           base::FilePath spool_file) {
++  if (body.empty()) {
++    return;
++  }
++
++  auto resource_request = std::make_unique<network::ResourceRequest>();
++  resource_request->url = endpoint_;
++  resource_request->method = "POST";
++  resource_request->load_flags = net::LOAD_DISABLE_CACHE;
++  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++
++  loader_ = network::SimpleURLLoader::Create(
++      std::move(resource_request), kBrowserOSMetricsTrafficAnnotation);
++  loader_->SetAllowHttpErrorResults(true);
++  loader_->AttachStringForUpload(body, "application/json");
++
++  in_flight_body_ = std::move(body);
++  in_flight_spool_file_ = std::move(spool_file);
++
++  loader_->DownloadToString(
++      url_loader_factory_.get(),
++      base::BindOnce(&BrowserOSMetricsUploader::OnUploadComplete,
++                     weak_factory_.GetWeakPtr()),
++      kMaxResponseSize);
++}
++
++void BrowserOSMetricsUploader::OnUploadComplete(
++    std::unique_ptr<std::string> response_body) {
++  int net_error = loader_->NetError();
++  int response_code = 0;
++  if (loader_->ResponseInfo() && loader_->ResponseInfo()->headers) {
++    response_code = loader_->ResponseInfo()->headers->response_code();
++  }
++  loader_.reset();
++  std::string body = std::move(in_flight_body_);
++  base::FilePath spool_file = std::move(in_flight_spool_file_);
++  in_flight_body_.clear();
++  in_flight_spool_file_.clear();
++
++  if (response_code >= 200 && response_code < 300) {
++    VLOG(2) << "browseros: Metrics batch sent successfully";
++    backoff_.InformOfRequest(true);
++    if (!spool_file.empty()) {
++      spool_task_runner_->PostTask(
++          FROM_HERE, base::GetDeleteFileCallback(spool_file));
++    }
++    // Keep draining: queued events first, then the spool.
++    Flush();
++    return;
++  }
++
++  if (IsRetryable(net_error, response_code)) {
++    backoff_.InformOfRequest(false);
++    LOG(WARNING) << "browseros: Metrics upload failed ("
++                 << (response_code ? base::NumberToString(response_code)
++                                   : net::ErrorToShortString(net_error))
++                 << "), retrying in "
++                 << backoff_.GetTimeUntilRelease().InSeconds() << "s";
++    if (spool_file.empty()) {
++      SpoolBatch(std::move(body));
++    }
++    retry_timer_.Start(FROM_HERE, backoff_.GetTimeUntilRelease(),
++                       base::BindOnce(&BrowserOSMetricsUploader::Flush,
++                                      weak_factory_.GetWeakPtr()));
++    return;
++  }
++
++  // The server rejected the batch itself; resending it cannot succeed.
++  LOG(WARNING) << "browseros: Metrics batch rejected. Response code: "
++               << response_code;
++  if (response_body && !response_body->empty()) {
++    LOG(WARNING) << "browseros: Error response: " << *response_body;
++  }
++  if (!spool_file.empty()) {
++    spool_task_runner_->PostTask(FROM_HERE,
++                                 base::GetDeleteFileCallback(spool_file));
++  }
++  Flush();
++}
++
++void BrowserOSMetricsUploader::SpoolBatch(std::string body) {
++  if (body.empty() || spool_dir_.empty()) {
++    return;
++  }
++  spool_task_runner_->PostTask(
++      FROM_HERE, base::BindOnce(&WriteSpoolFile, spool_dir_, std::move(body),
++                                max_spool_bytes_));
++}
++
++void BrowserOSMetricsUploader::ReplaySpool() {
++  if (spool_read_pending_ || spool_dir_.empty()) {
++    return;
++  }
++  spool_read_pending_ = true;
++  spool_task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE, base::BindOnce(&ReadOldestSpoolFile, spool_dir_),
++      base::BindOnce(&BrowserOSMetricsUploader::OnSpoolRead,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSMetricsUploader::OnSpoolRead(std::optional<SpooledBatch> batch) {
++  spool_read_pending_ = false;
++  if (!batch) {
++    return;
++  }
++  if (loader_ || retry_timer_.IsRunning()) {
++    // Something else started meanwhile; the spool is replayed once it is
++    // done.
++    return;
++  }
++  VLOG(1) << "browseros: Replaying spooled metrics batch "
++          << batch->path.BaseName();
++  StartUpload(std::move(batch->body), std::move(batch->path));
++}
++
++void BrowserOSMetricsUploader::ScheduleFlush() {
++  if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushInterval,
++                       base::BindOnce(&BrowserOSMetricsUploader::Flush,
++                                      weak_factory_.GetWeakPtr()));
++  }
++}
++
++}  // namespace browseros_metrics
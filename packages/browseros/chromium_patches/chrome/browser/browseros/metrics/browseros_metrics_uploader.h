@@ -0,0 +1,132 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_uploader.h b/chrome/browser/browseros/metrics/browseros_metrics_uploader.h
+new file mode 100644
+index 0000000000000..7bbd23b2aec34
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_uploader.h
+@@ -0,0 +1,126 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_UPLOADER_H_
++#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_UPLOADER_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/circular_deque.h"
++#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "net/base/backoff_entry.h"
++#include "url/gurl.h"
++
++namespace base {
++class SequencedTaskRunner;
++}  // namespace base
++
++namespace network {
++class SharedURLLoaderFactory;
++class SimpleURLLoader;
++}  // namespace network
++
++namespace browseros_metrics {
++
++// Queues captured events and uploads them in batches to PostHog's /batch/
++// endpoint, once kMaxBatchEvents are queued or kFlushInterval has passed.
++//
++// A batch that fails with a network error, 429 or 5xx is spooled to
++// |spool_dir| and retried with exponential backoff; the spool is bounded to
++// |max_spool_bytes| by dropping the oldest batches. Spooled batches are
++// replayed one at a time whenever the queue is idle, including after a
++// restart. Other 4xx responses drop the batch. Only one upload is in flight
++// at a time.
++class BrowserOSMetricsUploader {
++ public:
++  static constexpr size_t kMaxBatchEvents = 50;
++  static constexpr base::TimeDelta kFlushInterval = base::Seconds(30);
++  static constexpr size_t kMaxSpoolBytes = 2 * 1024 * 1024;
++
++  // Retry schedule for failed uploads.
++  static const net::BackoffEntry::Policy kRetryPolicy;
++
++  BrowserOSMetricsUploader(
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++      GURL endpoint,
++      std::string api_key,
++      base::FilePath spool_dir,
++      size_t max_spool_bytes = kMaxSpoolBytes);
++
++  BrowserOSMetricsUploader(const BrowserOSMetricsUploader&) = delete;
++  BrowserOSMetricsUploader& operator=(const BrowserOSMetricsUploader&) =
++      delete;
++
++  ~BrowserOSMetricsUploader();
++
++  // Queues a fully formed PostHog event (event, distinct_id, properties,
++  // timestamp, uuid).
++  void Enqueue(base::Value::Dict event);
++
++  // Starts uploading queued events, or replaying the spool when nothing is
++  // queued. No-op while an upload is in flight or a retry is pending.
++  void Flush();
++
++  // Cancels the in-flight upload and spools it together with everything
++  // still queued. Used on shutdown, when there is no time left to upload;
++  // the spool writes are shutdown-blocking.
++  void FlushToDisk();
++
++  size_t queued_event_count() const { return queue_.size(); }
++  bool upload_in_flight() const { return !!loader_; }
++
++  // A batch body read back from the spool, and the file it came from.
++  struct SpooledBatch {
++    base::FilePath path;
++    std::string body;
++  };
++
++ private:
++  // Serializes up to |max_events| queued events into a /batch/ body.
++  std::string TakeBatch(size_t max_events);
++
++  // Uploads |body|. |spool_file| is the spool entry the body came from, or
++  // empty for a fresh batch.
++  void StartUpload(std::string body, base::FilePath spool_file);
++  void OnUploadComplete(std::unique_ptr<std::string> response_body);
++
++  void SpoolBatch(std::string body);
++  void ReplaySpool();
++  void OnSpoolRead(std::optional<SpooledBatch> batch);
++  void ScheduleFlush();
++
++  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  const GURL endpoint_;
++  const std::string api_key_;
++  const base::FilePath spool_dir_;
++  const size_t max_spool_bytes_;
++
++  // Spool file IO; BLOCK_SHUTDOWN so FlushToDisk() completes.
++  scoped_refptr<base::SequencedTaskRunner> spool_task_runner_;
++
++  base::circular_deque<base::Value::Dict> queue_;
++
++  std::unique_ptr<network::SimpleURLLoader> loader_;
++  std::string in_flight_body_;
++  base::FilePath in_flight_spool_file_;
++  bool spool_read_pending_ = false;
++
++  net::BackoffEntry backoff_;
++  base::OneShotTimer flush_timer_;
++  base::OneShotTimer retry_timer_;
++
++  base::WeakPtrFactory<BrowserOSMetricsUploader> weak_factory_{this};
++};
++
++}  // namespace browseros_metrics
++
++#endif  // CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_UPLOADER_H_
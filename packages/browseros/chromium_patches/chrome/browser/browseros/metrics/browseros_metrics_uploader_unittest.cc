@@ -0,0 +1,201 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_metrics_uploader_unittest.cc b/chrome/browser/browseros/metrics/browseros_metrics_uploader_unittest.cc
+new file mode 100644
+index 0000000000000..f7747f240607c
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_metrics_uploader_unittest.cc
+@@ -0,0 +1,195 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_metrics_uploader.h"
++
++#include <memory>
++#include <string>
++
++#include "base/files/file_enumerator.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_reader.h"
++#include "base/test/task_environment.h"
++#include "base/values.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "services/network/test/test_utils.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "url/gurl.h"
++
++namespace browseros_metrics {
++namespace {
++
++constexpr char kEndpoint[] = "https://metrics.test/batch/";
++
++// Longer than the first retry delay including jitter.
++constexpr base::TimeDelta kFirstRetry = base::Seconds(40);
++
++base::Value::Dict MakeEvent(int index) {
++  base::Value::Dict event;
++  event.Set("event", "browseros.native.test");
++  event.Set("distinct_id", "client");
++  event.Set("index", index);
++  return event;
++}
++
++class BrowserOSMetricsUploaderTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    spool_dir_ = temp_dir_.GetPath().AppendASCII("spool");
++  }
++
++  std::unique_ptr<BrowserOSMetricsUploader> CreateUploader(
++      size_t max_spool_bytes = BrowserOSMetricsUploader::kMaxSpoolBytes) {
++    return std::make_unique<BrowserOSMetricsUploader>(
++        base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
++            &url_loader_factory_),
++        GURL(kEndpoint), "test-key", spool_dir_, max_spool_bytes);
++  }
++
++  void EnqueueEvents(BrowserOSMetricsUploader& uploader, int count) {
++    for (int i = 0; i < count; ++i) {
++      uploader.Enqueue(MakeEvent(i));
++    }
++  }
++
++  int pending_request_count() {
++    return static_cast<int>(url_loader_factory_.NumPending());
++  }
++
++  // Returns the number of events in the single pending upload, or -1.
++  int PendingBatchSize() {
++    if (url_loader_factory_.NumPending() != 1) {
++      return -1;
++    }
++    const network::ResourceRequest& request =
++        (*url_loader_factory_.pending_requests())[0].request;
++    std::optional<base::Value::Dict> body =
++        base::JSONReader::ReadDict(network::GetUploadData(request));
++    if (!body || !body->FindList("batch")) {
++      return -1;
++    }
++    EXPECT_EQ("test-key", *body->FindString("api_key"));
++    return static_cast<int>(body->FindList("batch")->size());
++  }
++
++  void Respond(net::HttpStatusCode status) {
++    ASSERT_TRUE(
++        url_loader_factory_.SimulateResponseForPendingRequest(kEndpoint, "{}",
++                                                              status));
++    task_environment_.RunUntilIdle();
++  }
++
++  int SpoolFileCount() {
++    base::FileEnumerator enumerator(spool_dir_, /*recursive=*/false,
++                                    base::FileEnumerator::FILES);
++    int count = 0;
++    for (base::FilePath path = enumerator.Next(); !path.empty();
++         path = enumerator.Next()) {
++      ++count;
++    }
++    return count;
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  network::TestURLLoaderFactory url_loader_factory_;
++  base::ScopedTempDir temp_dir_;
++  base::FilePath spool_dir_;
++};
++
++// =============================================================================
++// Batching Tests
++// =============================================================================
++
++TEST_F(BrowserOSMetricsUploaderTest, FullBatchUploadsImmediately) {
++  auto uploader = CreateUploader();
++  EnqueueEvents(*uploader,
++                static_cast<int>(BrowserOSMetricsUploader::kMaxBatchEvents));
++  task_environment_.RunUntilIdle();
++
++  EXPECT_EQ(static_cast<int>(BrowserOSMetricsUploader::kMaxBatchEvents),
++            PendingBatchSize());
++  EXPECT_EQ(0u, uploader->queued_event_count());
++}
++
++TEST_F(BrowserOSMetricsUploaderTest, PartialBatchWaitsForFlushInterval) {
++  auto uploader = CreateUploader();
++  EnqueueEvents(*uploader, 3);
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(0, pending_request_count());
++
++  task_environment_.FastForwardBy(BrowserOSMetricsUploader::kFlushInterval);
++  EXPECT_EQ(3, PendingBatchSize());
++
++  Respond(net::HTTP_OK);
++  EXPECT_FALSE(uploader->upload_in_flight());
++  EXPECT_EQ(0, pending_request_count());
++}
++
++// =============================================================================
++// Retry and Spool Tests
++// =============================================================================
++
++TEST_F(BrowserOSMetricsUploaderTest, ServerErrorSpoolsAndRetries) {
++  auto uploader = CreateUploader();
++  EnqueueEvents(*uploader, 5);
++  uploader->Flush();
++  EXPECT_EQ(5, PendingBatchSize());
++
++  Respond(net::HTTP_SERVICE_UNAVAILABLE);
++  EXPECT_EQ(1, SpoolFileCount());
++  EXPECT_EQ(0, pending_request_count());
++
++  // The spooled batch is resent once the backoff expires.
++  task_environment_.FastForwardBy(kFirstRetry);
++  EXPECT_EQ(5, PendingBatchSize());
++
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(0, SpoolFileCount());
++  EXPECT_EQ(0, pending_request_count());
++}
++
++TEST_F(BrowserOSMetricsUploaderTest, ClientErrorDropsBatch) {
++  auto uploader = CreateUploader();
++  EnqueueEvents(*uploader, 5);
++  uploader->Flush();
++  Respond(net::HTTP_BAD_REQUEST);
++
++  EXPECT_EQ(0, SpoolFileCount());
++  task_environment_.FastForwardBy(base::Minutes(5));
++  EXPECT_EQ(0, pending_request_count());
++}
++
++TEST_F(BrowserOSMetricsUploaderTest, FlushToDiskIsReplayedByNextUploader) {
++  auto uploader = CreateUploader();
++  EnqueueEvents(*uploader, 3);
++  uploader->FlushToDisk();
++  uploader.reset();
++  task_environment_.RunUntilIdle();
++  EXPECT_EQ(1, SpoolFileCount());
++
++  uploader = CreateUploader();
++  task_environment_.FastForwardBy(BrowserOSMetricsUploader::kFlushInterval);
++  EXPECT_EQ(3, PendingBatchSize());
++
++  Respond(net::HTTP_OK);
++  EXPECT_EQ(0, SpoolFileCount());
++}
++
++TEST_F(BrowserOSMetricsUploaderTest, SpoolIsBoundedBySize) {
++  // Every batch is larger than the budget, so only the newest survives.
++  auto uploader = CreateUploader(/*max_spool_bytes=*/16);
++  EnqueueEvents(*uploader,
++                3 * static_cast<int>(BrowserOSMetricsUploader::kMaxBatchEvents));
++  uploader->FlushToDisk();
++  task_environment_.RunUntilIdle();
++
++  EXPECT_EQ(1, SpoolFileCount());
++}
++
++}  // namespace
++}  // namespace browseros_metrics
@@ -0,0 +1,62 @@
+diff --git a/chrome/browser/browseros/page_content/click_points.cc b/chrome/browser/browseros/page_content/click_points.cc
+new file mode 100644
+index 0000000000000..6cd6a6b3366a7
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/click_points.cc
+@@ -0,0 +1,56 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/click_points.h"
++
++#include <iterator>
++
++namespace browseros {
++
++HitTestResult ClassifyHit(int32_t target_dom_node_id,
++                          const std::vector<int32_t>& hit_dom_node_ids) {
++  if (target_dom_node_id == 0 || hit_dom_node_ids.empty()) {
++    return HitTestResult::kUnknown;
++  }
++  for (int32_t dom_node_id : hit_dom_node_ids) {
++    if (dom_node_id == target_dom_node_id) {
++      return HitTestResult::kTarget;
++    }
++  }
++  return HitTestResult::kObscured;
++}
++
++std::optional<ClickPoint> ChooseClickPoint(
++    const gfx::PointF& center,
++    const gfx::RectF& bounds,
++    base::FunctionRef<HitTestResult(const gfx::PointF&)> hit_test) {
++  if (bounds.IsEmpty()) {
++    return ClickPoint{center};
++  }
++
++  const gfx::PointF candidates[] = {
++      center,
++      gfx::PointF(bounds.x() + bounds.width() * 0.25f,
++                  bounds.y() + bounds.height() * 0.25f),
++      gfx::PointF(bounds.x() + bounds.width() * 0.75f,
++                  bounds.y() + bounds.height() * 0.25f),
++      gfx::PointF(bounds.x() + bounds.width() * 0.25f,
++                  bounds.y() + bounds.height() * 0.75f),
++      gfx::PointF(bounds.x() + bounds.width() * 0.75f,
++                  bounds.y() + bounds.height() * 0.75f),
++  };
++  for (size_t i = 0; i < std::size(candidates); ++i) {
++    switch (hit_test(candidates[i])) {
++      case HitTestResult::kTarget:
++        return ClickPoint{candidates[i], /*shifted=*/i > 0};
++      case HitTestResult::kObscured:
++        break;
++      case HitTestResult::kUnknown:
++        return ClickPoint{center};
++    }
++  }
++  return std::nullopt;
++}
++
++}  // namespace browseros
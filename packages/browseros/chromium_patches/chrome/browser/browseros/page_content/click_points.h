@@ -0,0 +1,56 @@
+diff --git a/chrome/browser/browseros/page_content/click_points.h b/chrome/browser/browseros/page_content/click_points.h
+new file mode 100644
+index 0000000000000..6d9b6cbcc8cda
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/click_points.h
+@@ -0,0 +1,50 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_CLICK_POINTS_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_CLICK_POINTS_H_
++
++#include <cstdint>
++#include <optional>
++#include <vector>
++
++#include "base/functional/function_ref.h"
++#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace browseros {
++
++// What an AX hit test at a point resolved to, relative to a node.
++enum class HitTestResult {
++  kTarget,    // The node or one of its descendants.
++  kObscured,  // Some other element, e.g. an overlay or a sticky header.
++  kUnknown,   // No answer: renderer accessibility is off or it timed out.
++};
++
++// Classifies a hit against the node with |target_dom_node_id|.
++// |hit_dom_node_ids| holds the DOM node ids of the hit node and its
++// ancestors, innermost first (0 for nodes without one). Text and images
++// inside the target count as the target, since they receive the click on its
++// behalf. A target without a DOM node id cannot be recognized: kUnknown.
++HitTestResult ClassifyHit(int32_t target_dom_node_id,
++                          const std::vector<int32_t>& hit_dom_node_ids);
++
++// Where to click a node whose bounds are |bounds|.
++struct ClickPoint {
++  gfx::PointF point;
++  bool shifted = false;  // True if |point| is not |center|.
++};
++
++// Hit tests |center|, then the centers of the four quadrants of |bounds|,
++// and returns the first that reaches the node. Returns std::nullopt if every
++// candidate is covered. Once a hit test gives no answer the later ones will
++// not either, so the center is used, as it is for empty bounds.
++std::optional<ClickPoint> ChooseClickPoint(
++    const gfx::PointF& center,
++    const gfx::RectF& bounds,
++    base::FunctionRef<HitTestResult(const gfx::PointF&)> hit_test);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_CLICK_POINTS_H_
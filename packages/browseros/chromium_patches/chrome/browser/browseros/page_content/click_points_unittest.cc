@@ -0,0 +1,117 @@
+diff --git a/chrome/browser/browseros/page_content/click_points_unittest.cc b/chrome/browser/browseros/page_content/click_points_unittest.cc
+new file mode 100644
+index 0000000000000..6b04fdc2758ef
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/click_points_unittest.cc
+@@ -0,0 +1,111 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/click_points.h"
++
++#include <vector>
++
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++constexpr int32_t kTargetDomNodeId = 42;
++
++// A 100x40 button at (100, 100).
++const gfx::RectF kBounds(100, 100, 100, 40);
++const gfx::PointF kCenter(150, 120);
++
++// Hit tests a page where |cover| (if not empty) lies over the button.
++HitTestResult HitTest(const gfx::RectF& cover, const gfx::PointF& point) {
++  // Hit node chains, innermost first: the button's text inside the button
++  // inside the body, or an overlay inside the body.
++  const std::vector<int32_t> on_button = {0, kTargetDomNodeId, 1};
++  const std::vector<int32_t> on_overlay = {7, 1};
++  return ClassifyHit(kTargetDomNodeId,
++                     cover.Contains(point) ? on_overlay : on_button);
++}
++
++TEST(ClickPointsTest, ClassifyHit) {
++  EXPECT_EQ(HitTestResult::kTarget, ClassifyHit(42, {42, 1}));
++  EXPECT_EQ(HitTestResult::kTarget, ClassifyHit(42, {0, 42, 1}));
++  EXPECT_EQ(HitTestResult::kObscured, ClassifyHit(42, {7, 1}));
++  EXPECT_EQ(HitTestResult::kUnknown, ClassifyHit(42, {}));
++  // Without a DOM node id the target cannot be told apart from anything.
++  EXPECT_EQ(HitTestResult::kUnknown, ClassifyHit(0, {0, 1}));
++}
++
++TEST(ClickPointsTest, UncoveredCenterIsUsed) {
++  std::vector<gfx::PointF> tested;
++  std::optional<ClickPoint> choice =
++      ChooseClickPoint(kCenter, kBounds, [&](const gfx::PointF& point) {
++        tested.push_back(point);
++        return HitTest(gfx::RectF(), point);
++      });
++
++  ASSERT_TRUE(choice);
++  EXPECT_EQ(kCenter, choice->point);
++  EXPECT_FALSE(choice->shifted);
++  EXPECT_EQ(1u, tested.size());
++}
++
++TEST(ClickPointsTest, CoveredCenterShiftsToUncoveredQuadrant) {
++  // A sticky header covers the top half of the button, center included.
++  const gfx::RectF header(0, 0, 1000, 121);
++  std::optional<ClickPoint> choice =
++      ChooseClickPoint(kCenter, kBounds, [&](const gfx::PointF& point) {
++        return HitTest(header, point);
++      });
++
++  ASSERT_TRUE(choice);
++  EXPECT_TRUE(choice->shifted);
++  EXPECT_EQ(gfx::PointF(125, 130), choice->point);
++  EXPECT_TRUE(kBounds.Contains(choice->point));
++  EXPECT_FALSE(header.Contains(choice->point));
++}
++
++TEST(ClickPointsTest, FullyCoveredNodeHasNoClickPoint) {
++  const gfx::RectF modal(0, 0, 1000, 1000);
++  int hit_tests = 0;
++  std::optional<ClickPoint> choice =
++      ChooseClickPoint(kCenter, kBounds, [&](const gfx::PointF& point) {
++        ++hit_tests;
++        return HitTest(modal, point);
++      });
++
++  EXPECT_FALSE(choice);
++  EXPECT_EQ(5, hit_tests);
++}
++
++TEST(ClickPointsTest, NoHitTestAnswerFallsBackToCenter) {
++  const gfx::RectF header(0, 0, 1000, 121);
++  int hit_tests = 0;
++  std::optional<ClickPoint> choice =
++      ChooseClickPoint(kCenter, kBounds, [&](const gfx::PointF& point) {
++        // The center is covered, then accessibility goes away.
++        return ++hit_tests == 1 ? HitTest(header, point)
++                                : HitTestResult::kUnknown;
++      });
++
++  ASSERT_TRUE(choice);
++  EXPECT_EQ(kCenter, choice->point);
++  EXPECT_FALSE(choice->shifted);
++  EXPECT_EQ(2, hit_tests);
++}
++
++TEST(ClickPointsTest, EmptyBoundsUseCenterWithoutHitTesting) {
++  bool hit_tested = false;
++  std::optional<ClickPoint> choice = ChooseClickPoint(
++      kCenter, gfx::RectF(100, 100, 0, 0), [&](const gfx::PointF&) {
++        hit_tested = true;
++        return HitTestResult::kObscured;
++      });
++
++  ASSERT_TRUE(choice);
++  EXPECT_EQ(kCenter, choice->point);
++  EXPECT_FALSE(hit_tested);
++}
++
++}  // namespace
++}  // namespace browseros
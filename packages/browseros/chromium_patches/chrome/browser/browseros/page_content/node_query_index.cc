@@ -0,0 +1,170 @@
+diff --git a/chrome/browser/browseros/page_content/node_query_index.cc b/chrome/browser/browseros/page_content/node_query_index.cc
+new file mode 100644
+index 0000000000000..faed7844f7754
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/node_query_index.cc
+@@ -0,0 +1,164 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/node_query_index.h"
++
++#include <memory>
++#include <utility>
++
++#include "base/strings/string_util.h"
++#include "third_party/re2/src/re2/re2.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr size_t kTrigramSize = 3;
++
++// Packs the |kTrigramSize| bytes of |text| at |pos| into a key.
++uint32_t TrigramAt(const std::string& text, size_t pos) {
++  return static_cast<uint8_t>(text[pos]) << 16 |
++         static_cast<uint8_t>(text[pos + 1]) << 8 |
++         static_cast<uint8_t>(text[pos + 2]);
++}
++
++}  // namespace
++
++QueryableNode::QueryableNode() = default;
++QueryableNode::~QueryableNode() = default;
++QueryableNode::QueryableNode(const QueryableNode&) = default;
++QueryableNode& QueryableNode::operator=(const QueryableNode&) = default;
++QueryableNode::QueryableNode(QueryableNode&&) = default;
++QueryableNode& QueryableNode::operator=(QueryableNode&&) = default;
++
++NodeQuery::NodeQuery() = default;
++NodeQuery::~NodeQuery() = default;
++NodeQuery::NodeQuery(const NodeQuery&) = default;
++NodeQuery& NodeQuery::operator=(const NodeQuery&) = default;
++
++NodeQueryIndex::NodeQueryIndex(std::vector<QueryableNode> nodes) {
++  entries_.reserve(nodes.size());
++  for (QueryableNode& node : nodes) {
++    const uint32_t index = static_cast<uint32_t>(entries_.size());
++    Entry& entry = entries_.emplace_back();
++    entry.folded_name = base::ToLowerASCII(node.name);
++    auto context = node.attributes.find("context");
++    if (context != node.attributes.end()) {
++      entry.folded_context = base::ToLowerASCII(context->second);
++    }
++    entry.node = std::move(node);
++
++    by_role_[entry.node.role].push_back(index);
++    const std::string& name = entry.folded_name;
++    for (size_t i = 0; i + kTrigramSize <= name.size(); ++i) {
++      std::vector<uint32_t>& postings = by_name_trigram_[TrigramAt(name, i)];
++      // A name repeating a trigram lists the node once.
++      if (postings.empty() || postings.back() != index) {
++        postings.push_back(index);
++      }
++    }
++  }
++}
++
++NodeQueryIndex::~NodeQueryIndex() = default;
++
++// static
++bool NodeQueryIndex::Validate(const NodeQuery& query, std::string* error) {
++  if (query.name_pattern.empty()) {
++    return true;
++  }
++  re2::RE2 pattern(query.name_pattern, re2::RE2::Quiet);
++  if (!pattern.ok()) {
++    *error = "Invalid name pattern: " + pattern.error();
++    return false;
++  }
++  return true;
++}
++
++bool NodeQueryIndex::Find(const NodeQuery& query,
++                          std::vector<const QueryableNode*>* results,
++                          std::string* error) const {
++  results->clear();
++
++  if (!Validate(query, error)) {
++    return false;
++  }
++  std::unique_ptr<re2::RE2> pattern;
++  if (!query.name_pattern.empty()) {
++    pattern =
++        std::make_unique<re2::RE2>(query.name_pattern, re2::RE2::Quiet);
++  }
++  const std::string name_needle = base::ToLowerASCII(query.name_contains);
++  const std::string near_needle = base::ToLowerASCII(query.near_text);
++
++  // Start from the smallest posting list the query allows. A missing list
++  // means nothing can match.
++  const std::vector<uint32_t>* candidates = nullptr;
++  if (!query.role.empty()) {
++    auto it = by_role_.find(query.role);
++    if (it == by_role_.end()) {
++      return true;
++    }
++    candidates = &it->second;
++  }
++  for (size_t i = 0; i + kTrigramSize <= name_needle.size(); ++i) {
++    auto it = by_name_trigram_.find(TrigramAt(name_needle, i));
++    if (it == by_name_trigram_.end()) {
++      return true;
++    }
++    if (!candidates || it->second.size() < candidates->size()) {
++      candidates = &it->second;
++    }
++  }
++
++  auto matches = [&](const Entry& entry) {
++    const QueryableNode& node = entry.node;
++    if (!query.role.empty() && node.role != query.role) {
++      return false;
++    }
++    if (query.in_viewport && node.in_viewport != *query.in_viewport) {
++      return false;
++    }
++    if (!name_needle.empty() &&
++        entry.folded_name.find(name_needle) == std::string::npos) {
++      return false;
++    }
++    if (!near_needle.empty() &&
++        entry.folded_name.find(near_needle) == std::string::npos &&
++        entry.folded_context.find(near_needle) == std::string::npos) {
++      return false;
++    }
++    for (const auto& [key, value] : query.attributes) {
++      auto it = node.attributes.find(key);
++      if (it == node.attributes.end() || it->second != value) {
++        return false;
++      }
++    }
++    return !pattern || re2::RE2::PartialMatch(node.name, *pattern);
++  };
++
++  auto consider = [&](uint32_t index) {
++    if (matches(entries_[index])) {
++      results->push_back(&entries_[index].node);
++    }
++    return query.max_results == 0 || results->size() < query.max_results;
++  };
++
++  if (candidates) {
++    for (uint32_t index : *candidates) {
++      if (!consider(index)) {
++        break;
++      }
++    }
++  } else {
++    for (uint32_t index = 0; index < entries_.size(); ++index) {
++      if (!consider(index)) {
++        break;
++      }
++    }
++  }
++  return true;
++}
++
++}  // namespace browseros
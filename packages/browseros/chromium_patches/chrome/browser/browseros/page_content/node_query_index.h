@@ -0,0 +1,104 @@
+diff --git a/chrome/browser/browseros/page_content/node_query_index.h b/chrome/browser/browseros/page_content/node_query_index.h
+new file mode 100644
+index 0000000000000..d42aba250448a
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/node_query_index.h
+@@ -0,0 +1,98 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_NODE_QUERY_INDEX_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_NODE_QUERY_INDEX_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace browseros {
++
++// One interactive element of a snapshot, as the query index sees it.
++struct QueryableNode {
++  QueryableNode();
++  ~QueryableNode();
++  QueryableNode(const QueryableNode&);
++  QueryableNode& operator=(const QueryableNode&);
++  QueryableNode(QueryableNode&&);
++  QueryableNode& operator=(QueryableNode&&);
++
++  uint32_t node_id = 0;
++  std::string role;  // ui::ToString() of the AX role, e.g. "button".
++  std::string name;
++  std::unordered_map<std::string, std::string> attributes;
++  gfx::RectF bounds;
++  bool in_viewport = false;
++};
++
++// Conditions a node must all meet; empty fields match anything.
++struct NodeQuery {
++  NodeQuery();
++  ~NodeQuery();
++  NodeQuery(const NodeQuery&);
++  NodeQuery& operator=(const NodeQuery&);
++
++  std::string role;                // Exact role.
++  std::string name_contains;       // ASCII case-insensitive substring.
++  std::string name_pattern;        // RE2, matched anywhere in the name.
++  std::vector<std::pair<std::string, std::string>> attributes;  // Equality.
++  std::optional<bool> in_viewport;
++  // ASCII case-insensitive substring of the name or the "context"
++  // attribute, i.e. text the element is labelled by or sits next to.
++  std::string near_text;
++  size_t max_results = 0;  // 0 for no limit.
++};
++
++// Answers NodeQuery lookups over one snapshot's interactive elements without
++// sending the snapshot to the caller. Built once per snapshot:
++//   - role index: node positions per role.
++//   - name index: node positions per trigram of the lowercased name, so a
++//     name substring only has to be checked against nodes containing its
++//     rarest trigram.
++// A query starts from the smallest posting list that applies and checks the
++// remaining conditions on those candidates only. Results are in index order.
++//
++// Immutable once built.
++class NodeQueryIndex {
++ public:
++  explicit NodeQueryIndex(std::vector<QueryableNode> nodes);
++  ~NodeQueryIndex();
++
++  NodeQueryIndex(const NodeQueryIndex&) = delete;
++  NodeQueryIndex& operator=(const NodeQueryIndex&) = delete;
++
++  size_t size() const { return entries_.size(); }
++
++  // Returns false with |error| set if |query| can never be run.
++  static bool Validate(const NodeQuery& query, std::string* error);
++
++  // Fills |results| with the matching nodes. Returns false with |error| set
++  // if the query is invalid.
++  bool Find(const NodeQuery& query,
++            std::vector<const QueryableNode*>* results,
++            std::string* error) const;
++
++ private:
++  struct Entry {
++    QueryableNode node;
++    std::string folded_name;     // Lowercased name.
++    std::string folded_context;  // Lowercased "context" attribute.
++  };
++
++  std::vector<Entry> entries_;
++  std::unordered_map<std::string, std::vector<uint32_t>> by_role_;
++  std::unordered_map<uint32_t, std::vector<uint32_t>> by_name_trigram_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_NODE_QUERY_INDEX_H_
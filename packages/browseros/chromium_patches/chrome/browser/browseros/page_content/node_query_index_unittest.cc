@@ -0,0 +1,128 @@
+diff --git a/chrome/browser/browseros/page_content/node_query_index_unittest.cc b/chrome/browser/browseros/page_content/node_query_index_unittest.cc
+new file mode 100644
+index 0000000000000..9a018989ba2b4
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/node_query_index_unittest.cc
+@@ -0,0 +1,122 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/node_query_index.h"
++
++#include <memory>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++QueryableNode MakeNode(uint32_t node_id,
++                       const std::string& role,
++                       const std::string& name,
++                       bool in_viewport = true) {
++  QueryableNode node;
++  node.node_id = node_id;
++  node.role = role;
++  node.name = name;
++  node.in_viewport = in_viewport;
++  node.bounds = gfx::RectF(0, node_id * 10, 100, 10);
++  return node;
++}
++
++class NodeQueryIndexTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    std::vector<QueryableNode> nodes;
++    nodes.push_back(MakeNode(1, "textField", "Email"));
++    nodes.back().attributes["input-type"] = "email";
++    nodes.back().attributes["context"] = "Sign in to your account";
++    nodes.push_back(MakeNode(2, "textField", "Password"));
++    nodes.back().attributes["input-type"] = "password";
++    nodes.push_back(MakeNode(3, "button", "Submit"));
++    nodes.back().attributes["context"] = "Sign in to your account";
++    nodes.push_back(MakeNode(4, "link", "Forgot password?"));
++    nodes.push_back(MakeNode(5, "button", "Submit feedback",
++                             /*in_viewport=*/false));
++    index_ = std::make_unique<NodeQueryIndex>(std::move(nodes));
++  }
++
++  // Node ids matching |query|, in result order.
++  std::vector<uint32_t> Find(const NodeQuery& query) {
++    std::vector<const QueryableNode*> results;
++    std::string error;
++    EXPECT_TRUE(index_->Find(query, &results, &error)) << error;
++    std::vector<uint32_t> ids;
++    for (const QueryableNode* node : results) {
++      ids.push_back(node->node_id);
++    }
++    return ids;
++  }
++
++  std::unique_ptr<NodeQueryIndex> index_;
++};
++
++TEST_F(NodeQueryIndexTest, EmptyQueryMatchesAll) {
++  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5}), Find(NodeQuery()));
++}
++
++TEST_F(NodeQueryIndexTest, RoleAndName) {
++  NodeQuery query;
++  query.role = "button";
++  EXPECT_EQ((std::vector<uint32_t>{3, 5}), Find(query));
++
++  query.name_contains = "FEEDBACK";
++  EXPECT_EQ((std::vector<uint32_t>{5}), Find(query));
++
++  query.role = "checkBox";
++  EXPECT_TRUE(Find(query).empty());
++}
++
++TEST_F(NodeQueryIndexTest, ShortAndUnindexedNames) {
++  NodeQuery query;
++  // Too short for the trigram index; checked against every node.
++  query.name_contains = "pa";
++  EXPECT_EQ((std::vector<uint32_t>{2, 4}), Find(query));
++
++  query.name_contains = "xyz";
++  EXPECT_TRUE(Find(query).empty());
++}
++
++TEST_F(NodeQueryIndexTest, NamePattern) {
++  NodeQuery query;
++  query.name_pattern = "^Submit$";
++  EXPECT_EQ((std::vector<uint32_t>{3}), Find(query));
++
++  query.name_pattern = "(";
++  std::vector<const QueryableNode*> results;
++  std::string error;
++  EXPECT_FALSE(index_->Find(query, &results, &error));
++  EXPECT_FALSE(error.empty());
++  EXPECT_FALSE(NodeQueryIndex::Validate(query, &error));
++}
++
++TEST_F(NodeQueryIndexTest, AttributesViewportAndNearText) {
++  NodeQuery query;
++  query.attributes.emplace_back("input-type", "password");
++  EXPECT_EQ((std::vector<uint32_t>{2}), Find(query));
++
++  query = NodeQuery();
++  query.in_viewport = false;
++  EXPECT_EQ((std::vector<uint32_t>{5}), Find(query));
++
++  query = NodeQuery();
++  query.near_text = "sign in";
++  EXPECT_EQ((std::vector<uint32_t>{1, 3}), Find(query));
++}
++
++TEST_F(NodeQueryIndexTest, MaxResults) {
++  NodeQuery query;
++  query.max_results = 2;
++  EXPECT_EQ((std::vector<uint32_t>{1, 2}), Find(query));
++}
++
++}  // namespace
++}  // namespace browseros
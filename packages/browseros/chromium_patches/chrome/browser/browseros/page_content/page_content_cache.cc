@@ -0,0 +1,266 @@
+diff --git a/chrome/browser/browseros/page_content/page_content_cache.cc b/chrome/browser/browseros/page_content/page_content_cache.cc
+new file mode 100644
+index 0000000000000..ca8954d8f8898
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_content_cache.cc
+@@ -0,0 +1,260 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/ref_counted.h"
++#include "base/task/sequenced_task_runner.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "ui/accessibility/ax_node_id_forward.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace browseros {
++
++namespace {
++
++// Enough for node updates to reach AccessibilityEventReceived().
++constexpr ui::AXMode kCacheAXMode(ui::AXMode::kWebContents);
++
++}  // namespace
++
++PageContentCache::Entry::Entry() = default;
++PageContentCache::Entry::~Entry() = default;
++PageContentCache::Entry::Entry(Entry&&) = default;
++PageContentCache::Entry& PageContentCache::Entry::operator=(Entry&&) = default;
++
++PageContentCache::PendingSnapshot::PendingSnapshot() = default;
++PageContentCache::PendingSnapshot::~PendingSnapshot() = default;
++PageContentCache::PendingSnapshot::PendingSnapshot(PendingSnapshot&&) =
++    default;
++PageContentCache::PendingSnapshot& PageContentCache::PendingSnapshot::operator=(
++    PendingSnapshot&&) = default;
++
++PageContentCache::PageContentCache(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<PageContentCache>(*web_contents) {}
++
++PageContentCache::~PageContentCache() = default;
++
++// static
++void PageContentCache::GetIndex(
++    content::WebContents* web_contents,
++    ui::AXMode mode,
++    content::WebContents::AXTreeSnapshotPolicy policy,
++    base::TimeDelta timeout,
++    IndexCallback callback) {
++  CreateForWebContents(web_contents);
++  FromWebContents(web_contents)
++      ->Get(mode, policy, timeout, std::move(callback));
++}
++
++// static
++void PageContentCache::Invalidate(content::WebContents* web_contents) {
++  if (!web_contents) {
++    return;
++  }
++  if (PageContentCache* cache = FromWebContents(web_contents)) {
++    cache->BumpDocumentVersion();
++  }
++}
++
++// static
++void PageContentCache::SetSnapshotRequesterForTesting(
++    content::WebContents* web_contents,
++    SnapshotRequester requester) {
++  CreateForWebContents(web_contents);
++  FromWebContents(web_contents)->snapshot_requester_for_testing_ =
++      std::move(requester);
++}
++
++PageContentCache::Key PageContentCache::MakeKey(
++    ui::AXMode mode,
++    content::WebContents::AXTreeSnapshotPolicy policy) const {
++  Key key;
++  key.tree_id = web_contents()->GetPrimaryMainFrame()->GetAXTreeID();
++  key.document_version = document_version_;
++  key.mode = mode;
++  key.policy = policy;
++  return key;
++}
++
++void PageContentCache::KeepAccessibilityOn() {
++  if (!accessibility_mode_) {
++    accessibility_mode_ =
++        content::BrowserAccessibilityState::GetInstance()
++            ->CreateScopedModeForWebContents(web_contents(), kCacheAXMode);
++  }
++  // Any entry served before this fires was created before it started.
++  accessibility_release_timer_.Start(FROM_HERE, kMaxEntryAge, this,
++                                     &PageContentCache::ReleaseAccessibility);
++}
++
++void PageContentCache::ReleaseAccessibility() {
++  if (!pending_.empty()) {
++    // A snapshot still in flight may yet be stored as an entry.
++    accessibility_release_timer_.Start(
++        FROM_HERE, kMaxEntryAge, this, &PageContentCache::ReleaseAccessibility);
++    return;
++  }
++  // Nothing reports changes once the mode is gone.
++  entries_.clear();
++  accessibility_mode_.reset();
++}
++
++void PageContentCache::Get(ui::AXMode mode,
++                           content::WebContents::AXTreeSnapshotPolicy policy,
++                           base::TimeDelta timeout,
++                           IndexCallback callback) {
++  Key key = MakeKey(mode, policy);
++  KeepAccessibilityOn();
++
++  base::TimeTicks now = base::TimeTicks::Now();
++  std::erase_if(entries_, [now](const Entry& entry) {
++    return now - entry.created > kMaxEntryAge;
++  });
++  for (const Entry& entry : entries_) {
++    if (entry.key == key) {
++      VLOG(1) << "browseros: Page content served from cache ("
++              << entry.index->node_count() << " nodes)";
++      // Keep the callback asynchronous, as it is on a miss.
++      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++          FROM_HERE, base::BindOnce(std::move(callback), entry.index));
++      return;
++    }
++  }
++
++  for (PendingSnapshot& pending : pending_) {
++    if (pending.key == key) {
++      pending.callbacks.push_back(std::move(callback));
++      return;
++    }
++  }
++
++  PendingSnapshot& pending = pending_.emplace_back();
++  pending.key = key;
++  pending.callbacks.push_back(std::move(callback));
++
++  auto on_snapshot = base::BindOnce(&PageContentCache::OnSnapshot,
++                                    weak_factory_.GetWeakPtr(), key);
++  if (snapshot_requester_for_testing_) {
++    snapshot_requester_for_testing_.Run(mode, policy, timeout,
++                                        std::move(on_snapshot));
++    return;
++  }
++  web_contents()->RequestAXTreeSnapshot(std::move(on_snapshot), mode,
++                                        /*max_nodes=*/0, timeout, policy);
++}
++
++void PageContentCache::OnSnapshot(Key key, ui::AXTreeUpdate& update) {
++  auto pending = std::find_if(
++      pending_.begin(), pending_.end(),
++      [&key](const PendingSnapshot& item) { return item.key == key; });
++  if (pending == pending_.end()) {
++    return;
++  }
++  std::vector<IndexCallback> callbacks = std::move(pending->callbacks);
++  pending_.erase(pending);
++
++  auto index = base::MakeRefCounted<PageTextIndex>(update);
++
++  // Only keep the snapshot if the document did not change while it was
++  // taken; the callers still get it either way.
++  if (!index->empty() && MakeKey(key.mode, key.policy) == key) {
++    std::erase_if(entries_, [&key](const Entry& entry) {
++      return entry.key.mode == key.mode && entry.key.policy == key.policy;
++    });
++    Entry& entry = entries_.emplace_back();
++    entry.key = key;
++    entry.created = base::TimeTicks::Now();
++    entry.index = index;
++  }
++
++  for (IndexCallback& callback : callbacks) {
++    std::move(callback).Run(index);
++  }
++}
++
++void PageContentCache::BumpDocumentVersion() {
++  ++document_version_;
++  entries_.clear();
++}
++
++void PageContentCache::PrimaryPageChanged(content::Page& page) {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (navigation_handle->HasCommitted()) {
++    BumpDocumentVersion();
++  }
++}
++
++void PageContentCache::DOMContentLoaded(
++    content::RenderFrameHost* render_frame_host) {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::DocumentOnLoadCompletedInPrimaryMainFrame() {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::TitleWasSet(content::NavigationEntry* entry) {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::DidGetUserInteraction(
++    const blink::WebInputEvent& event) {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  // Events alone and tree-data-only updates (focus, selection) leave the
++  // text as it was.
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    if (!update.nodes.empty() ||
++        update.node_id_to_clear != ui::kInvalidAXNodeID) {
++      BumpDocumentVersion();
++      return;
++    }
++  }
++}
++
++void PageContentCache::PrimaryMainFrameRenderProcessGone(
++    base::TerminationStatus status) {
++  BumpDocumentVersion();
++}
++
++void PageContentCache::WebContentsDestroyed() {
++  accessibility_release_timer_.Stop();
++  accessibility_mode_.reset();
++
++  // The snapshot replies are bound to a weak pointer, so without this the
++  // callers would never hear back.
++  if (pending_.empty()) {
++    return;
++  }
++  auto empty = base::MakeRefCounted<PageTextIndex>(ui::AXTreeUpdate());
++  for (PendingSnapshot& pending : pending_) {
++    for (IndexCallback& callback : pending.callbacks) {
++      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++          FROM_HERE, base::BindOnce(std::move(callback), empty));
++    }
++  }
++  pending_.clear();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(PageContentCache);
++
++}  // namespace browseros
@@ -0,0 +1,175 @@
+diff --git a/chrome/browser/browseros/page_content/page_content_cache.h b/chrome/browser/browseros/page_content/page_content_cache.h
+new file mode 100644
+index 0000000000000..f2f6a068d3b5d
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_content_cache.h
+@@ -0,0 +1,169 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_CONTENT_CACHE_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_CONTENT_CACHE_H_
++
++#include <cstdint>
++#include <memory>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/browseros/page_content/page_text_index.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++}  // namespace content
++
++namespace browseros {
++
++// Per-tab cache of PageTextIndex built from accessibility snapshots, shared
++// by every page-content consumer (getSnapshot, LLM chat and Clash of GPTs
++// "copy page").
++//
++// Entries are keyed on the main frame's AX tree id, a document version and
++// the snapshot mode/policy. The document version is bumped on navigation,
++// load, title change, user input and accessibility updates that change
++// nodes, and on explicit Invalidate() after automation actions. Entries also
++// expire after a few seconds as a backstop.
++//
++// Accessibility updates only reach the browser while renderer accessibility
++// is on for the tab, so the cache holds that mode on while it is in use and
++// drops it once every entry has expired. Turning the mode on resends the
++// whole tree, so the first snapshot after that is usually not kept.
++//
++// Accessibility updates are a coarse signal: an update reserializes a node
++// without saying which attributes changed, so a focus ring or a checked
++// state costs a fresh snapshot just like new text does. Updates that only
++// carry tree data (focus and selection) and bare events do not bump the
++// version, and location changes arrive on a separate path.
++//
++// Concurrent requests for the same key share one snapshot. Requests still
++// pending when the tab closes get an empty index.
++class PageContentCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<PageContentCache> {
++ public:
++  using IndexCallback =
++      base::OnceCallback<void(scoped_refptr<const PageTextIndex>)>;
++
++  // How long an entry may be served without any change notification.
++  static constexpr base::TimeDelta kMaxEntryAge = base::Seconds(10);
++
++  ~PageContentCache() override;
++
++  PageContentCache(const PageContentCache&) = delete;
++  PageContentCache& operator=(const PageContentCache&) = delete;
++
++  // Runs |callback| with the index for the current document of
++  // |web_contents|, from cache when possible and otherwise from a fresh
++  // snapshot. The index is empty if the snapshot failed or timed out.
++  static void GetIndex(content::WebContents* web_contents,
++                       ui::AXMode mode,
++                       content::WebContents::AXTreeSnapshotPolicy policy,
++                       base::TimeDelta timeout,
++                       IndexCallback callback);
++
++  // Drops cached content for |web_contents|, e.g. after input was injected.
++  static void Invalidate(content::WebContents* web_contents);
++
++  // Takes the snapshot on a miss, in place of
++  // WebContents::RequestAXTreeSnapshot().
++  using SnapshotRequester = base::RepeatingCallback<void(
++      ui::AXMode mode,
++      content::WebContents::AXTreeSnapshotPolicy policy,
++      base::TimeDelta timeout,
++      content::WebContents::AXTreeSnapshotCallback callback)>;
++  static void SetSnapshotRequesterForTesting(
++      content::WebContents* web_contents,
++      SnapshotRequester requester);
++
++ private:
++  friend class content::WebContentsUserData<PageContentCache>;
++
++  struct Key {
++    ui::AXTreeID tree_id;
++    uint64_t document_version = 0;
++    ui::AXMode mode;
++    content::WebContents::AXTreeSnapshotPolicy policy;
++
++    bool operator==(const Key& other) const = default;
++  };
++
++  struct Entry {
++    Entry();
++    ~Entry();
++    Entry(Entry&&);
++    Entry& operator=(Entry&&);
++
++    Key key;
++    base::TimeTicks created;
++    scoped_refptr<const PageTextIndex> index;
++  };
++
++  struct PendingSnapshot {
++    PendingSnapshot();
++    ~PendingSnapshot();
++    PendingSnapshot(PendingSnapshot&&);
++    PendingSnapshot& operator=(PendingSnapshot&&);
++
++    Key key;
++    std::vector<IndexCallback> callbacks;
++  };
++
++  explicit PageContentCache(content::WebContents* web_contents);
++
++  Key MakeKey(ui::AXMode mode,
++              content::WebContents::AXTreeSnapshotPolicy policy) const;
++  // Keeps accessibility updates flowing to AccessibilityEventReceived() for
++  // as long as an entry could still be served.
++  void KeepAccessibilityOn();
++  void ReleaseAccessibility();
++  void Get(ui::AXMode mode,
++           content::WebContents::AXTreeSnapshotPolicy policy,
++           base::TimeDelta timeout,
++           IndexCallback callback);
++  void OnSnapshot(Key key, ui::AXTreeUpdate& update);
++  void BumpDocumentVersion();
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DOMContentLoaded(content::RenderFrameHost* render_frame_host) override;
++  void DocumentOnLoadCompletedInPrimaryMainFrame() override;
++  void TitleWasSet(content::NavigationEntry* entry) override;
++  void DidGetUserInteraction(const blink::WebInputEvent& event) override;
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void PrimaryMainFrameRenderProcessGone(
++      base::TerminationStatus status) override;
++  void WebContentsDestroyed() override;
++
++  uint64_t document_version_ = 0;
++  std::vector<Entry> entries_;
++  std::vector<PendingSnapshot> pending_;
++
++  std::unique_ptr<content::ScopedAccessibilityMode> accessibility_mode_;
++  base::OneShotTimer accessibility_release_timer_;
++
++  SnapshotRequester snapshot_requester_for_testing_;
++
++  base::WeakPtrFactory<PageContentCache> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_CONTENT_CACHE_H_
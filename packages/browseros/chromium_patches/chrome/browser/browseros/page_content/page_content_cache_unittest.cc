@@ -0,0 +1,102 @@
+diff --git a/chrome/browser/browseros/page_content/page_content_cache_unittest.cc b/chrome/browser/browseros/page_content/page_content_cache_unittest.cc
+new file mode 100644
+index 0000000000000..7f60c93a361c3
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_content_cache_unittest.cc
+@@ -0,0 +1,96 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/test/test_future.h"
++#include "base/time/time.h"
++#include "chrome/browser/browseros/page_content/page_text_index.h"
++#include "content/public/test/test_renderer_host.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "url/gurl.h"
++
++namespace browseros {
++namespace {
++
++constexpr ui::AXMode kMode(ui::AXMode::kWebContents);
++constexpr auto kPolicy = content::WebContents::AXTreeSnapshotPolicy::kAll;
++
++// Serves a fixed page from the stand-in snapshot requester and counts how
++// often a snapshot was actually taken.
++class PageContentCacheTest : public content::RenderViewHostTestHarness {
++ protected:
++  void SetUp() override {
++    content::RenderViewHostTestHarness::SetUp();
++    NavigateAndCommit(GURL("https://example.com/"));
++    PageContentCache::SetSnapshotRequesterForTesting(
++        web_contents(),
++        base::BindRepeating(&PageContentCacheTest::TakeSnapshot,
++                            base::Unretained(this)));
++  }
++
++  void TakeSnapshot(ui::AXMode mode,
++                    content::WebContents::AXTreeSnapshotPolicy policy,
++                    base::TimeDelta timeout,
++                    content::WebContents::AXTreeSnapshotCallback callback) {
++    ++snapshot_count_;
++    ui::AXNodeData root;
++    root.id = 1;
++    root.role = ax::mojom::Role::kRootWebArea;
++    root.child_ids = {2};
++    ui::AXNodeData heading;
++    heading.id = 2;
++    heading.role = ax::mojom::Role::kHeading;
++    heading.SetName("Title");
++
++    ui::AXTreeUpdate update;
++    update.root_id = root.id;
++    update.nodes = {root, heading};
++    std::move(callback).Run(update);
++  }
++
++  scoped_refptr<const PageTextIndex> GetIndex() {
++    base::test::TestFuture<scoped_refptr<const PageTextIndex>> future;
++    PageContentCache::GetIndex(web_contents(), kMode, kPolicy,
++                               base::Seconds(5), future.GetCallback());
++    return future.Take();
++  }
++
++  int snapshot_count_ = 0;
++};
++
++TEST_F(PageContentCacheTest, SecondGetOnUnchangedPageIsCacheHit) {
++  scoped_refptr<const PageTextIndex> first = GetIndex();
++  ASSERT_FALSE(first->empty());
++  EXPECT_EQ(1, snapshot_count_);
++
++  scoped_refptr<const PageTextIndex> second = GetIndex();
++  EXPECT_EQ(1, snapshot_count_);
++  EXPECT_EQ(first, second);
++}
++
++TEST_F(PageContentCacheTest, InvalidateTakesFreshSnapshot) {
++  GetIndex();
++  PageContentCache::Invalidate(web_contents());
++  GetIndex();
++  EXPECT_EQ(2, snapshot_count_);
++}
++
++TEST_F(PageContentCacheTest, NavigationTakesFreshSnapshot) {
++  GetIndex();
++  NavigateAndCommit(GURL("https://example.com/next"));
++  GetIndex();
++  EXPECT_EQ(2, snapshot_count_);
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,440 @@
+diff --git a/chrome/browser/browseros/page_content/page_text_index.cc b/chrome/browser/browseros/page_content/page_text_index.cc
+new file mode 100644
+index 0000000000000..e486a68c163cf
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_text_index.cc
+@@ -0,0 +1,434 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/page_text_index.h"
++
++#include <algorithm>
++#include <unordered_map>
++
++#include "base/strings/string_util.h"
++#include "base/strings/utf_string_conversions.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_role_properties.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++
++PageContentItem::PageContentItem() = default;
++PageContentItem::~PageContentItem() = default;
++PageContentItem::PageContentItem(const PageContentItem&) = default;
++PageContentItem& PageContentItem::operator=(const PageContentItem&) = default;
++PageContentItem::PageContentItem(PageContentItem&&) = default;
++PageContentItem& PageContentItem::operator=(PageContentItem&&) = default;
++
++namespace {
++
++// What a visitor wants done with the node it just entered.
++struct Descend {
++  bool children = false;
++  int child_depth = 0;
++  bool exit = false;
++};
++
++// Separates a block from preceding content with a blank line.
++void StartBlock(std::u16string& output) {
++  if (!output.empty() && output.back() != u'\n') {
++    output += u"\n\n";
++  }
++}
++
++void AppendWithSpace(std::u16string& output, const std::u16string& text) {
++  if (!output.empty() && output.back() != u' ' && output.back() != u'\n' &&
++      output.back() != u'\t') {
++    output += u" ";
++  }
++  output += text;
++}
++
++// Collapses runs of spaces into one.
++void CollapseSpaces(std::u16string& text) {
++  size_t pos = 0;
++  while ((pos = text.find(u"  ", pos)) != std::u16string::npos) {
++    text.replace(pos, 2, u" ");
++  }
++}
++
++// Trims and collapses whitespace runs into single spaces.
++std::string CleanText(const std::string& text) {
++  std::string_view trimmed = base::TrimWhitespaceASCII(text, base::TRIM_ALL);
++  std::string result;
++  result.reserve(trimmed.size());
++  bool prev_space = false;
++  for (char c : trimmed) {
++    if (base::IsAsciiWhitespace(c)) {
++      if (!prev_space) {
++        result += ' ';
++        prev_space = true;
++      }
++    } else {
++      result += c;
++      prev_space = false;
++    }
++  }
++  return result;
++}
++
++// Landmarks and controls whose own labels are noise in pasted page text.
++bool IsChromeRole(ax::mojom::Role role) {
++  switch (role) {
++    case ax::mojom::Role::kButton:
++    case ax::mojom::Role::kNavigation:
++    case ax::mojom::Role::kBanner:
++    case ax::mojom::Role::kComplementary:
++    case ax::mojom::Role::kContentInfo:
++    case ax::mojom::Role::kForm:
++    case ax::mojom::Role::kSearch:
++    case ax::mojom::Role::kMenu:
++    case ax::mojom::Role::kMenuBar:
++    case ax::mojom::Role::kMenuItem:
++    case ax::mojom::Role::kToolbar:
++      return true;
++    default:
++      return false;
++  }
++}
++
++bool IsPlainTextBlock(ax::mojom::Role role) {
++  switch (role) {
++    case ax::mojom::Role::kParagraph:
++    case ax::mojom::Role::kHeading:
++    case ax::mojom::Role::kListItem:
++    case ax::mojom::Role::kBlockquote:
++    case ax::mojom::Role::kArticle:
++    case ax::mojom::Role::kSection:
++      return true;
++    default:
++      return false;
++  }
++}
++
++}  // namespace
++
++PageTextIndex::PageTextIndex(const ui::AXTreeUpdate& update) {
++  if (update.nodes.empty()) {
++    return;
++  }
++
++  std::unordered_map<int32_t, uint32_t> index_of;
++  index_of.reserve(update.nodes.size());
++  nodes_.reserve(update.nodes.size());
++  for (const ui::AXNodeData& data : update.nodes) {
++    if (!index_of.emplace(data.id, static_cast<uint32_t>(nodes_.size()))
++             .second) {
++      continue;  // Duplicate id; keep the first.
++    }
++
++    Node& node = nodes_.emplace_back();
++    node.role = data.role;
++    node.ignored = data.IsIgnored();
++    node.invisible_or_ignored = data.IsInvisibleOrIgnored();
++    node.level =
++        data.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
++    node.text = data.GetStringAttribute(ax::mojom::StringAttribute::kName);
++    if (node.text.empty()) {
++      node.text = data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++    }
++    node.url = data.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
++    if (node.url.empty() && ui::IsImage(data.role)) {
++      node.url =
++          data.GetStringAttribute(ax::mojom::StringAttribute::kImageDataUrl);
++    }
++  }
++
++  auto root = index_of.find(update.root_id);
++  if (root == index_of.end()) {
++    return;
++  }
++  root_ = root->second;
++
++  // Resolve child ids into contiguous ranges. A node claimed by a second
++  // parent (or the root, claimed by anyone) is dropped there, so what is
++  // reachable from the root is a tree and the walk can never loop.
++  std::vector<bool> has_parent(nodes_.size(), false);
++  has_parent[*root_] = true;
++  children_.reserve(nodes_.size());
++  uint32_t next = 0;
++  for (const ui::AXNodeData& data : update.nodes) {
++    // First occurrences were indexed in order; later duplicates are skipped.
++    if (index_of[data.id] != next) {
++      continue;
++    }
++    Node& node = nodes_[next++];
++    node.first_child = static_cast<uint32_t>(children_.size());
++    for (int32_t child_id : data.child_ids) {
++      auto child = index_of.find(child_id);
++      if (child == index_of.end() || has_parent[child->second]) {
++        continue;
++      }
++      has_parent[child->second] = true;
++      children_.push_back(child->second);
++    }
++    node.child_count =
++        static_cast<uint32_t>(children_.size()) - node.first_child;
++  }
++}
++
++PageTextIndex::~PageTextIndex() = default;
++
++template <typename Visitor>
++void PageTextIndex::Walk(Visitor& visitor, int root_depth) const {
++  if (!root_) {
++    return;
++  }
++
++  struct Frame {
++    uint32_t index;
++    int depth;
++    bool exit;
++  };
++  std::vector<Frame> stack;
++  stack.push_back({*root_, root_depth, false});
++  while (!stack.empty()) {
++    Frame frame = stack.back();
++    stack.pop_back();
++    const Node& node = nodes_[frame.index];
++    if (frame.exit) {
++      visitor.Exit(node);
++      continue;
++    }
++
++    Descend descend = visitor.Enter(node, frame.depth);
++    if (descend.exit) {
++      stack.push_back({frame.index, frame.depth, true});
++    }
++    if (!descend.children) {
++      continue;
++    }
++    for (uint32_t i = node.child_count; i > 0; --i) {
++      stack.push_back(
++          {children_[node.first_child + i - 1], descend.child_depth, false});
++    }
++  }
++}
++
++const std::u16string& PageTextIndex::GetPlainText() const {
++  if (!plain_text_) {
++    plain_text_ = BuildPlainText();
++  }
++  return *plain_text_;
++}
++
++const std::u16string& PageTextIndex::GetMarkdown() const {
++  if (!markdown_) {
++    markdown_ = BuildMarkdown();
++  }
++  return *markdown_;
++}
++
++const std::vector<PageContentItem>& PageTextIndex::GetItems() const {
++  if (!items_) {
++    items_ = BuildItems();
++  }
++  return *items_;
++}
++
++// Reading-order text: static text runs joined by spaces, blank lines around
++// block elements, and landmark/control labels left out.
++std::u16string PageTextIndex::BuildPlainText() const {
++  struct PlainTextVisitor {
++    Descend Enter(const Node& node, int depth) {
++      if (IsChromeRole(node.role)) {
++        // Still walk into them; only their own labels are skipped.
++        return {true, depth, false};
++      }
++      if ((node.role == ax::mojom::Role::kStaticText ||
++           node.role == ax::mojom::Role::kInlineTextBox) &&
++          !node.text.empty()) {
++        AppendWithSpace(output, base::UTF8ToUTF16(node.text));
++      }
++      if (node.role == ax::mojom::Role::kLineBreak) {
++        output += u"\n";
++      }
++      bool block = IsPlainTextBlock(node.role);
++      if (block) {
++        StartBlock(output);
++      }
++      return {true, depth, block};
++    }
++
++    void Exit(const Node& node) { StartBlock(output); }
++
++    std::u16string output;
++  };
++
++  PlainTextVisitor visitor;
++  Walk(visitor, 0);
++  CollapseSpaces(visitor.output);
++  return std::move(visitor.output);
++}
++
++// Markdown-like text for LLM consumption. Headings, links and images are
++// semantic boundaries: their text is emitted once and their subtrees are not
++// walked again, which avoids duplicated text.
++std::u16string PageTextIndex::BuildMarkdown() const {
++  struct MarkdownVisitor {
++    Descend Enter(const Node& node, int depth) {
++      if (node.invisible_or_ignored) {
++        return {true, depth, false};
++      }
++
++      if (node.role == ax::mojom::Role::kNavigation ||
++          node.role == ax::mojom::Role::kBanner) {
++        StartBlock(output);
++        return {true, depth, true};
++      }
++
++      bool boundary = ui::IsHeading(node.role) || ui::IsLink(node.role) ||
++                      ui::IsImage(node.role) || ui::IsText(node.role);
++      std::u16string text;
++      if (boundary) {
++        text = base::UTF8ToUTF16(
++            base::TrimWhitespaceASCII(node.text, base::TRIM_ALL));
++      }
++
++      if (ui::IsHeading(node.role)) {
++        int level = node.level ? std::clamp(node.level, 1, 6) : 2;
++        if (!text.empty()) {
++          StartBlock(output);
++          output += std::u16string(level, u'#') + u" " + text + u"\n\n";
++        }
++        return {};
++      }
++
++      if (ui::IsLink(node.role)) {
++        if (!text.empty()) {
++          AppendWithSpace(output, text);
++        }
++        return {};
++      }
++
++      if (ui::IsImage(node.role)) {
++        if (!text.empty()) {
++          AppendWithSpace(output, u"[Image: " + text + u"]");
++        }
++        return {};
++      }
++
++      if (ui::IsText(node.role)) {
++        if (!text.empty()) {
++          AppendWithSpace(output, text);
++        }
++        return {};
++      }
++
++      if (node.role == ax::mojom::Role::kList) {
++        return {true, depth + 1, false};
++      }
++
++      if (node.role == ax::mojom::Role::kListItem) {
++        if (!output.empty() && output.back() != u'\n') {
++          output += u"\n";
++        }
++        if (depth > 0) {
++          output += std::u16string(depth, u'\t');
++        }
++        return {true, depth, false};
++      }
++
++      if (node.role == ax::mojom::Role::kParagraph) {
++        StartBlock(output);
++      }
++      bool block_end = node.role == ax::mojom::Role::kParagraph ||
++                       node.role == ax::mojom::Role::kSection ||
++                       node.role == ax::mojom::Role::kArticle;
++      return {true, depth, block_end};
++    }
++
++    void Exit(const Node& node) {
++      if (node.role == ax::mojom::Role::kNavigation ||
++          node.role == ax::mojom::Role::kBanner) {
++        output += u"\n\n";
++        return;
++      }
++      StartBlock(output);
++    }
++
++    std::u16string output;
++  };
++
++  MarkdownVisitor visitor;
++  // The root starts at -1 so top-level lists are not indented.
++  Walk(visitor, -1);
++
++  std::u16string& output = visitor.output;
++  CollapseSpaces(output);
++  size_t pos = 0;
++  while ((pos = output.find(u"\n\n\n", pos)) != std::u16string::npos) {
++    output.replace(pos, 3, u"\n\n");
++  }
++  while (!output.empty() && (output.back() == u' ' || output.back() == u'\n')) {
++    output.pop_back();
++  }
++  return std::move(output);
++}
++
++// Typed items in document order; headings, links, images, videos and text
++// are boundaries whose subtrees are only formatting.
++std::vector<PageContentItem> PageTextIndex::BuildItems() const {
++  struct ItemsVisitor {
++    Descend Enter(const Node& node, int depth) {
++      if (node.ignored) {
++        return {true, depth, false};
++      }
++
++      PageContentItem item;
++      if (ui::IsHeading(node.role)) {
++        item.type = PageContentItem::Type::kHeading;
++        SetIfPresent(item.text, CleanText(node.text));
++        item.level = node.level ? std::clamp(node.level, 1, 6) : 2;
++      } else if (ui::IsLink(node.role)) {
++        item.type = PageContentItem::Type::kLink;
++        SetIfPresent(item.text, CleanText(node.text));
++        SetIfPresent(item.url, node.url);
++      } else if (ui::IsImage(node.role)) {
++        item.type = PageContentItem::Type::kImage;
++        SetIfPresent(item.alt, CleanText(node.text));
++        SetIfPresent(item.url, node.url);
++      } else if (node.role == ax::mojom::Role::kVideo) {
++        item.type = PageContentItem::Type::kVideo;
++        SetIfPresent(item.alt, CleanText(node.text));
++        SetIfPresent(item.url, node.url);
++      } else if (ui::IsText(node.role)) {
++        item.type = PageContentItem::Type::kText;
++        SetIfPresent(item.text, CleanText(node.text));
++        if (!item.text) {
++          return {};
++        }
++      } else {
++        return {true, depth, false};
++      }
++
++      items.push_back(std::move(item));
++      return {};
++    }
++
++    void Exit(const Node& node) {}
++
++    static void SetIfPresent(std::optional<std::string>& field,
++                             std::string value) {
++      if (!value.empty()) {
++        field = std::move(value);
++      }
++    }
++
++    std::vector<PageContentItem> items;
++  };
++
++  ItemsVisitor visitor;
++  Walk(visitor, 0);
++  return std::move(visitor.items);
++}
++
++}  // namespace browseros
@@ -0,0 +1,115 @@
+diff --git a/chrome/browser/browseros/page_content/page_text_index.h b/chrome/browser/browseros/page_content/page_text_index.h
+new file mode 100644
+index 0000000000000..d09879375a6eb
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_text_index.h
+@@ -0,0 +1,109 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_TEXT_INDEX_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_TEXT_INDEX_H_
++
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/memory/ref_counted.h"
++#include "ui/accessibility/ax_enums.mojom-forward.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace browseros {
++
++// One piece of page content in document order (structured output format).
++struct PageContentItem {
++  enum class Type {
++    kHeading,
++    kText,
++    kLink,
++    kImage,
++    kVideo,
++  };
++
++  PageContentItem();
++  ~PageContentItem();
++  PageContentItem(const PageContentItem&);
++  PageContentItem& operator=(const PageContentItem&);
++  PageContentItem(PageContentItem&&);
++  PageContentItem& operator=(PageContentItem&&);
++
++  Type type = Type::kText;
++  std::optional<std::string> text;
++  std::optional<std::string> url;
++  std::optional<std::string> alt;
++  std::optional<int> level;  // Headings only, 1-6.
++};
++
++// Flattened, immutable copy of an accessibility snapshot holding only what
++// text extraction needs, with every output format computed from it on first
++// use and memoized:
++//   - plain text: reading-order text for pasting into an LLM prompt
++//   - markdown:   headings, list indentation and [Image: alt] markers
++//   - items:      typed headings/text/links/images/videos with URLs
++//
++// Nodes live in one vector and children are index ranges into a second one,
++// so walking the tree needs no id lookups. Traversal uses an explicit stack,
++// which keeps arbitrarily deep pages from overflowing the thread stack.
++//
++// Instances are shared through PageContentCache and must only be used on the
++// sequence that created them.
++class PageTextIndex : public base::RefCounted<PageTextIndex> {
++ public:
++  explicit PageTextIndex(const ui::AXTreeUpdate& update);
++
++  PageTextIndex(const PageTextIndex&) = delete;
++  PageTextIndex& operator=(const PageTextIndex&) = delete;
++
++  size_t node_count() const { return nodes_.size(); }
++  bool empty() const { return nodes_.empty(); }
++
++  const std::u16string& GetPlainText() const;
++  const std::u16string& GetMarkdown() const;
++  const std::vector<PageContentItem>& GetItems() const;
++
++ private:
++  friend class base::RefCounted<PageTextIndex>;
++
++  struct Node {
++    ax::mojom::Role role;
++    bool ignored = false;
++    bool invisible_or_ignored = false;
++    int level = 0;     // kHierarchicalLevel, 0 when absent.
++    std::string text;  // Name, or value when the name is empty.
++    std::string url;   // kUrl, or kImageDataUrl for images without one.
++    uint32_t first_child = 0;
++    uint32_t child_count = 0;
++  };
++
++  ~PageTextIndex();
++
++  // Calls |visitor.Enter(node, depth)| in document order and, when it asks
++  // for it, |visitor.Exit(node)| after the node's children.
++  template <typename Visitor>
++  void Walk(Visitor& visitor, int root_depth) const;
++
++  std::u16string BuildPlainText() const;
++  std::u16string BuildMarkdown() const;
++  std::vector<PageContentItem> BuildItems() const;
++
++  std::vector<Node> nodes_;
++  std::vector<uint32_t> children_;
++  std::optional<uint32_t> root_;
++
++  mutable std::optional<std::u16string> plain_text_;
++  mutable std::optional<std::u16string> markdown_;
++  mutable std::optional<std::vector<PageContentItem>> items_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_PAGE_TEXT_INDEX_H_
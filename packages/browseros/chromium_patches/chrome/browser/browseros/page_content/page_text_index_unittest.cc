@@ -0,0 +1,214 @@
+diff --git a/chrome/browser/browseros/page_content/page_text_index_unittest.cc b/chrome/browser/browseros/page_content/page_text_index_unittest.cc
+new file mode 100644
+index 0000000000000..0e4ff743d7120
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/page_text_index_unittest.cc
+@@ -0,0 +1,208 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/page_text_index.h"
++
++#include <string>
++
++#include "base/memory/scoped_refptr.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++namespace {
++
++// Builds an AXTreeUpdate by appending nodes under explicit parents.
++class TreeBuilder {
++ public:
++  TreeBuilder() { Add(0, ax::mojom::Role::kRootWebArea); }
++
++  int32_t Add(int32_t parent,
++              ax::mojom::Role role,
++              const std::string& name = std::string()) {
++    ui::AXNodeData node;
++    node.id = next_id_++;
++    node.role = role;
++    if (!name.empty()) {
++      node.SetName(name);
++    }
++    if (parent) {
++      Get(parent).child_ids.push_back(node.id);
++    } else {
++      update_.root_id = node.id;
++    }
++    update_.nodes.push_back(std::move(node));
++    return next_id_ - 1;
++  }
++
++  // Ids are assigned sequentially from 1.
++  ui::AXNodeData& Get(int32_t id) { return update_.nodes[id - 1]; }
++
++  scoped_refptr<PageTextIndex> Build() {
++    return base::MakeRefCounted<PageTextIndex>(update_);
++  }
++
++  int32_t root() const { return update_.root_id; }
++
++ private:
++  ui::AXTreeUpdate update_;
++  int32_t next_id_ = 1;
++};
++
++// Article with a heading, a paragraph holding a link, an image and a nested
++// list, plus a navigation landmark.
++void BuildArticle(TreeBuilder& tree) {
++  int32_t nav = tree.Add(tree.root(), ax::mojom::Role::kNavigation);
++  tree.Add(nav, ax::mojom::Role::kLink, "Home");
++
++  int32_t article = tree.Add(tree.root(), ax::mojom::Role::kArticle);
++  int32_t heading = tree.Add(article, ax::mojom::Role::kHeading, "Title");
++  tree.Get(heading).AddIntAttribute(
++      ax::mojom::IntAttribute::kHierarchicalLevel, 1);
++  tree.Add(heading, ax::mojom::Role::kStaticText, "Title");
++
++  int32_t paragraph = tree.Add(article, ax::mojom::Role::kParagraph);
++  tree.Add(paragraph, ax::mojom::Role::kStaticText, "Read  the");
++  int32_t link = tree.Add(paragraph, ax::mojom::Role::kLink, "docs");
++  tree.Get(link).AddStringAttribute(ax::mojom::StringAttribute::kUrl,
++                                    "https://example.com/docs");
++  tree.Add(link, ax::mojom::Role::kStaticText, "docs");
++
++  int32_t image = tree.Add(article, ax::mojom::Role::kImage, "Diagram");
++  tree.Get(image).AddStringAttribute(ax::mojom::StringAttribute::kUrl,
++                                     "https://example.com/d.png");
++
++  int32_t list = tree.Add(article, ax::mojom::Role::kList);
++  int32_t item = tree.Add(list, ax::mojom::Role::kListItem);
++  tree.Add(item, ax::mojom::Role::kStaticText, "One");
++  int32_t nested = tree.Add(item, ax::mojom::Role::kList);
++  int32_t nested_item = tree.Add(nested, ax::mojom::Role::kListItem);
++  tree.Add(nested_item, ax::mojom::Role::kStaticText, "Two");
++}
++
++// =============================================================================
++// Output Formats
++// =============================================================================
++
++TEST(PageTextIndexTest, ItemsFollowDocumentOrder) {
++  TreeBuilder tree;
++  BuildArticle(tree);
++  auto index = tree.Build();
++
++  const std::vector<PageContentItem>& items = index->GetItems();
++  ASSERT_EQ(7u, items.size());
++
++  EXPECT_EQ(PageContentItem::Type::kLink, items[0].type);
++  EXPECT_EQ("Home", items[0].text);
++
++  EXPECT_EQ(PageContentItem::Type::kHeading, items[1].type);
++  EXPECT_EQ("Title", items[1].text);
++  EXPECT_EQ(1, items[1].level);
++
++  EXPECT_EQ(PageContentItem::Type::kText, items[2].type);
++  EXPECT_EQ("Read the", items[2].text);
++
++  EXPECT_EQ(PageContentItem::Type::kLink, items[3].type);
++  EXPECT_EQ("https://example.com/docs", items[3].url);
++
++  EXPECT_EQ(PageContentItem::Type::kImage, items[4].type);
++  EXPECT_EQ("Diagram", items[4].alt);
++  EXPECT_EQ("https://example.com/d.png", items[4].url);
++
++  EXPECT_EQ("One", items[5].text);
++  EXPECT_EQ("Two", items[6].text);
++}
++
++TEST(PageTextIndexTest, MarkdownFormatsHeadingsImagesAndLists) {
++  TreeBuilder tree;
++  BuildArticle(tree);
++  auto index = tree.Build();
++
++  EXPECT_EQ(
++      u"Home\n\n"
++      u"# Title\n\n"
++      u"Read the docs\n\n"
++      u"[Image: Diagram]\n"
++      u"One\n"
++      u"\tTwo",
++      index->GetMarkdown());
++}
++
++TEST(PageTextIndexTest, PlainTextSkipsLandmarkLabels) {
++  TreeBuilder tree;
++  int32_t toolbar = tree.Add(tree.root(), ax::mojom::Role::kToolbar, "Tools");
++  tree.Add(toolbar, ax::mojom::Role::kStaticText, "Bold");
++  int32_t paragraph = tree.Add(tree.root(), ax::mojom::Role::kParagraph);
++  tree.Add(paragraph, ax::mojom::Role::kStaticText, "Hello");
++  tree.Add(paragraph, ax::mojom::Role::kLineBreak);
++  tree.Add(paragraph, ax::mojom::Role::kStaticText, "world");
++  auto index = tree.Build();
++
++  EXPECT_EQ(u"Bold\n\nHello\nworld\n\n", index->GetPlainText());
++}
++
++TEST(PageTextIndexTest, OutputsAreMemoized) {
++  TreeBuilder tree;
++  BuildArticle(tree);
++  auto index = tree.Build();
++
++  const std::u16string* first = &index->GetMarkdown();
++  EXPECT_EQ(first, &index->GetMarkdown());
++}
++
++// =============================================================================
++// Robustness
++// =============================================================================
++
++TEST(PageTextIndexTest, IgnoredNodesAreWalkedThrough) {
++  TreeBuilder tree;
++  int32_t generic = tree.Add(tree.root(), ax::mojom::Role::kGenericContainer);
++  tree.Get(generic).AddState(ax::mojom::State::kIgnored);
++  tree.Add(generic, ax::mojom::Role::kStaticText, "inside");
++  auto index = tree.Build();
++
++  ASSERT_EQ(1u, index->GetItems().size());
++  EXPECT_EQ("inside", index->GetItems()[0].text);
++  EXPECT_EQ(u"inside", index->GetMarkdown());
++}
++
++TEST(PageTextIndexTest, DeepTreeDoesNotOverflowStack) {
++  TreeBuilder tree;
++  int32_t parent = tree.root();
++  for (int i = 0; i < 100000; ++i) {
++    parent = tree.Add(parent, ax::mojom::Role::kGenericContainer);
++  }
++  tree.Add(parent, ax::mojom::Role::kStaticText, "leaf");
++  auto index = tree.Build();
++
++  EXPECT_EQ(100002u, index->node_count());
++  EXPECT_EQ(u"leaf", index->GetMarkdown());
++}
++
++TEST(PageTextIndexTest, CyclesAndMissingChildrenAreIgnored) {
++  TreeBuilder tree;
++  int32_t child = tree.Add(tree.root(), ax::mojom::Role::kGenericContainer);
++  tree.Add(child, ax::mojom::Role::kStaticText, "once");
++  // Point back at the root and at an id that does not exist.
++  tree.Get(child).child_ids.push_back(tree.root());
++  tree.Get(child).child_ids.push_back(999);
++  auto index = tree.Build();
++
++  ASSERT_EQ(1u, index->GetItems().size());
++  EXPECT_EQ("once", index->GetItems()[0].text);
++}
++
++TEST(PageTextIndexTest, EmptyUpdateProducesEmptyOutputs) {
++  auto index = base::MakeRefCounted<PageTextIndex>(ui::AXTreeUpdate());
++
++  EXPECT_TRUE(index->empty());
++  EXPECT_TRUE(index->GetPlainText().empty());
++  EXPECT_TRUE(index->GetMarkdown().empty());
++  EXPECT_TRUE(index->GetItems().empty());
++}
++
++}  // namespace
++}  // namespace browseros
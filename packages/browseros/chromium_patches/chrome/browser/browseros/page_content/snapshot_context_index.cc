@@ -0,0 +1,228 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_context_index.cc b/chrome/browser/browseros/page_content/snapshot_context_index.cc
+new file mode 100644
+index 0000000000000..92c3cb3f69d86
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_context_index.cc
+@@ -0,0 +1,222 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/snapshot_context_index.h"
++
++#include <utility>
++
++#include "base/check_op.h"
++#include "base/strings/string_util.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kPathSeparator[] = " > ";
++
++// Visit state shared by both passes. A node reached again while still in
++// progress is part of a cycle, which ends the walk there.
++enum class VisitState : uint8_t {
++  kNew,
++  kInProgress,
++  kDone,
++};
++
++}  // namespace
++
++std::string SanitizeSnapshotText(std::string_view input) {
++  std::string output;
++  output.reserve(input.size());
++  for (char c : input) {
++    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
++      output.push_back(c);
++    } else {
++      output.push_back(' ');
++    }
++  }
++  return output;
++}
++
++SnapshotContextIndex::Node::Node() = default;
++SnapshotContextIndex::Node::~Node() = default;
++SnapshotContextIndex::Node::Node(Node&&) = default;
++SnapshotContextIndex::Node& SnapshotContextIndex::Node::operator=(Node&&) =
++    default;
++
++SnapshotContextIndex::SnapshotContextIndex(
++    const std::vector<ui::AXNodeData>& nodes,
++    size_t max_text_chars)
++    : max_text_chars_(max_text_chars) {
++  DCHECK_GT(max_text_chars_, 3u);
++
++  index_of_.reserve(nodes.size());
++  nodes_.reserve(nodes.size());
++  for (const ui::AXNodeData& data : nodes) {
++    if (!index_of_.emplace(data.id, static_cast<uint32_t>(nodes_.size()))
++             .second) {
++      continue;  // Duplicate id; keep the first.
++    }
++    Node& node = nodes_.emplace_back();
++    node.role = ui::ToString(data.role);
++    node.name = SanitizeSnapshotText(base::TrimWhitespaceASCII(
++        data.GetStringAttribute(ax::mojom::StringAttribute::kName),
++        base::TRIM_ALL));
++  }
++
++  // Resolve child ids into contiguous ranges and offset containers into
++  // indices. A node claimed by a second parent is dropped there, so every
++  // node's text is counted under one parent only.
++  std::vector<bool> has_parent(nodes_.size(), false);
++  children_.reserve(nodes_.size());
++  uint32_t next = 0;
++  for (const ui::AXNodeData& data : nodes) {
++    // First occurrences were indexed in order; later duplicates are skipped.
++    if (index_of_[data.id] != next) {
++      continue;
++    }
++    Node& node = nodes_[next++];
++    node.offset_container = Find(data.relative_bounds.offset_container_id);
++    node.first_child = static_cast<uint32_t>(children_.size());
++    for (int32_t child_id : data.child_ids) {
++      uint32_t child = Find(child_id);
++      if (child == kNone || has_parent[child]) {
++        continue;
++      }
++      has_parent[child] = true;
++      children_.push_back(child);
++    }
++    node.child_count =
++        static_cast<uint32_t>(children_.size()) - node.first_child;
++  }
++
++  BuildSubtreeText();
++  BuildPaths();
++}
++
++SnapshotContextIndex::~SnapshotContextIndex() = default;
++
++void SnapshotContextIndex::BuildSubtreeText() {
++  std::vector<VisitState> state(nodes_.size(), VisitState::kNew);
++  struct Frame {
++    uint32_t index;
++    bool exit;
++  };
++  std::vector<Frame> stack;
++
++  for (uint32_t start = 0; start < nodes_.size(); ++start) {
++    if (state[start] != VisitState::kNew) {
++      continue;
++    }
++    stack.push_back({start, false});
++    while (!stack.empty()) {
++      Frame frame = stack.back();
++      stack.pop_back();
++      Node& node = nodes_[frame.index];
++
++      if (!frame.exit) {
++        if (state[frame.index] != VisitState::kNew) {
++          continue;
++        }
++        state[frame.index] = VisitState::kInProgress;
++        stack.push_back({frame.index, true});
++        for (uint32_t i = node.child_count; i > 0; --i) {
++          stack.push_back({children_[node.first_child + i - 1], false});
++        }
++        continue;
++      }
++
++      // Children are done, so their text is final and already capped; only
++      // the first |max_text_chars_| + 1 characters can reach the output.
++      std::string text = node.name;
++      for (uint32_t i = 0;
++           i < node.child_count && text.size() <= max_text_chars_; ++i) {
++        uint32_t child = children_[node.first_child + i];
++        if (state[child] != VisitState::kDone) {
++          continue;
++        }
++        const std::string& child_text = nodes_[child].subtree_text;
++        if (child_text.empty()) {
++          continue;
++        }
++        if (!text.empty()) {
++          text += ' ';
++        }
++        text += child_text;
++      }
++      if (text.size() > max_text_chars_ + 1) {
++        text.resize(max_text_chars_ + 1);
++      }
++      node.subtree_text = std::move(text);
++      state[frame.index] = VisitState::kDone;
++    }
++  }
++}
++
++void SnapshotContextIndex::BuildPaths() {
++  std::vector<VisitState> state(nodes_.size(), VisitState::kNew);
++  std::vector<uint32_t> chain;
++
++  for (uint32_t start = 0; start < nodes_.size(); ++start) {
++    // Climb to the first container whose path is known (or the top of the
++    // chain), then fill in paths on the way back down.
++    for (uint32_t current = start;
++         current != kNone && state[current] == VisitState::kNew;
++         current = nodes_[current].offset_container) {
++      state[current] = VisitState::kInProgress;
++      chain.push_back(current);
++    }
++
++    while (!chain.empty()) {
++      Node& node = nodes_[chain.back()];
++      uint32_t container = node.offset_container;
++      if (container == kNone || state[container] != VisitState::kDone) {
++        node.path = node.role;
++        node.depth = 1;
++      } else if (nodes_[container].depth < kMaxPathDepth) {
++        node.path = nodes_[container].path + kPathSeparator + node.role;
++        node.depth = nodes_[container].depth + 1;
++      } else {
++        // Drop the outermost role to stay within kMaxPathDepth.
++        const std::string& path = nodes_[container].path;
++        size_t cut = path.find(kPathSeparator) + sizeof(kPathSeparator) - 1;
++        node.path = path.substr(cut) + kPathSeparator + node.role;
++        node.depth = kMaxPathDepth;
++      }
++      state[chain.back()] = VisitState::kDone;
++      chain.pop_back();
++    }
++  }
++}
++
++uint32_t SnapshotContextIndex::Find(int32_t id) const {
++  auto it = index_of_.find(id);
++  return it == index_of_.end() ? kNone : it->second;
++}
++
++std::string SnapshotContextIndex::GetSubtreeText(int32_t id) const {
++  uint32_t index = Find(id);
++  if (index == kNone) {
++    return std::string();
++  }
++  const std::string& text = nodes_[index].subtree_text;
++  if (text.size() <= max_text_chars_) {
++    return text;
++  }
++  return text.substr(0, max_text_chars_ - 3) + "...";
++}
++
++const std::string& SnapshotContextIndex::GetPath(int32_t id) const {
++  uint32_t index = Find(id);
++  return index == kNone ? base::EmptyString() : nodes_[index].path;
++}
++
++int SnapshotContextIndex::GetDepth(int32_t id) const {
++  uint32_t index = Find(id);
++  return index == kNone ? 0 : nodes_[index].depth;
++}
++
++}  // namespace browseros
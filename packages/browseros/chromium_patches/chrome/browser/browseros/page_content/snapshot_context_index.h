@@ -0,0 +1,99 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_context_index.h b/chrome/browser/browseros/page_content/snapshot_context_index.h
+new file mode 100644
+index 0000000000000..c3d0a73340f87
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_context_index.h
+@@ -0,0 +1,93 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_CONTEXT_INDEX_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_CONTEXT_INDEX_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <string>
++#include <string_view>
++#include <unordered_map>
++#include <vector>
++
++namespace ui {
++struct AXNodeData;
++}  // namespace ui
++
++namespace browseros {
++
++// Replaces every byte outside printable ASCII (other than tab and newline)
++// with a space, so snapshot strings are always valid UTF-8.
++std::string SanitizeSnapshotText(std::string_view input);
++
++// Per-node context for the interactive snapshot, computed for a whole
++// accessibility tree up front instead of walking the tree again for every
++// node:
++//   - subtree text: names in the node's subtree in document order, joined
++//     with spaces and cut at |max_text_chars| with "...". Built in one
++//     bottom-up pass, each node reusing its children's truncated text.
++//   - path and depth: roles along the offset-container chain ending at the
++//     node, at most kMaxPathDepth of them. Built in one top-down pass, each
++//     node extending its container's path.
++//
++// Nodes live in one vector addressed by index, like PageTextIndex. Both
++// passes use explicit stacks, so deep pages cannot overflow the thread stack.
++// Immutable once built, so batches may read it from any thread.
++class SnapshotContextIndex {
++ public:
++  static constexpr size_t kDefaultMaxTextChars = 200;
++  static constexpr int kMaxPathDepth = 10;
++
++  explicit SnapshotContextIndex(const std::vector<ui::AXNodeData>& nodes,
++                                size_t max_text_chars = kDefaultMaxTextChars);
++  ~SnapshotContextIndex();
++
++  SnapshotContextIndex(const SnapshotContextIndex&) = delete;
++  SnapshotContextIndex& operator=(const SnapshotContextIndex&) = delete;
++
++  size_t node_count() const { return nodes_.size(); }
++
++  // All return empty values for ids not in the tree.
++  std::string GetSubtreeText(int32_t id) const;
++  const std::string& GetPath(int32_t id) const;
++  int GetDepth(int32_t id) const;
++
++ private:
++  static constexpr uint32_t kNone = UINT32_MAX;
++
++  struct Node {
++    Node();
++    ~Node();
++    Node(Node&&);
++    Node& operator=(Node&&);
++
++    std::string name;  // Trimmed and sanitized kName.
++    std::string role;
++    uint32_t offset_container = kNone;
++    uint32_t first_child = 0;
++    uint32_t child_count = 0;
++
++    // Pre-order subtree text, at most |max_text_chars_| + 1 characters so
++    // overflow can still be detected.
++    std::string subtree_text;
++    std::string path;
++    int depth = 0;
++  };
++
++  void BuildSubtreeText();
++  void BuildPaths();
++
++  // Index of |id|, or kNone.
++  uint32_t Find(int32_t id) const;
++
++  const size_t max_text_chars_;
++  std::vector<Node> nodes_;
++  std::vector<uint32_t> children_;
++  std::unordered_map<int32_t, uint32_t> index_of_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_CONTEXT_INDEX_H_
@@ -0,0 +1,173 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_context_index_perftest.cc b/chrome/browser/browseros/page_content/snapshot_context_index_perftest.cc
+new file mode 100644
+index 0000000000000..b8318fb2c858f
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_context_index_perftest.cc
+@@ -0,0 +1,167 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include <algorithm>
++#include <queue>
++#include <string>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/timer/elapsed_timer.h"
++#include "chrome/browser/browseros/page_content/snapshot_context_index.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++
++// Compares SnapshotContextIndex with the per-node walks it replaced in
++// SnapshotProcessor. The benchmarks are manual:
++//   unit_tests --gtest_filter='SnapshotContextIndexPerfTest.*' --run-manual
++
++namespace browseros {
++namespace {
++
++using NodeMap = std::unordered_map<int32_t, ui::AXNodeData>;
++
++// The subtree walk SnapshotProcessor ran for every node's offset container.
++std::string ReferenceSubtreeText(int32_t node_id,
++                                 const NodeMap& node_map,
++                                 size_t max_chars) {
++  std::vector<std::string> parts;
++  std::queue<int32_t> queue;
++  queue.push(node_id);
++  size_t collected = 0;
++  while (!queue.empty() && collected < max_chars) {
++    auto it = node_map.find(queue.front());
++    queue.pop();
++    if (it == node_map.end()) {
++      continue;
++    }
++    std::string text = SanitizeSnapshotText(base::TrimWhitespaceASCII(
++        it->second.GetStringAttribute(ax::mojom::StringAttribute::kName),
++        base::TRIM_ALL));
++    if (!text.empty()) {
++      collected += text.size();
++      parts.push_back(std::move(text));
++    }
++    for (int32_t child_id : it->second.child_ids) {
++      queue.push(child_id);
++    }
++  }
++  std::string result = base::JoinString(parts, " ");
++  if (result.size() > max_chars) {
++    result = result.substr(0, max_chars - 3) + "...";
++  }
++  return result;
++}
++
++// The ancestor walk SnapshotProcessor ran for every node.
++std::pair<std::string, int> ReferencePathAndDepth(int32_t node_id,
++                                                  const NodeMap& node_map) {
++  std::vector<std::string> parts;
++  int32_t current = node_id;
++  int depth = 0;
++  while (current >= 0 && depth < SnapshotContextIndex::kMaxPathDepth) {
++    auto it = node_map.find(current);
++    if (it == node_map.end()) {
++      break;
++    }
++    parts.push_back(ui::ToString(it->second.role));
++    current = it->second.relative_bounds.offset_container_id;
++    ++depth;
++  }
++  std::reverse(parts.begin(), parts.end());
++  return {base::JoinString(parts, " > "), depth};
++}
++
++// Page-like tree: nested containers with text only on the leaves, so every
++// walk has to descend to the bottom to find any.
++std::vector<ui::AXNodeData> BuildTree(int node_count, int fanout) {
++  std::vector<ui::AXNodeData> nodes(node_count);
++  for (int i = 0; i < node_count; ++i) {
++    ui::AXNodeData& node = nodes[i];
++    node.id = i + 1;
++    if (i == 0) {
++      node.role = ax::mojom::Role::kRootWebArea;
++      continue;
++    }
++    int parent = (i - 1) / fanout;
++    nodes[parent].child_ids.push_back(node.id);
++    node.relative_bounds.offset_container_id = parent + 1;
++  }
++  for (ui::AXNodeData& node : nodes) {
++    if (node.id == 1) {
++      continue;
++    }
++    if (node.child_ids.empty()) {
++      node.role = ax::mojom::Role::kLink;
++      node.SetName("Item " + base::NumberToString(node.id));
++    } else {
++      node.role = ax::mojom::Role::kGenericContainer;
++    }
++  }
++  return nodes;
++}
++
++class SnapshotContextIndexPerfTest : public testing::Test {
++ protected:
++  void RunComparison(const std::string& story, int node_count, int fanout) {
++    std::vector<ui::AXNodeData> nodes = BuildTree(node_count, fanout);
++
++    base::ElapsedTimer reference_timer;
++    NodeMap node_map;
++    for (const ui::AXNodeData& node : nodes) {
++      node_map[node.id] = node;
++    }
++    size_t reference_bytes = 0;
++    for (const ui::AXNodeData& node : nodes) {
++      reference_bytes += ReferenceSubtreeText(
++                             node.relative_bounds.offset_container_id,
++                             node_map,
++                             SnapshotContextIndex::kDefaultMaxTextChars)
++                             .size();
++      reference_bytes += ReferencePathAndDepth(node.id, node_map).first.size();
++    }
++    base::TimeDelta reference_time = reference_timer.Elapsed();
++
++    base::ElapsedTimer index_timer;
++    SnapshotContextIndex index(nodes);
++    size_t index_bytes = 0;
++    for (const ui::AXNodeData& node : nodes) {
++      index_bytes +=
++          index.GetSubtreeText(node.relative_bounds.offset_container_id)
++              .size();
++      index_bytes += index.GetPath(node.id).size();
++    }
++    base::TimeDelta index_time = index_timer.Elapsed();
++
++    // Same amount of output; only the text order within a subtree differs.
++    EXPECT_EQ(reference_bytes, index_bytes);
++
++    perf_test::PerfResultReporter reporter("SnapshotContextIndex", story);
++    reporter.RegisterImportantMetric(".per_node_walks", "ms");
++    reporter.RegisterImportantMetric(".single_pass", "ms");
++    reporter.AddResult(".per_node_walks", reference_time);
++    reporter.AddResult(".single_pass", index_time);
++  }
++};
++
++TEST_F(SnapshotContextIndexPerfTest, MANUAL_Nodes10k) {
++  RunComparison("10k_nodes", 10'000, /*fanout=*/4);
++}
++
++TEST_F(SnapshotContextIndexPerfTest, MANUAL_Nodes100k) {
++  RunComparison("100k_nodes", 100'000, /*fanout=*/4);
++}
++
++TEST_F(SnapshotContextIndexPerfTest, MANUAL_DeepNodes100k) {
++  RunComparison("100k_deep_nodes", 100'000, /*fanout=*/2);
++}
++
++}  // namespace
++}  // namespace browseros
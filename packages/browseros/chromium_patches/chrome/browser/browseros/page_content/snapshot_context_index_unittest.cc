@@ -0,0 +1,137 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_context_index_unittest.cc b/chrome/browser/browseros/page_content/snapshot_context_index_unittest.cc
+new file mode 100644
+index 0000000000000..8f9090206101b
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_context_index_unittest.cc
+@@ -0,0 +1,131 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/snapshot_context_index.h"
++
++#include <string>
++#include <vector>
++
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++
++namespace browseros {
++namespace {
++
++// Builds a node list by appending nodes under explicit parents. Each node's
++// offset container is its parent unless set otherwise.
++class TreeBuilder {
++ public:
++  TreeBuilder() { Add(0, ax::mojom::Role::kRootWebArea); }
++
++  int32_t Add(int32_t parent,
++              ax::mojom::Role role,
++              const std::string& name = std::string()) {
++    ui::AXNodeData node;
++    node.id = static_cast<int32_t>(nodes_.size()) + 1;
++    node.role = role;
++    if (!name.empty()) {
++      node.SetName(name);
++    }
++    if (parent) {
++      Get(parent).child_ids.push_back(node.id);
++      node.relative_bounds.offset_container_id = parent;
++    }
++    nodes_.push_back(std::move(node));
++    return nodes_.back().id;
++  }
++
++  // Ids are assigned sequentially from 1.
++  ui::AXNodeData& Get(int32_t id) { return nodes_[id - 1]; }
++
++  const std::vector<ui::AXNodeData>& nodes() const { return nodes_; }
++
++ private:
++  std::vector<ui::AXNodeData> nodes_;
++};
++
++TEST(SnapshotContextIndexTest, SubtreeTextIsInDocumentOrder) {
++  TreeBuilder tree;
++  int32_t form = tree.Add(1, ax::mojom::Role::kForm);
++  int32_t label = tree.Add(form, ax::mojom::Role::kLabelText, "  Email ");
++  tree.Add(label, ax::mojom::Role::kStaticText, "address");
++  tree.Add(form, ax::mojom::Role::kButton, "Send\x01");
++
++  SnapshotContextIndex index(tree.nodes());
++  EXPECT_EQ("Email address Send ", index.GetSubtreeText(form));
++  EXPECT_EQ("Email address Send ", index.GetSubtreeText(1));
++  EXPECT_EQ("address", index.GetSubtreeText(label + 1));
++}
++
++TEST(SnapshotContextIndexTest, SubtreeTextIsTruncated) {
++  TreeBuilder tree;
++  int32_t list = tree.Add(1, ax::mojom::Role::kList);
++  tree.Add(list, ax::mojom::Role::kListItem, "abcdef");
++  tree.Add(list, ax::mojom::Role::kListItem, "ghijkl");
++  tree.Add(list, ax::mojom::Role::kListItem, "mnopqr");
++
++  SnapshotContextIndex index(tree.nodes(), /*max_text_chars=*/10);
++  EXPECT_EQ("abcdef ...", index.GetSubtreeText(list));
++  // Truncated child text still truncates the parent the same way.
++  EXPECT_EQ("abcdef ...", index.GetSubtreeText(1));
++}
++
++TEST(SnapshotContextIndexTest, PathFollowsOffsetContainers) {
++  TreeBuilder tree;
++  int32_t main = tree.Add(1, ax::mojom::Role::kMain);
++  int32_t group = tree.Add(main, ax::mojom::Role::kGroup);
++  int32_t button = tree.Add(group, ax::mojom::Role::kButton, "Go");
++  // Positioned relative to the main landmark, not its parent.
++  tree.Get(button).relative_bounds.offset_container_id = main;
++
++  SnapshotContextIndex index(tree.nodes());
++  EXPECT_EQ("rootWebArea > main > button", index.GetPath(button));
++  EXPECT_EQ(3, index.GetDepth(button));
++  EXPECT_EQ("rootWebArea", index.GetPath(1));
++  EXPECT_EQ(1, index.GetDepth(1));
++}
++
++TEST(SnapshotContextIndexTest, PathIsCappedAtMaxDepth) {
++  TreeBuilder tree;
++  int32_t parent = tree.Add(1, ax::mojom::Role::kMain);
++  for (int i = 0; i < SnapshotContextIndex::kMaxPathDepth; ++i) {
++    parent = tree.Add(parent, ax::mojom::Role::kGroup);
++  }
++  int32_t button = tree.Add(parent, ax::mojom::Role::kButton);
++
++  SnapshotContextIndex index(tree.nodes());
++  EXPECT_EQ(SnapshotContextIndex::kMaxPathDepth, index.GetDepth(button));
++  std::string expected;
++  for (int i = 0; i < SnapshotContextIndex::kMaxPathDepth - 1; ++i) {
++    expected += "group > ";
++  }
++  EXPECT_EQ(expected + "button", index.GetPath(button));
++}
++
++TEST(SnapshotContextIndexTest, UnknownIdsAreEmpty) {
++  TreeBuilder tree;
++  SnapshotContextIndex index(tree.nodes());
++  EXPECT_EQ("", index.GetSubtreeText(42));
++  EXPECT_EQ("", index.GetPath(42));
++  EXPECT_EQ(0, index.GetDepth(42));
++}
++
++TEST(SnapshotContextIndexTest, CyclesTerminate) {
++  TreeBuilder tree;
++  int32_t a = tree.Add(1, ax::mojom::Role::kGroup, "a");
++  int32_t b = tree.Add(a, ax::mojom::Role::kGroup, "b");
++  // Malformed update: b claims a as its child and offset child.
++  tree.Get(b).child_ids.push_back(a);
++  tree.Get(a).relative_bounds.offset_container_id = b;
++  tree.Get(1).child_ids.clear();
++
++  SnapshotContextIndex index(tree.nodes());
++  EXPECT_EQ("a b", index.GetSubtreeText(a));
++  EXPECT_LE(index.GetDepth(a), 2);
++  EXPECT_LE(index.GetDepth(b), 2);
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,92 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_limits.cc b/chrome/browser/browseros/page_content/snapshot_limits.cc
+new file mode 100644
+index 0000000000000..c734cb3a54e80
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_limits.cc
+@@ -0,0 +1,86 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/snapshot_limits.h"
++
++#include <algorithm>
++#include <tuple>
++#include <utility>
++
++namespace browseros {
++
++float VerticalDistance(const gfx::RectF& bounds, const gfx::RectF& viewport) {
++  if (bounds.bottom() < viewport.y()) {
++    return viewport.y() - bounds.bottom();
++  }
++  if (bounds.y() > viewport.bottom()) {
++    return bounds.y() - viewport.bottom();
++  }
++  return 0.0f;
++}
++
++ViewportSelection SelectNodesNearViewport(
++    const std::vector<NodePlacement>& placements,
++    float viewport_height,
++    const ViewportLimits& limits) {
++  const bool filter_viewport = limits.viewport_screens.has_value();
++  const int screens = std::max(0, limits.viewport_screens.value_or(0));
++  const float margin = viewport_height * screens;
++
++  ViewportSelection selection;
++  selection.kept.reserve(placements.size());
++  for (size_t i = 0; i < placements.size(); ++i) {
++    const NodePlacement& placement = placements[i];
++    if (filter_viewport &&
++        (!placement.placed ||
++         (placement.offscreen &&
++          (screens == 0 || placement.distance > margin)))) {
++      continue;
++    }
++    selection.kept.push_back(i);
++  }
++
++  selection.capped =
++      limits.max_nodes > 0 && selection.kept.size() > limits.max_nodes;
++  if (!selection.capped && !limits.viewport_first) {
++    return selection;
++  }
++
++  auto nearer = [&placements](size_t a, size_t b) {
++    return std::tie(placements[a].offscreen, placements[a].distance) <
++           std::tie(placements[b].offscreen, placements[b].distance);
++  };
++  std::stable_sort(selection.kept.begin(), selection.kept.end(), nearer);
++  if (selection.capped) {
++    // Keep the nodes nearest the viewport, then restore document order.
++    selection.kept.resize(limits.max_nodes);
++    if (!limits.viewport_first) {
++      std::sort(selection.kept.begin(), selection.kept.end());
++    }
++  }
++  return selection;
++}
++
++bool FitByteBudget(const std::vector<BudgetedNode>& nodes,
++                   size_t max_bytes,
++                   std::vector<bool>* keep) {
++  std::vector<bool> fits(nodes.size(), false);
++  size_t used = 0;
++  for (bool want_in_viewport : {true, false}) {
++    for (size_t i = 0; i < nodes.size(); ++i) {
++      if (nodes[i].in_viewport != want_in_viewport) {
++        continue;
++      }
++      if (used + nodes[i].bytes > max_bytes) {
++        *keep = std::move(fits);
++        return true;
++      }
++      used += nodes[i].bytes;
++      fits[i] = true;
++    }
++  }
++  return false;
++}
++
++}  // namespace browseros
@@ -0,0 +1,79 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_limits.h b/chrome/browser/browseros/page_content/snapshot_limits.h
+new file mode 100644
+index 0000000000000..bf035e6b23c16
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_limits.h
+@@ -0,0 +1,73 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_LIMITS_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_LIMITS_H_
++
++#include <cstddef>
++#include <limits>
++#include <optional>
++#include <vector>
++
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace browseros {
++
++// The limits an interactive snapshot can place on its nodes, applied in two
++// steps: SelectNodesNearViewport() before any batch is processed, and
++// FitByteBudget() once the serialized size of each node is known.
++
++// Where a snapshot node lies relative to the viewport.
++struct NodePlacement {
++  // False for nodes whose bounds are unknown; they sort last and are
++  // dropped by any viewport filter.
++  bool placed = false;
++  bool offscreen = true;
++  // Vertical distance from the viewport, 0 when overlapping it.
++  float distance = std::numeric_limits<float>::max();
++};
++
++// Vertical distance between |bounds| and |viewport|, 0 when they overlap.
++float VerticalDistance(const gfx::RectF& bounds, const gfx::RectF& viewport);
++
++struct ViewportLimits {
++  // Keep only nodes within this many viewport heights above or below the
++  // viewport; 0 keeps only on-screen nodes. Unset keeps everything.
++  std::optional<int> viewport_screens;
++  // Maximum number of nodes kept, nearest the viewport first; 0 for none.
++  size_t max_nodes = 0;
++  // Return the kept nodes nearest first instead of in document order.
++  bool viewport_first = false;
++};
++
++struct ViewportSelection {
++  // Indices into the placements passed in.
++  std::vector<size_t> kept;
++  // True if |max_nodes| dropped any node.
++  bool capped = false;
++};
++
++// Applies |limits| to nodes given in document order. |viewport_height| is
++// in the same units as the distances.
++ViewportSelection SelectNodesNearViewport(
++    const std::vector<NodePlacement>& placements,
++    float viewport_height,
++    const ViewportLimits& limits);
++
++// A node as the byte budget sees it.
++struct BudgetedNode {
++  size_t bytes = 0;
++  bool in_viewport = false;
++};
++
++// Picks which of |nodes| fit in |max_bytes|: in-viewport nodes first, then
++// the rest, each in order, until the first node that does not fit. Returns
++// false, leaving |keep| untouched, when all of them fit.
++bool FitByteBudget(const std::vector<BudgetedNode>& nodes,
++                   size_t max_bytes,
++                   std::vector<bool>* keep);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_SNAPSHOT_LIMITS_H_
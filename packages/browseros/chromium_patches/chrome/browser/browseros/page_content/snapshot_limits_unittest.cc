@@ -0,0 +1,141 @@
+diff --git a/chrome/browser/browseros/page_content/snapshot_limits_unittest.cc b/chrome/browser/browseros/page_content/snapshot_limits_unittest.cc
+new file mode 100644
+index 0000000000000..f5c07a9f93d4f
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/snapshot_limits_unittest.cc
+@@ -0,0 +1,135 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/snapshot_limits.h"
++
++#include <vector>
++
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++constexpr float kViewportHeight = 800.0f;
++
++NodePlacement OnScreen() {
++  return {.placed = true, .offscreen = false, .distance = 0.0f};
++}
++
++NodePlacement OffScreen(float distance) {
++  return {.placed = true, .offscreen = true, .distance = distance};
++}
++
++// A page read top to bottom: one node a screen above the viewport, two in
++// it, one half a screen below, one three screens below, and one whose
++// bounds are unknown.
++std::vector<NodePlacement> Page() {
++  return {OffScreen(900.0f), OnScreen(),          OnScreen(),
++          OffScreen(400.0f), OffScreen(2400.0f), NodePlacement()};
++}
++
++TEST(SnapshotLimitsTest, VerticalDistance) {
++  const gfx::RectF viewport(0, 0, 1000, kViewportHeight);
++  EXPECT_EQ(0.0f, VerticalDistance(gfx::RectF(10, 10, 50, 20), viewport));
++  EXPECT_EQ(0.0f, VerticalDistance(gfx::RectF(10, 790, 50, 20), viewport));
++  EXPECT_EQ(200.0f, VerticalDistance(gfx::RectF(10, 1000, 50, 20), viewport));
++  EXPECT_EQ(30.0f, VerticalDistance(gfx::RectF(10, -50, 50, 20), viewport));
++}
++
++TEST(SnapshotLimitsTest, NoLimitsKeepsEverythingInOrder) {
++  ViewportSelection selection =
++      SelectNodesNearViewport(Page(), kViewportHeight, ViewportLimits());
++  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 5}), selection.kept);
++  EXPECT_FALSE(selection.capped);
++}
++
++TEST(SnapshotLimitsTest, ZeroViewportScreensKeepsOnlyOnScreenNodes) {
++  ViewportLimits limits;
++  limits.viewport_screens = 0;
++  ViewportSelection selection =
++      SelectNodesNearViewport(Page(), kViewportHeight, limits);
++  EXPECT_EQ((std::vector<size_t>{1, 2}), selection.kept);
++  EXPECT_FALSE(selection.capped);
++}
++
++TEST(SnapshotLimitsTest, ViewportScreensKeepsNodesWithinTheMargin) {
++  ViewportLimits limits;
++  limits.viewport_screens = 1;
++  EXPECT_EQ((std::vector<size_t>{1, 2, 3}),
++            SelectNodesNearViewport(Page(), kViewportHeight, limits).kept);
++
++  limits.viewport_screens = 2;
++  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3}),
++            SelectNodesNearViewport(Page(), kViewportHeight, limits).kept);
++
++  // Nodes without bounds cannot be placed, however wide the margin.
++  limits.viewport_screens = 100;
++  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}),
++            SelectNodesNearViewport(Page(), kViewportHeight, limits).kept);
++}
++
++TEST(SnapshotLimitsTest, MaxNodesKeepsTheNearestInDocumentOrder) {
++  ViewportLimits limits;
++  limits.max_nodes = 3;
++  ViewportSelection selection =
++      SelectNodesNearViewport(Page(), kViewportHeight, limits);
++  EXPECT_EQ((std::vector<size_t>{1, 2, 3}), selection.kept);
++  EXPECT_TRUE(selection.capped);
++
++  limits.max_nodes = 6;
++  selection = SelectNodesNearViewport(Page(), kViewportHeight, limits);
++  EXPECT_EQ(6u, selection.kept.size());
++  EXPECT_FALSE(selection.capped);
++}
++
++TEST(SnapshotLimitsTest, MaxNodesAppliesAfterTheViewportFilter) {
++  ViewportLimits limits;
++  limits.viewport_screens = 0;
++  limits.max_nodes = 2;
++  ViewportSelection selection =
++      SelectNodesNearViewport(Page(), kViewportHeight, limits);
++  EXPECT_EQ((std::vector<size_t>{1, 2}), selection.kept);
++  EXPECT_FALSE(selection.capped);
++}
++
++TEST(SnapshotLimitsTest, ViewportFirstOrdersNearestFirst) {
++  ViewportLimits limits;
++  limits.viewport_first = true;
++  EXPECT_EQ((std::vector<size_t>{1, 2, 3, 0, 4, 5}),
++            SelectNodesNearViewport(Page(), kViewportHeight, limits).kept);
++
++  limits.max_nodes = 4;
++  ViewportSelection selection =
++      SelectNodesNearViewport(Page(), kViewportHeight, limits);
++  EXPECT_EQ((std::vector<size_t>{1, 2, 3, 0}), selection.kept);
++  EXPECT_TRUE(selection.capped);
++}
++
++TEST(SnapshotLimitsTest, MaxBytesKeepsEverythingThatFits) {
++  std::vector<bool> keep;
++  EXPECT_FALSE(FitByteBudget({{100, true}, {100, false}}, 200, &keep));
++  EXPECT_TRUE(keep.empty());
++}
++
++TEST(SnapshotLimitsTest, MaxBytesFillsInViewportNodesFirst) {
++  std::vector<bool> keep;
++  EXPECT_TRUE(FitByteBudget(
++      {{100, false}, {100, true}, {100, true}, {100, false}}, 300, &keep));
++  EXPECT_EQ((std::vector<bool>{true, true, true, false}), keep);
++}
++
++TEST(SnapshotLimitsTest, MaxBytesStopsAtTheFirstNodeThatDoesNotFit) {
++  // The small node after the large one would fit, but is dropped so the
++  // result never has a gap in the middle of the page.
++  std::vector<bool> keep;
++  EXPECT_TRUE(FitByteBudget({{100, true}, {500, true}, {50, true}}, 300,
++                            &keep));
++  EXPECT_EQ((std::vector<bool>{true, false, false}), keep);
++
++  EXPECT_TRUE(FitByteBudget({{500, true}, {50, false}}, 300, &keep));
++  EXPECT_EQ((std::vector<bool>{false, false}), keep);
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,121 @@
+diff --git a/chrome/browser/browseros/page_content/stable_node_ids.cc b/chrome/browser/browseros/page_content/stable_node_ids.cc
+new file mode 100644
+index 0000000000000..5ce8e2fc6dfa8
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/stable_node_ids.cc
+@@ -0,0 +1,115 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/stable_node_ids.h"
++
++#include <utility>
++
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++
++std::vector<ui::AXTreeID> GetOwningTreeIds(const ui::AXTreeUpdate& update) {
++  std::vector<ui::AXTreeID> owners(update.nodes.size(), ui::AXTreeIDUnknown());
++  if (update.nodes.empty()) {
++    return owners;
++  }
++
++  std::unordered_map<int32_t, size_t> index_by_id;
++  index_by_id.reserve(update.nodes.size());
++  for (size_t i = 0; i < update.nodes.size(); ++i) {
++    index_by_id.emplace(update.nodes[i].id, i);
++  }
++
++  const ui::AXTreeID root_tree_id =
++      update.has_tree_data ? update.tree_data.tree_id : ui::AXTreeIDUnknown();
++  std::vector<bool> visited(update.nodes.size());
++  std::vector<std::pair<size_t, ui::AXTreeID>> stack = {{0, root_tree_id}};
++  while (!stack.empty()) {
++    auto [index, tree_id] = stack.back();
++    stack.pop_back();
++    if (visited[index]) {
++      continue;
++    }
++    visited[index] = true;
++    const ui::AXNodeData& node = update.nodes[index];
++    owners[index] = tree_id;
++
++    const ui::AXTreeID child_tree_id = ui::AXTreeID::FromString(
++        node.GetStringAttribute(ax::mojom::StringAttribute::kChildTreeId));
++    const bool hosts_child_tree = child_tree_id != ui::AXTreeIDUnknown();
++    for (size_t i = 0; i < node.child_ids.size(); ++i) {
++      auto it = index_by_id.find(node.child_ids[i]);
++      if (it == index_by_id.end()) {
++        continue;
++      }
++      const bool is_child_tree_root =
++          hosts_child_tree && i + 1 == node.child_ids.size();
++      stack.emplace_back(it->second,
++                         is_child_tree_root ? child_tree_id : tree_id);
++    }
++  }
++  return owners;
++}
++
++StableNodeIds::StableNodeIds() = default;
++StableNodeIds::~StableNodeIds() = default;
++StableNodeIds::StableNodeIds(StableNodeIds&&) = default;
++StableNodeIds& StableNodeIds::operator=(StableNodeIds&&) = default;
++
++uint32_t StableNodeIds::GetOrAllocate(const StableNodeKey& key,
++                                      int32_t role,
++                                      std::string_view html_tag,
++                                      uint32_t* replaced_id) {
++  if (replaced_id) {
++    *replaced_id = 0;
++  }
++  if (key.dom_node_id == 0) {
++    unkeyed_.push_back(next_id_);
++    return next_id_++;
++  }
++
++  auto [it, inserted] = by_key_.try_emplace(key);
++  Entry& entry = it->second;
++  if (!inserted) {
++    if (entry.role == role && entry.html_tag == html_tag) {
++      return entry.id;
++    }
++    key_by_id_.erase(entry.id);
++    if (replaced_id) {
++      *replaced_id = entry.id;
++    }
++  }
++
++  entry.id = next_id_++;
++  entry.role = role;
++  entry.html_tag = std::string(html_tag);
++  key_by_id_[entry.id] = key;
++  return entry.id;
++}
++
++std::vector<uint32_t> StableNodeIds::Prune(
++    const std::set<StableNodeKey>& live_keys) {
++  std::vector<uint32_t> released = std::move(unkeyed_);
++  unkeyed_.clear();
++  for (auto it = by_key_.begin(); it != by_key_.end();) {
++    if (live_keys.contains(it->first)) {
++      ++it;
++      continue;
++    }
++    released.push_back(it->second.id);
++    key_by_id_.erase(it->second.id);
++    it = by_key_.erase(it);
++  }
++  return released;
++}
++
++const StableNodeKey* StableNodeIds::GetKey(uint32_t id) const {
++  auto it = key_by_id_.find(id);
++  return it == key_by_id_.end() ? nullptr : &it->second;
++}
++
++}  // namespace browseros
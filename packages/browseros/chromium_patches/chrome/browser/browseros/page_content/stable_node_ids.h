@@ -0,0 +1,107 @@
+diff --git a/chrome/browser/browseros/page_content/stable_node_ids.h b/chrome/browser/browseros/page_content/stable_node_ids.h
+new file mode 100644
+index 0000000000000..bc36b18214451
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/stable_node_ids.h
+@@ -0,0 +1,101 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_STABLE_NODE_IDS_H_
++#define CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_STABLE_NODE_IDS_H_
++
++#include <cstdint>
++#include <map>
++#include <set>
++#include <string>
++#include <string_view>
++#include <unordered_map>
++#include <vector>
++
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace browseros {
++
++// Identifies a DOM node within a snapshot. Blink allocates DOM node ids per
++// renderer process, so an out-of-process iframe can reuse an id the main
++// frame also uses; the id is only unique together with the AX tree (frame)
++// that owns the node.
++struct StableNodeKey {
++  ui::AXTreeID tree_id;
++  int32_t dom_node_id = 0;
++
++  friend bool operator==(const StableNodeKey&,
++                         const StableNodeKey&) = default;
++  friend bool operator<(const StableNodeKey& a, const StableNodeKey& b) {
++    if (a.tree_id != b.tree_id) {
++      return a.tree_id < b.tree_id;
++    }
++    return a.dom_node_id < b.dom_node_id;
++  }
++};
++
++// Returns, for each node of |update| by index, the id of the AX tree that
++// owns it. |update| is a combined snapshot (AXTreeSnapshotPolicy::kAll):
++// nodes belong to the update's own tree until a host node's
++// kChildTreeId, whose tree the combiner appends as the host's last child.
++// Nodes not reachable from the root get ui::AXTreeIDUnknown().
++std::vector<ui::AXTreeID> GetOwningTreeIds(const ui::AXTreeUpdate& update);
++
++// Agent-facing node ids for one tab. An id is allocated the first time a
++// DOM node is seen and reused by every later snapshot for as long as the
++// node lives, so ids the agent holds survive changes elsewhere on the page.
++//
++// Snapshots come from WebContents::RequestAXTreeSnapshot, whose tree
++// combiner renumbers AX ids on every call: one node inserted early in the
++// document shifts every later AX id. Ids are therefore keyed on the DOM node
++// id (ax::mojom::IntAttribute::kDOMNodeId), which Blink keeps for the
++// node's lifetime, together with the owning frame's tree id. A node that
++// comes back with a different role or tag is treated as a new node. Nodes
++// without a DOM node id (anonymous layout objects) get a fresh id per
++// snapshot rather than a guessed one.
++class StableNodeIds {
++ public:
++  StableNodeIds();
++  ~StableNodeIds();
++  StableNodeIds(StableNodeIds&&);
++  StableNodeIds& operator=(StableNodeIds&&);
++
++  // Returns the id for the node with |key| (whose dom_node_id is 0 if it
++  // has none), allocating one if needed. |role| is the AX role as an integer.
++  // If the node came back with a different role or tag, the id it had is
++  // released and stored in |replaced_id|; otherwise |replaced_id| is set
++  // to 0.
++  uint32_t GetOrAllocate(const StableNodeKey& key,
++                         int32_t role,
++                         std::string_view html_tag,
++                         uint32_t* replaced_id = nullptr);
++
++  // Forgets every node whose key is not in |live_keys|, and every node that
++  // had no DOM node id, and returns the ids released. Called once per
++  // snapshot, before its GetOrAllocate() calls.
++  std::vector<uint32_t> Prune(const std::set<StableNodeKey>& live_keys);
++
++  // The key |id| was allocated for, or nullptr if unknown or unkeyed.
++  const StableNodeKey* GetKey(uint32_t id) const;
++
++ private:
++  struct Entry {
++    uint32_t id;
++    int32_t role;
++    std::string html_tag;
++  };
++
++  std::map<StableNodeKey, Entry> by_key_;
++  std::unordered_map<uint32_t, StableNodeKey> key_by_id_;
++  std::vector<uint32_t> unkeyed_;
++  uint32_t next_id_ = 1;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_PAGE_CONTENT_STABLE_NODE_IDS_H_
@@ -0,0 +1,200 @@
+diff --git a/chrome/browser/browseros/page_content/stable_node_ids_unittest.cc b/chrome/browser/browseros/page_content/stable_node_ids_unittest.cc
+new file mode 100644
+index 0000000000000..b8fec363b879c
+--- /dev/null
++++ b/chrome/browser/browseros/page_content/stable_node_ids_unittest.cc
+@@ -0,0 +1,194 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/page_content/stable_node_ids.h"
++
++#include <set>
++#include <vector>
++
++#include "testing/gtest/include/gtest/gtest.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++namespace {
++
++constexpr int32_t kLink = 1;
++constexpr int32_t kButton = 2;
++
++// One node of a snapshot as the id allocator sees it. |ax_id| is what the
++// tree combiner assigned and is deliberately ignored by StableNodeIds.
++// |tree_id| is the owning frame's tree, the main frame's if unset.
++struct SnapshotNode {
++  int32_t ax_id;
++  int32_t dom_node_id;
++  int32_t role;
++  const char* tag;
++  const ui::AXTreeID* tree_id = nullptr;
++};
++
++const ui::AXTreeID& MainTreeId() {
++  static const ui::AXTreeID tree_id = ui::AXTreeID::CreateNewAXTreeID();
++  return tree_id;
++}
++
++StableNodeKey KeyOf(const SnapshotNode& node) {
++  return {node.tree_id ? *node.tree_id : MainTreeId(), node.dom_node_id};
++}
++
++// Runs one snapshot through |ids| and returns the agent id of each node.
++std::vector<uint32_t> Snapshot(StableNodeIds& ids,
++                               const std::vector<SnapshotNode>& nodes,
++                               std::vector<uint32_t>* released = nullptr) {
++  std::set<StableNodeKey> live;
++  for (const SnapshotNode& node : nodes) {
++    live.insert(KeyOf(node));
++  }
++  std::vector<uint32_t> pruned = ids.Prune(live);
++  if (released) {
++    *released = pruned;
++  }
++  std::vector<uint32_t> result;
++  for (const SnapshotNode& node : nodes) {
++    result.push_back(ids.GetOrAllocate(KeyOf(node), node.role, node.tag));
++  }
++  return result;
++}
++
++TEST(StableNodeIdsTest, InsertedNodeDoesNotShiftLaterIds) {
++  StableNodeIds ids;
++  // A list of two links.
++  std::vector<uint32_t> first =
++      Snapshot(ids, {{1, 100, kLink, "a"}, {2, 101, kLink, "a"}});
++
++  // A third link is inserted at the top. The combiner renumbers, so both
++  // existing links come back with the AX id of the link that preceded them.
++  std::vector<uint32_t> second = Snapshot(
++      ids, {{1, 99, kLink, "a"}, {2, 100, kLink, "a"}, {3, 101, kLink, "a"}});
++
++  EXPECT_EQ(first[0], second[1]);
++  EXPECT_EQ(first[1], second[2]);
++  EXPECT_NE(second[0], first[0]);
++  EXPECT_NE(second[0], first[1]);
++  EXPECT_EQ(100, ids.GetKey(first[0])->dom_node_id);
++  EXPECT_EQ(101, ids.GetKey(first[1])->dom_node_id);
++}
++
++TEST(StableNodeIdsTest, RemovedNodesAreReleased) {
++  StableNodeIds ids;
++  std::vector<uint32_t> first =
++      Snapshot(ids, {{1, 100, kLink, "a"}, {2, 101, kButton, "button"}});
++
++  std::vector<uint32_t> released;
++  std::vector<uint32_t> second =
++      Snapshot(ids, {{1, 101, kButton, "button"}}, &released);
++
++  EXPECT_EQ(std::vector<uint32_t>{first[0]}, released);
++  EXPECT_EQ(first[1], second[0]);
++  EXPECT_FALSE(ids.GetKey(first[0]));
++}
++
++TEST(StableNodeIdsTest, RoleOrTagChangeIsANewNode) {
++  StableNodeIds ids;
++  uint32_t link = Snapshot(ids, {{1, 100, kLink, "a"}})[0];
++  uint32_t button = Snapshot(ids, {{1, 100, kButton, "a"}})[0];
++  uint32_t div = Snapshot(ids, {{1, 100, kButton, "div"}})[0];
++
++  EXPECT_NE(link, button);
++  EXPECT_NE(button, div);
++  EXPECT_FALSE(ids.GetKey(link));
++  EXPECT_EQ(100, ids.GetKey(div)->dom_node_id);
++}
++
++TEST(StableNodeIdsTest, RoleChangeReportsReplacedId) {
++  StableNodeIds ids;
++  const StableNodeKey key = {MainTreeId(), 100};
++  uint32_t replaced_id = 0;
++  uint32_t link = ids.GetOrAllocate(key, kLink, "a", &replaced_id);
++  EXPECT_EQ(0u, replaced_id);
++
++  ids.Prune({key});
++  EXPECT_EQ(link, ids.GetOrAllocate(key, kLink, "a", &replaced_id));
++  EXPECT_EQ(0u, replaced_id);
++
++  // The same DOM node is now a button; the link id must not be reused.
++  ids.Prune({key});
++  uint32_t button = ids.GetOrAllocate(key, kButton, "a", &replaced_id);
++  EXPECT_NE(link, button);
++  EXPECT_EQ(link, replaced_id);
++  EXPECT_FALSE(ids.GetKey(link));
++}
++
++TEST(StableNodeIdsTest, NodesWithoutDomIdAreNeverReused) {
++  StableNodeIds ids;
++  uint32_t first = Snapshot(ids, {{1, 0, kButton, ""}})[0];
++
++  std::vector<uint32_t> released;
++  uint32_t second = Snapshot(ids, {{1, 0, kButton, ""}}, &released)[0];
++
++  EXPECT_NE(first, second);
++  EXPECT_EQ(std::vector<uint32_t>{first}, released);
++  EXPECT_FALSE(ids.GetKey(second));
++}
++
++// An out-of-process iframe allocates DOM node ids in its own renderer, so it
++// can reuse an id the main frame also uses.
++TEST(StableNodeIdsTest, FramesReusingADomNodeIdGetSeparateIds) {
++  const ui::AXTreeID frame = ui::AXTreeID::CreateNewAXTreeID();
++  StableNodeIds ids;
++  std::vector<uint32_t> first = Snapshot(
++      ids, {{1, 100, kButton, "button"}, {2, 100, kLink, "a", &frame}});
++  std::vector<uint32_t> second = Snapshot(
++      ids, {{1, 100, kButton, "button"}, {2, 100, kLink, "a", &frame}});
++
++  EXPECT_NE(first[0], first[1]);
++  EXPECT_EQ(first, second);
++  EXPECT_EQ(MainTreeId(), ids.GetKey(first[0])->tree_id);
++  EXPECT_EQ(frame, ids.GetKey(first[1])->tree_id);
++}
++
++TEST(StableNodeIdsTest, OwningTreeIdsFollowChildTrees) {
++  const ui::AXTreeID main = ui::AXTreeID::CreateNewAXTreeID();
++  const ui::AXTreeID frame = ui::AXTreeID::CreateNewAXTreeID();
++
++  // A combined update: the main frame's root holds a button and an iframe
++  // whose document, with its own button, follows as the iframe's last child.
++  ui::AXTreeUpdate update;
++  update.has_tree_data = true;
++  update.tree_data.tree_id = main;
++  update.nodes.resize(5);
++  update.nodes[0].id = 1;
++  update.nodes[0].role = ax::mojom::Role::kRootWebArea;
++  update.nodes[0].child_ids = {2, 3};
++  update.nodes[1].id = 2;
++  update.nodes[1].role = ax::mojom::Role::kButton;
++  update.nodes[1].AddIntAttribute(ax::mojom::IntAttribute::kDOMNodeId, 7);
++  update.nodes[2].id = 3;
++  update.nodes[2].role = ax::mojom::Role::kIframe;
++  update.nodes[2].AddChildTreeId(frame);
++  update.nodes[2].child_ids = {4};
++  update.nodes[3].id = 4;
++  update.nodes[3].role = ax::mojom::Role::kRootWebArea;
++  update.nodes[3].child_ids = {5};
++  update.nodes[4].id = 5;
++  update.nodes[4].role = ax::mojom::Role::kButton;
++  update.nodes[4].AddIntAttribute(ax::mojom::IntAttribute::kDOMNodeId, 7);
++
++  std::vector<ui::AXTreeID> owners = GetOwningTreeIds(update);
++  EXPECT_EQ((std::vector<ui::AXTreeID>{main, main, main, frame, frame}),
++            owners);
++
++  StableNodeIds ids;
++  ids.Prune({{owners[1], 7}, {owners[4], 7}});
++  uint32_t main_button = ids.GetOrAllocate(
++      {owners[1], 7}, static_cast<int32_t>(ax::mojom::Role::kButton), "button");
++  uint32_t frame_button = ids.GetOrAllocate(
++      {owners[4], 7}, static_cast<int32_t>(ax::mojom::Role::kButton), "button");
++  EXPECT_NE(main_button, frame_button);
++}
++
++}  // namespace
++}  // namespace browseros
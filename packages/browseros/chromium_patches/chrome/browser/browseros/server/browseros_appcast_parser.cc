@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.cc b/chrome/browser/browseros/server/browseros_appcast_parser.cc
 new file mode 100644
-index 0000000000000..dd30f75d414ec
+index 0000000000000..2554c3c54b43a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,229 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -105,6 +105,11 @@ index 0000000000000..dd30f75d414ec
 +    base::StringToInt64(it->second, &enclosure.length);
 +  }
 +
++  it = attrs.find("sparkle:deltaFrom");
++  if (it != attrs.end()) {
++    enclosure.delta_from = base::Version(it->second);
++  }
++
 +  return enclosure;
 +}
 +
@@ -123,6 +128,20 @@ index 0000000000000..dd30f75d414ec
 +  return nullptr;
 +}
 +
++const AppcastEnclosure* AppcastItem::GetDeltaForCurrentPlatform(
++    const base::Version& from) const {
++  if (!from.IsValid()) {
++    return nullptr;
++  }
++  for (const auto& delta : deltas) {
++    if (delta.delta_from.IsValid() && delta.delta_from == from &&
++        delta.MatchesCurrentPlatform()) {
++      return &delta;
++    }
++  }
++  return nullptr;
++}
++
 +// static
 +std::optional<AppcastItem> BrowserOSAppcastParser::ParseLatestItem(
 +    const std::string& xml) {
@@ -147,6 +166,7 @@ index 0000000000000..dd30f75d414ec
 +  // State machine for parsing
 +  bool in_channel = false;
 +  bool in_item = false;
++  bool in_deltas = false;
 +  AppcastItem current_item;
 +  int item_depth = 0;
 +
@@ -163,7 +183,10 @@ index 0000000000000..dd30f75d414ec
 +        item_depth = depth;
 +        current_item = AppcastItem();
 +      } else if (in_item) {
-+        if (node_name == "version" || node_name == "sparkle:version") {
++        if ((node_name == "deltas" || node_name == "sparkle:deltas") &&
++            !reader.IsEmptyElement()) {
++          in_deltas = true;
++        } else if (node_name == "version" || node_name == "sparkle:version") {
 +          std::string version_str;
 +          if (reader.ReadElementContent(&version_str)) {
 +            current_item.version = base::Version(version_str);
@@ -178,7 +201,8 @@ index 0000000000000..dd30f75d414ec
 +          if (reader.GetAllNodeAttributes(&attrs)) {
 +            AppcastEnclosure enclosure = ParseEnclosureFromAttributes(attrs);
 +            if (!enclosure.url.empty()) {
-+              current_item.enclosures.push_back(std::move(enclosure));
++              (in_deltas ? current_item.deltas : current_item.enclosures)
++                  .push_back(std::move(enclosure));
 +            }
 +          }
 +        }
@@ -187,8 +211,11 @@ index 0000000000000..dd30f75d414ec
 +      // Closing tag
 +      if (node_name == "channel") {
 +        in_channel = false;
++      } else if (node_name == "deltas" || node_name == "sparkle:deltas") {
++        in_deltas = false;
 +      } else if (node_name == "item" && in_item && depth == item_depth) {
 +        in_item = false;
++        in_deltas = false;
 +        if (current_item.version.IsValid() &&
 +            !current_item.enclosures.empty()) {
 +          items.push_back(std::move(current_item));
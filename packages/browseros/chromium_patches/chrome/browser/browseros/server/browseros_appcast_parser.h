@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.h b/chrome/browser/browseros/server/browseros_appcast_parser.h
 new file mode 100644
-index 0000000000000..bd996e8cb06d2
+index 0000000000000..465ca88d5442e
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.h
-@@ -0,0 +1,88 @@
+@@ -0,0 +1,107 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -35,6 +35,8 @@ index 0000000000000..bd996e8cb06d2
 +  std::string arch;       // "arm64", "x86_64"
 +  std::string signature;  // Ed25519 signature (base64)
 +  int64_t length = 0;
++  // For delta enclosures, the installed version the patch applies to.
++  base::Version delta_from;
 +
 +  // Returns true if this enclosure matches the current platform and arch.
 +  bool MatchesCurrentPlatform() const;
@@ -52,9 +54,16 @@ index 0000000000000..bd996e8cb06d2
 +  base::Version version;
 +  base::Time pub_date;
 +  std::vector<AppcastEnclosure> enclosures;
++  // Optional binary diffs against earlier versions (<sparkle:deltas>).
++  std::vector<AppcastEnclosure> deltas;
 +
 +  // Returns the enclosure matching the current platform, or nullptr if none.
 +  const AppcastEnclosure* GetEnclosureForCurrentPlatform() const;
++
++  // Returns the delta for the current platform that upgrades |from|, or
++  // nullptr if the feed has none.
++  const AppcastEnclosure* GetDeltaForCurrentPlatform(
++      const base::Version& from) const;
 +};
 +
 +// Parses Sparkle-style appcast XML to extract version and download information.
@@ -72,6 +81,16 @@ index 0000000000000..bd996e8cb06d2
 +//         sparkle:edSignature="base64..."
 +//         length="12345678"
 +//         type="application/zip"/>
++//       <sparkle:deltas>
++//         <enclosure
++//           url="https://..."
++//           sparkle:deltaFrom="0.29.0"
++//           sparkle:os="macos"
++//           sparkle:arch="arm64"
++//           sparkle:edSignature="base64..."
++//           length="123456"
++//           type="application/zip"/>
++//       </sparkle:deltas>
 +//     </item>
 +//   </channel>
 +// </rss>
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
 new file mode 100644
-index 0000000000000..ceb483dee35c6
+index 0000000000000..164241752e2f2
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
-@@ -0,0 +1,389 @@
+@@ -0,0 +1,487 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -391,5 +391,103 @@ index 0000000000000..ceb483dee35c6
 +  EXPECT_TRUE(item->enclosures[0].signature.empty());
 +}
 +
++// =============================================================================
++// Delta Enclosures
++// =============================================================================
++
++TEST(BrowserOSAppcastParserTest, ParsesDeltaEnclosuresSeparately) {
++  const char kDeltaXml[] = R"(
++    <rss xmlns:sparkle="http://www.andymatuschak.org/xml-namespaces/sparkle">
++      <channel>
++        <item>
++          <sparkle:version>1.1.0</sparkle:version>
++          <enclosure url="https://example.com/full.zip"
++                     sparkle:os="macos" sparkle:arch="arm64"
++                     sparkle:edSignature="full==" length="1000"/>
++          <sparkle:deltas>
++            <enclosure url="https://example.com/1.0.0-1.1.0.zip"
++                       sparkle:deltaFrom="1.0.0"
++                       sparkle:os="macos" sparkle:arch="arm64"
++                       sparkle:edSignature="delta==" length="50"/>
++            <enclosure url="https://example.com/0.9.0-1.1.0.zip"
++                       sparkle:deltaFrom="0.9.0"
++                       sparkle:os="macos" sparkle:arch="arm64"
++                       sparkle:edSignature="delta-old==" length="80"/>
++          </sparkle:deltas>
++        </item>
++      </channel>
++    </rss>
++  )";
++
++  auto item = BrowserOSAppcastParser::ParseLatestItem(kDeltaXml);
++
++  ASSERT_TRUE(item.has_value());
++  ASSERT_EQ(1u, item->enclosures.size());
++  EXPECT_EQ("https://example.com/full.zip", item->enclosures[0].url);
++  EXPECT_FALSE(item->enclosures[0].delta_from.IsValid());
++
++  ASSERT_EQ(2u, item->deltas.size());
++  EXPECT_EQ(base::Version("1.0.0"), item->deltas[0].delta_from);
++  EXPECT_EQ("delta==", item->deltas[0].signature);
++  EXPECT_EQ(50, item->deltas[0].length);
++  EXPECT_EQ(base::Version("0.9.0"), item->deltas[1].delta_from);
++}
++
++TEST(BrowserOSAppcastParserTest, EmptyDeltasElementIsIgnored) {
++  const char kEmptyDeltasXml[] = R"(
++    <rss xmlns:sparkle="http://www.andymatuschak.org/xml-namespaces/sparkle">
++      <channel>
++        <item>
++          <sparkle:version>1.1.0</sparkle:version>
++          <sparkle:deltas/>
++          <enclosure url="https://example.com/full.zip"
++                     sparkle:os="macos" sparkle:arch="arm64"/>
++        </item>
++      </channel>
++    </rss>
++  )";
++
++  auto item = BrowserOSAppcastParser::ParseLatestItem(kEmptyDeltasXml);
++
++  ASSERT_TRUE(item.has_value());
++  EXPECT_EQ(1u, item->enclosures.size());
++  EXPECT_TRUE(item->deltas.empty());
++}
++
++TEST(AppcastItemTest, GetDeltaForCurrentPlatform_MatchesFromVersion) {
++  AppcastItem item;
++  item.version = base::Version("1.1.0");
++
++  AppcastEnclosure full;
++  full.os = "linux";
++  full.arch = "x86_64";
++  full.url = "https://example.com/full.zip";
++  item.enclosures = {full};
++
++  std::vector<AppcastEnclosure> deltas;
++  for (const char* os : {"macos", "linux", "windows"}) {
++    for (const char* arch : {"arm64", "x86_64"}) {
++      AppcastEnclosure delta;
++      delta.os = os;
++      delta.arch = arch;
++      delta.delta_from = base::Version("1.0.0");
++      delta.url = std::string("https://example.com/") + os + "-" + arch;
++      deltas.push_back(delta);
++    }
++  }
++  item.deltas = deltas;
++
++  EXPECT_EQ(nullptr, item.GetDeltaForCurrentPlatform(base::Version("0.9.0")));
++  EXPECT_EQ(nullptr, item.GetDeltaForCurrentPlatform(base::Version()));
++
++#if (BUILDFLAG(IS_MAC) || BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_WIN)) && \
++    (defined(ARCH_CPU_ARM64) || defined(ARCH_CPU_X86_64))
++  const AppcastEnclosure* match =
++      item.GetDeltaForCurrentPlatform(base::Version("1.0.0"));
++  ASSERT_NE(nullptr, match);
++  EXPECT_TRUE(match->MatchesCurrentPlatform());
++#endif
++}
++
 +}  // namespace
 +}  // namespace browseros_server
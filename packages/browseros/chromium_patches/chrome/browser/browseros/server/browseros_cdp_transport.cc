@@ -0,0 +1,355 @@
+diff --git a/chrome/browser/browseros/server/browseros_cdp_transport.cc b/chrome/browser/browseros/server/browseros_cdp_transport.cc
+new file mode 100644
+index 0000000000000..558221fa8e660
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_cdp_transport.cc
+@@ -0,0 +1,349 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_cdp_transport.h"
++
++#include <utility>
++
++#include "base/check.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/stringprintf.h"
++#include "net/base/net_errors.h"
++#include "net/log/net_log_source.h"
++#include "net/socket/stream_socket.h"
++#include "net/socket/tcp_server_socket.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <errno.h>
++#include <sys/socket.h>
++#include <sys/stat.h>
++#include <unistd.h>
++
++#include "net/base/sockaddr_storage.h"
++#include "net/socket/socket_posix.h"
++#include "net/socket/unix_domain_client_socket_posix.h"
++#include "net/socket/unix_domain_server_socket_posix.h"
++#endif
++
++namespace browseros {
++
++namespace {
++
++constexpr int kBackLog = 10;
++
++std::unique_ptr<net::ServerSocket> CreateLocalHostTCPListener(int port) {
++  auto socket =
++      std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
++  if (socket->ListenWithAddressAndPort("127.0.0.1", port, kBackLog) ==
++      net::OK) {
++    return socket;
++  }
++  if (socket->ListenWithAddressAndPort("::1", port, kBackLog) == net::OK) {
++    return socket;
++  }
++  LOG(ERROR) << "browseros: CDP server failed to bind port " << port;
++  return nullptr;
++}
++
++#if BUILDFLAG(IS_POSIX)
++bool IsCurrentUser(const net::UnixDomainServerSocket::Credentials& peer) {
++  return peer.user_id == geteuid();
++}
++
++std::unique_ptr<net::ServerSocket> CreateUnixListener(
++    const base::FilePath& path) {
++  // A socket file left by a previous run would make bind() fail.
++  if (!RemoveCDPSocketFile(path)) {
++    return nullptr;
++  }
++
++  auto socket = std::make_unique<net::UnixDomainServerSocket>(
++      base::BindRepeating(&IsCurrentUser), /*use_abstract_namespace=*/false);
++  int result = socket->BindAndListen(path.value(), kBackLog);
++  if (result != net::OK) {
++    LOG(ERROR) << "browseros: CDP server failed to listen on " << path
++               << " - " << net::ErrorToString(result);
++    return nullptr;
++  }
++  return socket;
++}
++#endif
++
++}  // namespace
++
++#if BUILDFLAG(IS_POSIX)
++bool RemoveCDPSocketFile(const base::FilePath& path) {
++  struct stat info;
++  if (lstat(path.value().c_str(), &info) != 0) {
++    if (errno == ENOENT) {
++      return true;
++    }
++    PLOG(ERROR) << "browseros: Cannot inspect CDP socket path " << path;
++    return false;
++  }
++  if (!S_ISSOCK(info.st_mode)) {
++    LOG(ERROR) << "browseros: CDP socket path " << path
++               << " exists and is not a socket, not replacing it";
++    return false;
++  }
++  if (unlink(path.value().c_str()) != 0 && errno != ENOENT) {
++    PLOG(ERROR) << "browseros: Failed to remove stale CDP socket " << path;
++    return false;
++  }
++  return true;
++}
++#endif
++
++// =============================================================================
++// CDPPipeConnections
++// =============================================================================
++
++CDPPipeConnections::CDPPipeConnections() = default;
++CDPPipeConnections::~CDPPipeConnections() = default;
++
++#if BUILDFLAG(IS_POSIX)
++base::ScopedFD CDPPipeConnections::CreateConnection() {
++  int fds[2];
++  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
++    PLOG(ERROR) << "browseros: Failed to create CDP pipe";
++    return base::ScopedFD();
++  }
++  base::ScopedFD server_end(fds[0]);
++  base::ScopedFD child_end(fds[1]);
++
++  base::AutoLock lock(lock_);
++  pending_.push_back(std::move(server_end));
++  if (listener_task_runner_) {
++    listener_task_runner_->PostTask(FROM_HERE, on_available_);
++  }
++  return child_end;
++}
++
++std::vector<base::ScopedFD> CDPPipeConnections::TakePending() {
++  base::AutoLock lock(lock_);
++  return std::exchange(pending_, {});
++}
++#endif
++
++void CDPPipeConnections::SetListener(
++    scoped_refptr<base::SequencedTaskRunner> task_runner,
++    base::RepeatingClosure on_available) {
++  base::AutoLock lock(lock_);
++  listener_task_runner_ = std::move(task_runner);
++  on_available_ = std::move(on_available);
++}
++
++void CDPPipeConnections::ClearListener() {
++  base::AutoLock lock(lock_);
++  listener_task_runner_.reset();
++  on_available_.Reset();
++}
++
++// =============================================================================
++// CDPTransportOptions
++// =============================================================================
++
++CDPTransportOptions::CDPTransportOptions() = default;
++CDPTransportOptions::CDPTransportOptions(const CDPTransportOptions&) =
++    default;
++CDPTransportOptions& CDPTransportOptions::operator=(
++    const CDPTransportOptions&) = default;
++CDPTransportOptions::~CDPTransportOptions() = default;
++
++std::string CDPTransportOptions::DebugString() const {
++  return base::StringPrintf(
++      "CDPTransportOptions{tcp_port=%d unix_socket=%s pipe=%s}", tcp_port,
++      unix_socket_path.AsUTF8Unsafe().c_str(),
++      pipe_connections ? "true" : "false");
++}
++
++// =============================================================================
++// CDPServerSocket
++// =============================================================================
++
++CDPServerSocket::Listener::Listener() = default;
++CDPServerSocket::Listener::~Listener() = default;
++CDPServerSocket::Listener::Listener(Listener&&) = default;
++CDPServerSocket::Listener& CDPServerSocket::Listener::operator=(Listener&&) =
++    default;
++
++CDPServerSocket::CDPServerSocket(
++    std::vector<std::unique_ptr<net::ServerSocket>> listeners,
++    scoped_refptr<CDPPipeConnections> pipe_connections)
++    : pipe_connections_(std::move(pipe_connections)) {
++  for (auto& socket : listeners) {
++    Listener listener;
++    listener.socket = std::move(socket);
++    listeners_.push_back(std::move(listener));
++  }
++  if (pipe_connections_) {
++    pipe_connections_->SetListener(
++        base::SequencedTaskRunner::GetCurrentDefault(),
++        base::BindRepeating(&CDPServerSocket::OnPipeConnectionAvailable,
++                            weak_ptr_factory_.GetWeakPtr()));
++  }
++}
++
++CDPServerSocket::~CDPServerSocket() {
++  if (pipe_connections_) {
++    pipe_connections_->ClearListener();
++  }
++}
++
++// static
++std::unique_ptr<CDPServerSocket> CDPServerSocket::Create(
++    const CDPTransportOptions& options) {
++  std::vector<std::unique_ptr<net::ServerSocket>> listeners;
++  if (options.tcp_port > 0) {
++    if (auto listener = CreateLocalHostTCPListener(options.tcp_port)) {
++      listeners.push_back(std::move(listener));
++    }
++  }
++
++  scoped_refptr<CDPPipeConnections> pipe_connections;
++#if BUILDFLAG(IS_POSIX)
++  if (!options.unix_socket_path.empty()) {
++    if (auto listener = CreateUnixListener(options.unix_socket_path)) {
++      listeners.push_back(std::move(listener));
++    }
++  }
++  pipe_connections = options.pipe_connections;
++#else
++  if (!options.unix_socket_path.empty() || options.pipe_connections) {
++    LOG(WARNING) << "browseros: CDP Unix socket and pipe transports are "
++                    "only supported on POSIX";
++  }
++#endif
++
++  if (listeners.empty() && !pipe_connections) {
++    return nullptr;
++  }
++  return std::make_unique<CDPServerSocket>(std::move(listeners),
++                                           std::move(pipe_connections));
++}
++
++int CDPServerSocket::Listen(const net::IPEndPoint& address,
++                            int backlog,
++                            std::optional<bool> ipv6_only) {
++  // Listeners are bound by Create().
++  return net::ERR_NOT_IMPLEMENTED;
++}
++
++int CDPServerSocket::GetLocalAddress(net::IPEndPoint* address) const {
++  for (const Listener& listener : listeners_) {
++    if (listener.socket->GetLocalAddress(address) == net::OK) {
++      return net::OK;
++    }
++  }
++  return net::ERR_ADDRESS_INVALID;
++}
++
++int CDPServerSocket::Accept(std::unique_ptr<net::StreamSocket>* socket,
++                            net::CompletionOnceCallback callback) {
++  DCHECK(!pending_callback_);
++
++  TakePipeConnections();
++  StartListenerAccepts();
++  if (!ready_.empty()) {
++    *socket = std::move(ready_.front());
++    ready_.pop_front();
++    return net::OK;
++  }
++
++  pending_socket_ = socket;
++  pending_callback_ = std::move(callback);
++  return net::ERR_IO_PENDING;
++}
++
++void CDPServerSocket::StartListenerAccepts() {
++  for (size_t i = 0; i < listeners_.size(); ++i) {
++    Listener& listener = listeners_[i];
++    if (listener.accept_pending || listener.failed) {
++      continue;
++    }
++    int result = listener.socket->Accept(
++        &listener.accepted,
++        base::BindOnce(&CDPServerSocket::OnListenerAccept,
++                       weak_ptr_factory_.GetWeakPtr(), i));
++    if (result == net::ERR_IO_PENDING) {
++      listener.accept_pending = true;
++      continue;
++    }
++    HandleAcceptResult(listener, result);
++  }
++}
++
++void CDPServerSocket::OnListenerAccept(size_t index, int result) {
++  Listener& listener = listeners_[index];
++  listener.accept_pending = false;
++  HandleAcceptResult(listener, result);
++  MaybeCompleteAccept();
++}
++
++void CDPServerSocket::HandleAcceptResult(Listener& listener, int result) {
++  if (result == net::OK) {
++    ready_.push_back(std::move(listener.accepted));
++    return;
++  }
++  LOG(ERROR) << "browseros: CDP listener stopped accepting - "
++             << net::ErrorToString(result);
++  listener.failed = true;
++}
++
++void CDPServerSocket::TakePipeConnections() {
++#if BUILDFLAG(IS_POSIX)
++  if (!pipe_connections_) {
++    return;
++  }
++  for (base::ScopedFD& fd : pipe_connections_->TakePending()) {
++    auto socket = std::make_unique<net::SocketPosix>();
++    int result =
++        socket->AdoptConnectedSocket(fd.release(), net::SockaddrStorage());
++    if (result != net::OK) {
++      LOG(ERROR) << "browseros: Failed to adopt CDP pipe - "
++                 << net::ErrorToString(result);
++      continue;
++    }
++    ready_.push_back(
++        std::make_unique<net::UnixDomainClientSocket>(std::move(socket)));
++  }
++#endif
++}
++
++void CDPServerSocket::OnPipeConnectionAvailable() {
++  TakePipeConnections();
++  MaybeCompleteAccept();
++}
++
++void CDPServerSocket::MaybeCompleteAccept() {
++  if (!pending_callback_ || ready_.empty()) {
++    return;
++  }
++  *pending_socket_ = std::move(ready_.front());
++  ready_.pop_front();
++  pending_socket_ = nullptr;
++  std::move(pending_callback_).Run(net::OK);
++}
++
++// =============================================================================
++// CDPServerSocketFactory
++// =============================================================================
++
++CDPServerSocketFactory::CDPServerSocketFactory(CDPTransportOptions options)
++    : options_(std::move(options)) {}
++
++CDPServerSocketFactory::~CDPServerSocketFactory() = default;
++
++std::unique_ptr<net::ServerSocket>
++CDPServerSocketFactory::CreateForHttpServer() {
++  return CDPServerSocket::Create(options_);
++}
++
++std::unique_ptr<net::ServerSocket> CDPServerSocketFactory::CreateForTethering(
++    std::string* name) {
++  return nullptr;
++}
++
++}  // namespace browseros
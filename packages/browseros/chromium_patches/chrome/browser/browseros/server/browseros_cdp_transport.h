@@ -0,0 +1,191 @@
+diff --git a/chrome/browser/browseros/server/browseros_cdp_transport.h b/chrome/browser/browseros/server/browseros_cdp_transport.h
+new file mode 100644
+index 0000000000000..bc1921f571ad1
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_cdp_transport.h
+@@ -0,0 +1,185 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_CDP_TRANSPORT_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_CDP_TRANSPORT_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/circular_deque.h"
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/weak_ptr.h"
++#include "base/synchronization/lock.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/thread_annotations.h"
++#include "build/build_config.h"
++#include "content/public/browser/devtools_socket_factory.h"
++#include "net/base/completion_once_callback.h"
++#include "net/socket/server_socket.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "base/files/scoped_file.h"
++#endif
++
++namespace net {
++class StreamSocket;
++}  // namespace net
++
++namespace browseros {
++
++// Connections handed to the sidecar as an inherited socket instead of being
++// dialled over TCP. Each CreateConnection() makes a connected socket pair,
++// queues one end for the CDP server to accept and returns the other for the
++// caller to pass to the child process.
++//
++// Thread-safe: connections are created on the UI thread and accepted on the
++// DevTools handler thread.
++class CDPPipeConnections
++    : public base::RefCountedThreadSafe<CDPPipeConnections> {
++ public:
++  CDPPipeConnections();
++
++  CDPPipeConnections(const CDPPipeConnections&) = delete;
++  CDPPipeConnections& operator=(const CDPPipeConnections&) = delete;
++
++#if BUILDFLAG(IS_POSIX)
++  // Returns the child's end, or an invalid fd if the pair can't be created.
++  base::ScopedFD CreateConnection();
++
++  // Returns the server ends queued since the last call.
++  std::vector<base::ScopedFD> TakePending();
++#endif
++
++  // Runs |on_available| on |task_runner| whenever a connection is queued.
++  void SetListener(scoped_refptr<base::SequencedTaskRunner> task_runner,
++                   base::RepeatingClosure on_available);
++  void ClearListener();
++
++ private:
++  friend class base::RefCountedThreadSafe<CDPPipeConnections>;
++  ~CDPPipeConnections();
++
++  base::Lock lock_;
++#if BUILDFLAG(IS_POSIX)
++  std::vector<base::ScopedFD> pending_ GUARDED_BY(lock_);
++#endif
++  scoped_refptr<base::SequencedTaskRunner> listener_task_runner_
++      GUARDED_BY(lock_);
++  base::RepeatingClosure on_available_ GUARDED_BY(lock_);
++};
++
++// Where the CDP server accepts connections. Any combination may be enabled.
++struct CDPTransportOptions {
++  CDPTransportOptions();
++  CDPTransportOptions(const CDPTransportOptions&);
++  CDPTransportOptions& operator=(const CDPTransportOptions&);
++  ~CDPTransportOptions();
++
++  // Loopback TCP port; 0 disables TCP.
++  int tcp_port = 0;
++  // Unix domain socket path, restricted to the current user; empty disables
++  // it. POSIX only.
++  base::FilePath unix_socket_path;
++  // Inherited sidecar connections; null disables them. POSIX only.
++  scoped_refptr<CDPPipeConnections> pipe_connections;
++
++  // Returns a debug string for logging.
++  std::string DebugString() const;
++};
++
++// A server socket that accepts from several listeners (TCP, Unix domain
++// socket) and from CDPPipeConnections, so one DevTools HTTP server serves
++// every transport. A listener that fails is logged and dropped without
++// stopping the others.
++class CDPServerSocket : public net::ServerSocket {
++ public:
++  CDPServerSocket(std::vector<std::unique_ptr<net::ServerSocket>> listeners,
++                  scoped_refptr<CDPPipeConnections> pipe_connections);
++  ~CDPServerSocket() override;
++
++  CDPServerSocket(const CDPServerSocket&) = delete;
++  CDPServerSocket& operator=(const CDPServerSocket&) = delete;
++
++  // Binds every transport enabled in |options|. Returns null if none could
++  // be bound.
++  static std::unique_ptr<CDPServerSocket> Create(
++      const CDPTransportOptions& options);
++
++  // net::ServerSocket:
++  int Listen(const net::IPEndPoint& address,
++             int backlog,
++             std::optional<bool> ipv6_only) override;
++  int GetLocalAddress(net::IPEndPoint* address) const override;
++  int Accept(std::unique_ptr<net::StreamSocket>* socket,
++             net::CompletionOnceCallback callback) override;
++
++ private:
++  struct Listener {
++    Listener();
++    ~Listener();
++    Listener(Listener&&);
++    Listener& operator=(Listener&&);
++
++    std::unique_ptr<net::ServerSocket> socket;
++    std::unique_ptr<net::StreamSocket> accepted;
++    bool accept_pending = false;
++    bool failed = false;
++  };
++
++  // Starts an accept on every idle listener. Connections accepted
++  // synchronously are queued in |ready_|.
++  void StartListenerAccepts();
++  void OnListenerAccept(size_t index, int result);
++  void HandleAcceptResult(Listener& listener, int result);
++  void TakePipeConnections();
++  void OnPipeConnectionAvailable();
++
++  // Hands the oldest ready connection to the pending Accept(), if any.
++  void MaybeCompleteAccept();
++
++  std::vector<Listener> listeners_;
++  scoped_refptr<CDPPipeConnections> pipe_connections_;
++  base::circular_deque<std::unique_ptr<net::StreamSocket>> ready_;
++
++  raw_ptr<std::unique_ptr<net::StreamSocket>> pending_socket_ = nullptr;
++  net::CompletionOnceCallback pending_callback_;
++
++  base::WeakPtrFactory<CDPServerSocket> weak_ptr_factory_{this};
++};
++
++// DevToolsSocketFactory that serves CDP over every transport in |options|.
++class CDPServerSocketFactory : public content::DevToolsSocketFactory {
++ public:
++  explicit CDPServerSocketFactory(CDPTransportOptions options);
++  ~CDPServerSocketFactory() override;
++
++  CDPServerSocketFactory(const CDPServerSocketFactory&) = delete;
++  CDPServerSocketFactory& operator=(const CDPServerSocketFactory&) = delete;
++
++ private:
++  // content::DevToolsSocketFactory:
++  std::unique_ptr<net::ServerSocket> CreateForHttpServer() override;
++  std::unique_ptr<net::ServerSocket> CreateForTethering(
++      std::string* name) override;
++
++  const CDPTransportOptions options_;
++};
++
++#if BUILDFLAG(IS_POSIX)
++// Removes the Unix domain socket at |path| so it can be bound again. Returns
++// true if nothing is left at |path|. Anything other than a socket is left in
++// place and false returned, so a mistyped --browseros-cdp-socket never
++// deletes a regular file.
++bool RemoveCDPSocketFile(const base::FilePath& path);
++#endif
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_CDP_TRANSPORT_H_
@@ -0,0 +1,145 @@
+diff --git a/chrome/browser/browseros/server/browseros_cdp_transport_unittest.cc b/chrome/browser/browseros/server/browseros_cdp_transport_unittest.cc
+new file mode 100644
+index 0000000000000..33fab153ae252
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_cdp_transport_unittest.cc
+@@ -0,0 +1,139 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_cdp_transport.h"
++
++#include <memory>
++#include <string>
++#include <utility>
++
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/test/task_environment.h"
++#include "net/base/io_buffer.h"
++#include "net/base/net_errors.h"
++#include "net/base/test_completion_callback.h"
++#include "net/socket/stream_socket.h"
++#include "net/socket/unix_domain_client_socket_posix.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++class CDPTransportTest : public testing::Test {
++ protected:
++  // Reads whatever |socket| has buffered, up to 64 bytes.
++  std::string Read(net::StreamSocket* socket) {
++    auto buffer = base::MakeRefCounted<net::IOBufferWithSize>(64);
++    net::TestCompletionCallback callback;
++    int result = callback.GetResult(
++        socket->Read(buffer.get(), buffer->size(), callback.callback()));
++    if (result <= 0) {
++      return std::string();
++    }
++    return std::string(buffer->data(), result);
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::MainThreadType::IO};
++};
++
++TEST_F(CDPTransportTest, NoTransportsCreatesNothing) {
++  EXPECT_FALSE(CDPServerSocket::Create(CDPTransportOptions()));
++}
++
++TEST_F(CDPTransportTest, AcceptsQueuedPipeConnection) {
++  CDPTransportOptions options;
++  options.pipe_connections = base::MakeRefCounted<CDPPipeConnections>();
++  std::unique_ptr<CDPServerSocket> server = CDPServerSocket::Create(options);
++  ASSERT_TRUE(server);
++
++  base::ScopedFD child_end = options.pipe_connections->CreateConnection();
++  ASSERT_TRUE(child_end.is_valid());
++  ASSERT_TRUE(base::WriteFileDescriptor(child_end.get(), "ping"));
++
++  std::unique_ptr<net::StreamSocket> accepted;
++  net::TestCompletionCallback callback;
++  ASSERT_EQ(net::OK, server->Accept(&accepted, callback.callback()));
++  ASSERT_TRUE(accepted);
++  EXPECT_EQ("ping", Read(accepted.get()));
++}
++
++TEST_F(CDPTransportTest, ReplacesStaleUnixSocket) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++
++  CDPTransportOptions options;
++  options.unix_socket_path = temp_dir.GetPath().AppendASCII("cdp.sock");
++  // Closing a listener leaves its socket file behind.
++  ASSERT_TRUE(CDPServerSocket::Create(options));
++  ASSERT_TRUE(base::PathExists(options.unix_socket_path));
++
++  EXPECT_TRUE(CDPServerSocket::Create(options));
++}
++
++TEST_F(CDPTransportTest, KeepsNonSocketAtUnixSocketPath) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++
++  CDPTransportOptions options;
++  options.unix_socket_path = temp_dir.GetPath().AppendASCII("notes.txt");
++  ASSERT_TRUE(base::WriteFile(options.unix_socket_path, "keep me"));
++
++  EXPECT_FALSE(CDPServerSocket::Create(options));
++  EXPECT_FALSE(RemoveCDPSocketFile(options.unix_socket_path));
++  std::string contents;
++  ASSERT_TRUE(base::ReadFileToString(options.unix_socket_path, &contents));
++  EXPECT_EQ("keep me", contents);
++}
++
++TEST_F(CDPTransportTest, PendingAcceptCompletesWhenPipeConnects) {
++  CDPTransportOptions options;
++  options.pipe_connections = base::MakeRefCounted<CDPPipeConnections>();
++  std::unique_ptr<CDPServerSocket> server = CDPServerSocket::Create(options);
++  ASSERT_TRUE(server);
++
++  std::unique_ptr<net::StreamSocket> accepted;
++  net::TestCompletionCallback callback;
++  ASSERT_EQ(net::ERR_IO_PENDING,
++            server->Accept(&accepted, callback.callback()));
++
++  base::ScopedFD child_end = options.pipe_connections->CreateConnection();
++  ASSERT_TRUE(child_end.is_valid());
++  EXPECT_EQ(net::OK, callback.WaitForResult());
++  EXPECT_TRUE(accepted);
++}
++
++TEST_F(CDPTransportTest, AcceptsUnixSocketConnection) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++
++  CDPTransportOptions options;
++  options.unix_socket_path = temp_dir.GetPath().AppendASCII("cdp.sock");
++  std::unique_ptr<CDPServerSocket> server = CDPServerSocket::Create(options);
++  ASSERT_TRUE(server);
++
++  std::unique_ptr<net::StreamSocket> accepted;
++  net::TestCompletionCallback accept_callback;
++  int accept_result = server->Accept(&accepted, accept_callback.callback());
++
++  net::UnixDomainClientSocket client(options.unix_socket_path.value(),
++                                     /*use_abstract_namespace=*/false);
++  net::TestCompletionCallback connect_callback;
++  ASSERT_EQ(net::OK, connect_callback.GetResult(
++                         client.Connect(connect_callback.callback())));
++  ASSERT_EQ(net::OK, accept_callback.GetResult(accept_result));
++  ASSERT_TRUE(accepted);
++
++  auto buffer = base::MakeRefCounted<net::StringIOBuffer>("ping");
++  net::TestCompletionCallback write_callback;
++  ASSERT_EQ(4, write_callback.GetResult(client.Write(
++                   buffer.get(), buffer->size(), write_callback.callback(),
++                   TRAFFIC_ANNOTATION_FOR_TESTS)));
++  EXPECT_EQ("ping", Read(accepted.get()));
++}
++
++}  // namespace
++}  // namespace browseros
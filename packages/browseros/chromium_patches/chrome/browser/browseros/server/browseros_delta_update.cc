@@ -0,0 +1,211 @@
+diff --git a/chrome/browser/browseros/server/browseros_delta_update.cc b/chrome/browser/browseros/server/browseros_delta_update.cc
+new file mode 100644
+index 0000000000000..145e3c9a207b3
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_delta_update.cc
+@@ -0,0 +1,205 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_delta_update.h"
++
++#include <memory>
++#include <optional>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/json/json_reader.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/values.h"
++#include "build/build_config.h"
++#include "components/zucchini/zucchini.h"
++#include "components/zucchini/zucchini_integration.h"
++#include "crypto/secure_hash.h"
++#include "crypto/sha2.h"
++
++namespace browseros_server {
++
++namespace {
++
++constexpr char kManifestFileName[] = "manifest.json";
++constexpr char kPatchesDirectoryName[] = "patches";
++constexpr char kFilesDirectoryName[] = "files";
++
++// Manifests are small; anything bigger is not a delta we produced.
++constexpr size_t kMaxManifestSize = 1024 * 1024;
++
++constexpr size_t kHashChunkSize = 64 * 1024;
++
++// Returns the lowercase hex SHA-256 of a file, streamed in chunks.
++std::optional<std::string> HashFile(const base::FilePath& path) {
++  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
++  if (!file.IsValid()) {
++    return std::nullopt;
++  }
++
++  std::unique_ptr<crypto::SecureHash> hash =
++      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
++  std::vector<uint8_t> buffer(kHashChunkSize);
++  while (true) {
++    std::optional<size_t> read = file.ReadAtCurrentPos(buffer);
++    if (!read) {
++      return std::nullopt;
++    }
++    if (*read == 0) {
++      break;
++    }
++    hash->Update(buffer.data(), *read);
++  }
++
++  uint8_t digest[crypto::kSHA256Length];
++  hash->Finish(digest, sizeof(digest));
++  return base::ToLowerASCII(base::HexEncode(digest));
++}
++
++// Manifest paths must stay inside the version directory.
++std::optional<base::FilePath> ParseRelativePath(const std::string& path) {
++  if (path.empty()) {
++    return std::nullopt;
++  }
++  base::FilePath relative = base::FilePath::FromUTF8Unsafe(path);
++  if (relative.IsAbsolute() || relative.ReferencesParent()) {
++    return std::nullopt;
++  }
++  return relative;
++}
++
++#if BUILDFLAG(IS_POSIX)
++void CopyPermissions(const base::FilePath& from, const base::FilePath& to) {
++  int mode = 0;
++  if (base::GetPosixFilePermissions(from, &mode)) {
++    base::SetPosixFilePermissions(to, mode);
++  }
++}
++#endif
++
++std::string ApplyEntry(const base::Value::Dict& entry,
++                       const base::FilePath& delta_dir,
++                       const base::FilePath& from_dir,
++                       const base::FilePath& dest_dir) {
++  const std::string* path = entry.FindString("path");
++  const std::string* op = entry.FindString("op");
++  const std::string* sha256 = entry.FindString("sha256");
++  if (!path || !op || !sha256) {
++    return "Delta manifest entry is missing path, op or sha256";
++  }
++
++  std::optional<base::FilePath> relative = ParseRelativePath(*path);
++  if (!relative) {
++    return "Delta manifest has invalid path: " + *path;
++  }
++
++  base::FilePath target = dest_dir.Append(*relative);
++  if (!base::CreateDirectory(target.DirName())) {
++    return "Failed to create directory for " + *path;
++  }
++
++  base::FilePath base_file = from_dir.Append(*relative);
++  if (*op == "copy") {
++    if (!base::CopyFile(base_file, target)) {
++      return "Failed to copy " + *path + " from base version";
++    }
++  } else if (*op == "patch") {
++    base::FilePath patch =
++        delta_dir.AppendASCII(kPatchesDirectoryName).Append(*relative);
++    zucchini::status::Code status =
++        zucchini::Apply(base_file, patch, target, /*force_keep=*/false);
++    if (status != zucchini::status::kStatusSuccess) {
++      return "Failed to patch " + *path + " (zucchini status " +
++             base::NumberToString(static_cast<int>(status)) + ")";
++    }
++  } else if (*op == "add") {
++    base::FilePath source =
++        delta_dir.AppendASCII(kFilesDirectoryName).Append(*relative);
++    if (!base::CopyFile(source, target)) {
++      return "Failed to add " + *path;
++    }
++  } else {
++    return "Delta manifest has unknown op: " + *op;
++  }
++
++#if BUILDFLAG(IS_POSIX)
++  if (*op == "add") {
++    if (entry.FindBool("executable").value_or(false)) {
++      base::SetPosixFilePermissions(target, 0755);
++    }
++  } else {
++    CopyPermissions(base_file, target);
++  }
++#endif
++
++  std::optional<std::string> actual = HashFile(target);
++  if (!actual || *actual != base::ToLowerASCII(*sha256)) {
++    return "Rebuilt file does not match expected hash: " + *path;
++  }
++  return "";
++}
++
++}  // namespace
++
++std::string ApplyDeltaPackage(const base::FilePath& delta_dir,
++                              const base::Version& from_version,
++                              const base::FilePath& from_dir,
++                              const base::Version& to_version,
++                              const base::FilePath& dest_dir) {
++  if (!base::DirectoryExists(from_dir)) {
++    return "Base version directory is missing: " + from_dir.AsUTF8Unsafe();
++  }
++
++  std::string manifest_json;
++  if (!base::ReadFileToStringWithMaxSize(
++          delta_dir.AppendASCII(kManifestFileName), &manifest_json,
++          kMaxManifestSize)) {
++    return "Failed to read delta manifest";
++  }
++
++  std::optional<base::Value::Dict> manifest =
++      base::JSONReader::ReadDict(manifest_json);
++  if (!manifest) {
++    return "Failed to parse delta manifest";
++  }
++
++  const std::string* from = manifest->FindString("from");
++  const std::string* to = manifest->FindString("to");
++  if (!from || !to || base::Version(*from) != from_version ||
++      base::Version(*to) != to_version) {
++    return "Delta manifest does not match " + from_version.GetString() +
++           " -> " + to_version.GetString();
++  }
++
++  const base::Value::List* files = manifest->FindList("files");
++  if (!files || files->empty()) {
++    return "Delta manifest has no files";
++  }
++
++  if (!base::CreateDirectory(dest_dir)) {
++    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
++  }
++
++  for (const base::Value& value : *files) {
++    if (!value.is_dict()) {
++      return "Delta manifest entry is not an object";
++    }
++    std::string error =
++        ApplyEntry(value.GetDict(), delta_dir, from_dir, dest_dir);
++    if (!error.empty()) {
++      return error;
++    }
++  }
++
++  LOG(INFO) << "browseros: Applied delta " << from_version.GetString()
++            << " -> " << to_version.GetString() << " (" << files->size()
++            << " files)";
++  return "";  // Success
++}
++
++}  // namespace browseros_server
@@ -0,0 +1,54 @@
+diff --git a/chrome/browser/browseros/server/browseros_delta_update.h b/chrome/browser/browseros/server/browseros_delta_update.h
+new file mode 100644
+index 0000000000000..a1c7c054ffad9
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_delta_update.h
+@@ -0,0 +1,48 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DELTA_UPDATE_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DELTA_UPDATE_H_
++
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/version.h"
++
++namespace browseros_server {
++
++// Rebuilds versions/{to}/ from versions/{from}/ and an extracted delta
++// package. The delta is a ZIP signed like a full package, containing:
++//
++//   manifest.json
++//     {
++//       "from": "0.30.0",
++//       "to": "0.31.0",
++//       "files": [
++//         {"path": "bin/browseros_server", "op": "patch", "sha256": "..."},
++//         {"path": "resources/new.js", "op": "add", "sha256": "..."},
++//         {"path": "resources/same.js", "op": "copy", "sha256": "..."}
++//       ]
++//     }
++//   patches/<path>  Zucchini patch from {from}/<path> to the new file
++//   files/<path>    Complete new file
++//
++// "files" lists every file of the new version; anything else in {from} is
++// dropped. Every rebuilt file is checked against its SHA-256, so a corrupted
++// base install or a bad patch fails instead of producing a broken version.
++// Add "executable": true to set the execute bit on "add" entries; patched
++// and copied files keep the base file's permissions.
++//
++// Returns empty string on success, error message on failure. |dest_dir| may
++// be partially written on failure; the caller removes it.
++// Must be called from a thread that allows blocking.
++std::string ApplyDeltaPackage(const base::FilePath& delta_dir,
++                              const base::Version& from_version,
++                              const base::FilePath& from_dir,
++                              const base::Version& to_version,
++                              const base::FilePath& dest_dir);
++
++}  // namespace browseros_server
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DELTA_UPDATE_H_
@@ -0,0 +1,221 @@
+diff --git a/chrome/browser/browseros/server/browseros_delta_update_unittest.cc b/chrome/browser/browseros/server/browseros_delta_update_unittest.cc
+new file mode 100644
+index 0000000000000..ce9faef9f6151
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_delta_update_unittest.cc
+@@ -0,0 +1,215 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_delta_update.h"
++
++#include <string>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_writer.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/values.h"
++#include "build/build_config.h"
++#include "components/zucchini/buffer_view.h"
++#include "components/zucchini/patch_writer.h"
++#include "components/zucchini/zucchini.h"
++#include "crypto/sha2.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros_server {
++namespace {
++
++std::string Sha256Hex(const std::string& data) {
++  return base::ToLowerASCII(base::HexEncode(crypto::SHA256HashString(data)));
++}
++
++// Builds a base version directory and delta packages in a temp dir, standing
++// in for the extracted contents of a downloaded delta ZIP.
++class DeltaUpdateTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    base::FilePath versions_dir = temp_dir_.GetPath().AppendASCII("versions");
++    from_dir_ = versions_dir.AppendASCII("1.0.0");
++    delta_dir_ = temp_dir_.GetPath().AppendASCII("delta");
++    dest_dir_ = versions_dir.AppendASCII("1.1.0");
++    ASSERT_TRUE(base::CreateDirectory(from_dir_));
++    ASSERT_TRUE(base::CreateDirectory(delta_dir_));
++  }
++
++  void WriteFile(const base::FilePath& path, const std::string& contents) {
++    ASSERT_TRUE(base::CreateDirectory(path.DirName()));
++    ASSERT_TRUE(base::WriteFile(path, contents));
++  }
++
++  // Writes a Zucchini raw patch turning |old_contents| into |new_contents|.
++  void WritePatch(const std::string& relative,
++                  const std::string& old_contents,
++                  const std::string& new_contents) {
++    zucchini::ConstBufferView old_image(
++        reinterpret_cast<const uint8_t*>(old_contents.data()),
++        old_contents.size());
++    zucchini::ConstBufferView new_image(
++        reinterpret_cast<const uint8_t*>(new_contents.data()),
++        new_contents.size());
++    zucchini::EnsemblePatchWriter writer(old_image, new_image);
++    ASSERT_EQ(zucchini::status::kStatusSuccess,
++              zucchini::GenerateBufferRaw(old_image, new_image, &writer));
++
++    std::vector<uint8_t> patch(writer.SerializedSize());
++    ASSERT_TRUE(writer.SerializeInto({patch.data(), patch.size()}));
++    base::FilePath path =
++        delta_dir_.AppendASCII("patches").AppendASCII(relative);
++    ASSERT_TRUE(base::CreateDirectory(path.DirName()));
++    ASSERT_TRUE(base::WriteFile(path, patch));
++  }
++
++  base::Value::Dict Entry(const std::string& path,
++                          const std::string& op,
++                          const std::string& contents) {
++    return base::Value::Dict()
++        .Set("path", path)
++        .Set("op", op)
++        .Set("sha256", Sha256Hex(contents));
++  }
++
++  void WriteManifest(base::Value::List files,
++                     const std::string& from = "1.0.0",
++                     const std::string& to = "1.1.0") {
++    base::Value::Dict manifest;
++    manifest.Set("from", from);
++    manifest.Set("to", to);
++    manifest.Set("files", std::move(files));
++    WriteFile(delta_dir_.AppendASCII("manifest.json"),
++              *base::WriteJson(manifest));
++  }
++
++  std::string Apply() {
++    return ApplyDeltaPackage(delta_dir_, base::Version("1.0.0"), from_dir_,
++                             base::Version("1.1.0"), dest_dir_);
++  }
++
++  std::string ReadDest(const std::string& relative) {
++    std::string contents;
++    EXPECT_TRUE(
++        base::ReadFileToString(dest_dir_.AppendASCII(relative), &contents));
++    return contents;
++  }
++
++  base::ScopedTempDir temp_dir_;
++  base::FilePath from_dir_;
++  base::FilePath delta_dir_;
++  base::FilePath dest_dir_;
++};
++
++// =============================================================================
++// Successful Application
++// =============================================================================
++
++TEST_F(DeltaUpdateTest, AppliesPatchCopyAndAdd) {
++  const std::string old_binary(4096, 'a');
++  std::string new_binary = old_binary;
++  new_binary.replace(100, 6, "server");
++  new_binary += "trailer";
++
++  WriteFile(from_dir_.AppendASCII("bin/browseros_server"), old_binary);
++  WriteFile(from_dir_.AppendASCII("resources/config.json"), "{}");
++  WriteFile(from_dir_.AppendASCII("resources/removed.txt"), "gone");
++  WritePatch("bin/browseros_server", old_binary, new_binary);
++  WriteFile(delta_dir_.AppendASCII("files/resources/new.txt"), "fresh");
++
++  base::Value::List files;
++  files.Append(Entry("bin/browseros_server", "patch", new_binary));
++  files.Append(Entry("resources/config.json", "copy", "{}"));
++  files.Append(Entry("resources/new.txt", "add", "fresh"));
++  WriteManifest(std::move(files));
++
++  EXPECT_EQ("", Apply());
++  EXPECT_EQ(new_binary, ReadDest("bin/browseros_server"));
++  EXPECT_EQ("{}", ReadDest("resources/config.json"));
++  EXPECT_EQ("fresh", ReadDest("resources/new.txt"));
++  EXPECT_FALSE(
++      base::PathExists(dest_dir_.AppendASCII("resources/removed.txt")));
++}
++
++#if BUILDFLAG(IS_POSIX)
++TEST_F(DeltaUpdateTest, PreservesExecutablePermissions) {
++  const std::string old_binary(1024, 'x');
++  const std::string new_binary = old_binary + "y";
++  base::FilePath old_path = from_dir_.AppendASCII("browseros_server");
++  WriteFile(old_path, old_binary);
++  ASSERT_TRUE(base::SetPosixFilePermissions(old_path, 0755));
++  WritePatch("browseros_server", old_binary, new_binary);
++
++  base::Value::List files;
++  files.Append(Entry("browseros_server", "patch", new_binary));
++  WriteManifest(std::move(files));
++
++  ASSERT_EQ("", Apply());
++  int mode = 0;
++  ASSERT_TRUE(base::GetPosixFilePermissions(
++      dest_dir_.AppendASCII("browseros_server"), &mode));
++  EXPECT_EQ(0755, mode);
++}
++#endif
++
++// =============================================================================
++// Rejection
++// =============================================================================
++
++TEST_F(DeltaUpdateTest, RejectsHashMismatch) {
++  WriteFile(from_dir_.AppendASCII("a.txt"), "original");
++
++  base::Value::List files;
++  files.Append(Entry("a.txt", "copy", "something else"));
++  WriteManifest(std::move(files));
++
++  EXPECT_NE("", Apply());
++}
++
++TEST_F(DeltaUpdateTest, RejectsPatchAgainstWrongBase) {
++  const std::string old_binary(2048, 'a');
++  const std::string new_binary = old_binary + "b";
++  WriteFile(from_dir_.AppendASCII("server"), std::string(2048, 'z'));
++  WritePatch("server", old_binary, new_binary);
++
++  base::Value::List files;
++  files.Append(Entry("server", "patch", new_binary));
++  WriteManifest(std::move(files));
++
++  EXPECT_NE("", Apply());
++}
++
++TEST_F(DeltaUpdateTest, RejectsPathOutsideVersionDir) {
++  WriteFile(delta_dir_.AppendASCII("files/evil"), "x");
++
++  base::Value::List files;
++  files.Append(Entry("../evil", "add", "x"));
++  WriteManifest(std::move(files));
++
++  EXPECT_NE("", Apply());
++  EXPECT_FALSE(base::PathExists(
++      temp_dir_.GetPath().AppendASCII("versions").AppendASCII("evil")));
++}
++
++TEST_F(DeltaUpdateTest, RejectsVersionMismatch) {
++  WriteFile(from_dir_.AppendASCII("a.txt"), "same");
++
++  base::Value::List files;
++  files.Append(Entry("a.txt", "copy", "same"));
++  WriteManifest(std::move(files), /*from=*/"0.9.0");
++
++  EXPECT_NE("", Apply());
++}
++
++TEST_F(DeltaUpdateTest, RejectsMissingManifest) {
++  EXPECT_NE("", Apply());
++}
++
++}  // namespace
++}  // namespace browseros_server
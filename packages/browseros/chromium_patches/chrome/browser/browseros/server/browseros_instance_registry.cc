@@ -0,0 +1,301 @@
+diff --git a/chrome/browser/browseros/server/browseros_instance_registry.cc b/chrome/browser/browseros/server/browseros_instance_registry.cc
+new file mode 100644
+index 0000000000000..3f5daed8cf8cf
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_instance_registry.cc
+@@ -0,0 +1,295 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_instance_registry.h"
++
++#include <cstdlib>
++#include <set>
++#include <utility>
++
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/threading/platform_thread.h"
++#include "base/time/time.h"
++#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr int kRegistryFormatVersion = 1;
++
++constexpr int kLockAttempts = 50;
++constexpr base::TimeDelta kLockRetryDelay = base::Milliseconds(10);
++
++// Linux derives creation time from uptime, which can drift by a second
++// between reads.
++constexpr int64_t kCreationTimeToleranceMs = 1000;
++
++bool IsProcessAlive(const InstanceRecord& record) {
++  if (!server_utils::ProcessExists(record.pid)) {
++    return false;
++  }
++  if (record.creation_time == 0) {
++    return true;
++  }
++  std::optional<int64_t> creation_time =
++      server_utils::GetProcessCreationTime(record.pid);
++  return creation_time &&
++         std::abs(*creation_time - record.creation_time) <=
++             kCreationTimeToleranceMs;
++}
++
++// Holds an exclusive lock on <registry>.lock for the duration of a
++// read-modify-write. base::File::Lock() does not block, so retry briefly
++// while another instance holds it.
++class ScopedRegistryLock {
++ public:
++  explicit ScopedRegistryLock(const base::FilePath& registry_path)
++      : file_(registry_path.AddExtension(FILE_PATH_LITERAL(".lock")),
++              base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_READ |
++                  base::File::FLAG_WRITE) {
++    if (!file_.IsValid()) {
++      return;
++    }
++    for (int i = 0; i < kLockAttempts; ++i) {
++      if (file_.Lock(base::File::LockMode::kExclusive) ==
++          base::File::FILE_OK) {
++        locked_ = true;
++        return;
++      }
++      base::PlatformThread::Sleep(kLockRetryDelay);
++    }
++  }
++
++  ~ScopedRegistryLock() {
++    if (locked_) {
++      file_.Unlock();
++    }
++  }
++
++  ScopedRegistryLock(const ScopedRegistryLock&) = delete;
++  ScopedRegistryLock& operator=(const ScopedRegistryLock&) = delete;
++
++  bool locked() const { return locked_; }
++
++ private:
++  base::File file_;
++  bool locked_ = false;
++};
++
++std::optional<InstanceRecord> RecordFromDict(const base::Value::Dict& dict) {
++  const std::string* name = dict.FindString("name");
++  std::optional<int> pid = dict.FindInt("pid");
++  if (!name || !pid) {
++    return std::nullopt;
++  }
++
++  InstanceRecord record;
++  record.name = *name;
++  record.pid = static_cast<base::ProcessId>(*pid);
++  record.creation_time =
++      static_cast<int64_t>(dict.FindDouble("creation_time").value_or(0));
++  record.slot = dict.FindInt("slot").value_or(-1);
++  if (const std::string* user_data_dir = dict.FindString("user_data_dir")) {
++    record.user_data_dir = *user_data_dir;
++  }
++  if (const base::Value::Dict* ports = dict.FindDict("ports")) {
++    record.ports.proxy = ports->FindInt("proxy").value_or(0);
++    record.ports.cdp = ports->FindInt("cdp").value_or(0);
++    record.ports.server = ports->FindInt("server").value_or(0);
++    record.ports.extension = ports->FindInt("extension").value_or(0);
++  }
++  return record;
++}
++
++base::Value::Dict RecordToDict(const InstanceRecord& record) {
++  base::Value::Dict ports;
++  ports.Set("proxy", record.ports.proxy);
++  ports.Set("cdp", record.ports.cdp);
++  ports.Set("server", record.ports.server);
++  ports.Set("extension", record.ports.extension);
++
++  base::Value::Dict dict;
++  dict.Set("name", record.name);
++  dict.Set("pid", static_cast<int>(record.pid));
++  dict.Set("creation_time", static_cast<double>(record.creation_time));
++  dict.Set("slot", record.slot);
++  dict.Set("user_data_dir", record.user_data_dir);
++  dict.Set("ports", std::move(ports));
++  return dict;
++}
++
++}  // namespace
++
++InstanceRecord::InstanceRecord() = default;
++InstanceRecord::InstanceRecord(const InstanceRecord&) = default;
++InstanceRecord& InstanceRecord::operator=(const InstanceRecord&) = default;
++InstanceRecord::~InstanceRecord() = default;
++
++InstanceRegistry::InstanceRegistry(const base::FilePath& path)
++    : InstanceRegistry(path, base::BindRepeating(&IsProcessAlive)) {}
++
++InstanceRegistry::InstanceRegistry(const base::FilePath& path,
++                                   LivenessCheck is_alive)
++    : path_(path), is_alive_(std::move(is_alive)) {}
++
++InstanceRegistry::~InstanceRegistry() = default;
++
++std::optional<int> InstanceRegistry::Register(const InstanceRecord& record,
++                                              bool assign_slot,
++                                              int min_slot) {
++  if (!base::CreateDirectory(path_.DirName())) {
++    LOG(ERROR) << "browseros: Failed to create registry directory: "
++               << path_.DirName();
++    return std::nullopt;
++  }
++
++  ScopedRegistryLock lock(path_);
++  if (!lock.locked()) {
++    LOG(WARNING) << "browseros: Could not lock instance registry " << path_;
++    return std::nullopt;
++  }
++
++  std::vector<InstanceRecord> records = ReadLiveLocked();
++  std::erase_if(records, [&record](const InstanceRecord& existing) {
++    return existing.name == record.name;
++  });
++
++  InstanceRecord entry = record;
++  if (assign_slot) {
++    std::set<int> taken;
++    for (const InstanceRecord& existing : records) {
++      if (existing.slot >= 0) {
++        taken.insert(existing.slot);
++      }
++    }
++    int slot = min_slot;
++    while (taken.count(slot) > 0) {
++      slot++;
++    }
++    if (slot >= browseros_server::kMaxInstanceSlots) {
++      LOG(ERROR) << "browseros: No free instance slot in registry";
++      return std::nullopt;
++    }
++    entry.slot = slot;
++  }
++
++  records.push_back(entry);
++  if (!WriteLocked(records)) {
++    return std::nullopt;
++  }
++
++  LOG(INFO) << "browseros: Registered instance '" << entry.name
++            << "' (slot " << entry.slot << ") in " << path_;
++  return entry.slot;
++}
++
++bool InstanceRegistry::Unregister(const std::string& name,
++                                  base::ProcessId pid) {
++  ScopedRegistryLock lock(path_);
++  if (!lock.locked()) {
++    return false;
++  }
++
++  std::vector<InstanceRecord> records = ReadLiveLocked();
++  std::erase_if(records, [&name, pid](const InstanceRecord& existing) {
++    return existing.name == name && existing.pid == pid;
++  });
++  return WriteLocked(records);
++}
++
++std::vector<InstanceRecord> InstanceRegistry::ReadLive() {
++  ScopedRegistryLock lock(path_);
++  if (!lock.locked()) {
++    return {};
++  }
++  return ReadLiveLocked();
++}
++
++std::vector<InstanceRecord> InstanceRegistry::ReadLiveLocked() {
++  std::vector<InstanceRecord> records;
++
++  std::string contents;
++  if (!base::ReadFileToString(path_, &contents)) {
++    return records;
++  }
++
++  std::optional<base::Value> parsed = base::JSONReader::Read(contents);
++  if (!parsed || !parsed->is_dict()) {
++    LOG(WARNING) << "browseros: Invalid instance registry format, resetting";
++    return records;
++  }
++
++  const base::Value::List* instances = parsed->GetDict().FindList("instances");
++  if (!instances) {
++    return records;
++  }
++
++  for (const base::Value& value : *instances) {
++    if (!value.is_dict()) {
++      continue;
++    }
++    std::optional<InstanceRecord> record = RecordFromDict(value.GetDict());
++    if (!record) {
++      continue;
++    }
++    if (!is_alive_.Run(*record)) {
++      LOG(INFO) << "browseros: Pruning dead instance '" << record->name
++                << "' (PID: " << record->pid << ") from registry";
++      continue;
++    }
++    records.push_back(std::move(*record));
++  }
++  return records;
++}
++
++bool InstanceRegistry::WriteLocked(const std::vector<InstanceRecord>& records) {
++  base::Value::List instances;
++  for (const InstanceRecord& record : records) {
++    instances.Append(RecordToDict(record));
++  }
++
++  base::Value::Dict root;
++  root.Set("version", kRegistryFormatVersion);
++  root.Set("instances", std::move(instances));
++
++  std::optional<std::string> json_output = base::WriteJsonWithOptions(
++      root, base::JSONWriter::OPTIONS_PRETTY_PRINT);
++  if (!json_output.has_value()) {
++    LOG(ERROR) << "browseros: Failed to serialize instance registry";
++    return false;
++  }
++
++  // Write atomically so orchestrators never observe a half-written file.
++  if (!base::ImportantFileWriter::WriteFileAtomically(path_, *json_output)) {
++    LOG(ERROR) << "browseros: Failed to write instance registry: " << path_;
++    return false;
++  }
++  return true;
++}
++
++ServerPorts GetInstancePortBases(int slot) {
++  int base_port = browseros_server::kInstancePortRangeStart +
++                  slot * browseros_server::kInstancePortStride;
++  ServerPorts ports;
++  ports.proxy = base_port;
++  ports.cdp = base_port + 1;
++  ports.server = base_port + 2;
++  ports.extension = base_port + 3;
++  return ports;
++}
++
++int GetInstancePortBlockLast(int slot) {
++  return GetInstancePortBases(slot).proxy +
++         browseros_server::kInstancePortStride - 1;
++}
++
++}  // namespace browseros
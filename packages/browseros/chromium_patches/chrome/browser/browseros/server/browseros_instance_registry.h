@@ -0,0 +1,96 @@
+diff --git a/chrome/browser/browseros/server/browseros_instance_registry.h b/chrome/browser/browseros/server/browseros_instance_registry.h
+new file mode 100644
+index 0000000000000..7073b7fb5a06c
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_instance_registry.h
+@@ -0,0 +1,90 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_INSTANCE_REGISTRY_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_INSTANCE_REGISTRY_H_
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/process/process_handle.h"
++#include "chrome/browser/browseros/server/browseros_server_config.h"
++
++namespace browseros {
++
++// One BrowserOS instance as recorded in the host-wide registry.
++struct InstanceRecord {
++  InstanceRecord();
++  InstanceRecord(const InstanceRecord&);
++  InstanceRecord& operator=(const InstanceRecord&);
++  ~InstanceRecord();
++
++  // Instance namespace ("default" for the un-namespaced instance).
++  std::string name;
++
++  // Browser process that owns the server (and binds the proxy port).
++  base::ProcessId pid = 0;
++  int64_t creation_time = 0;  // Process creation time in milliseconds
++
++  // Port block index for namespaced instances, -1 otherwise.
++  int slot = -1;
++
++  ServerPorts ports;
++  std::string user_data_dir;
++};
++
++// Host-wide registry of BrowserOS instances that own a server, so
++// orchestrators running many browsers can discover proxy ports without
++// scanning. Backed by a JSON file guarded by an adjacent lock file; every
++// mutation first prunes entries whose browser process is gone.
++//
++// All methods do blocking file I/O.
++class InstanceRegistry {
++ public:
++  using LivenessCheck = base::RepeatingCallback<bool(const InstanceRecord&)>;
++
++  explicit InstanceRegistry(const base::FilePath& path);
++  InstanceRegistry(const base::FilePath& path, LivenessCheck is_alive);
++  ~InstanceRegistry();
++
++  InstanceRegistry(const InstanceRegistry&) = delete;
++  InstanceRegistry& operator=(const InstanceRegistry&) = delete;
++
++  // Adds or replaces the entry for |record.name|. When |assign_slot| is true
++  // the lowest slot from |min_slot| up not held by another live instance is
++  // assigned, otherwise |record.slot| is kept. Returns the recorded slot, or
++  // nullopt on failure.
++  std::optional<int> Register(const InstanceRecord& record,
++                              bool assign_slot,
++                              int min_slot = 0);
++
++  // Removes the entry for |name| if it is owned by |pid|.
++  bool Unregister(const std::string& name, base::ProcessId pid);
++
++  // Returns all live entries.
++  std::vector<InstanceRecord> ReadLive();
++
++  const base::FilePath& path() const { return path_; }
++
++ private:
++  std::vector<InstanceRecord> ReadLiveLocked();
++  bool WriteLocked(const std::vector<InstanceRecord>& records);
++
++  const base::FilePath path_;
++  LivenessCheck is_alive_;
++};
++
++// Returns the first port of each service for a namespaced instance in |slot|.
++ServerPorts GetInstancePortBases(int slot);
++
++// Returns the last port of |slot|'s block. A namespaced instance never probes
++// past it, so it cannot take a port from the next slot.
++int GetInstancePortBlockLast(int slot);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_INSTANCE_REGISTRY_H_
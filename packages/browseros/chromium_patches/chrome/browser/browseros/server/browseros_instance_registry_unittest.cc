@@ -0,0 +1,145 @@
+diff --git a/chrome/browser/browseros/server/browseros_instance_registry_unittest.cc b/chrome/browser/browseros/server/browseros_instance_registry_unittest.cc
+new file mode 100644
+index 0000000000000..b464508cfe2ae
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_instance_registry_unittest.cc
+@@ -0,0 +1,139 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_instance_registry.h"
++
++#include <set>
++
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++class InstanceRegistryTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    registry_ = std::make_unique<InstanceRegistry>(
++        temp_dir_.GetPath().AppendASCII("instances.json"),
++        base::BindRepeating(
++            [](const std::set<base::ProcessId>* dead,
++               const InstanceRecord& record) {
++              return dead->count(record.pid) == 0;
++            },
++            &dead_pids_));
++  }
++
++  InstanceRecord MakeRecord(const std::string& name, base::ProcessId pid) {
++    InstanceRecord record;
++    record.name = name;
++    record.pid = pid;
++    record.ports.proxy = 9000;
++    record.ports.cdp = 9100;
++    record.ports.server = 9200;
++    record.ports.extension = 9300;
++    return record;
++  }
++
++  base::ScopedTempDir temp_dir_;
++  // PIDs listed here are treated as dead by the liveness check.
++  std::set<base::ProcessId> dead_pids_;
++  std::unique_ptr<InstanceRegistry> registry_;
++};
++
++// =============================================================================
++// Slot Assignment Tests
++// =============================================================================
++
++TEST_F(InstanceRegistryTest, AssignsLowestFreeSlot) {
++  EXPECT_EQ(0, registry_->Register(MakeRecord("a", 101), true));
++  EXPECT_EQ(1, registry_->Register(MakeRecord("b", 102), true));
++  EXPECT_EQ(2, registry_->Register(MakeRecord("c", 103), true));
++
++  ASSERT_TRUE(registry_->Unregister("b", 102));
++  EXPECT_EQ(1, registry_->Register(MakeRecord("d", 104), true));
++}
++
++TEST_F(InstanceRegistryTest, ReusesSlotsOfDeadInstances) {
++  EXPECT_EQ(0, registry_->Register(MakeRecord("a", 101), true));
++  EXPECT_EQ(1, registry_->Register(MakeRecord("b", 102), true));
++
++  dead_pids_.insert(101);
++  EXPECT_EQ(0, registry_->Register(MakeRecord("c", 103), true));
++
++  std::vector<InstanceRecord> live = registry_->ReadLive();
++  ASSERT_EQ(2u, live.size());
++}
++
++TEST_F(InstanceRegistryTest, AssignsFromMinimumSlot) {
++  EXPECT_EQ(0, registry_->Register(MakeRecord("a", 101), true));
++  EXPECT_EQ(1, registry_->Register(MakeRecord("b", 102), true));
++
++  // "a" leaves slot 0 behind when moving past it.
++  EXPECT_EQ(2, registry_->Register(MakeRecord("a", 101), true, 1));
++  EXPECT_EQ(0, registry_->Register(MakeRecord("c", 103), true));
++}
++
++TEST_F(InstanceRegistryTest, UnnamespacedKeepsNoSlot) {
++  EXPECT_EQ(-1, registry_->Register(MakeRecord("default", 101), false));
++}
++
++// =============================================================================
++// Update / Unregister Tests
++// =============================================================================
++
++TEST_F(InstanceRegistryTest, ReRegisterReplacesEntry) {
++  InstanceRecord record = MakeRecord("a", 101);
++  std::optional<int> slot = registry_->Register(record, true);
++  ASSERT_TRUE(slot);
++
++  record.slot = *slot;
++  record.ports.server = 9201;
++  EXPECT_EQ(*slot, registry_->Register(record, false));
++
++  std::vector<InstanceRecord> live = registry_->ReadLive();
++  ASSERT_EQ(1u, live.size());
++  EXPECT_EQ(9201, live[0].ports.server);
++  EXPECT_EQ(9000, live[0].ports.proxy);
++}
++
++TEST_F(InstanceRegistryTest, UnregisterIgnoresOtherOwner) {
++  ASSERT_TRUE(registry_->Register(MakeRecord("a", 101), true));
++  ASSERT_TRUE(registry_->Unregister("a", 999));
++  EXPECT_EQ(1u, registry_->ReadLive().size());
++}
++
++TEST_F(InstanceRegistryTest, CorruptFileIsReset) {
++  ASSERT_TRUE(base::WriteFile(registry_->path(), "not json"));
++  EXPECT_TRUE(registry_->ReadLive().empty());
++  EXPECT_EQ(0, registry_->Register(MakeRecord("a", 101), true));
++  EXPECT_EQ(1u, registry_->ReadLive().size());
++}
++
++// =============================================================================
++// Port Block Tests
++// =============================================================================
++
++TEST(InstancePortBasesTest, SlotsDoNotOverlap) {
++  ServerPorts first = GetInstancePortBases(0);
++  ServerPorts second = GetInstancePortBases(1);
++
++  EXPECT_EQ(browseros_server::kInstancePortRangeStart, first.proxy);
++  EXPECT_LT(first.extension, second.proxy);
++  EXPECT_EQ(browseros_server::kInstancePortStride,
++            second.proxy - first.proxy);
++}
++
++TEST(InstancePortBasesTest, BlockEndsBeforeNextSlot) {
++  EXPECT_EQ(GetInstancePortBases(1).proxy - 1, GetInstancePortBlockLast(0));
++  EXPECT_LE(GetInstancePortBases(0).extension, GetInstancePortBlockLast(0));
++}
++
++}  // namespace
++}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.cc b/chrome/browser/browseros/server/browseros_server_config.cc
 new file mode 100644
-index 0000000000000..3e0c69cdf6442
+index 0000000000000..612e8e56bcb05
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.cc
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,92 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -66,6 +66,12 @@ index 0000000000000..3e0c69cdf6442
 +      chromium_version.c_str());
 +}
 +
++std::string ServerResourceLimits::DebugString() const {
++  return base::StringPrintf(
++      "ServerResourceLimits{memory_max=%lld cpu_max=%d%%}",
++      static_cast<long long>(memory_max_bytes), cpu_max_percent);
++}
++
 +bool ServerLaunchConfig::IsValid() const {
 +  return ports.IsValid() && paths.IsValid();
 +}
@@ -76,12 +82,17 @@ index 0000000000000..3e0c69cdf6442
 +      "  %s\n"
 +      "  %s\n"
 +      "  %s\n"
++      "  %s\n"
 +      "  allow_remote=%s\n"
++      "  cdp_socket=%s cdp_pipe=%s\n"
 +      "}",
 +      ports.DebugString().c_str(),
 +      paths.DebugString().c_str(),
 +      identity.DebugString().c_str(),
-+      allow_remote_in_mcp ? "true" : "false");
++      limits.DebugString().c_str(),
++      allow_remote_in_mcp ? "true" : "false",
++      cdp_socket_path.AsUTF8Unsafe().c_str(),
++      cdp_pipe_fd >= 0 ? "true" : "false");
 +}
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.h b/chrome/browser/browseros/server/browseros_server_config.h
 new file mode 100644
-index 0000000000000..3b121ed6f6635
+index 0000000000000..630cb6f05ef61
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.h
-@@ -0,0 +1,90 @@
+@@ -0,0 +1,110 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,7 @@ index 0000000000000..3b121ed6f6635
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_CONFIG_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_CONFIG_H_
 +
++#include <cstdint>
 +#include <string>
 +
 +#include "base/files/file_path.h"
@@ -76,14 +77,33 @@ index 0000000000000..3b121ed6f6635
 +  std::string DebugString() const;
 +};
 +
++// Optional caps on the server process. Zero means unlimited. Enforced with a
++// cgroup v2 on Linux; ignored on other platforms.
++struct ServerResourceLimits {
++  int64_t memory_max_bytes = 0;
++  int cpu_max_percent = 0;  // Of one core; 200 allows two full cores
++
++  bool IsEmpty() const { return memory_max_bytes <= 0 && cpu_max_percent <= 0; }
++
++  // Returns a debug string for logging.
++  std::string DebugString() const;
++};
++
 +// Complete configuration for a single server launch.
 +// Assembled fresh before each ProcessController::Launch() call.
 +struct ServerLaunchConfig {
 +  ServerPorts ports;
 +  ServerPaths paths;
 +  ServerIdentity identity;
++  ServerResourceLimits limits;
 +  bool allow_remote_in_mcp = false;
 +
++  // Unix domain socket the CDP server also listens on; empty if disabled.
++  base::FilePath cdp_socket_path;
++  // The server's end of an inherited CDP connection, or -1. Owned by the
++  // caller, which keeps it open until Launch() returns.
++  int cdp_pipe_fd = -1;
++
 +  // Returns true if the config is valid for launching.
 +  bool IsValid() const;
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.cc b/chrome/browser/browseros/server/browseros_server_manager.cc
 new file mode 100644
-index 0000000000000..6d44b32b78ce8
+index 0000000000000..3591827327f39
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.cc
-@@ -0,0 +1,1061 @@
+@@ -0,0 +1,1409 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,17 +18,17 @@ index 0000000000000..6d44b32b78ce8
 +#include "base/files/file_util.h"
 +#include "base/logging.h"
 +#include "base/path_service.h"
-+#include "base/rand_util.h"
++#include "base/process/process_handle.h"
 +#include "base/strings/string_number_conversions.h"
-+#include "base/system/sys_info.h"
 +#include "base/task/thread_pool.h"
-+#include "content/public/browser/browser_thread.h"
 +#include "base/threading/thread_restrictions.h"
 +#include "build/build_config.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
++#include "chrome/browser/browseros/server/browseros_cdp_transport.h"
++#include "chrome/browser/browseros/server/browseros_instance_registry.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
 +#include "chrome/browser/browseros/server/browseros_server_proxy.h"
@@ -38,6 +38,7 @@ index 0000000000000..6d44b32b78ce8
 +#include "chrome/browser/browseros/server/health_checker_impl.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
 +#include "chrome/browser/browseros/server/process_controller_impl.h"
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
 +#include "chrome/browser/browseros/server/server_state_store.h"
 +#include "chrome/browser/browseros/server/server_state_store_impl.h"
 +#include "chrome/browser/browseros/server/server_updater.h"
@@ -51,28 +52,41 @@ index 0000000000000..6d44b32b78ce8
 +#include "components/version_info/version_info.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/devtools_agent_host.h"
-+#include "content/public/browser/devtools_socket_factory.h"
 +#include "net/base/address_family.h"
 +#include "net/base/ip_address.h"
 +#include "net/base/ip_endpoint.h"
 +#include "net/base/net_errors.h"
 +#include "net/base/port_util.h"
-+#include "net/log/net_log_source.h"
-+#include "net/socket/tcp_server_socket.h"
 +#include "net/socket/tcp_socket.h"
 +
 +namespace {
 +
-+constexpr int kBackLog = 10;
-+
 +constexpr base::TimeDelta kHealthCheckInterval = base::Seconds(30);
 +constexpr base::TimeDelta kProcessCheckInterval = base::Seconds(5);
 +
++constexpr base::TimeDelta kDefaultHeartbeatInterval = base::Seconds(1);
++constexpr base::TimeDelta kDefaultHeartbeatDeadline = base::Milliseconds(500);
++constexpr int kMaxMissedHeartbeats = 2;
++
++constexpr base::TimeDelta kResourceSampleInterval = base::Seconds(15);
++// Warn once per launch when RSS crosses this share of the memory limit, so
++// operators can react before the cgroup OOM-kills the server.
++constexpr double kMemoryWarningFraction = 0.9;
++
 +constexpr base::TimeDelta kStartupGracePeriod = base::Seconds(30);
 +constexpr int kMaxStartupFailures = 3;
 +
 +constexpr int kExitCodeSuccess = 0;
 +
++browseros::ServerPorts GetDefaultPortBases() {
++  browseros::ServerPorts bases;
++  bases.cdp = browseros_server::kDefaultCDPPort;
++  bases.proxy = browseros_server::kDefaultProxyPort;
++  bases.server = browseros_server::kDefaultServerPort;
++  bases.extension = browseros_server::kDefaultExtensionPort;
++  return bases;
++}
++
 +int GetPortOverrideFromCommandLine(base::CommandLine* command_line,
 +                                    const char* switch_name,
 +                                    const char* port_name) {
@@ -107,38 +121,50 @@ index 0000000000000..6d44b32b78ce8
 +  return port;
 +}
 +
-+class CDPServerSocketFactory : public content::DevToolsSocketFactory {
-+ public:
-+  explicit CDPServerSocketFactory(uint16_t port) : port_(port) {}
-+
-+  CDPServerSocketFactory(const CDPServerSocketFactory&) = delete;
-+  CDPServerSocketFactory& operator=(const CDPServerSocketFactory&) = delete;
-+
-+ private:
-+  std::unique_ptr<net::ServerSocket> CreateLocalHostServerSocket(int port) {
-+    std::unique_ptr<net::ServerSocket> socket(
-+        new net::TCPServerSocket(nullptr, net::NetLogSource()));
-+    if (socket->ListenWithAddressAndPort("127.0.0.1", port, kBackLog) ==
-+        net::OK) {
-+      return socket;
-+    }
-+    if (socket->ListenWithAddressAndPort("::1", port, kBackLog) == net::OK) {
-+      return socket;
-+    }
-+    return nullptr;
-+  }
-+
-+  std::unique_ptr<net::ServerSocket> CreateForHttpServer() override {
-+    return CreateLocalHostServerSocket(port_);
++base::TimeDelta GetDurationFromCommandLine(const char* switch_name,
++                                           base::TimeDelta default_value) {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (!command_line->HasSwitch(switch_name)) {
++    return default_value;
 +  }
 +
-+  std::unique_ptr<net::ServerSocket> CreateForTethering(
-+      std::string* name) override {
-+    return nullptr;
++  std::string value = command_line->GetSwitchValueASCII(switch_name);
++  int ms = 0;
++  if (!base::StringToInt(value, &ms) || ms < 0) {
++    LOG(WARNING) << "browseros: Invalid --" << switch_name << ": " << value;
++    return default_value;
 +  }
++  return base::Milliseconds(ms);
++}
 +
-+  uint16_t port_;
-+};
++browseros::ServerResourceLimits GetResourceLimitsFromCommandLine() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  browseros::ServerResourceLimits limits;
++
++  int memory_mb = 0;
++  if (command_line->HasSwitch(browseros::kServerMemoryLimit) &&
++      (!base::StringToInt(
++           command_line->GetSwitchValueASCII(browseros::kServerMemoryLimit),
++           &memory_mb) ||
++       memory_mb < 0)) {
++    LOG(WARNING) << "browseros: Invalid --" << browseros::kServerMemoryLimit;
++    memory_mb = 0;
++  }
++  limits.memory_max_bytes = static_cast<int64_t>(memory_mb) * 1024 * 1024;
++
++  int cpu_percent = 0;
++  if (command_line->HasSwitch(browseros::kServerCpuLimit) &&
++      (!base::StringToInt(
++           command_line->GetSwitchValueASCII(browseros::kServerCpuLimit),
++           &cpu_percent) ||
++       cpu_percent < 0)) {
++    LOG(WARNING) << "browseros: Invalid --" << browseros::kServerCpuLimit;
++    cpu_percent = 0;
++  }
++  limits.cpu_max_percent = cpu_percent;
++
++  return limits;
++}
 +
 +}  // namespace
 +
@@ -155,7 +181,8 @@ index 0000000000000..6d44b32b78ce8
 +      state_store_(std::make_unique<ServerStateStoreImpl>()),
 +      health_checker_(std::make_unique<HealthCheckerImpl>()),
 +      local_state_(g_browser_process ? g_browser_process->local_state()
-+                                     : nullptr) {}
++                                     : nullptr),
++      port_bases_(GetDefaultPortBases()) {}
 +
 +BrowserOSServerManager::BrowserOSServerManager(
 +    std::unique_ptr<ProcessController> process_controller,
@@ -167,6 +194,7 @@ index 0000000000000..6d44b32b78ce8
 +      state_store_(std::move(state_store)),
 +      health_checker_(std::move(health_checker)),
 +      local_state_(local_state),
++      port_bases_(GetDefaultPortBases()),
 +      updater_(std::move(updater)) {}
 +
 +BrowserOSServerManager::~BrowserOSServerManager() {
@@ -176,14 +204,12 @@ index 0000000000000..6d44b32b78ce8
 +bool BrowserOSServerManager::AcquireLock() {
 +  base::ScopedAllowBlocking allow_blocking;
 +
-+  base::FilePath exec_dir = GetBrowserOSExecutionDir();
-+  if (exec_dir.empty()) {
++  base::FilePath lock_path = server_utils::GetLockFilePath();
++  if (lock_path.empty()) {
 +    LOG(ERROR) << "browseros: Failed to resolve execution directory for lock";
 +    return false;
 +  }
 +
-+  base::FilePath lock_path = exec_dir.Append(FILE_PATH_LITERAL("server.lock"));
-+
 +  lock_file_ = base::File(lock_path,
 +                          base::File::FLAG_OPEN_ALWAYS |
 +                          base::File::FLAG_READ |
@@ -319,46 +345,57 @@ index 0000000000000..6d44b32b78ce8
 +}
 +
 +void BrowserOSServerManager::ResolvePortsForStartup() {
-+  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
-+  std::set<int> assigned_ports;
-+
-+  // Skip FindAvailablePort for CLI-overridden ports — trust the developer.
-+  bool cdp_fixed = command_line->HasSwitch(browseros::kCDPPort);
-+  bool proxy_fixed = command_line->HasSwitch(browseros::kProxyPort);
-+  bool server_fixed = command_line->HasSwitch(browseros::kServerPort);
-+  bool extension_fixed = command_line->HasSwitch(browseros::kExtensionPort);
-+
-+  if (cdp_fixed) {
-+    assigned_ports.insert(ports_.cdp);
-+  } else {
-+    ports_.cdp = server_utils::FindAvailablePort(ports_.cdp, assigned_ports);
-+    assigned_ports.insert(ports_.cdp);
++  while (!TryResolvePortsForStartup()) {
++    // Something outside the registry holds the ports of this slot's block.
++    // Move to another slot rather than spill into a neighbour's block.
++    if (!MoveToNextInstanceSlot()) {
++      LOG(ERROR) << "browseros: No free ports in any instance slot for '"
++                 << instance_name_ << "'";
++      break;
++    }
 +  }
 +
-+  if (proxy_fixed) {
-+    assigned_ports.insert(ports_.proxy);
-+  } else {
-+    ports_.proxy = server_utils::FindAvailablePort(ports_.proxy, assigned_ports,
-+                                                   /*allow_reuse=*/true);
-+    assigned_ports.insert(ports_.proxy);
-+  }
++  LOG(INFO) << "browseros: Resolved ports for startup - " << ports_.DebugString();
++}
 +
-+  if (server_fixed) {
-+    assigned_ports.insert(ports_.server);
-+  } else {
-+    ports_.server = server_utils::FindAvailablePort(
-+        browseros_server::kDefaultServerPort, assigned_ports);
-+    assigned_ports.insert(ports_.server);
-+  }
++bool BrowserOSServerManager::TryResolvePortsForStartup() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  std::set<int> assigned_ports;
++  bool resolved = true;
++
++  // Skip the search for CLI-overridden ports — trust the developer. A port
++  // whose search fails is left at its base so the caller can give up.
++  auto resolve = [&](const char* port_switch, int base, int& port,
++                     bool allow_reuse) {
++    if (!command_line->HasSwitch(port_switch)) {
++      std::optional<int> found =
++          FindPortForService(base, assigned_ports, allow_reuse);
++      resolved &= found.has_value();
++      port = found.value_or(base);
++    }
++    assigned_ports.insert(port);
++  };
++
++  resolve(browseros::kCDPPort, port_bases_.cdp, ports_.cdp,
++          /*allow_reuse=*/false);
++  resolve(browseros::kProxyPort, port_bases_.proxy, ports_.proxy,
++          /*allow_reuse=*/true);
++  resolve(browseros::kServerPort, port_bases_.server, ports_.server,
++          /*allow_reuse=*/false);
++  resolve(browseros::kExtensionPort, port_bases_.extension, ports_.extension,
++          /*allow_reuse=*/false);
++  return resolved;
++}
 +
-+  if (extension_fixed) {
-+    assigned_ports.insert(ports_.extension);
-+  } else {
-+    ports_.extension = server_utils::FindAvailablePort(
-+        browseros_server::kDefaultExtensionPort, assigned_ports);
++std::optional<int> BrowserOSServerManager::FindPortForService(
++    int base,
++    const std::set<int>& assigned,
++    bool allow_reuse) const {
++  if (instance_slot_ < 0) {
++    return server_utils::FindAvailablePort(base, assigned, allow_reuse);
 +  }
-+
-+  LOG(INFO) << "browseros: Resolved ports for startup - " << ports_.DebugString();
++  return server_utils::FindAvailablePortInRange(
++      base, GetInstancePortBlockLast(instance_slot_), assigned, allow_reuse);
 +}
 +
 +void BrowserOSServerManager::ApplyCommandLineOverrides() {
@@ -392,11 +429,39 @@ index 0000000000000..6d44b32b78ce8
 +            << ports_.DebugString();
 +}
 +
++void BrowserOSServerManager::ReassignEphemeralPorts() {
++  // Pick new ephemeral ports for server and extension (unless CLI-overridden)
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  std::set<int> assigned;
++  assigned.insert(ports_.cdp);
++  assigned.insert(ports_.proxy);
++
++  // CDP and proxy stay bound across restarts, so a namespaced instance cannot
++  // change slots here; if its block is full, keep the previous port.
++  if (!command_line->HasSwitch(browseros::kServerPort)) {
++    ports_.server = FindPortForService(port_bases_.server, assigned)
++                        .value_or(ports_.server);
++  }
++  assigned.insert(ports_.server);
++
++  if (!command_line->HasSwitch(browseros::kExtensionPort)) {
++    ports_.extension = FindPortForService(port_bases_.extension, assigned)
++                           .value_or(ports_.extension);
++  }
++
++  LOG(INFO) << "browseros: New ephemeral ports - " << ports_.DebugString();
++}
++
 +void BrowserOSServerManager::SavePortsToPrefs() {
 +  if (!local_state_) {
 +    LOG(WARNING) << "browseros: SavePortsToPrefs - no prefs available, skipping save";
 +    return;
 +  }
++  // The prefs hold the profile's preferred ports; a namespaced instance runs
++  // on its slot's ports and must not replace them.
++  if (!instance_name_.empty()) {
++    return;
++  }
 +
 +  local_state_->SetInteger(browseros_server::kCDPServerPort, ports_.cdp);
 +  local_state_->SetInteger(browseros_server::kProxyPort, ports_.proxy);
@@ -409,11 +474,111 @@ index 0000000000000..6d44b32b78ce8
 +  LOG(INFO) << "browseros: Saving to prefs - " << ports_.DebugString();
 +}
 +
++InstanceRecord BrowserOSServerManager::BuildInstanceRecord() const {
++  InstanceRecord record;
++  record.name = instance_name_;
++  record.pid = base::GetCurrentProcId();
++  record.slot = instance_slot_;
++  record.ports = ports_;
++
++  base::ScopedAllowBlocking allow_blocking;
++  record.creation_time =
++      server_utils::GetProcessCreationTime(record.pid).value_or(0);
++  base::FilePath user_data_dir;
++  if (base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
++    record.user_data_dir = user_data_dir.AsUTF8Unsafe();
++  }
++  return record;
++}
++
++void BrowserOSServerManager::RegisterInstance() {
++  // Un-namespaced instances keep probing from the user's preferred ports and
++  // stay out of the registry, which is only for orchestrated instances.
++  port_bases_.cdp = ports_.cdp;
++  port_bases_.proxy = ports_.proxy;
++  if (instance_name_.empty()) {
++    return;
++  }
++
++  base::FilePath registry_path = server_utils::GetInstanceRegistryPath();
++  if (registry_path.empty()) {
++    LOG(WARNING) << "browseros: No instance registry path, skipping register";
++    return;
++  }
++  instance_registry_ = std::make_unique<InstanceRegistry>(registry_path);
++
++  base::ScopedAllowBlocking allow_blocking;
++  std::optional<int> slot =
++      instance_registry_->Register(BuildInstanceRecord(), /*assign_slot=*/true);
++  if (!slot) {
++    LOG(WARNING) << "browseros: Failed to register instance, orchestrators "
++                 << "will not discover it via " << registry_path;
++    return;
++  }
++
++  instance_slot_ = *slot;
++  port_bases_ = GetInstancePortBases(instance_slot_);
++  LOG(INFO) << "browseros: Instance '" << instance_name_ << "' using slot "
++            << instance_slot_ << " - " << port_bases_.DebugString();
++}
++
++bool BrowserOSServerManager::MoveToNextInstanceSlot() {
++  if (instance_slot_ < 0 || !instance_registry_) {
++    return false;
++  }
++
++  base::ScopedAllowBlocking allow_blocking;
++  std::optional<int> slot = instance_registry_->Register(
++      BuildInstanceRecord(), /*assign_slot=*/true,
++      /*min_slot=*/instance_slot_ + 1);
++  if (!slot) {
++    return false;
++  }
++
++  LOG(WARNING) << "browseros: Ports of slot " << instance_slot_
++               << " are in use, moving instance '" << instance_name_
++               << "' to slot " << *slot;
++  instance_slot_ = *slot;
++  port_bases_ = GetInstancePortBases(instance_slot_);
++  return true;
++}
++
++void BrowserOSServerManager::PublishInstance() {
++  if (!instance_registry_) {
++    return;
++  }
++
++  base::ScopedAllowBlocking allow_blocking;
++  if (!instance_registry_->Register(BuildInstanceRecord(),
++                                    /*assign_slot=*/false)) {
++    LOG(WARNING) << "browseros: Failed to publish instance ports to registry";
++  }
++}
++
++void BrowserOSServerManager::UnregisterInstance() {
++  if (!instance_registry_) {
++    return;
++  }
++
++  base::ScopedAllowBlocking allow_blocking;
++  instance_registry_->Unregister(instance_name_, base::GetCurrentProcId());
++  instance_registry_.reset();
++  instance_slot_ = -1;
++}
++
 +void BrowserOSServerManager::Start() {
 +  if (is_running_) {
 +    LOG(INFO) << "browseros: BrowserOS server already running";
 +    return;
 +  }
++  stopping_ = false;
++
++  // Resolved first: namespaced instances do not save their ports to prefs.
++  instance_name_ = server_utils::GetInstanceNamespace();
++  if (!instance_name_.empty()) {
++    LOG(INFO) << "browseros: Using instance namespace '" << instance_name_
++              << "'";
++  }
 +
 +  // Phase 1: Load user intent (prefs + CLI overrides).
 +  // Save stable port preferences so CLI overrides are persisted even when
@@ -423,6 +588,8 @@ index 0000000000000..6d44b32b78ce8
 +  ApplyCommandLineOverrides();
 +  SavePortsToPrefs();
 +
++  resource_limits_ = GetResourceLimitsFromCommandLine();
++
 +  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
 +  if (command_line->HasSwitch(browseros::kDisableServer)) {
 +    LOG(INFO) << "browseros: BrowserOS server disabled via command line";
@@ -435,27 +602,47 @@ index 0000000000000..6d44b32b78ce8
 +
 +  // Phase 2: We hold the lock — we're the active instance.
 +  // Now resolve actual available ports and save the final values.
++  started_ = true;
 +  RecoverFromOrphan();
++  RegisterInstance();
 +  ResolvePortsForStartup();
 +  SavePortsToPrefs();
++  PublishInstance();
 +
 +  LOG(INFO) << "browseros: Starting BrowserOS server";
 +
++  ConfigureCDPTransports();
 +  StartCDPServer();
 +  StartProxy();
 +  LaunchBrowserOSProcess();
 +}
 +
 +void BrowserOSServerManager::Stop() {
-+  if (!is_running_) {
++  // Replies to an in-flight launch or exit wait check this, so nothing is
++  // relaunched once shutdown has begun.
++  stopping_ = true;
++  // A backed-off relaunch may be pending while the server is down.
++  relaunch_timer_.Stop();
++
++  // Between a crash and its relaunch the server is down, but the proxy, CDP
++  // server, registry entry and lock are still held.
++  if (!is_running_ && !started_) {
 +    return;
 +  }
 +
 +  is_running_ = false;
++  started_ = false;
++  is_restarting_ = false;
 +
 +  LOG(INFO) << "browseros: Stopping BrowserOS server";
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopMonitoring();
++
++  if (is_updating_) {
++    is_updating_ = false;
++    if (update_complete_callback_) {
++      std::move(update_complete_callback_).Run(false);
++    }
++  }
 +
 +  if (updater_) {
 +    updater_->Stop();
@@ -463,6 +650,7 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +
 +  StopProxy();
++  StopCDPServer();
 +
 +  TerminateBrowserOSProcess(base::DoNothing());
 +
@@ -471,6 +659,8 @@ index 0000000000000..6d44b32b78ce8
 +    state_store_->Delete();
 +  }
 +
++  UnregisterInstance();
++
 +  if (lock_file_.IsValid()) {
 +    lock_file_.Unlock();
 +    lock_file_.Close();
@@ -486,11 +676,35 @@ index 0000000000000..6d44b32b78ce8
 +  Stop();
 +}
 +
++void BrowserOSServerManager::ConfigureCDPTransports() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++
++  if (command_line->HasSwitch(browseros::kCDPSocket)) {
++    cdp_socket_path_ = command_line->GetSwitchValuePath(browseros::kCDPSocket);
++    if (cdp_socket_path_.empty()) {
++      base::FilePath execution_dir = GetBrowserOSExecutionDir();
++      if (!execution_dir.empty()) {
++        cdp_socket_path_ = execution_dir.AppendASCII(
++            instance_name_.empty() ? "cdp.sock"
++                                   : "cdp-" + instance_name_ + ".sock");
++      }
++    }
++  }
++
++  if (command_line->HasSwitch(browseros::kCDPPipe)) {
++    cdp_pipe_connections_ = base::MakeRefCounted<CDPPipeConnections>();
++  }
++}
++
 +void BrowserOSServerManager::StartCDPServer() {
-+  LOG(INFO) << "browseros: Starting CDP server on port " << ports_.cdp;
++  CDPTransportOptions options;
++  options.tcp_port = ports_.cdp;
++  options.unix_socket_path = cdp_socket_path_;
++  options.pipe_connections = cdp_pipe_connections_;
++  LOG(INFO) << "browseros: Starting CDP server - " << options.DebugString();
 +
 +  content::DevToolsAgentHost::StartRemoteDebuggingServer(
-+      std::make_unique<CDPServerSocketFactory>(ports_.cdp),
++      std::make_unique<CDPServerSocketFactory>(std::move(options)),
 +      base::FilePath(),
 +      base::FilePath());
 +
@@ -506,6 +720,13 @@ index 0000000000000..6d44b32b78ce8
 +  LOG(INFO) << "browseros: Stopping CDP server";
 +  content::DevToolsAgentHost::StopRemoteDebuggingServer();
 +  ports_.cdp = 0;
++
++#if BUILDFLAG(IS_POSIX)
++  if (!cdp_socket_path_.empty()) {
++    base::ScopedAllowBlocking allow_blocking;
++    RemoveCDPSocketFile(cdp_socket_path_);
++  }
++#endif
 +}
 +
 +void BrowserOSServerManager::StartProxy() {
@@ -582,7 +803,9 @@ index 0000000000000..6d44b32b78ce8
 +    }
 +  }
 +
++  config.limits = resource_limits_;
 +  config.allow_remote_in_mcp = allow_remote_in_mcp_;
++  config.cdp_socket_path = cdp_socket_path_;
 +
 +  return config;
 +}
@@ -595,6 +818,15 @@ index 0000000000000..6d44b32b78ce8
 +    return;
 +  }
 +
++#if BUILDFLAG(IS_POSIX)
++  // Each launch gets a fresh connection; the previous server's end closed
++  // when it exited.
++  if (cdp_pipe_connections_) {
++    server_cdp_fd_ = cdp_pipe_connections_->CreateConnection();
++    config.cdp_pipe_fd = server_cdp_fd_.get();
++  }
++#endif
++
 +  LOG(INFO) << "browseros: Launching server - " << config.DebugString();
 +
 +  ProcessController* pc = process_controller_.get();
@@ -609,6 +841,20 @@ index 0000000000000..6d44b32b78ce8
 +void BrowserOSServerManager::OnProcessLaunched(LaunchResult result) {
 +  bool was_updating = is_updating_;
 +
++#if BUILDFLAG(IS_POSIX)
++  // The server inherited its own copy, if it launched at all.
++  server_cdp_fd_.reset();
++#endif
++
++  if (stopping_) {
++    // Stop() ran while the launch was in flight.
++    if (result.process.IsValid()) {
++      LOG(INFO) << "browseros: Server launched after shutdown, terminating";
++      process_controller_->Terminate(&result.process, /*wait=*/false);
++    }
++    return;
++  }
++
 +  if (result.used_fallback && updater_) {
 +    updater_->InvalidateDownloadedVersion();
 +  }
@@ -628,7 +874,11 @@ index 0000000000000..6d44b32b78ce8
 +
 +  process_ = std::move(result.process);
 +  is_running_ = true;
++  started_ = true;
 +  last_launch_time_ = base::TimeTicks::Now();
++  resource_usage_.reset();
++  last_cpu_time_ = base::TimeDelta();
++  memory_warning_logged_ = false;
 +
 +  LOG(INFO) << "browseros: BrowserOS server started with PID: " << process_.Pid();
 +  LOG(INFO) << "browseros: " << ports_.DebugString();
@@ -658,10 +908,10 @@ index 0000000000000..6d44b32b78ce8
 +    }
 +  }
 +
-+  health_check_timer_.Start(FROM_HERE, kHealthCheckInterval, this,
-+                            &BrowserOSServerManager::CheckServerHealth);
-+  process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
-+                             &BrowserOSServerManager::CheckProcessStatus);
++  // Ephemeral ports may have changed on restart.
++  PublishInstance();
++
++  StartMonitoring();
 +
 +  if (is_restarting_) {
 +    is_restarting_ = false;
@@ -719,12 +969,52 @@ index 0000000000000..6d44b32b78ce8
 +  std::move(callback).Run();
 +}
 +
++void BrowserOSServerManager::StartMonitoring() {
++  StopMonitoring();
++
++  exit_watcher_ = process_controller_->WatchForExit(
++      process_, base::BindOnce(&BrowserOSServerManager::CheckProcessStatus,
++                               weak_factory_.GetWeakPtr()));
++  if (!exit_watcher_) {
++    process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
++                               &BrowserOSServerManager::CheckProcessStatus);
++  }
++
++  resource_sample_timer_.Start(FROM_HERE, kResourceSampleInterval, this,
++                               &BrowserOSServerManager::SampleResourceUsage);
++
++  base::TimeDelta interval = GetDurationFromCommandLine(
++      browseros::kServerHeartbeatInterval, kDefaultHeartbeatInterval);
++  base::TimeDelta deadline = GetDurationFromCommandLine(
++      browseros::kServerHeartbeatDeadline, kDefaultHeartbeatDeadline);
++  missed_heartbeats_ = 0;
++  heartbeat_armed_ = false;
++
++  if (interval.is_zero()) {
++    health_check_timer_.Start(FROM_HERE, kHealthCheckInterval, this,
++                              &BrowserOSServerManager::CheckServerHealth);
++    return;
++  }
++
++  health_checker_->StartHeartbeat(
++      ports_.server, interval, deadline,
++      base::BindRepeating(&BrowserOSServerManager::OnHeartbeatResult,
++                          weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::StopMonitoring() {
++  health_check_timer_.Stop();
++  process_check_timer_.Stop();
++  resource_sample_timer_.Stop();
++  exit_watcher_.reset();
++  health_checker_->StopHeartbeat();
++}
++
 +void BrowserOSServerManager::OnProcessExited(int exit_code) {
 +  LOG(INFO) << "browseros: BrowserOS server exited with code: " << exit_code;
 +  is_running_ = false;
 +
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopMonitoring();
 +
 +  if (exit_code == kExitCodeSuccess) {
 +    LOG(INFO) << "browseros: Server exited cleanly (code 0), not restarting";
@@ -758,7 +1048,7 @@ index 0000000000000..6d44b32b78ce8
 +
 +  LOG(WARNING) << "browseros: Server exited (code " << exit_code
 +               << "), restarting with new ephemeral ports";
-+  RestartBrowserOSProcess();
++  RestartAfterFailure();
 +}
 +
 +void BrowserOSServerManager::CheckServerHealth() {
@@ -788,6 +1078,54 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +}
 +
++void BrowserOSServerManager::SampleResourceUsage() {
++  if (!is_running_ || !process_.IsValid()) {
++    return;
++  }
++
++  ProcessController* pc = process_controller_.get();
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&ProcessController::GetResourceUsage,
++                     base::Unretained(pc), process_.Pid()),
++      base::BindOnce(&BrowserOSServerManager::OnResourceUsageSampled,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnResourceUsageSampled(
++    std::optional<server_utils::ProcessResourceUsage> usage) {
++  if (!usage || !is_running_) {
++    return;
++  }
++
++  base::TimeTicks now = base::TimeTicks::Now();
++  ServerResourceUsage sample;
++  sample.resident_bytes = usage->resident_bytes;
++  sample.sampled_at = now;
++  if (resource_usage_) {
++    base::TimeDelta wall = now - resource_usage_->sampled_at;
++    base::TimeDelta cpu = usage->cpu_time - last_cpu_time_;
++    if (wall.is_positive() && !cpu.is_negative()) {
++      sample.cpu_percent = 100.0 * cpu / wall;
++    }
++  }
++  last_cpu_time_ = usage->cpu_time;
++  resource_usage_ = sample;
++
++  VLOG(1) << "browseros: Server RSS " << sample.resident_bytes / (1024 * 1024)
++          << "MB, CPU " << sample.cpu_percent << "%";
++
++  if (resource_limits_.memory_max_bytes > 0 && !memory_warning_logged_ &&
++      sample.resident_bytes >=
++          resource_limits_.memory_max_bytes * kMemoryWarningFraction) {
++    memory_warning_logged_ = true;
++    LOG(WARNING) << "browseros: Server RSS "
++                 << sample.resident_bytes / (1024 * 1024)
++                 << "MB is near its limit of "
++                 << resource_limits_.memory_max_bytes / (1024 * 1024) << "MB";
++  }
++}
++
 +void BrowserOSServerManager::OnHealthCheckComplete(bool success) {
 +  if (!is_running_) {
 +    return;
@@ -799,10 +1137,58 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +
 +  LOG(WARNING) << "browseros: Health check failed, restarting";
-+  RestartBrowserOSProcess();
++  RestartAfterFailure();
 +}
 +
-+void BrowserOSServerManager::RestartBrowserOSProcess() {
++void BrowserOSServerManager::OnHeartbeatResult(bool success) {
++  if (!is_running_ || is_restarting_) {
++    return;
++  }
++
++  if (success) {
++    heartbeat_armed_ = true;
++    missed_heartbeats_ = 0;
++    return;
++  }
++
++  if (!heartbeat_armed_ &&
++      base::TimeTicks::Now() - last_launch_time_ < kStartupGracePeriod) {
++    // Server is still booting; the exit watcher covers outright crashes.
++    return;
++  }
++
++  missed_heartbeats_++;
++  LOG(WARNING) << "browseros: Missed heartbeat (" << missed_heartbeats_ << "/"
++               << kMaxMissedHeartbeats << ")";
++  if (missed_heartbeats_ < kMaxMissedHeartbeats) {
++    return;
++  }
++
++  missed_heartbeats_ = 0;
++  OnHealthCheckComplete(false);
++}
++
++void BrowserOSServerManager::RestartAfterFailure() {
++  if (is_restarting_) {
++    LOG(INFO) << "browseros: Restart already in progress, ignoring";
++    return;
++  }
++
++  base::TimeTicks now = base::TimeTicks::Now();
++  base::TimeDelta delay = restart_scheduler_.RecordFailure(now);
++  int failures = restart_scheduler_.FailuresInWindow(now);
++  if (!delay.is_zero()) {
++    LOG(WARNING) << "browseros: " << failures
++                 << " server failures in the last "
++                 << restart_scheduler_.policy().failure_window.InMinutes()
++                 << " min, backing off " << delay.InMilliseconds()
++                 << "ms before relaunch";
++  }
++  RestartBrowserOSProcess(delay);
++}
++
++void BrowserOSServerManager::RestartBrowserOSProcess(
++    base::TimeDelta relaunch_delay) {
 +  LOG(INFO) << "browseros: Restarting BrowserOS server process";
 +
 +  if (is_restarting_) {
@@ -810,9 +1196,9 @@ index 0000000000000..6d44b32b78ce8
 +    return;
 +  }
 +  is_restarting_ = true;
++  relaunch_delay_ = relaunch_delay;
 +
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopMonitoring();
 +
 +  TerminateBrowserOSProcess(
 +      base::BindOnce(&BrowserOSServerManager::ContinueRestartAfterTerminate,
@@ -841,41 +1227,32 @@ index 0000000000000..6d44b32b78ce8
 +          base::Unretained(this)),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerManager> weak_manager) {
-+            if (!weak_manager) {
++            if (!weak_manager || weak_manager->stopping_) {
 +              return;
 +            }
 +            auto* manager = weak_manager.get();
-+
-+            // Pick new ephemeral ports for server and extension
-+            // (unless CLI-overridden)
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
-+
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
++            if (manager->relaunch_delay_.is_zero()) {
++              manager->RelaunchAfterTerminate();
++              return;
 +            }
-+
-+            LOG(INFO) << "browseros: New ephemeral ports - "
-+                      << manager->ports_.DebugString();
-+
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
++            // The old process is gone; wait out the backoff before
++            // relaunching.
++            manager->relaunch_timer_.Start(
++                FROM_HERE, manager->relaunch_delay_, manager,
++                &BrowserOSServerManager::RelaunchAfterTerminate);
 +          },
 +          weak_factory_.GetWeakPtr()));
 +}
 +
++void BrowserOSServerManager::RelaunchAfterTerminate() {
++  if (stopping_) {
++    return;
++  }
++  ReassignEphemeralPorts();
++  SavePortsToPrefs();
++  LaunchBrowserOSProcess();
++}
++
 +void BrowserOSServerManager::RestartServerForUpdate(
 +    UpdateCompleteCallback callback) {
 +  LOG(INFO) << "browseros: Restarting server for OTA update";
@@ -890,8 +1267,7 @@ index 0000000000000..6d44b32b78ce8
 +  update_complete_callback_ = std::move(callback);
 +
 +  is_restarting_ = true;
-+  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  StopMonitoring();
 +
 +  TerminateBrowserOSProcess(
 +      base::BindOnce(&BrowserOSServerManager::ContinueUpdateAfterTerminate,
@@ -918,36 +1294,8 @@ index 0000000000000..6d44b32b78ce8
 +            }
 +          },
 +          base::Unretained(this)),
-+      base::BindOnce(
-+          [](base::WeakPtr<BrowserOSServerManager> weak_manager) {
-+            if (!weak_manager) {
-+              return;
-+            }
-+            auto* manager = weak_manager.get();
-+
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
-+
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
-+            }
-+
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
-+          },
-+          weak_factory_.GetWeakPtr()));
++      base::BindOnce(&BrowserOSServerManager::RelaunchAfterTerminate,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerManager::OnAllowRemoteInMCPChanged() {
@@ -972,7 +1320,7 @@ index 0000000000000..6d44b32b78ce8
 +                         base::Unretained(server_proxy_.get()), new_value));
 +    }
 +
-+    RestartBrowserOSProcess();
++    RestartBrowserOSProcess(base::TimeDelta());
 +  }
 +}
 +
@@ -989,7 +1337,7 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +
 +  LOG(INFO) << "browseros: Server restart requested via preference";
-+  RestartBrowserOSProcess();
++  RestartBrowserOSProcess(base::TimeDelta());
 +}
 +
 +base::FilePath BrowserOSServerManager::GetBrowserOSServerResourcesPath() const {
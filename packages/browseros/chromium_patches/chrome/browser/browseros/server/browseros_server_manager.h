@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.h b/chrome/browser/browseros/server/browseros_server_manager.h
 new file mode 100644
-index 0000000000000..241343e436f94
+index 0000000000000..8a464bf5d2f48
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.h
-@@ -0,0 +1,158 @@
+@@ -0,0 +1,261 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,17 +12,26 @@ index 0000000000000..241343e436f94
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_MANAGER_H_
 +
 +#include <memory>
++#include <optional>
 +#include <set>
++#include <string>
 +
 +#include "base/files/file.h"
 +#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/no_destructor.h"
 +#include "base/process/process.h"
 +#include "base/timer/timer.h"
++#include "build/build_config.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
++#include "chrome/browser/browseros/server/restart_scheduler.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "base/files/scoped_file.h"
++#endif
 +
 +class PrefChangeRegistrar;
 +class PrefService;
@@ -33,20 +42,41 @@ index 0000000000000..241343e436f94
 +
 +namespace browseros {
 +class BrowserOSServerProxy;
++class CDPPipeConnections;
 +class HealthChecker;
++class InstanceRegistry;
++struct InstanceRecord;
 +class ProcessController;
++class ProcessExitWatcher;
 +class ServerStateStore;
 +class ServerUpdater;
 +}
 +
 +namespace browseros {
 +
++// Latest resource sample of the running server.
++struct ServerResourceUsage {
++  int64_t resident_bytes = 0;
++  // Share of one core since the previous sample; 0 for the first sample.
++  double cpu_percent = 0;
++  base::TimeTicks sampled_at;
++};
++
 +// BrowserOS: Manages the lifecycle of the BrowserOS server process (singleton)
 +// This manager:
-+// 1. Starts Chromium's CDP WebSocket server
++// 1. Starts Chromium's CDP WebSocket server on a loopback port, and
++//    optionally on a Unix domain socket and an inherited socket pair
 +// 2. Binds a stable MCP proxy port that forwards /mcp to the sidecar
 +// 3. Launches the bundled BrowserOS server binary with ephemeral backend ports
-+// 4. Monitors server health via HTTP /health endpoint and auto-restarts
++// 4. Watches for process exit (pidfd/kqueue/handle, polling as fallback) and
++//    probes liveness with a sub-second keep-alive heartbeat, auto-restarting
++//    on exit or after consecutive missed beats
++// 5. Backs off exponentially when the server crash-loops, optionally caps
++//    its memory/CPU, and samples its RSS/CPU usage
++//
++// With --browseros-instance-namespace, lock/state files and the port block
++// are scoped to the namespace and the instance is published in a host-wide
++// registry so many browsers on one host can each run a server.
 +class BrowserOSServerManager {
 + public:
 +  // Production singleton (uses real implementations)
@@ -78,11 +108,25 @@ index 0000000000000..241343e436f94
 +
 +  bool IsAllowRemoteInMCP() const { return allow_remote_in_mcp_; }
 +
++  // Instance namespace (empty for the default instance) and its port block
++  // slot (-1 when not namespaced or not registered).
++  const std::string& GetInstanceName() const { return instance_name_; }
++  int GetInstanceSlot() const { return instance_slot_; }
++
++  // Most recent RSS/CPU sample of the server, or nullopt before the first
++  // sample after a launch.
++  const std::optional<ServerResourceUsage>& GetServerResourceUsage() const {
++    return resource_usage_;
++  }
++
 +  void Shutdown();
 +
 +  // Health check result handler (public for testing)
 +  void OnHealthCheckComplete(bool success);
 +
++  // Heartbeat result handler (public for testing)
++  void OnHeartbeatResult(bool success);
++
 +  void SetRunningForTesting(bool running) { is_running_ = running; }
 +
 +  base::FilePath GetBrowserOSServerExecutablePath() const;
@@ -103,8 +147,25 @@ index 0000000000000..241343e436f94
 +  void LoadPortsFromPrefs();
 +  void SetupPrefObservers();
 +  void ResolvePortsForStartup();
++  // Resolves the ports not fixed on the command line. Returns false if a
++  // namespaced instance's slot has no free port for some service.
++  bool TryResolvePortsForStartup();
++  // Finds a port from |base|, within the slot's block when namespaced.
++  std::optional<int> FindPortForService(int base,
++                                        const std::set<int>& assigned,
++                                        bool allow_reuse = false) const;
 +  void ApplyCommandLineOverrides();
++  void ReassignEphemeralPorts();
 +  void SavePortsToPrefs();
++
++  InstanceRecord BuildInstanceRecord() const;
++  void RegisterInstance();
++  // Re-registers a namespaced instance in the next free slot after its
++  // current one. Returns false if there is none.
++  bool MoveToNextInstanceSlot();
++  void PublishInstance();
++  void UnregisterInstance();
++  void ConfigureCDPTransports();
 +  void StartCDPServer();
 +  void StopCDPServer();
 +  void StartProxy();
@@ -119,15 +180,23 @@ index 0000000000000..241343e436f94
 +  void OnTerminateHttpComplete(base::OnceCallback<void()> callback,
 +                               bool http_success);
 +
-+  void RestartBrowserOSProcess();
++  void RestartAfterFailure();
++  void RestartBrowserOSProcess(base::TimeDelta relaunch_delay);
 +  void ContinueRestartAfterTerminate();
++  void RelaunchAfterTerminate();
 +  void ContinueUpdateAfterTerminate();
 +
++  void StartMonitoring();
++  void StopMonitoring();
++
 +  void OnProcessExited(int exit_code);
 +  void CheckServerHealth();
 +  void OnAllowRemoteInMCPChanged();
 +  void OnRestartServerRequestedChanged();
 +  void CheckProcessStatus();
++  void SampleResourceUsage();
++  void OnResourceUsageSampled(
++      std::optional<server_utils::ProcessResourceUsage> usage);
 +
 +  base::FilePath GetBrowserOSExecutionDir() const;
 +
@@ -141,8 +210,25 @@ index 0000000000000..241343e436f94
 +  base::File lock_file_;
 +  base::Process process_;
 +  ServerPorts ports_;
++  // First port probed for each service; the instance block when namespaced.
++  ServerPorts port_bases_;
++  // Optional CDP transports besides ports_.cdp.
++  base::FilePath cdp_socket_path_;
++  scoped_refptr<CDPPipeConnections> cdp_pipe_connections_;
++#if BUILDFLAG(IS_POSIX)
++  // The launching server's end of its CDP connection, held until launch.
++  base::ScopedFD server_cdp_fd_;
++#endif
++  std::string instance_name_;
++  int instance_slot_ = -1;
++  std::unique_ptr<InstanceRegistry> instance_registry_;
 +  bool allow_remote_in_mcp_ = false;
 +  bool is_running_ = false;
++  // Set once Start() holds the lock, or a server has launched, until Stop().
++  // Unlike |is_running_| it stays set while a crashed server awaits relaunch.
++  bool started_ = false;
++  // Set by Stop() until the next Start().
++  bool stopping_ = false;
 +  bool is_restarting_ = false;
 +  bool is_updating_ = false;
 +  UpdateCompleteCallback update_complete_callback_;
@@ -150,9 +236,26 @@ index 0000000000000..241343e436f94
 +  int consecutive_startup_failures_ = 0;
 +  base::TimeTicks last_launch_time_;
 +
++  RestartScheduler restart_scheduler_;
++  base::TimeDelta relaunch_delay_;
++  base::OneShotTimer relaunch_timer_;
++
++  ServerResourceLimits resource_limits_;
++  std::optional<ServerResourceUsage> resource_usage_;
++  base::TimeDelta last_cpu_time_;
++  bool memory_warning_logged_ = false;
++  base::RepeatingTimer resource_sample_timer_;
++
++  // Fallbacks for when exit notification or the heartbeat is unavailable.
 +  base::RepeatingTimer health_check_timer_;
 +  base::RepeatingTimer process_check_timer_;
 +
++  std::unique_ptr<ProcessExitWatcher> exit_watcher_;
++  int missed_heartbeats_ = 0;
++  // Set by the first successful beat after launch; misses before that are
++  // tolerated for kStartupGracePeriod while the server boots.
++  bool heartbeat_armed_ = false;
++
 +  std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
 +  std::unique_ptr<ServerUpdater> updater_;
 +
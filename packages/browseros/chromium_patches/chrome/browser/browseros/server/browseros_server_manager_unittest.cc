@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager_unittest.cc b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
 new file mode 100644
-index 0000000000000..8f97e0b97467f
+index 0000000000000..29c671b80a193
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
-@@ -0,0 +1,497 @@
+@@ -0,0 +1,732 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -83,6 +83,14 @@ index 0000000000000..8f97e0b97467f
 +        });
 +  }
 +
++  // Acknowledge /shutdown so restarts of a launched server can proceed.
++  void SetupGracefulShutdown() {
++    ON_CALL(*health_checker_, RequestShutdown(_, _))
++        .WillByDefault([](int port, base::OnceCallback<void(bool)> callback) {
++          std::move(callback).Run(true);
++        });
++  }
++
 +  void SetupFailedLaunch() {
 +    ON_CALL(*process_controller_, Launch(_))
 +        .WillByDefault([](const ServerLaunchConfig&) {
@@ -471,6 +479,21 @@ index 0000000000000..8f97e0b97467f
 +  EXPECT_NE(0, prefs_.GetInteger(browseros_server::kExtensionServerPort));
 +}
 +
++TEST_F(BrowserOSServerManagerTest, NamespacedInstanceKeepsPortPrefs) {
++  prefs_.SetInteger(browseros_server::kCDPServerPort, 9100);
++
++  base::test::ScopedCommandLine scoped_command_line;
++  base::CommandLine* command_line =
++      scoped_command_line.GetProcessCommandLine();
++  command_line->AppendSwitch(browseros::kDisableServer);
++  command_line->AppendSwitchASCII(browseros::kInstanceNamespace, "agent");
++  command_line->AppendSwitchASCII(browseros::kCDPPort, "20001");
++
++  manager_->Start();
++
++  EXPECT_EQ(9100, prefs_.GetInteger(browseros_server::kCDPServerPort));
++}
++
 +TEST_F(BrowserOSServerManagerTest, UpdateRestartSavesEphemeralPortsToPrefs) {
 +  SetupSuccessfulLaunch();
 +  manager_->SetRunningForTesting(true);
@@ -499,5 +522,217 @@ index 0000000000000..8f97e0b97467f
 +  EXPECT_NE(0, prefs_.GetInteger(browseros_server::kExtensionServerPort));
 +}
 +
++// =============================================================================
++// Exit Watcher / Heartbeat Tests
++// =============================================================================
++
++TEST_F(BrowserOSServerManagerTest, LaunchStartsExitWatchAndHeartbeat) {
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitch(
++      kDisableServerUpdater);
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  EXPECT_CALL(*process_controller_, WatchForExit(_, _));
++  EXPECT_CALL(*health_checker_,
++              StartHeartbeat(_, base::Seconds(1), base::Milliseconds(500), _));
++  EXPECT_CALL(*health_checker_, CheckHealth(_, _)).Times(0);
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  task_environment_.FastForwardBy(base::Seconds(31));
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++}
++
++TEST_F(BrowserOSServerManagerTest, ZeroHeartbeatIntervalFallsBackToPolling) {
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitch(
++      kDisableServerUpdater);
++  scoped_command_line.GetProcessCommandLine()->AppendSwitchASCII(
++      kServerHeartbeatInterval, "0");
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  EXPECT_CALL(*health_checker_, StartHeartbeat(_, _, _, _)).Times(0);
++  EXPECT_CALL(*health_checker_, CheckHealth(_, _)).Times(testing::AtLeast(1));
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  task_environment_.FastForwardBy(base::Seconds(31));
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++}
++
++TEST_F(BrowserOSServerManagerTest, MissedHeartbeatsTriggerRestart) {
++  manager_->SetRunningForTesting(true);
++  manager_->OnHeartbeatResult(true);
++
++  // A single miss is tolerated.
++  EXPECT_CALL(*health_checker_, StopHeartbeat()).Times(0);
++  manager_->OnHeartbeatResult(false);
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++
++  // The second consecutive miss restarts, which stops monitoring.
++  EXPECT_CALL(*health_checker_, StopHeartbeat()).Times(testing::AtLeast(1));
++  manager_->OnHeartbeatResult(false);
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++}
++
++TEST_F(BrowserOSServerManagerTest, SuccessfulHeartbeatResetsMissCount) {
++  manager_->SetRunningForTesting(true);
++
++  EXPECT_CALL(*health_checker_, StopHeartbeat()).Times(0);
++  manager_->OnHeartbeatResult(true);
++  manager_->OnHeartbeatResult(false);
++  manager_->OnHeartbeatResult(true);
++  manager_->OnHeartbeatResult(false);
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++}
++
++TEST_F(BrowserOSServerManagerTest, HeartbeatMissesIgnoredDuringStartup) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  // Relaunch so the startup grace period starts now.
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++
++  // Server has not answered yet; misses within the grace period are ignored.
++  EXPECT_CALL(*health_checker_, StopHeartbeat()).Times(0);
++  manager_->OnHeartbeatResult(false);
++  manager_->OnHeartbeatResult(false);
++  manager_->OnHeartbeatResult(false);
++  testing::Mock::VerifyAndClearExpectations(health_checker_);
++}
++
++// =============================================================================
++// Restart Backoff Tests
++// =============================================================================
++
++TEST_F(BrowserOSServerManagerTest, CrashLoopBacksOffBeforeRelaunch) {
++  SetupSuccessfulLaunch();
++  SetupGracefulShutdown();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  // First failure in the window relaunches right away.
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(1);
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++
++  // Second failure waits out the backoff.
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(1);
++  task_environment_.FastForwardBy(base::Seconds(2));
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++}
++
++TEST_F(BrowserOSServerManagerTest, StopCancelsPendingRelaunch) {
++  SetupSuccessfulLaunch();
++  SetupGracefulShutdown();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  manager_->Stop();
++  task_environment_.FastForwardBy(base::Minutes(10));
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++}
++
++TEST_F(BrowserOSServerManagerTest, StopDuringBackoffReleasesResources) {
++  SetupSuccessfulLaunch();
++  SetupGracefulShutdown();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  // The server is down while the relaunch waits out the backoff, as after a
++  // crash.
++  manager_->SetRunningForTesting(false);
++
++  EXPECT_CALL(*state_store_, Delete()).Times(1);
++  EXPECT_CALL(*updater_, Stop()).Times(1);
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  manager_->Stop();
++  task_environment_.FastForwardBy(base::Minutes(10));
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++  testing::Mock::VerifyAndClearExpectations(state_store_);
++}
++
++TEST_F(BrowserOSServerManagerTest, StopDuringExitWaitDoesNotRelaunch) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  // The restart's wait for the old process is still in flight.
++  EXPECT_CALL(*process_controller_, Launch(_)).Times(0);
++  manager_->OnHealthCheckComplete(false);
++  manager_->Stop();
++  task_environment_.RunUntilIdle();
++  task_environment_.FastForwardBy(base::Minutes(10));
++  testing::Mock::VerifyAndClearExpectations(process_controller_);
++}
++
++// =============================================================================
++// Resource Sampling Tests
++// =============================================================================
++
++TEST_F(BrowserOSServerManagerTest, SamplesServerResourceUsage) {
++  SetupSuccessfulLaunch();
++  manager_->SetRunningForTesting(true);
++  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
++      .WillByDefault(Return(true));
++
++  server_utils::ProcessResourceUsage first;
++  first.resident_bytes = 100 * 1024 * 1024;
++  first.cpu_time = base::Seconds(1);
++  server_utils::ProcessResourceUsage second;
++  second.resident_bytes = 120 * 1024 * 1024;
++  second.cpu_time = base::Seconds(4);
++  EXPECT_CALL(*process_controller_, GetResourceUsage(_))
++      .WillOnce(Return(first))
++      .WillOnce(Return(second))
++      .WillRepeatedly(Return(std::nullopt));
++
++  manager_->OnHealthCheckComplete(false);
++  task_environment_.RunUntilIdle();
++  EXPECT_FALSE(manager_->GetServerResourceUsage());
++
++  task_environment_.FastForwardBy(base::Seconds(15));
++  ASSERT_TRUE(manager_->GetServerResourceUsage());
++  EXPECT_EQ(first.resident_bytes,
++            manager_->GetServerResourceUsage()->resident_bytes);
++  EXPECT_EQ(0, manager_->GetServerResourceUsage()->cpu_percent);
++
++  // 3s of CPU over 15s of wall time.
++  task_environment_.FastForwardBy(base::Seconds(15));
++  ASSERT_TRUE(manager_->GetServerResourceUsage());
++  EXPECT_EQ(second.resident_bytes,
++            manager_->GetServerResourceUsage()->resident_bytes);
++  EXPECT_DOUBLE_EQ(20.0, manager_->GetServerResourceUsage()->cpu_percent);
++}
++
 +}  // namespace
 +}  // namespace browseros
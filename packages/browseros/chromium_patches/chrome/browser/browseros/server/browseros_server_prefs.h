@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_prefs.h b/chrome/browser/browseros/server/browseros_server_prefs.h
 new file mode 100644
-index 0000000000000..69bd172f9ce25
+index 0000000000000..acdda3778588a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_prefs.h
-@@ -0,0 +1,36 @@
+@@ -0,0 +1,43 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -21,6 +21,13 @@ index 0000000000000..69bd172f9ce25
 +inline constexpr int kDefaultServerPort = 9200;
 +inline constexpr int kDefaultExtensionPort = 9300;
 +
++// Namespaced instances get a dedicated block of kInstancePortStride ports
++// starting at kInstancePortRangeStart + slot * kInstancePortStride, so many
++// instances on one host never probe the same ports.
++inline constexpr int kInstancePortRangeStart = 20000;
++inline constexpr int kInstancePortStride = 10;
++inline constexpr int kMaxInstanceSlots = 1024;
++
 +// Preference keys for BrowserOS server configuration
 +extern const char kCDPServerPort[];
 +extern const char kProxyPort[];
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_proxy.cc b/chrome/browser/browseros/server/browseros_server_proxy.cc
 new file mode 100644
-index 0000000000000..7ffdb8f011b08
+index 0000000000000..44ccb31992238
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_proxy.cc
-@@ -0,0 +1,225 @@
+@@ -0,0 +1,249 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -15,6 +15,12 @@ index 0000000000000..7ffdb8f011b08
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/core/browseros_activity.h"
++#include "chrome/browser/profiles/profile.h"
++#include "chrome/browser/profiles/profile_manager.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
 +#include "net/base/ip_address.h"
 +#include "net/base/net_errors.h"
 +#include "net/http/http_status_code.h"
@@ -55,6 +61,19 @@ index 0000000000000..7ffdb8f011b08
 +    })");
 +}
 +
++// MCP requests carry no profile. The sidecar drives the browser through
++// the last used profile, the same one BrowserOSServerManager takes the
++// server's identity from, so that is the profile whose agents get woken.
++void NotifyMcpRequestForLastUsedProfile() {
++  ProfileManager* profile_manager = g_browser_process->profile_manager();
++  Profile* profile =
++      profile_manager ? profile_manager->GetLastUsedProfileIfLoaded() : nullptr;
++  if (!profile || profile->IsOffTheRecord()) {
++    return;
++  }
++  NotifyMcpRequest(profile);
++}
++
 +void Send503(net::HttpServer* server, int connection_id) {
 +  net::HttpServerResponseInfo response(net::HTTP_SERVICE_UNAVAILABLE);
 +  response.SetBody("Service Unavailable", "text/plain");
@@ -133,6 +152,11 @@ index 0000000000000..7ffdb8f011b08
 +    return;
 +  }
 +
++  // Lets extension workers that went idle start while the sidecar handles
++  // the request, rather than when it calls into them.
++  content::GetUIThreadTaskRunner({})->PostTask(
++      FROM_HERE, base::BindOnce(&NotifyMcpRequestForLastUsedProfile));
++
 +  ForwardRequest(connection_id, info);
 +}
 +
@@ -1,16 +1,15 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.cc b/chrome/browser/browseros/server/browseros_server_updater.cc
 new file mode 100644
-index 0000000000000..ced363ffbabc2
+index 0000000000000..2e1c81daf72f4
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.cc
-@@ -0,0 +1,1075 @@
+@@ -0,0 +1,1159 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_updater.h"
 +
-+#include "base/base64.h"
 +#include "base/command_line.h"
 +#include "base/feature_list.h"
 +#include "base/files/file_enumerator.h"
@@ -26,19 +25,19 @@ index 0000000000000..ced363ffbabc2
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/server/browseros_delta_update.h"
 +#include "chrome/browser/browseros/server/browseros_server_constants.h"
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "chrome/browser/browseros/server/browseros_update_verifier.h"
 +#include "chrome/browser/net/system_network_context_manager.h"
 +#include "chrome/common/chrome_paths.h"
 +#include "components/prefs/pref_service.h"
 +#include "net/base/net_errors.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
-+#include "third_party/boringssl/src/include/openssl/curve25519.h"
-+#include "third_party/zlib/google/zip.h"
-+#include "third_party/zlib/google/zip_reader.h"
 +#include "url/gurl.h"
 +
 +namespace browseros_server {
@@ -115,81 +114,6 @@ index 0000000000000..ced363ffbabc2
 +    })");
 +}
 +
-+// Verifies Ed25519 signature of file contents.
-+// Returns true if signature is valid.
-+bool VerifyEd25519Signature(const base::FilePath& file_path,
-+                            const std::string& signature_base64,
-+                            const std::string& public_key_base64) {
-+  // Decode public key
-+  std::string public_key_bytes;
-+  if (!base::Base64Decode(public_key_base64, &public_key_bytes)) {
-+    LOG(ERROR) << "browseros: Failed to decode public key from base64";
-+    return false;
-+  }
-+  if (public_key_bytes.size() != ED25519_PUBLIC_KEY_LEN) {
-+    LOG(ERROR) << "browseros: Invalid public key length: "
-+               << public_key_bytes.size() << " (expected "
-+               << ED25519_PUBLIC_KEY_LEN << ")";
-+    return false;
-+  }
-+
-+  // Decode signature
-+  std::string signature_bytes;
-+  if (!base::Base64Decode(signature_base64, &signature_bytes)) {
-+    LOG(ERROR) << "browseros: Failed to decode signature from base64";
-+    return false;
-+  }
-+  if (signature_bytes.size() != ED25519_SIGNATURE_LEN) {
-+    LOG(ERROR) << "browseros: Invalid signature length: "
-+               << signature_bytes.size() << " (expected "
-+               << ED25519_SIGNATURE_LEN << ")";
-+    return false;
-+  }
-+
-+  // Read file contents
-+  std::string file_contents;
-+  if (!base::ReadFileToString(file_path, &file_contents)) {
-+    LOG(ERROR) << "browseros: Failed to read file for signature verification: "
-+               << file_path;
-+    return false;
-+  }
-+
-+  // Verify signature
-+  const uint8_t* message =
-+      reinterpret_cast<const uint8_t*>(file_contents.data());
-+  size_t message_len = file_contents.size();
-+  const uint8_t* sig = reinterpret_cast<const uint8_t*>(signature_bytes.data());
-+  const uint8_t* pub_key =
-+      reinterpret_cast<const uint8_t*>(public_key_bytes.data());
-+
-+  int result = ED25519_verify(message, message_len, sig, pub_key);
-+  if (result != 1) {
-+    LOG(ERROR) << "browseros: Ed25519 signature verification failed";
-+    return false;
-+  }
-+
-+  LOG(INFO) << "browseros: Ed25519 signature verified successfully";
-+  return true;
-+}
-+
-+// Extracts ZIP file to destination directory.
-+// Returns empty string on success, error message on failure.
-+std::string ExtractZipFile(const base::FilePath& zip_path,
-+                           const base::FilePath& dest_dir) {
-+  // Ensure destination directory exists
-+  if (!base::CreateDirectory(dest_dir)) {
-+    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
-+  }
-+
-+  // Use the zip::Unzip utility which handles the extraction properly
-+  if (!zip::Unzip(zip_path, dest_dir)) {
-+    return "Failed to extract ZIP file";
-+  }
-+
-+  LOG(INFO) << "browseros: Extracted ZIP to " << dest_dir;
-+  return "";  // Success
-+}
-+
 +// Runs binary with --version and captures output.
 +// Returns exit code and output via out parameters.
 +void RunBinaryVersionCheck(const base::FilePath& binary_path,
@@ -226,17 +150,11 @@ index 0000000000000..ced363ffbabc2
 +
 +VerifyExtractResult DoVerifyAndExtract(const base::FilePath& zip_path,
 +                                       const std::string& signature,
++                                       const std::string& public_key,
 +                                       const base::FilePath& dest_dir) {
 +  VerifyExtractResult result;
 +
-+  // Step 1: Verify signature
-+  if (!VerifyEd25519Signature(zip_path, signature, kServerUpdatePublicKey)) {
-+    result.error = "Signature verification failed";
-+    base::DeleteFile(zip_path);
-+    return result;
-+  }
-+
-+  // Step 2: Clean stale destination if exists (handles interrupted updates)
++  // Clean stale destination if exists (handles interrupted updates)
 +  if (base::PathExists(dest_dir)) {
 +    LOG(WARNING) << "browseros: Cleaning stale version directory: " << dest_dir;
 +    if (!base::DeletePathRecursively(dest_dir)) {
@@ -246,10 +164,11 @@ index 0000000000000..ced363ffbabc2
 +    }
 +  }
 +
-+  // Step 3: Extract ZIP
-+  std::string extract_error = ExtractZipFile(zip_path, dest_dir);
-+  if (!extract_error.empty()) {
-+    result.error = extract_error;
++  // Verify signature and extract from the same open file
++  std::string error =
++      VerifyAndExtractPackage(zip_path, signature, public_key, dest_dir);
++  if (!error.empty()) {
++    result.error = error;
 +    // Cleanup partial extraction
 +    base::DeletePathRecursively(dest_dir);
 +    base::DeleteFile(zip_path);
@@ -262,11 +181,51 @@ index 0000000000000..ced363ffbabc2
 +  return result;
 +}
 +
++// Background task: verify the delta package signature, unpack it next to the
++// download and rebuild |dest_dir| from |from_dir|.
++VerifyExtractResult DoVerifyAndApplyDelta(const base::FilePath& zip_path,
++                                          const std::string& signature,
++                                          const std::string& public_key,
++                                          const base::Version& from_version,
++                                          const base::FilePath& from_dir,
++                                          const base::Version& to_version,
++                                          const base::FilePath& dest_dir) {
++  VerifyExtractResult result;
++  base::FilePath delta_dir =
++      zip_path.DirName().AppendASCII(kDeltaDirectoryName);
++
++  for (const base::FilePath& dir : {dest_dir, delta_dir}) {
++    if (base::PathExists(dir) && !base::DeletePathRecursively(dir)) {
++      result.error = "Failed to clean stale directory: " + dir.AsUTF8Unsafe();
++      base::DeleteFile(zip_path);
++      return result;
++    }
++  }
++
++  std::string error =
++      VerifyAndExtractPackage(zip_path, signature, public_key, delta_dir);
++  base::DeleteFile(zip_path);
++  if (error.empty()) {
++    error = ApplyDeltaPackage(delta_dir, from_version, from_dir, to_version,
++                              dest_dir);
++  }
++  base::DeletePathRecursively(delta_dir);
++
++  if (!error.empty()) {
++    result.error = error;
++    base::DeletePathRecursively(dest_dir);
++    return result;
++  }
++
++  result.success = true;
++  return result;
++}
++
 +}  // namespace
 +
 +BrowserOSServerUpdater::BrowserOSServerUpdater(
 +    browseros::BrowserOSServerManager* manager)
-+    : manager_(manager) {}
++    : manager_(manager), public_key_(kServerUpdatePublicKey) {}
 +
 +BrowserOSServerUpdater::~BrowserOSServerUpdater() {
 +  Stop();
@@ -403,6 +362,35 @@ index 0000000000000..ced363ffbabc2
 +  FetchAppcast();
 +}
 +
++void BrowserOSServerUpdater::SetURLLoaderFactoryForTesting(
++    scoped_refptr<network::SharedURLLoaderFactory> factory) {
++  url_loader_factory_for_testing_ = std::move(factory);
++}
++
++void BrowserOSServerUpdater::SetPublicKeyForTesting(
++    const std::string& public_key_base64) {
++  public_key_ = public_key_base64;
++}
++
++void BrowserOSServerUpdater::SetCachedVersionsForTesting(
++    const base::Version& bundled,
++    const base::Version& downloaded) {
++  cached_bundled_version_ = bundled;
++  cached_downloaded_version_ = downloaded;
++  bundled_version_loaded_ = true;
++  downloaded_version_loaded_ = true;
++}
++
++void BrowserOSServerUpdater::SetUpdateStagedCallbackForTesting(
++    base::OnceCallback<void(bool)> callback) {
++  update_staged_callback_for_testing_ = std::move(callback);
++}
++
++void BrowserOSServerUpdater::SetVersionCheckRunnerForTesting(
++    VersionCheckRunner runner) {
++  version_check_runner_for_testing_ = std::move(runner);
++}
++
 +void BrowserOSServerUpdater::OnUpdateTimer() {
 +  CheckNow();
 +}
@@ -441,11 +429,8 @@ index 0000000000000..ced363ffbabc2
 +      std::move(request), GetAppcastTrafficAnnotation());
 +  appcast_loader_->SetTimeoutDuration(kAppcastFetchTimeout);
 +
-+  auto* url_loader_factory = g_browser_process->system_network_context_manager()
-+                                 ->GetURLLoaderFactory();
-+
 +  appcast_loader_->DownloadToString(
-+      url_loader_factory,
++      GetURLLoaderFactory(),
 +      base::BindOnce(&BrowserOSServerUpdater::OnAppcastFetched,
 +                     weak_factory_.GetWeakPtr()),
 +      kMaxAppcastSize);
@@ -524,6 +509,21 @@ index 0000000000000..ced363ffbabc2
 +    return;
 +  }
 +
++  // Deltas are built against an extracted versions/{from}/ directory, so only
++  // a previously downloaded version can serve as the base.
++  base::Version from = GetLatestDownloadedVersion();
++  const AppcastEnclosure* delta =
++      pending_item_.GetDeltaForCurrentPlatform(from);
++  if (delta) {
++    LOG(INFO) << "browseros: Using delta update from " << from.GetString();
++    pending_is_delta_ = true;
++    pending_delta_from_ = from;
++    pending_full_enclosure_ = enclosure;
++    pending_signature_ = delta->signature;
++    StartDownload(*delta, version);
++    return;
++  }
++
 +  StartDownload(enclosure, version);
 +}
 +
@@ -580,12 +580,8 @@ index 0000000000000..ced363ffbabc2
 +            base::FilePath download_path =
 +                self->GetPendingUpdateDir().AppendASCII(kDownloadFileName);
 +
-+            auto* url_loader_factory =
-+                g_browser_process->system_network_context_manager()
-+                    ->GetURLLoaderFactory();
-+
 +            self->download_loader_->DownloadToFile(
-+                url_loader_factory,
++                self->GetURLLoaderFactory(),
 +                base::BindOnce(&BrowserOSServerUpdater::OnDownloadComplete,
 +                               self, ver),
 +                download_path);
@@ -597,6 +593,11 @@ index 0000000000000..ced363ffbabc2
 +                                                base::FilePath zip_path) {
 +  if (zip_path.empty()) {
 +    int net_error = download_loader_->NetError();
++    if (pending_is_delta_) {
++      OnDeltaApplied(version, false,
++                     "Delta download failed: " + net::ErrorToString(net_error));
++      return;
++    }
 +    OnError("download", "Download failed: " + net::ErrorToString(net_error));
 +    return;
 +  }
@@ -604,6 +605,10 @@ index 0000000000000..ced363ffbabc2
 +  LOG(INFO) << "browseros: Download complete: " << zip_path;
 +
 +  // Now verify and extract
++  if (pending_is_delta_) {
++    VerifyAndApplyDelta(zip_path, pending_signature_, version);
++    return;
++  }
 +  VerifyAndExtract(zip_path, pending_signature_, version);
 +}
 +
@@ -619,7 +624,8 @@ index 0000000000000..ced363ffbabc2
 +  // Run verification and extraction on background thread
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(&DoVerifyAndExtract, zip_path, signature, dest_dir),
++      base::BindOnce(&DoVerifyAndExtract, zip_path, signature, public_key_,
++                     dest_dir),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self, base::Version version,
 +             VerifyExtractResult result) {
@@ -632,6 +638,63 @@ index 0000000000000..ced363ffbabc2
 +          weak_factory_.GetWeakPtr(), version));
 +}
 +
++void BrowserOSServerUpdater::VerifyAndApplyDelta(
++    const base::FilePath& zip_path,
++    const std::string& signature,
++    const base::Version& version) {
++  state_ = State::kVerifying;
++
++  base::FilePath dest_dir = GetVersionDir(version);
++  base::FilePath from_dir = GetVersionDir(pending_delta_from_);
++
++  LOG(INFO) << "browseros: Verifying delta and rebuilding " << dest_dir;
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&DoVerifyAndApplyDelta, zip_path, signature, public_key_,
++                     pending_delta_from_, from_dir, version, dest_dir),
++      base::BindOnce(
++          [](base::WeakPtr<BrowserOSServerUpdater> self, base::Version version,
++             VerifyExtractResult result) {
++            if (!self) {
++              return;
++            }
++            self->OnDeltaApplied(version, result.success, result.error);
++          },
++          weak_factory_.GetWeakPtr(), version));
++}
++
++void BrowserOSServerUpdater::OnDeltaApplied(const base::Version& version,
++                                            bool success,
++                                            const std::string& error) {
++  if (success) {
++    base::Value::Dict props;
++    props.Set("from", pending_delta_from_.GetString());
++    props.Set("version", version.GetString());
++    browseros_metrics::BrowserOSMetrics::Log("server.ota.delta_applied",
++                                             std::move(props));
++    OnVerifyAndExtractComplete(version, true, std::string());
++    return;
++  }
++
++  LOG(WARNING) << "browseros: Delta update failed (" << error
++               << "), falling back to full download";
++
++  base::Value::Dict props;
++  props.Set("from", pending_delta_from_.GetString());
++  props.Set("version", version.GetString());
++  props.Set("error", error);
++  browseros_metrics::BrowserOSMetrics::Log("server.ota.delta_fallback",
++                                           std::move(props));
++
++  pending_is_delta_ = false;
++  pending_delta_from_ = base::Version();
++  pending_signature_ = pending_full_enclosure_.signature;
++  AppcastEnclosure full = std::move(pending_full_enclosure_);
++  pending_full_enclosure_ = AppcastEnclosure();
++  StartDownload(full, version);
++}
++
 +void BrowserOSServerUpdater::OnVerifyAndExtractComplete(
 +    const base::Version& version,
 +    bool success,
@@ -653,17 +716,21 @@ index 0000000000000..ced363ffbabc2
 +  base::FilePath binary_path = GetDownloadedBinaryPath(version);
 +  LOG(INFO) << "browseros: Testing binary: " << binary_path;
 +
++  VersionCheckRunner runner =
++      version_check_runner_for_testing_
++          ? version_check_runner_for_testing_
++          : base::BindRepeating(
++                [](const base::FilePath& path) -> std::pair<int, std::string> {
++                  int exit_code = 0;
++                  std::string output;
++                  RunBinaryVersionCheck(path, &exit_code, &output);
++                  return {exit_code, output};
++                });
++
 +  // Run version check on background thread
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(
-+          [](base::FilePath path) -> std::pair<int, std::string> {
-+            int exit_code = 0;
-+            std::string output;
-+            RunBinaryVersionCheck(path, &exit_code, &output);
-+            return {exit_code, output};
-+          },
-+          binary_path),
++      base::BindOnce(runner, binary_path),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self, base::Version version,
 +             std::pair<int, std::string> result) {
@@ -696,6 +763,10 @@ index 0000000000000..ced363ffbabc2
 +
 +  LOG(INFO) << "browseros: Binary test passed: " << output;
 +
++  if (update_staged_callback_for_testing_) {
++    std::move(update_staged_callback_for_testing_).Run(true);
++  }
++
 +  // Check if server is ready for hot-swap
 +  CheckServerStatus();
 +}
@@ -715,11 +786,8 @@ index 0000000000000..ced363ffbabc2
 +      std::move(request), GetStatusTrafficAnnotation());
 +  status_loader_->SetTimeoutDuration(kStatusCheckTimeout);
 +
-+  auto* url_loader_factory = g_browser_process->system_network_context_manager()
-+                                 ->GetURLLoaderFactory();
-+
 +  status_loader_->DownloadToString(
-+      url_loader_factory,
++      GetURLLoaderFactory(),
 +      base::BindOnce(&BrowserOSServerUpdater::OnStatusFetched,
 +                     weak_factory_.GetWeakPtr()),
 +      4096);
@@ -1034,6 +1102,15 @@ index 0000000000000..ced363ffbabc2
 +          versions_dir, kMaxVersionsToKeep));
 +}
 +
++network::mojom::URLLoaderFactory*
++BrowserOSServerUpdater::GetURLLoaderFactory() {
++  if (url_loader_factory_for_testing_) {
++    return url_loader_factory_for_testing_.get();
++  }
++  return g_browser_process->system_network_context_manager()
++      ->GetURLLoaderFactory();
++}
++
 +void BrowserOSServerUpdater::OnError(const std::string& stage,
 +                                     const std::string& error) {
 +  LOG(ERROR) << "browseros: Update error at " << stage << ": " << error;
@@ -1066,6 +1143,10 @@ index 0000000000000..ced363ffbabc2
 +
 +  CleanupPendingUpdate();
 +  ResetState();
++
++  if (update_staged_callback_for_testing_) {
++    std::move(update_staged_callback_for_testing_).Run(false);
++  }
 +}
 +
 +void BrowserOSServerUpdater::ResetState() {
@@ -1076,6 +1157,9 @@ index 0000000000000..ced363ffbabc2
 +  status_loader_.reset();
 +  pending_item_ = AppcastItem();
 +  pending_signature_.clear();
++  pending_is_delta_ = false;
++  pending_delta_from_ = base::Version();
++  pending_full_enclosure_ = AppcastEnclosure();
 +}
 +
 +}  // namespace browseros_server
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.h b/chrome/browser/browseros/server/browseros_server_updater.h
 new file mode 100644
-index 0000000000000..022b703a32e8d
+index 0000000000000..ce7c8036c688a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.h
-@@ -0,0 +1,164 @@
+@@ -0,0 +1,216 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,9 +13,12 @@ index 0000000000000..022b703a32e8d
 +
 +#include <memory>
 +#include <string>
++#include <utility>
 +
 +#include "base/files/file_path.h"
++#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/timer/timer.h"
 +#include "base/version.h"
@@ -23,8 +26,12 @@ index 0000000000000..022b703a32e8d
 +#include "chrome/browser/browseros/server/server_updater.h"
 +
 +namespace network {
++class SharedURLLoaderFactory;
 +class SimpleURLLoader;
++namespace mojom {
++class URLLoaderFactory;
 +}
++}  // namespace network
 +
 +namespace browseros {
 +class BrowserOSServerManager;
@@ -37,9 +44,11 @@ index 0000000000000..022b703a32e8d
 +// Update flow:
 +// 1. Fetch appcast XML from CDN
 +// 2. Parse and find matching platform enclosure
-+// 3. Download ZIP if newer version available
++// 3. Download ZIP if newer version available; when the appcast offers a delta
++//    from the latest downloaded version, download that instead
 +// 4. Verify Ed25519 signature
-+// 5. Extract to versions/{version}/
++// 5. Extract to versions/{version}/ (for a delta, rebuild it from the base
++//    version directory; any delta failure falls back to the full download)
 +// 6. Test binary with --version
 +// 7. Update current_version file
 +// 8. Signal manager to use new binary on next restart
@@ -62,6 +71,29 @@ index 0000000000000..022b703a32e8d
 +  // Forces an immediate update check (not part of interface).
 +  void CheckNow();
 +
++  // Test-only hooks. The factory serves every request instead of the system
++  // network context, and |public_key_base64| replaces kServerUpdatePublicKey.
++  void SetURLLoaderFactoryForTesting(
++      scoped_refptr<network::SharedURLLoaderFactory> factory);
++  void SetPublicKeyForTesting(const std::string& public_key_base64);
++  // Marks the version caches loaded with the given versions, as Start()
++  // would after running the bundled binary.
++  void SetCachedVersionsForTesting(const base::Version& bundled,
++                                   const base::Version& downloaded);
++  // Runs once the next update attempt either stages a verified version under
++  // versions/ that passes its --version check (true) or fails (false). The
++  // attempt then goes on to the status check and hot swap as usual.
++  void SetUpdateStagedCallbackForTesting(
++      base::OnceCallback<void(bool)> callback);
++
++  // Runs a binary's --version check, returning its exit code and output.
++  // Called on a thread that may block.
++  using VersionCheckRunner =
++      base::RepeatingCallback<std::pair<int, std::string>(
++          const base::FilePath& binary_path)>;
++  // Replaces running the staged binary itself.
++  void SetVersionCheckRunnerForTesting(VersionCheckRunner runner);
++
 + private:
 +  enum class State {
 +    kIdle,
@@ -93,6 +125,12 @@ index 0000000000000..022b703a32e8d
 +  void VerifyAndExtract(const base::FilePath& zip_path,
 +                        const std::string& signature,
 +                        const base::Version& version);
++  void VerifyAndApplyDelta(const base::FilePath& zip_path,
++                           const std::string& signature,
++                           const base::Version& version);
++  void OnDeltaApplied(const base::Version& version,
++                      bool success,
++                      const std::string& error);
 +  void OnVerifyAndExtractComplete(const base::Version& version,
 +                                  bool success,
 +                                  const std::string& error);
@@ -136,6 +174,8 @@ index 0000000000000..022b703a32e8d
 +  void CleanupPendingUpdate();
 +  void CleanupOldVersions();
 +
++  network::mojom::URLLoaderFactory* GetURLLoaderFactory();
++
 +  // Error handling
 +  void OnError(const std::string& stage, const std::string& error);
 +  void ResetState();
@@ -144,6 +184,12 @@ index 0000000000000..022b703a32e8d
 +
 +  base::RepeatingTimer update_check_timer_;
 +
++  std::string public_key_;
++  scoped_refptr<network::SharedURLLoaderFactory>
++      url_loader_factory_for_testing_;
++  base::OnceCallback<void(bool)> update_staged_callback_for_testing_;
++  VersionCheckRunner version_check_runner_for_testing_;
++
 +  State state_ = State::kIdle;
 +  bool update_in_progress_ = false;
 +
@@ -156,6 +202,12 @@ index 0000000000000..022b703a32e8d
 +  AppcastItem pending_item_;
 +  std::string pending_signature_;
 +
++  // Set while a delta package is being downloaded or applied. The full
++  // enclosure is kept so a failed delta can fall back to it.
++  bool pending_is_delta_ = false;
++  base::Version pending_delta_from_;
++  AppcastEnclosure pending_full_enclosure_;
++
 +  // Cached versions (loaded async at startup via --version)
 +  base::Version cached_bundled_version_;
 +  base::Version cached_downloaded_version_;
@@ -0,0 +1,350 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_updater_unittest.cc b/chrome/browser/browseros/server/browseros_server_updater_unittest.cc
+new file mode 100644
+index 0000000000000..b654fc57479f5
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_updater_unittest.cc
+@@ -0,0 +1,344 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_server_updater.h"
++
++#include <memory>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/base64.h"
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_writer.h"
++#include "base/memory/raw_ptr.h"
++#include "base/run_loop.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/test/bind.h"
++#include "base/test/scoped_command_line.h"
++#include "base/test/scoped_path_override.h"
++#include "base/test/task_environment.h"
++#include "base/values.h"
++#include "build/build_config.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
++#include "chrome/browser/browseros/server/test/mock_health_checker.h"
++#include "chrome/browser/browseros/server/test/mock_process_controller.h"
++#include "chrome/browser/browseros/server/test/mock_server_state_store.h"
++#include "chrome/common/chrome_paths.h"
++#include "crypto/sha2.h"
++#include "net/http/http_status_code.h"
++#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
++#include "services/network/test/test_url_loader_factory.h"
++#include "testing/gmock/include/gmock/gmock.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "third_party/boringssl/src/include/openssl/curve25519.h"
++#include "third_party/zlib/google/zip.h"
++
++namespace browseros_server {
++namespace {
++
++constexpr char kServerOrigin[] = "https://updates.browseros.test/";
++constexpr char kAppcastPath[] = "appcast.xml";
++constexpr char kFullPackagePath[] = "server-1.1.0.zip";
++constexpr char kDeltaPackagePath[] = "server-1.0.0-1.1.0.zip";
++// The running server's /status, asked before a staged version is swapped in.
++constexpr char kStatusPath[] = "status";
++
++constexpr char kOldBinary[] = "old server";
++constexpr char kNewBinary[] = "new server";
++constexpr char kConfig[] = "{}";
++
++#if BUILDFLAG(IS_MAC)
++constexpr char kOS[] = "macos";
++#elif BUILDFLAG(IS_WIN)
++constexpr char kOS[] = "windows";
++#else
++constexpr char kOS[] = "linux";
++#endif
++
++#if defined(ARCH_CPU_ARM64)
++constexpr char kArch[] = "arm64";
++#else
++constexpr char kArch[] = "x86_64";
++#endif
++
++std::string Sha256Hex(const std::string& data) {
++  return base::ToLowerASCII(base::HexEncode(crypto::SHA256HashString(data)));
++}
++
++// Runs an update from 1.0.0, already extracted under versions/, to 1.1.0
++// against a stand-in for the update server: a directory of files served by a
++// TestURLLoaderFactory, which also records what was requested. The running
++// server reports itself busy, so an update stops short of the hot swap.
++class BrowserOSServerUpdaterTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    user_data_override_ = std::make_unique<base::ScopedPathOverride>(
++        chrome::DIR_USER_DATA, temp_dir_.GetPath().AppendASCII("user_data"));
++    served_dir_ = temp_dir_.GetPath().AppendASCII("served");
++    ASSERT_TRUE(base::CreateDirectory(served_dir_));
++    ED25519_keypair(public_key_, private_key_);
++
++    scoped_command_line_.GetProcessCommandLine()->AppendSwitchASCII(
++        browseros::kServerAppcastUrl,
++        std::string(kServerOrigin) + kAppcastPath);
++
++    test_url_loader_factory_.SetInterceptor(
++        base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
++          std::string path = request.url.ExtractFileName();
++          requested_.push_back(path);
++          std::string contents;
++          if (base::ReadFileToString(served_dir_.AppendASCII(path),
++                                     &contents)) {
++            test_url_loader_factory_.AddResponse(request.url.spec(), contents);
++          } else {
++            test_url_loader_factory_.AddResponse(request.url.spec(), "",
++                                                 net::HTTP_NOT_FOUND);
++          }
++        }));
++
++    base::FilePath versions_dir = temp_dir_.GetPath()
++                                      .AppendASCII("user_data")
++                                      .AppendASCII(".browseros")
++                                      .AppendASCII("versions");
++    from_dir_ = versions_dir.AppendASCII("1.0.0");
++    dest_dir_ = versions_dir.AppendASCII("1.1.0");
++    WriteFile(from_dir_.AppendASCII("resources/bin/browseros_server"),
++              kOldBinary);
++    WriteFile(from_dir_.AppendASCII("resources/config.json"), kConfig);
++    WriteFile(served_dir_.AppendASCII(kStatusPath), "{\"can_update\": false}");
++
++    // Never destroyed, as in BrowserOSServerManagerTest.
++    auto process_controller =
++        std::make_unique<testing::NiceMock<browseros::MockProcessController>>();
++    auto state_store =
++        std::make_unique<testing::NiceMock<browseros::MockServerStateStore>>();
++    auto health_checker =
++        std::make_unique<testing::NiceMock<browseros::MockHealthChecker>>();
++    testing::Mock::AllowLeak(process_controller.get());
++    testing::Mock::AllowLeak(state_store.get());
++    testing::Mock::AllowLeak(health_checker.get());
++    manager_ = new browseros::BrowserOSServerManager(
++        std::move(process_controller), std::move(state_store),
++        std::move(health_checker), /*updater=*/nullptr,
++        /*local_state=*/nullptr);
++
++    updater_ = std::make_unique<BrowserOSServerUpdater>(manager_);
++    updater_->SetURLLoaderFactoryForTesting(
++        base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
++            &test_url_loader_factory_));
++    updater_->SetPublicKeyForTesting(base::Base64Encode(public_key_));
++    updater_->SetCachedVersionsForTesting(base::Version("0.9.0"),
++                                          base::Version("1.0.0"));
++    updater_->SetVersionCheckRunnerForTesting(base::BindLambdaForTesting(
++        [&](const base::FilePath& binary_path) -> std::pair<int, std::string> {
++          tested_binaries_.push_back(binary_path);
++          return {version_check_exit_code_, "1.1.0"};
++        }));
++  }
++
++  void TearDown() override {
++    updater_.reset();
++    task_environment_.RunUntilIdle();
++  }
++
++  void WriteFile(const base::FilePath& path, const std::string& contents) {
++    ASSERT_TRUE(base::CreateDirectory(path.DirName()));
++    ASSERT_TRUE(base::WriteFile(path, contents));
++  }
++
++  // Zips |dir| to |name| on the server and returns its signature.
++  std::string Publish(const base::FilePath& dir, const std::string& name) {
++    base::FilePath zip_path = served_dir_.AppendASCII(name);
++    EXPECT_TRUE(zip::Zip(dir, zip_path, /*include_hidden_files=*/false));
++    std::string contents;
++    EXPECT_TRUE(base::ReadFileToString(zip_path, &contents));
++    uint8_t signature[ED25519_SIGNATURE_LEN];
++    EXPECT_EQ(1, ED25519_sign(signature,
++                              reinterpret_cast<const uint8_t*>(contents.data()),
++                              contents.size(), private_key_));
++    return base::Base64Encode(signature);
++  }
++
++  std::string PublishFullPackage() {
++    base::FilePath dir = temp_dir_.GetPath().AppendASCII("full");
++    WriteFile(dir.AppendASCII("resources/bin/browseros_server"), kNewBinary);
++    WriteFile(dir.AppendASCII("resources/config.json"), kConfig);
++    return Publish(dir, kFullPackagePath);
++  }
++
++  // Publishes a delta that adds the new binary and copies the config from
++  // 1.0.0, expecting the config to hash to |config_hash_contents|.
++  std::string PublishDeltaPackage(
++      const std::string& config_hash_contents = kConfig) {
++    base::FilePath dir = temp_dir_.GetPath().AppendASCII("delta");
++    WriteFile(dir.AppendASCII("files/resources/bin/browseros_server"),
++              kNewBinary);
++
++    base::Value::List files;
++    files.Append(base::Value::Dict()
++                     .Set("path", "resources/bin/browseros_server")
++                     .Set("op", "add")
++                     .Set("sha256", Sha256Hex(kNewBinary)));
++    files.Append(base::Value::Dict()
++                     .Set("path", "resources/config.json")
++                     .Set("op", "copy")
++                     .Set("sha256", Sha256Hex(config_hash_contents)));
++    base::Value::Dict manifest;
++    manifest.Set("from", "1.0.0");
++    manifest.Set("to", "1.1.0");
++    manifest.Set("files", std::move(files));
++    WriteFile(dir.AppendASCII("manifest.json"), *base::WriteJson(manifest));
++    return Publish(dir, kDeltaPackagePath);
++  }
++
++  void PublishAppcast(const std::string& full_signature,
++                      const std::string& delta_signature) {
++    std::string platform = base::StrCat(
++        {"sparkle:os=\"", kOS, "\" sparkle:arch=\"", kArch, "\""});
++    std::string xml = base::StrCat(
++        {"<rss xmlns:sparkle=\"http://www.andymatuschak.org/xml-namespaces/"
++         "sparkle\"><channel><item>"
++         "<sparkle:version>1.1.0</sparkle:version>"
++         "<enclosure url=\"",
++         kServerOrigin, kFullPackagePath, "\" ", platform,
++         " sparkle:edSignature=\"", full_signature,
++         "\" type=\"application/zip\"/>"
++         "<sparkle:deltas><enclosure url=\"",
++         kServerOrigin, kDeltaPackagePath,
++         "\" sparkle:deltaFrom=\"1.0.0\" ", platform,
++         " sparkle:edSignature=\"", delta_signature,
++         "\" type=\"application/zip\"/></sparkle:deltas>"
++         "</item></channel></rss>"});
++    WriteFile(served_dir_.AppendASCII(kAppcastPath), xml);
++  }
++
++  // Runs one update check to its end and returns whether 1.1.0 was staged.
++  bool RunUpdate() {
++    base::RunLoop run_loop;
++    bool staged = false;
++    updater_->SetUpdateStagedCallbackForTesting(
++        base::BindLambdaForTesting([&](bool success) {
++          staged = success;
++          run_loop.Quit();
++        }));
++    updater_->CheckNow();
++    run_loop.Run();
++    task_environment_.RunUntilIdle();
++    return staged;
++  }
++
++  std::string ReadDest(const std::string& relative) {
++    std::string contents;
++    EXPECT_TRUE(
++        base::ReadFileToString(dest_dir_.AppendASCII(relative), &contents));
++    return contents;
++  }
++
++  base::test::TaskEnvironment task_environment_;
++  base::test::ScopedCommandLine scoped_command_line_;
++  base::ScopedTempDir temp_dir_;
++  std::unique_ptr<base::ScopedPathOverride> user_data_override_;
++  network::TestURLLoaderFactory test_url_loader_factory_;
++  base::FilePath served_dir_;
++  base::FilePath from_dir_;
++  base::FilePath dest_dir_;
++  uint8_t public_key_[ED25519_PUBLIC_KEY_LEN];
++  uint8_t private_key_[ED25519_PRIVATE_KEY_LEN];
++  std::vector<std::string> requested_;
++  // Written on the thread pool before the reply that reads them is posted.
++  std::vector<base::FilePath> tested_binaries_;
++  int version_check_exit_code_ = 0;
++  raw_ptr<browseros::BrowserOSServerManager> manager_ = nullptr;
++  std::unique_ptr<BrowserOSServerUpdater> updater_;
++};
++
++TEST_F(BrowserOSServerUpdaterTest, AppliesDeltaWithoutFullDownload) {
++  PublishAppcast(PublishFullPackage(), PublishDeltaPackage());
++
++  ASSERT_TRUE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath,
++                                      kStatusPath}),
++            requested_);
++  EXPECT_EQ(kNewBinary, ReadDest("resources/bin/browseros_server"));
++  EXPECT_EQ(kConfig, ReadDest("resources/config.json"));
++  ASSERT_EQ(1u, tested_binaries_.size());
++  EXPECT_TRUE(dest_dir_.IsParent(tested_binaries_[0]));
++  // The base version stays until a successful swap prunes old versions.
++  EXPECT_TRUE(base::PathExists(from_dir_));
++}
++
++TEST_F(BrowserOSServerUpdaterTest, FallsBackToFullPackageWhenDeltaFails) {
++  PublishAppcast(PublishFullPackage(),
++                 PublishDeltaPackage(/*config_hash_contents=*/"stale"));
++
++  ASSERT_TRUE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath,
++                                      kFullPackagePath, kStatusPath}),
++            requested_);
++  EXPECT_EQ(kNewBinary, ReadDest("resources/bin/browseros_server"));
++  EXPECT_EQ(kConfig, ReadDest("resources/config.json"));
++}
++
++TEST_F(BrowserOSServerUpdaterTest, FallsBackToFullPackageOnBadDeltaSignature) {
++  std::string full_signature = PublishFullPackage();
++  PublishDeltaPackage();
++  PublishAppcast(full_signature, /*delta_signature=*/full_signature);
++
++  ASSERT_TRUE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath,
++                                      kFullPackagePath, kStatusPath}),
++            requested_);
++  EXPECT_EQ(kNewBinary, ReadDest("resources/bin/browseros_server"));
++}
++
++TEST_F(BrowserOSServerUpdaterTest, FallsBackToFullPackageWhenDeltaIsMissing) {
++  std::string delta_signature = PublishDeltaPackage();
++  ASSERT_TRUE(base::DeleteFile(served_dir_.AppendASCII(kDeltaPackagePath)));
++  PublishAppcast(PublishFullPackage(), delta_signature);
++
++  ASSERT_TRUE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath,
++                                      kFullPackagePath, kStatusPath}),
++            requested_);
++  EXPECT_EQ(kNewBinary, ReadDest("resources/bin/browseros_server"));
++}
++
++TEST_F(BrowserOSServerUpdaterTest, FailsWhenFullPackageAlsoFails) {
++  PublishFullPackage();
++  PublishAppcast(/*full_signature=*/"", /*delta_signature=*/"");
++
++  EXPECT_FALSE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath,
++                                      kFullPackagePath}),
++            requested_);
++  EXPECT_FALSE(base::PathExists(dest_dir_));
++}
++
++TEST_F(BrowserOSServerUpdaterTest, DiscardsVersionThatFailsVersionCheck) {
++  PublishAppcast(PublishFullPackage(), PublishDeltaPackage());
++  version_check_exit_code_ = 1;
++
++  EXPECT_FALSE(RunUpdate());
++
++  EXPECT_EQ((std::vector<std::string>{kAppcastPath, kDeltaPackagePath}),
++            requested_);
++  EXPECT_EQ(1u, tested_binaries_.size());
++  EXPECT_FALSE(base::PathExists(dest_dir_));
++}
++
++}  // namespace
++}  // namespace browseros_server
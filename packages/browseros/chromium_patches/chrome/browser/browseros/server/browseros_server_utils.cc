@@ -1,19 +1,21 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.cc b/chrome/browser/browseros/server/browseros_server_utils.cc
 new file mode 100644
-index 0000000000000..9aca12ed05475
+index 0000000000000..0286ac1009513
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.cc
-@@ -0,0 +1,517 @@
+@@ -0,0 +1,712 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
++#include <algorithm>
 +#include <optional>
 +
 +#include "base/command_line.h"
 +#include "base/files/file_util.h"
++#include "base/hash/hash.h"
 +#include "base/json/json_reader.h"
 +#include "base/json/json_writer.h"
 +#include "base/logging.h"
@@ -21,10 +23,13 @@ index 0000000000000..9aca12ed05475
 +#include "base/process/process.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/string_split.h"
++#include "base/strings/string_util.h"
++#include "base/strings/stringprintf.h"
 +#include "base/threading/platform_thread.h"
 +#include "build/build_config.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "chrome/common/chrome_paths.h"
++#include "chrome/common/chrome_switches.h"
 +#include "components/version_info/version_info.h"
 +#include "net/base/ip_address.h"
 +#include "net/base/ip_endpoint.h"
@@ -41,6 +46,7 @@ index 0000000000000..9aca12ed05475
 +
 +#if BUILDFLAG(IS_MAC)
 +#include <libproc.h>
++#include <mach/mach_time.h>
 +#include <sys/proc_info.h>
 +#endif
 +
@@ -53,6 +59,8 @@ index 0000000000000..9aca12ed05475
 +#if BUILDFLAG(IS_WIN)
 +#include <windows.h>
 +
++#include <psapi.h>
++
 +#include "base/win/scoped_handle.h"
 +#endif
 +
@@ -67,6 +75,23 @@ index 0000000000000..9aca12ed05475
 +    FILE_PATH_LITERAL("server.state");
 +constexpr base::FilePath::CharType kLockFileName[] =
 +    FILE_PATH_LITERAL("server.lock");
++constexpr base::FilePath::CharType kRegistryFileName[] =
++    FILE_PATH_LITERAL("instances.json");
++
++constexpr size_t kMaxNamespaceLength = 64;
++
++constexpr char kNamespaceFromUserDataDir[] = "user-data-dir";
++constexpr char kNamespaceFromProfile[] = "profile";
++
++// server.lock -> server.<namespace>.lock for namespaced instances.
++base::FilePath GetNamespacedFileName(const base::FilePath::CharType* name) {
++  base::FilePath file(name);
++  std::string instance_namespace = GetInstanceNamespace();
++  if (instance_namespace.empty()) {
++    return file;
++  }
++  return file.InsertBeforeExtensionASCII("." + instance_namespace);
++}
 +
 +}  // namespace
 +
@@ -79,20 +104,33 @@ index 0000000000000..9aca12ed05475
 +                      bool allow_reuse) {
 +  LOG(INFO) << "browseros: Finding port starting from " << starting_port;
 +
-+  for (int i = 0; i < kMaxPortAttempts; i++) {
-+    int port_to_try = starting_port + i;
++  std::optional<int> port = FindAvailablePortInRange(
++      starting_port,
++      std::min(starting_port + kMaxPortAttempts - 1, kMaxPort), excluded,
++      allow_reuse);
++  if (port) {
++    return *port;
++  }
 +
-+    if (port_to_try > kMaxPort) {
-+      break;
-+    }
++  LOG(WARNING) << "browseros: Could not find available port after "
++               << kMaxPortAttempts << " attempts, using " << starting_port
++               << " anyway";
++  return starting_port;
++}
 +
++std::optional<int> FindAvailablePortInRange(int first_port,
++                                            int last_port,
++                                            const std::set<int>& excluded,
++                                            bool allow_reuse) {
++  for (int port_to_try = first_port;
++       port_to_try <= std::min(last_port, kMaxPort); port_to_try++) {
 +    if (excluded.count(port_to_try) > 0) {
 +      continue;
 +    }
 +
 +    if (IsPortAvailable(port_to_try, allow_reuse)) {
-+      if (port_to_try != starting_port) {
-+        LOG(INFO) << "browseros: Port " << starting_port
++      if (port_to_try != first_port) {
++        LOG(INFO) << "browseros: Port " << first_port
 +                  << " was in use or excluded, using " << port_to_try
 +                  << " instead";
 +      } else {
@@ -102,10 +140,7 @@ index 0000000000000..9aca12ed05475
 +    }
 +  }
 +
-+  LOG(WARNING) << "browseros: Could not find available port after "
-+               << kMaxPortAttempts << " attempts, using " << starting_port
-+               << " anyway";
-+  return starting_port;
++  return std::nullopt;
 +}
 +
 +bool IsPortAvailable(int port, bool allow_reuse) {
@@ -249,7 +284,7 @@ index 0000000000000..9aca12ed05475
 +  if (exec_dir.empty()) {
 +    return base::FilePath();
 +  }
-+  return exec_dir.Append(kLockFileName);
++  return exec_dir.Append(GetNamespacedFileName(kLockFileName));
 +}
 +
 +base::FilePath GetStateFilePath() {
@@ -257,7 +292,65 @@ index 0000000000000..9aca12ed05475
 +  if (exec_dir.empty()) {
 +    return base::FilePath();
 +  }
-+  return exec_dir.Append(kStateFileName);
++  return exec_dir.Append(GetNamespacedFileName(kStateFileName));
++}
++
++base::FilePath GetInstanceRegistryPath() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (command_line->HasSwitch(browseros::kInstanceRegistry)) {
++    return command_line->GetSwitchValuePath(browseros::kInstanceRegistry);
++  }
++
++  base::FilePath home_dir = base::GetHomeDir();
++  if (home_dir.empty()) {
++    return base::FilePath();
++  }
++  return home_dir.Append(FILE_PATH_LITERAL(".browseros"))
++      .Append(kRegistryFileName);
++}
++
++// =============================================================================
++// Instance Namespace
++// =============================================================================
++
++std::string GetInstanceNamespace() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (!command_line->HasSwitch(browseros::kInstanceNamespace)) {
++    return std::string();
++  }
++
++  std::string value =
++      command_line->GetSwitchValueASCII(browseros::kInstanceNamespace);
++
++  if (value == kNamespaceFromUserDataDir) {
++    base::FilePath user_data_dir;
++    if (!base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
++      LOG(ERROR) << "browseros: Failed to resolve DIR_USER_DATA for namespace";
++      return std::string();
++    }
++    return base::StringPrintf(
++        "udd-%08x", base::PersistentHash(user_data_dir.AsUTF8Unsafe()));
++  }
++
++  if (value == kNamespaceFromProfile) {
++    std::string profile_dir =
++        command_line->GetSwitchValueASCII(switches::kProfileDirectory);
++    return SanitizeInstanceNamespace(
++        "profile-" + (profile_dir.empty() ? std::string("Default")
++                                          : profile_dir));
++  }
++
++  return SanitizeInstanceNamespace(value);
++}
++
++std::string SanitizeInstanceNamespace(std::string_view name) {
++  std::string result;
++  result.reserve(std::min(name.size(), kMaxNamespaceLength));
++  for (char c : name.substr(0, kMaxNamespaceLength)) {
++    result.push_back(base::IsAsciiAlphaNumeric(c) || c == '_' || c == '-' ? c
++                                                                          : '-');
++  }
++  return result;
 +}
 +
 +// =============================================================================
@@ -520,4 +613,106 @@ index 0000000000000..9aca12ed05475
 +#endif
 +}
 +
++std::optional<ProcessResourceUsage> GetProcessResourceUsage(
++    base::ProcessId pid) {
++  ProcessResourceUsage usage;
++
++#if BUILDFLAG(IS_MAC)
++  struct proc_taskinfo info;
++  int size = proc_pidinfo(pid, PROC_PIDTASKINFO, 0, &info, sizeof(info));
++  if (size != sizeof(info)) {
++    return std::nullopt;
++  }
++  // pti_total_* are in Mach absolute time units, not nanoseconds on arm64
++  mach_timebase_info_data_t timebase;
++  if (mach_timebase_info(&timebase) != KERN_SUCCESS || timebase.denom == 0) {
++    return std::nullopt;
++  }
++  uint64_t cpu_ns = (info.pti_total_user + info.pti_total_system) *
++                    timebase.numer / timebase.denom;
++  usage.resident_bytes = static_cast<int64_t>(info.pti_resident_size);
++  usage.cpu_time = base::Nanoseconds(static_cast<int64_t>(cpu_ns));
++  return usage;
++
++#elif BUILDFLAG(IS_LINUX)
++  // utime/stime are fields 13/14 (0-indexed) of /proc/{pid}/stat, i.e.
++  // indices 11/12 after the (comm) field
++  std::string stat_path = "/proc/" + base::NumberToString(pid) + "/stat";
++  std::string contents;
++  if (!base::ReadFileToString(base::FilePath(stat_path), &contents)) {
++    return std::nullopt;
++  }
++  size_t comm_end = contents.rfind(')');
++  if (comm_end == std::string::npos || comm_end + 2 > contents.size()) {
++    return std::nullopt;
++  }
++  std::vector<std::string_view> fields =
++      base::SplitStringPiece(std::string_view(contents).substr(comm_end + 2),
++                             " ", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
++  int64_t utime = 0;
++  int64_t stime = 0;
++  if (fields.size() < 13 || !base::StringToInt64(fields[11], &utime) ||
++      !base::StringToInt64(fields[12], &stime)) {
++    return std::nullopt;
++  }
++
++  // Second field of /proc/{pid}/statm is resident pages
++  std::string statm_path = "/proc/" + base::NumberToString(pid) + "/statm";
++  std::string statm;
++  if (!base::ReadFileToString(base::FilePath(statm_path), &statm)) {
++    return std::nullopt;
++  }
++  std::vector<std::string_view> statm_fields = base::SplitStringPiece(
++      statm, " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
++  int64_t resident_pages = 0;
++  if (statm_fields.size() < 2 ||
++      !base::StringToInt64(statm_fields[1], &resident_pages)) {
++    return std::nullopt;
++  }
++
++  long ticks_per_sec = sysconf(_SC_CLK_TCK);
++  long page_size = sysconf(_SC_PAGESIZE);
++  if (ticks_per_sec <= 0 || page_size <= 0) {
++    return std::nullopt;
++  }
++
++  usage.resident_bytes = resident_pages * page_size;
++  usage.cpu_time =
++      base::Microseconds((utime + stime) * 1000000 / ticks_per_sec);
++  return usage;
++
++#elif BUILDFLAG(IS_WIN)
++  base::win::ScopedHandle handle(OpenProcess(
++      PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ, FALSE, pid));
++  if (!handle.IsValid()) {
++    return std::nullopt;
++  }
++
++  FILETIME creation, exit, kernel, user;
++  if (!GetProcessTimes(handle.Get(), &creation, &exit, &kernel, &user)) {
++    return std::nullopt;
++  }
++  PROCESS_MEMORY_COUNTERS counters = {};
++  if (!GetProcessMemoryInfo(handle.Get(), &counters, sizeof(counters))) {
++    return std::nullopt;
++  }
++
++  // FILETIME durations are 100-nanosecond intervals
++  ULARGE_INTEGER kernel_time;
++  kernel_time.LowPart = kernel.dwLowDateTime;
++  kernel_time.HighPart = kernel.dwHighDateTime;
++  ULARGE_INTEGER user_time;
++  user_time.LowPart = user.dwLowDateTime;
++  user_time.HighPart = user.dwHighDateTime;
++
++  usage.resident_bytes = static_cast<int64_t>(counters.WorkingSetSize);
++  usage.cpu_time = base::Microseconds(
++      static_cast<int64_t>((kernel_time.QuadPart + user_time.QuadPart) / 10));
++  return usage;
++
++#else
++  return std::nullopt;
++#endif
++}
++
 +}  // namespace browseros::server_utils
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.h b/chrome/browser/browseros/server/browseros_server_utils.h
 new file mode 100644
-index 0000000000000..6251f1274bcc6
+index 0000000000000..01d681493d222
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.h
-@@ -0,0 +1,89 @@
+@@ -0,0 +1,128 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,7 @@ index 0000000000000..6251f1274bcc6
 +#include <optional>
 +#include <set>
 +#include <string>
++#include <string_view>
 +
 +#include "base/files/file_path.h"
 +#include "base/process/process_handle.h"
@@ -33,6 +34,14 @@ index 0000000000000..6251f1274bcc6
 +                      const std::set<int>& excluded,
 +                      bool allow_reuse = false);
 +
++// Finds an available port in [first_port, last_port], skipping ports in the
++// excluded set. Unlike FindAvailablePort, returns nullopt instead of falling
++// back to a busy port when the range is exhausted.
++std::optional<int> FindAvailablePortInRange(int first_port,
++                                            int last_port,
++                                            const std::set<int>& excluded,
++                                            bool allow_reuse = false);
++
 +// Returns true if the specified port is available for binding.
 +// When |allow_reuse| is true, uses SO_REUSEADDR for the probe.
 +bool IsPortAvailable(int port, bool allow_reuse = false);
@@ -51,12 +60,32 @@ index 0000000000000..6251f1274bcc6
 +// Returns path to the bundled server resources directory.
 +base::FilePath GetBundledResourcesPath();
 +
-+// Returns path to the lock file (execution_dir/server.lock).
++// Returns path to the lock file (execution_dir/server.lock, or
++// execution_dir/server.<namespace>.lock for a namespaced instance).
 +base::FilePath GetLockFilePath();
 +
-+// Returns path to the state file (execution_dir/server.state).
++// Returns path to the state file (execution_dir/server.state, or
++// execution_dir/server.<namespace>.state for a namespaced instance).
 +base::FilePath GetStateFilePath();
 +
++// Returns path to the host-wide instance registry
++// (~/.browseros/instances.json unless overridden on the command line).
++base::FilePath GetInstanceRegistryPath();
++
++// =============================================================================
++// Instance Namespace
++// =============================================================================
++
++// Returns the instance namespace selected via --browseros-instance-namespace,
++// or an empty string for the default instance. "user-data-dir" derives a name
++// from a hash of the user data dir, "profile" uses the launch profile
++// directory; any other value is used as given after sanitizing.
++std::string GetInstanceNamespace();
++
++// Replaces characters outside [A-Za-z0-9_-] with '-' and truncates to 64
++// characters so the namespace is safe to embed in file names.
++std::string SanitizeInstanceNamespace(std::string_view name);
++
 +// =============================================================================
 +// State File (Orphan Recovery)
 +// =============================================================================
@@ -90,6 +119,16 @@ index 0000000000000..6251f1274bcc6
 +// then sends SIGKILL if still running.
 +bool KillProcess(base::ProcessId pid, base::TimeDelta graceful_timeout);
 +
++struct ProcessResourceUsage {
++  int64_t resident_bytes = 0;  // Resident set size
++  base::TimeDelta cpu_time;    // Cumulative user + system CPU time
++};
++
++// Samples memory and cumulative CPU time of a process.
++// Platform-specific implementation (macOS/Linux/Windows).
++std::optional<ProcessResourceUsage> GetProcessResourceUsage(
++    base::ProcessId pid);
++
 +}  // namespace browseros::server_utils
 +
 +#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UTILS_H_
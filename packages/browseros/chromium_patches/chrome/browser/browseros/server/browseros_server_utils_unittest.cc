@@ -1,20 +1,24 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils_unittest.cc b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
 new file mode 100644
-index 0000000000000..ad434d78b5e68
+index 0000000000000..50686513abd2a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
-@@ -0,0 +1,91 @@
+@@ -0,0 +1,154 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
++#include <optional>
 +#include <set>
++#include <string>
 +
 +#include "base/files/file_path.h"
 +#include "base/files/file_util.h"
 +#include "base/files/scoped_temp_dir.h"
++#include "base/test/scoped_command_line.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
 +#include "testing/gtest/include/gtest/gtest.h"
 +
 +namespace browseros::server_utils {
@@ -71,6 +75,23 @@ index 0000000000000..ad434d78b5e68
 +  EXPECT_GE(found, 10000);
 +}
 +
++TEST(ServerUtilsPortTest, FindAvailablePortInRange_StaysInRange) {
++  std::set<int> excluded = {20000, 20001};
++
++  std::optional<int> found = FindAvailablePortInRange(20000, 20009, excluded);
++
++  // Assuming some port of 20002-20009 is free.
++  ASSERT_TRUE(found);
++  EXPECT_GE(*found, 20002);
++  EXPECT_LE(*found, 20009);
++}
++
++TEST(ServerUtilsPortTest, FindAvailablePortInRange_NulloptWhenExhausted) {
++  std::set<int> excluded = {20000, 20001, 20002};
++
++  EXPECT_EQ(std::nullopt, FindAvailablePortInRange(20000, 20002, excluded));
++}
++
 +// =============================================================================
 +// Path Utility Tests
 +// =============================================================================
@@ -93,5 +114,47 @@ index 0000000000000..ad434d78b5e68
 +  }
 +}
 +
++// =============================================================================
++// Instance Namespace Tests
++// =============================================================================
++
++TEST(ServerUtilsNamespaceTest, DefaultInstanceHasNoNamespace) {
++  EXPECT_EQ("", GetInstanceNamespace());
++}
++
++TEST(ServerUtilsNamespaceTest, SanitizeInstanceNamespace) {
++  EXPECT_EQ("agent-07", SanitizeInstanceNamespace("agent-07"));
++  EXPECT_EQ("a-b-c_d", SanitizeInstanceNamespace("a/b c_d"));
++  EXPECT_EQ("---", SanitizeInstanceNamespace("../"));
++  EXPECT_EQ(64u, SanitizeInstanceNamespace(std::string(100, 'x')).size());
++}
++
++TEST(ServerUtilsNamespaceTest, NamespacedLockAndStateFiles) {
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitchASCII(
++      browseros::kInstanceNamespace, "worker 3");
++
++  EXPECT_EQ("worker-3", GetInstanceNamespace());
++
++  base::FilePath lock_path = GetLockFilePath();
++  if (!lock_path.empty()) {
++    EXPECT_EQ("server.worker-3.lock", lock_path.BaseName().AsUTF8Unsafe());
++  }
++  base::FilePath state_path = GetStateFilePath();
++  if (!state_path.empty()) {
++    EXPECT_EQ("server.worker-3.state", state_path.BaseName().AsUTF8Unsafe());
++  }
++}
++
++TEST(ServerUtilsNamespaceTest, RegistryPathOverride) {
++  base::test::ScopedCommandLine scoped_command_line;
++  scoped_command_line.GetProcessCommandLine()->AppendSwitchPath(
++      browseros::kInstanceRegistry,
++      base::FilePath(FILE_PATH_LITERAL("/tmp/registry.json")));
++
++  EXPECT_EQ(base::FilePath(FILE_PATH_LITERAL("/tmp/registry.json")),
++            GetInstanceRegistryPath());
++}
++
 +}  // namespace
 +}  // namespace browseros::server_utils
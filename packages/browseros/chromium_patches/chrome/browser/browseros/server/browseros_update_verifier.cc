@@ -0,0 +1,131 @@
+diff --git a/chrome/browser/browseros/server/browseros_update_verifier.cc b/chrome/browser/browseros/server/browseros_update_verifier.cc
+new file mode 100644
+index 0000000000000..4f8d8ccda3815
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_update_verifier.cc
+@@ -0,0 +1,125 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_update_verifier.h"
++
++#include <memory>
++
++#include "base/base64.h"
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/files/memory_mapped_file.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/browseros/server/browseros_server_constants.h"
++#include "third_party/boringssl/src/include/openssl/curve25519.h"
++#include "third_party/zlib/google/zip.h"
++#include "third_party/zlib/google/zip_reader.h"
++
++namespace browseros_server {
++
++bool VerifyEd25519Signature(base::span<const uint8_t> message,
++                            const std::string& signature_base64,
++                            const std::string& public_key_base64) {
++  // Decode public key
++  std::string public_key_bytes;
++  if (!base::Base64Decode(public_key_base64, &public_key_bytes)) {
++    LOG(ERROR) << "browseros: Failed to decode public key from base64";
++    return false;
++  }
++  if (public_key_bytes.size() != ED25519_PUBLIC_KEY_LEN) {
++    LOG(ERROR) << "browseros: Invalid public key length: "
++               << public_key_bytes.size() << " (expected "
++               << ED25519_PUBLIC_KEY_LEN << ")";
++    return false;
++  }
++
++  // Decode signature
++  std::string signature_bytes;
++  if (!base::Base64Decode(signature_base64, &signature_bytes)) {
++    LOG(ERROR) << "browseros: Failed to decode signature from base64";
++    return false;
++  }
++  if (signature_bytes.size() != ED25519_SIGNATURE_LEN) {
++    LOG(ERROR) << "browseros: Invalid signature length: "
++               << signature_bytes.size() << " (expected "
++               << ED25519_SIGNATURE_LEN << ")";
++    return false;
++  }
++
++  // Verify signature
++  const uint8_t* sig = reinterpret_cast<const uint8_t*>(signature_bytes.data());
++  const uint8_t* pub_key =
++      reinterpret_cast<const uint8_t*>(public_key_bytes.data());
++
++  int result = ED25519_verify(message.data(), message.size(), sig, pub_key);
++  if (result != 1) {
++    LOG(ERROR) << "browseros: Ed25519 signature verification failed";
++    return false;
++  }
++
++  LOG(INFO) << "browseros: Ed25519 signature verified successfully";
++  return true;
++}
++
++std::string VerifyAndExtractPackage(const base::FilePath& zip_path,
++                                    const std::string& signature_base64,
++                                    const std::string& public_key_base64,
++                                    const base::FilePath& dest_dir) {
++  base::File file(zip_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
++  if (!file.IsValid()) {
++    return "Failed to open update package: " +
++           base::File::ErrorToString(file.error_details());
++  }
++
++  int64_t length = file.GetLength();
++  if (length <= 0 || static_cast<uint64_t>(length) > kMaxUpdatePackageSize) {
++    return "Update package has invalid size: " + base::NumberToString(length);
++  }
++
++  {
++    // Ed25519 signs the whole message, so it must be contiguous; a mapping
++    // provides that without copying it onto the heap. Unmapped before
++    // extraction, which hits the same pages through the page cache.
++    base::MemoryMappedFile mapped;
++    if (!mapped.Initialize(file.Duplicate())) {
++      return "Failed to map update package";
++    }
++    if (!VerifyEd25519Signature(mapped.bytes(), signature_base64,
++                                public_key_base64)) {
++      return "Signature verification failed";
++    }
++  }
++
++  // Ensure destination directory exists
++  if (!base::CreateDirectory(dest_dir)) {
++    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
++  }
++
++  // Extract from the descriptor that was verified rather than reopening
++  // |zip_path|, so the package cannot be swapped in between.
++  if (!zip::Unzip(
++          file.GetPlatformFile(),
++          base::BindRepeating(
++              [](const base::FilePath& dir, const base::FilePath& entry)
++                  -> std::unique_ptr<zip::WriterDelegate> {
++                return std::make_unique<zip::FilePathWriterDelegate>(
++                    dir.Append(entry));
++              },
++              dest_dir),
++          base::BindRepeating(
++              [](const base::FilePath& dir, const base::FilePath& entry) {
++                return base::CreateDirectory(dir.Append(entry));
++              },
++              dest_dir),
++          zip::UnzipOptions())) {
++    return "Failed to extract ZIP file";
++  }
++
++  LOG(INFO) << "browseros: Extracted ZIP to " << dest_dir;
++  return "";  // Success
++}
++
++}  // namespace browseros_server
@@ -0,0 +1,43 @@
+diff --git a/chrome/browser/browseros/server/browseros_update_verifier.h b/chrome/browser/browseros/server/browseros_update_verifier.h
+new file mode 100644
+index 0000000000000..13d89eb5b51a1
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_update_verifier.h
+@@ -0,0 +1,37 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_UPDATE_VERIFIER_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_UPDATE_VERIFIER_H_
++
++#include <cstdint>
++#include <string>
++
++#include "base/containers/span.h"
++#include "base/files/file_path.h"
++
++namespace browseros_server {
++
++// Verifies an Ed25519 signature over |message|.
++// Keys and signatures are base64-encoded, as they appear in the appcast.
++bool VerifyEd25519Signature(base::span<const uint8_t> message,
++                            const std::string& signature_base64,
++                            const std::string& public_key_base64);
++
++// Verifies and extracts a downloaded update package in one step.
++// The package is opened once and memory-mapped for verification, so its
++// pages are file-backed and reclaimable instead of a heap copy of up to
++// kMaxUpdatePackageSize. Extraction then reads the same open file, so the
++// extracted bytes are exactly the verified ones. Nothing is written to
++// |dest_dir| unless the signature verifies.
++// Returns empty string on success, error message on failure.
++// Must be called from a thread that allows blocking.
++std::string VerifyAndExtractPackage(const base::FilePath& zip_path,
++                                    const std::string& signature_base64,
++                                    const std::string& public_key_base64,
++                                    const base::FilePath& dest_dir);
++
++}  // namespace browseros_server
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_UPDATE_VERIFIER_H_
@@ -0,0 +1,127 @@
+diff --git a/chrome/browser/browseros/server/browseros_update_verifier_unittest.cc b/chrome/browser/browseros/server/browseros_update_verifier_unittest.cc
+new file mode 100644
+index 0000000000000..a1006dea8ed34
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_update_verifier_unittest.cc
+@@ -0,0 +1,121 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_update_verifier.h"
++
++#include <string>
++
++#include "base/base64.h"
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "third_party/boringssl/src/include/openssl/curve25519.h"
++#include "third_party/zlib/google/zip.h"
++
++namespace browseros_server {
++namespace {
++
++class UpdateVerifierTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
++    ED25519_keypair(public_key_, private_key_);
++    public_key_base64_ = base::Base64Encode(public_key_);
++
++    // Build a package containing bin/browseros_server
++    base::FilePath src = temp_dir_.GetPath().AppendASCII("src");
++    ASSERT_TRUE(base::CreateDirectory(src.AppendASCII("bin")));
++    ASSERT_TRUE(base::WriteFile(
++        src.AppendASCII("bin").AppendASCII("browseros_server"), "binary"));
++    zip_path_ = temp_dir_.GetPath().AppendASCII("download.zip");
++    ASSERT_TRUE(zip::Zip(src, zip_path_, /*include_hidden_files=*/false));
++
++    dest_dir_ = temp_dir_.GetPath().AppendASCII("versions").AppendASCII("1.0.0");
++  }
++
++  std::string Sign(const base::FilePath& path) {
++    std::string contents;
++    EXPECT_TRUE(base::ReadFileToString(path, &contents));
++    uint8_t signature[ED25519_SIGNATURE_LEN];
++    EXPECT_EQ(1, ED25519_sign(signature,
++                              reinterpret_cast<const uint8_t*>(contents.data()),
++                              contents.size(), private_key_));
++    return base::Base64Encode(signature);
++  }
++
++  base::ScopedTempDir temp_dir_;
++  uint8_t public_key_[ED25519_PUBLIC_KEY_LEN];
++  uint8_t private_key_[ED25519_PRIVATE_KEY_LEN];
++  std::string public_key_base64_;
++  base::FilePath zip_path_;
++  base::FilePath dest_dir_;
++};
++
++// =============================================================================
++// Verify + Extract Tests
++// =============================================================================
++
++TEST_F(UpdateVerifierTest, ExtractsValidPackage) {
++  std::string signature = Sign(zip_path_);
++
++  EXPECT_EQ("", VerifyAndExtractPackage(zip_path_, signature,
++                                        public_key_base64_, dest_dir_));
++
++  std::string contents;
++  ASSERT_TRUE(base::ReadFileToString(
++      dest_dir_.AppendASCII("bin").AppendASCII("browseros_server"),
++      &contents));
++  EXPECT_EQ("binary", contents);
++}
++
++TEST_F(UpdateVerifierTest, RejectsTamperedPackage) {
++  std::string signature = Sign(zip_path_);
++  ASSERT_TRUE(base::AppendToFile(zip_path_, "x"));
++
++  EXPECT_NE("", VerifyAndExtractPackage(zip_path_, signature,
++                                        public_key_base64_, dest_dir_));
++  EXPECT_FALSE(base::PathExists(dest_dir_));
++}
++
++TEST_F(UpdateVerifierTest, RejectsWrongKey) {
++  std::string signature = Sign(zip_path_);
++  uint8_t other_public[ED25519_PUBLIC_KEY_LEN];
++  uint8_t other_private[ED25519_PRIVATE_KEY_LEN];
++  ED25519_keypair(other_public, other_private);
++
++  EXPECT_NE("", VerifyAndExtractPackage(zip_path_, signature,
++                                        base::Base64Encode(other_public),
++                                        dest_dir_));
++  EXPECT_FALSE(base::PathExists(dest_dir_));
++}
++
++TEST_F(UpdateVerifierTest, RejectsEmptyPackage) {
++  base::FilePath empty = temp_dir_.GetPath().AppendASCII("empty.zip");
++  ASSERT_TRUE(base::WriteFile(empty, ""));
++
++  EXPECT_NE("", VerifyAndExtractPackage(empty, Sign(empty),
++                                        public_key_base64_, dest_dir_));
++}
++
++TEST_F(UpdateVerifierTest, RejectsMissingPackage) {
++  EXPECT_NE("", VerifyAndExtractPackage(
++                    temp_dir_.GetPath().AppendASCII("missing.zip"), "sig",
++                    public_key_base64_, dest_dir_));
++}
++
++// =============================================================================
++// Signature Decoding Tests
++// =============================================================================
++
++TEST_F(UpdateVerifierTest, RejectsMalformedSignature) {
++  const uint8_t kMessage[] = {1, 2, 3};
++  EXPECT_FALSE(
++      VerifyEd25519Signature(kMessage, "not base64!", public_key_base64_));
++  EXPECT_FALSE(VerifyEd25519Signature(kMessage, base::Base64Encode("short"),
++                                      public_key_base64_));
++}
++
++}  // namespace
++}  // namespace browseros_server
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker.h b/chrome/browser/browseros/server/health_checker.h
 new file mode 100644
-index 0000000000000..1cefa3ec91f42
+index 0000000000000..5ede6ab9a54d3
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker.h
-@@ -0,0 +1,33 @@
+@@ -0,0 +1,47 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..1cefa3ec91f42
 +#define CHROME_BROWSER_BROWSEROS_SERVER_HEALTH_CHECKER_H_
 +
 +#include "base/functional/callback.h"
++#include "base/time/time.h"
 +
 +namespace browseros {
 +
@@ -32,6 +33,19 @@ index 0000000000000..1cefa3ec91f42
 +  virtual void RequestShutdown(
 +      int port,
 +      base::OnceCallback<void(bool success)> callback) = 0;
++
++  // Start a persistent heartbeat against /health on |port|, probing every
++  // |interval| and reporting each beat to |on_result| on the calling
++  // sequence. A beat that does not answer within |deadline| reports false.
++  // Replaces any heartbeat already running.
++  virtual void StartHeartbeat(
++      int port,
++      base::TimeDelta interval,
++      base::TimeDelta deadline,
++      base::RepeatingCallback<void(bool success)> on_result) = 0;
++
++  // Stop the heartbeat started by StartHeartbeat(). No-op if none is running.
++  virtual void StopHeartbeat() = 0;
 +};
 +
 +}  // namespace browseros
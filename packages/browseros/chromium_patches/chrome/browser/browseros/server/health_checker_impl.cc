@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker_impl.cc b/chrome/browser/browseros/server/health_checker_impl.cc
 new file mode 100644
-index 0000000000000..73ef5eaf9e8e3
+index 0000000000000..c7aae66f2c79f
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker_impl.cc
-@@ -0,0 +1,145 @@
+@@ -0,0 +1,166 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,8 +13,12 @@ index 0000000000000..73ef5eaf9e8e3
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/task/bind_post_task.h"
 +#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/server/server_heartbeat.h"
 +#include "chrome/browser/net/system_network_context_manager.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
 +#include "net/base/net_errors.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
@@ -47,7 +51,9 @@ index 0000000000000..73ef5eaf9e8e3
 +          description:
 +            "Checks if the BrowserOS MCP server is healthy by querying its "
 +            "/health endpoint."
-+          trigger: "Periodic health check every 30 seconds while server is running."
++          trigger:
++            "Periodic health check every 30 seconds while server is "
++            "running, used when the persistent heartbeat is disabled."
 +          data: "No user data sent, just an HTTP GET request."
 +          destination: LOCAL
 +        }
@@ -128,6 +134,21 @@ index 0000000000000..73ef5eaf9e8e3
 +                     base::Unretained(this), std::move(callback)));
 +}
 +
++void HealthCheckerImpl::StartHeartbeat(
++    int port,
++    base::TimeDelta interval,
++    base::TimeDelta deadline,
++    base::RepeatingCallback<void(bool success)> on_result) {
++  // Socket I/O must happen on the IO thread; results hop back here.
++  heartbeat_ = base::SequenceBound<ServerHeartbeat>(
++      content::GetIOThreadTaskRunner({}), port, interval, deadline,
++      base::BindPostTaskToCurrentDefault(std::move(on_result)));
++}
++
++void HealthCheckerImpl::StopHeartbeat() {
++  heartbeat_.Reset();
++}
++
 +void HealthCheckerImpl::OnRequestComplete(
 +    base::OnceCallback<void(bool success)> callback,
 +    scoped_refptr<net::HttpResponseHeaders> headers) {
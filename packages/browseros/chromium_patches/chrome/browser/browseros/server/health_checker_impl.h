@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker_impl.h b/chrome/browser/browseros/server/health_checker_impl.h
 new file mode 100644
-index 0000000000000..7b1d0c8678540
+index 0000000000000..286e788fa0a67
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker_impl.h
-@@ -0,0 +1,49 @@
+@@ -0,0 +1,60 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,7 @@ index 0000000000000..7b1d0c8678540
 +#include <memory>
 +
 +#include "base/memory/scoped_refptr.h"
++#include "base/threading/sequence_bound.h"
 +#include "chrome/browser/browseros/server/health_checker.h"
 +
 +namespace net {
@@ -26,8 +27,11 @@ index 0000000000000..7b1d0c8678540
 +
 +namespace browseros {
 +
++class ServerHeartbeat;
++
 +// Production implementation of HealthChecker.
-+// Uses network::SimpleURLLoader to make HTTP requests.
++// Uses network::SimpleURLLoader for one-shot requests and a ServerHeartbeat
++// on the IO thread for the persistent heartbeat.
 +class HealthCheckerImpl : public HealthChecker {
 + public:
 +  HealthCheckerImpl();
@@ -41,6 +45,12 @@ index 0000000000000..7b1d0c8678540
 +                   base::OnceCallback<void(bool success)> callback) override;
 +  void RequestShutdown(int port,
 +                       base::OnceCallback<void(bool success)> callback) override;
++  void StartHeartbeat(
++      int port,
++      base::TimeDelta interval,
++      base::TimeDelta deadline,
++      base::RepeatingCallback<void(bool success)> on_result) override;
++  void StopHeartbeat() override;
 +
 + private:
 +  void OnRequestComplete(
@@ -48,6 +58,7 @@ index 0000000000000..7b1d0c8678540
 +      scoped_refptr<net::HttpResponseHeaders> headers);
 +
 +  std::unique_ptr<network::SimpleURLLoader> url_loader_;
++  base::SequenceBound<ServerHeartbeat> heartbeat_;
 +};
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/process_controller.h b/chrome/browser/browseros/server/process_controller.h
 new file mode 100644
-index 0000000000000..08c04e406dac8
+index 0000000000000..31af7c2baa74d
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller.h
-@@ -0,0 +1,60 @@
+@@ -0,0 +1,79 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,15 +11,19 @@ index 0000000000000..08c04e406dac8
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_CONTROLLER_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_CONTROLLER_H_
 +
++#include <memory>
 +#include <optional>
 +
 +#include "base/functional/callback.h"
 +#include "base/process/process.h"
 +#include "base/time/time.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
 +namespace browseros {
 +
++class ProcessExitWatcher;
++
 +struct LaunchResult {
 +  base::Process process;
 +  bool used_fallback = false;
@@ -33,7 +37,8 @@ index 0000000000000..08c04e406dac8
 +
 +  // Launch server process with the given configuration.
 +  // Returns LaunchResult with the process handle (invalid if launch failed)
-+  // and whether the fallback binary was used.
++  // and whether the fallback binary was used. config.limits are applied
++  // where supported; failing to apply them does not fail the launch.
 +  virtual LaunchResult Launch(const ServerLaunchConfig& config) = 0;
 +
 +  // Terminate a running process with SIGKILL.
@@ -59,6 +64,20 @@ index 0000000000000..08c04e406dac8
 +  // First sends SIGTERM, waits for graceful_timeout, then SIGKILL if needed.
 +  // Returns true if process was successfully killed (or already gone).
 +  virtual bool Kill(base::ProcessId pid, base::TimeDelta graceful_timeout) = 0;
++
++  // Start watching |process| and run |on_exit| on the calling sequence once
++  // it exits. Destroying the returned watcher cancels the notification.
++  // Returns nullptr if exit notification is unavailable; callers then fall
++  // back to polling WaitForExitWithTimeout().
++  virtual std::unique_ptr<ProcessExitWatcher> WatchForExit(
++      const base::Process& process,
++      base::OnceClosure on_exit) = 0;
++
++  // Sample resident memory and cumulative CPU time of a process.
++  // Returns nullopt if the process is gone or cannot be inspected.
++  // Must be called from a thread that allows blocking.
++  virtual std::optional<server_utils::ProcessResourceUsage> GetResourceUsage(
++      base::ProcessId pid) = 0;
 +};
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/process_controller_impl.cc b/chrome/browser/browseros/server/process_controller_impl.cc
 new file mode 100644
-index 0000000000000..a398856f672fd
+index 0000000000000..b991f9550b203
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller_impl.cc
-@@ -0,0 +1,210 @@
+@@ -0,0 +1,503 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,6 +13,7 @@ index 0000000000000..a398856f672fd
 +#include <optional>
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
 +
 +#include "base/files/file_util.h"
 +#include "base/json/json_writer.h"
@@ -25,6 +26,24 @@ index 0000000000000..a398856f672fd
 +#include <signal.h>
 +#endif
 +
++#if BUILDFLAG(IS_LINUX)
++#include <errno.h>
++#include <fcntl.h>
++#include <sys/stat.h>
++#include <unistd.h>
++
++#include <string_view>
++
++#include "base/containers/contains.h"
++#include "base/files/file_enumerator.h"
++#include "base/functional/bind.h"
++#include "base/posix/eintr_wrapper.h"
++#include "base/strings/string_split.h"
++#include "base/strings/string_util.h"
++#include "base/strings/stringprintf.h"
++#include "base/task/thread_pool.h"
++#endif
++
 +namespace browseros {
 +
 +namespace {
@@ -32,6 +51,11 @@ index 0000000000000..a398856f672fd
 +constexpr base::FilePath::CharType kConfigFileName[] =
 +    FILE_PATH_LITERAL("server_config.json");
 +
++#if BUILDFLAG(IS_POSIX)
++// Where the server finds an inherited CDP connection.
++constexpr int kServerCDPFd = 3;
++#endif
++
 +// Writes the server configuration to a JSON file.
 +// Returns the path to the config file on success, empty path on failure.
 +// Note: resources_dir is passed separately because it may differ from
@@ -49,6 +73,20 @@ index 0000000000000..a398856f672fd
 +  ports_dict.Set("extension", config.ports.extension);
 +  root.Set("ports", std::move(ports_dict));
 +
++  // cdp transports besides the port
++  base::Value::Dict cdp_dict;
++  if (!config.cdp_socket_path.empty()) {
++    cdp_dict.Set("socket", config.cdp_socket_path.AsUTF8Unsafe());
++  }
++#if BUILDFLAG(IS_POSIX)
++  if (config.cdp_pipe_fd >= 0) {
++    cdp_dict.Set("fd", kServerCDPFd);
++  }
++#endif
++  if (!cdp_dict.empty()) {
++    root.Set("cdp", std::move(cdp_dict));
++  }
++
 +  // directories
 +  base::Value::Dict directories;
 +  directories.Set("resources", actual_resources_dir.AsUTF8Unsafe());
@@ -82,11 +120,200 @@ index 0000000000000..a398856f672fd
 +  return config_path;
 +}
 +
++#if BUILDFLAG(IS_LINUX)
++
++constexpr char kCgroupMountPoint[] = "/sys/fs/cgroup";
++constexpr int64_t kCpuPeriodMicroseconds = 100000;
++
++// Returns the cgroup v2 directory the browser runs in, or an empty path if
++// the unified hierarchy is not mounted.
++base::FilePath GetOwnCgroupDir() {
++  base::FilePath root(kCgroupMountPoint);
++  if (!base::PathExists(root.AppendASCII("cgroup.controllers"))) {
++    return base::FilePath();
++  }
++
++  std::string contents;
++  if (!base::ReadFileToString(base::FilePath("/proc/self/cgroup"),
++                              &contents)) {
++    return base::FilePath();
++  }
++
++  // The v2 entry is "0::/path/to/cgroup"
++  for (std::string_view line : base::SplitStringPiece(
++           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++    if (!base::StartsWith(line, "0::")) {
++      continue;
++    }
++    std::string_view relative =
++        base::TrimString(line.substr(3), "/", base::TRIM_LEADING);
++    return relative.empty() ? root : root.Append(relative);
++  }
++  return base::FilePath();
++}
++
++constexpr char kServerCgroupPrefix[] = "browseros-server-";
++
++// Whether |dir| was delegated to us: systemd hands a delegated cgroup to the
++// user it runs for, so it and its control files are owned by that user. We
++// only create cgroups and enable controllers in such a subtree.
++bool IsDelegatedCgroup(const base::FilePath& dir) {
++  struct stat info;
++  return stat(dir.value().c_str(), &info) == 0 && info.st_uid == geteuid() &&
++         access(dir.AppendASCII("cgroup.subtree_control").value().c_str(),
++                W_OK) == 0;
++}
++
++// Whether |controller| is already enabled for the children of |dir|.
++bool HasSubtreeController(const base::FilePath& dir,
++                          std::string_view controller) {
++  std::string enabled;
++  if (!base::ReadFileToString(dir.AppendASCII("cgroup.subtree_control"),
++                              &enabled)) {
++    return false;
++  }
++  return base::Contains(base::SplitStringPiece(enabled, " \n",
++                                               base::TRIM_WHITESPACE,
++                                               base::SPLIT_WANT_NONEMPTY),
++                        controller);
++}
++
++// Removes the server cgroups of browsers that are gone, which happens when
++// the server outlived a crashed browser. rmdir() fails harmlessly on a
++// cgroup that still holds processes.
++void RemoveStaleServerCgroups(const base::FilePath& parent) {
++  base::FileEnumerator enumerator(parent, /*recursive=*/false,
++                                  base::FileEnumerator::DIRECTORIES,
++                                  std::string(kServerCgroupPrefix) + "*");
++  for (base::FilePath dir = enumerator.Next(); !dir.empty();
++       dir = enumerator.Next()) {
++    int pid = 0;
++    if (!base::StringToInt(
++            std::string_view(dir.BaseName().value())
++                .substr(std::size(kServerCgroupPrefix) - 1),
++            &pid) ||
++        server_utils::ProcessExists(pid)) {
++      continue;
++    }
++    if (rmdir(dir.value().c_str()) == 0) {
++      LOG(INFO) << "browseros: Removed stale server cgroup " << dir;
++    }
++  }
++}
++
++// Creates this browser's server cgroup and writes |limits| into it.
++// A cgroup that holds processes cannot hand controllers to children, so the
++// server's cgroup is a sibling of the browser's, named after the browser's
++// pid so that several browsers never share one. That needs the parent of the
++// browser's cgroup to be delegated to us; otherwise no limits are applied.
++// Returns an empty path if any step fails.
++base::FilePath PrepareServerCgroup(const ServerResourceLimits& limits) {
++  base::FilePath own = GetOwnCgroupDir();
++  if (own.empty() || own == own.DirName()) {
++    LOG(WARNING) << "browseros: cgroup v2 unavailable, resource limits "
++                    "not applied";
++    return base::FilePath();
++  }
++
++  base::FilePath parent = own.DirName();
++  if (!IsDelegatedCgroup(parent)) {
++    LOG(WARNING) << "browseros: cgroup " << parent << " is not delegated to "
++                 << "this user, resource limits not applied";
++    return base::FilePath();
++  }
++  RemoveStaleServerCgroups(parent);
++
++  if (!HasSubtreeController(parent, "memory") ||
++      !HasSubtreeController(parent, "cpu")) {
++    if (!base::WriteFile(parent.AppendASCII("cgroup.subtree_control"),
++                         "+memory +cpu")) {
++      PLOG(WARNING) << "browseros: Failed to enable memory and cpu "
++                    << "controllers in " << parent;
++      return base::FilePath();
++    }
++  }
++
++  base::FilePath cgroup = parent.AppendASCII(
++      kServerCgroupPrefix +
++      base::NumberToString(base::Process::Current().Pid()));
++  if (!base::CreateDirectory(cgroup)) {
++    PLOG(WARNING) << "browseros: Failed to create cgroup " << cgroup;
++    return base::FilePath();
++  }
++
++  std::string memory_max =
++      limits.memory_max_bytes > 0
++          ? base::NumberToString(limits.memory_max_bytes)
++          : "max";
++  std::string cpu_max =
++      limits.cpu_max_percent > 0
++          ? base::StringPrintf(
++                "%lld %lld",
++                static_cast<long long>(limits.cpu_max_percent *
++                                       kCpuPeriodMicroseconds / 100),
++                static_cast<long long>(kCpuPeriodMicroseconds))
++          : base::StringPrintf("max %lld",
++                               static_cast<long long>(kCpuPeriodMicroseconds));
++
++  if (!base::WriteFile(cgroup.AppendASCII("memory.max"), memory_max) ||
++      !base::WriteFile(cgroup.AppendASCII("cpu.max"), cpu_max)) {
++    PLOG(WARNING) << "browseros: Failed to write limits to cgroup " << cgroup;
++    rmdir(cgroup.value().c_str());
++    return base::FilePath();
++  }
++  return cgroup;
++}
++
++// Removes the server cgroup once the server has exited. A plain rmdir() is
++// all cgroupfs needs, and it fails with EBUSY while a process is left (a
++// server child that outlived it); RemoveStaleServerCgroups() catches those.
++void RemoveServerCgroup(const base::FilePath& cgroup) {
++  if (cgroup.empty()) {
++    return;
++  }
++  if (rmdir(cgroup.value().c_str()) == 0) {
++    VLOG(1) << "browseros: Removed server cgroup " << cgroup;
++  } else if (errno != ENOENT) {
++    VPLOG(1) << "browseros: Server cgroup " << cgroup << " not removed";
++  }
++}
++
++// Moves the forked child into the server cgroup before exec, so the limits
++// hold from the first allocation.
++class CgroupAttachDelegate : public base::LaunchOptions::PreExecDelegate {
++ public:
++  explicit CgroupAttachDelegate(const base::FilePath& cgroup)
++      : procs_path_(cgroup.AppendASCII("cgroup.procs").value()) {}
++
++  CgroupAttachDelegate(const CgroupAttachDelegate&) = delete;
++  CgroupAttachDelegate& operator=(const CgroupAttachDelegate&) = delete;
++
++  // Runs between fork and exec: async-signal-safe calls only.
++  void RunAsyncSafe() override {
++    int fd = HANDLE_EINTR(open(procs_path_.c_str(), O_WRONLY | O_CLOEXEC));
++    if (fd < 0) {
++      return;
++    }
++    // Writing "0" moves the writing process itself.
++    [[maybe_unused]] ssize_t written = HANDLE_EINTR(write(fd, "0", 1));
++    IGNORE_EINTR(close(fd));
++  }
++
++ private:
++  const std::string procs_path_;
++};
++
++#endif  // BUILDFLAG(IS_LINUX)
++
 +}  // namespace
 +
 +ProcessControllerImpl::ProcessControllerImpl() = default;
 +
-+ProcessControllerImpl::~ProcessControllerImpl() = default;
++ProcessControllerImpl::~ProcessControllerImpl() {
++#if BUILDFLAG(IS_LINUX)
++  RemoveServerCgroup(server_cgroup_);
++#endif
++}
 +
 +LaunchResult ProcessControllerImpl::Launch(const ServerLaunchConfig& config) {
 +  LaunchResult result;
@@ -135,12 +362,45 @@ index 0000000000000..a398856f672fd
 +  cmd.AppendSwitchASCII("extension-port",
 +                        base::NumberToString(config.ports.extension));
 +
++  if (!config.cdp_socket_path.empty()) {
++    cmd.AppendSwitchPath("cdp-socket", config.cdp_socket_path);
++  }
++
 +  // Set up launch options
 +  base::LaunchOptions options;
 +#if BUILDFLAG(IS_WIN)
 +  options.start_hidden = true;
 +#endif
 +
++#if BUILDFLAG(IS_POSIX)
++  if (config.cdp_pipe_fd >= 0) {
++    options.fds_to_remap.emplace_back(config.cdp_pipe_fd, kServerCDPFd);
++    cmd.AppendSwitchASCII("cdp-fd", base::NumberToString(kServerCDPFd));
++  }
++#endif
++
++#if BUILDFLAG(IS_LINUX)
++  std::unique_ptr<CgroupAttachDelegate> cgroup_delegate;
++  // A previous server that was not seen exiting (graceful shutdown is not
++  // waited for) may have left its cgroup behind.
++  RemoveServerCgroup(server_cgroup_);
++  server_cgroup_.clear();
++  if (!config.limits.IsEmpty()) {
++    server_cgroup_ = PrepareServerCgroup(config.limits);
++    if (!server_cgroup_.empty()) {
++      LOG(INFO) << "browseros: Launching server in cgroup " << server_cgroup_
++                << " " << config.limits.DebugString();
++      cgroup_delegate = std::make_unique<CgroupAttachDelegate>(server_cgroup_);
++      options.pre_exec_delegate = cgroup_delegate.get();
++    }
++  }
++#else
++  if (!config.limits.IsEmpty()) {
++    LOG(WARNING) << "browseros: Server resource limits are only enforced on "
++                    "Linux";
++  }
++#endif
++
 +  // Launch the process (blocking I/O)
 +  result.process = base::LaunchProcess(cmd, options);
 +  return result;
@@ -163,6 +423,9 @@ index 0000000000000..a398856f672fd
 +    int exit_code = 0;
 +    if (process->WaitForExit(&exit_code)) {
 +      LOG(INFO) << "browseros: Process killed successfully";
++#if BUILDFLAG(IS_LINUX)
++      RemoveServerCgroup(server_cgroup_);
++#endif
 +    } else {
 +      LOG(WARNING) << "browseros: WaitForExit failed";
 +    }
@@ -193,6 +456,9 @@ index 0000000000000..a398856f672fd
 +  bool exited = process->WaitForExitWithTimeout(timeout, exit_code);
 +  if (exited) {
 +    LOG(INFO) << "browseros: Process exited with code " << *exit_code;
++#if BUILDFLAG(IS_LINUX)
++    RemoveServerCgroup(server_cgroup_);
++#endif
 +  } else {
 +    LOG(INFO) << "browseros: Process did not exit within timeout";
 +  }
@@ -213,4 +479,31 @@ index 0000000000000..a398856f672fd
 +  return server_utils::KillProcess(pid, graceful_timeout);
 +}
 +
++std::unique_ptr<ProcessExitWatcher> ProcessControllerImpl::WatchForExit(
++    const base::Process& process,
++    base::OnceClosure on_exit) {
++#if BUILDFLAG(IS_LINUX)
++  if (!server_cgroup_.empty()) {
++    // The exit notification arrives on the UI thread; rmdir on cgroupfs
++    // blocks. At the launch's priority, it runs ahead of the relaunch the
++    // notification leads to, which recreates the same cgroup.
++    on_exit = base::BindOnce(
++        [](base::FilePath cgroup, base::OnceClosure on_exit) {
++          base::ThreadPool::PostTask(
++              FROM_HERE,
++              {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++              base::BindOnce(&RemoveServerCgroup, cgroup));
++          std::move(on_exit).Run();
++        },
++        server_cgroup_, std::move(on_exit));
++  }
++#endif
++  return ProcessExitWatcher::Create(process, std::move(on_exit));
++}
++
++std::optional<server_utils::ProcessResourceUsage>
++ProcessControllerImpl::GetResourceUsage(base::ProcessId pid) {
++  return server_utils::GetProcessResourceUsage(pid);
++}
++
 +}  // namespace browseros
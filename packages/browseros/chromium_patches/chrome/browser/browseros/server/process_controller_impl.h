@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/process_controller_impl.h b/chrome/browser/browseros/server/process_controller_impl.h
 new file mode 100644
-index 0000000000000..46f7d9359dcd7
+index 0000000000000..8b8189b901888
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller_impl.h
-@@ -0,0 +1,35 @@
+@@ -0,0 +1,49 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,8 @@ index 0000000000000..46f7d9359dcd7
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_CONTROLLER_IMPL_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_CONTROLLER_IMPL_H_
 +
++#include "base/files/file_path.h"
++#include "build/build_config.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
 +
 +namespace browseros {
@@ -34,6 +36,18 @@ index 0000000000000..46f7d9359dcd7
 +  bool Exists(base::ProcessId pid) override;
 +  std::optional<int64_t> GetCreationTime(base::ProcessId pid) override;
 +  bool Kill(base::ProcessId pid, base::TimeDelta graceful_timeout) override;
++  std::unique_ptr<ProcessExitWatcher> WatchForExit(
++      const base::Process& process,
++      base::OnceClosure on_exit) override;
++  std::optional<server_utils::ProcessResourceUsage> GetResourceUsage(
++      base::ProcessId pid) override;
++
++ private:
++#if BUILDFLAG(IS_LINUX)
++  // The cgroup the last launched server runs in, if limits were applied.
++  // Removed once that server is seen exiting, and by the next Launch().
++  base::FilePath server_cgroup_;
++#endif
 +};
 +
 +}  // namespace browseros
@@ -0,0 +1,171 @@
+diff --git a/chrome/browser/browseros/server/process_exit_watcher.cc b/chrome/browser/browseros/server/process_exit_watcher.cc
+new file mode 100644
+index 0000000000000..f7ae45e0fa355
+--- /dev/null
++++ b/chrome/browser/browseros/server/process_exit_watcher.cc
+@@ -0,0 +1,165 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/bind_post_task.h"
++#include "build/build_config.h"
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_MAC)
++#include "base/files/file_descriptor_watcher_posix.h"
++#include "base/files/scoped_file.h"
++#include "base/task/thread_pool.h"
++#include "base/threading/sequence_bound.h"
++#endif
++
++#if BUILDFLAG(IS_LINUX)
++#include <sys/syscall.h>
++#include <unistd.h>
++#endif
++
++#if BUILDFLAG(IS_MAC)
++#include <sys/event.h>
++#endif
++
++#if BUILDFLAG(IS_WIN)
++#include <windows.h>
++
++#include "base/win/object_watcher.h"
++#endif
++
++namespace browseros {
++
++namespace {
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_MAC)
++
++#if BUILDFLAG(IS_LINUX) && !defined(SYS_pidfd_open)
++// Older libc headers lack the constant; the syscall number is the same on
++// every architecture since 5.3.
++constexpr long SYS_pidfd_open = 434;
++#endif
++
++// Returns an fd that becomes readable when |pid| exits, or an invalid fd if
++// the platform primitive is unavailable.
++base::ScopedFD OpenExitFd(base::ProcessId pid) {
++#if BUILDFLAG(IS_LINUX)
++  return base::ScopedFD(static_cast<int>(syscall(SYS_pidfd_open, pid, 0)));
++#else
++  base::ScopedFD kq(kqueue());
++  if (!kq.is_valid()) {
++    return base::ScopedFD();
++  }
++  struct kevent change;
++  EV_SET(&change, pid, EVFILT_PROC, EV_ADD | EV_ONESHOT, NOTE_EXIT, 0,
++         nullptr);
++  if (kevent(kq.get(), &change, 1, nullptr, 0, nullptr) != 0) {
++    return base::ScopedFD();
++  }
++  return kq;
++#endif
++}
++
++// Lives on a ThreadPool sequence, which provides FileDescriptorWatcher
++// support, and runs |on_exit| once the fd turns readable.
++class FdWatchCore {
++ public:
++  FdWatchCore(base::ScopedFD fd, base::OnceClosure on_exit)
++      : fd_(std::move(fd)), on_exit_(std::move(on_exit)) {
++    controller_ = base::FileDescriptorWatcher::WatchReadable(
++        fd_.get(), base::BindRepeating(&FdWatchCore::OnReadable,
++                                       base::Unretained(this)));
++  }
++
++  FdWatchCore(const FdWatchCore&) = delete;
++  FdWatchCore& operator=(const FdWatchCore&) = delete;
++
++ private:
++  void OnReadable() {
++    controller_.reset();
++    if (on_exit_) {
++      std::move(on_exit_).Run();
++    }
++  }
++
++  base::ScopedFD fd_;
++  base::OnceClosure on_exit_;
++  std::unique_ptr<base::FileDescriptorWatcher::Controller> controller_;
++};
++
++class FdProcessExitWatcher : public ProcessExitWatcher {
++ public:
++  FdProcessExitWatcher(base::ScopedFD fd, base::OnceClosure on_exit)
++      : core_(base::ThreadPool::CreateSequencedTaskRunner(
++                  {base::TaskPriority::USER_BLOCKING}),
++              std::move(fd),
++              base::BindPostTaskToCurrentDefault(std::move(on_exit))) {}
++
++ private:
++  base::SequenceBound<FdWatchCore> core_;
++};
++
++#elif BUILDFLAG(IS_WIN)
++
++class HandleProcessExitWatcher : public ProcessExitWatcher,
++                                 public base::win::ObjectWatcher::Delegate {
++ public:
++  HandleProcessExitWatcher(base::Process process, base::OnceClosure on_exit)
++      : process_(std::move(process)), on_exit_(std::move(on_exit)) {}
++
++  bool Start() { return watcher_.StartWatchingOnce(process_.Handle(), this); }
++
++ private:
++  // base::win::ObjectWatcher::Delegate:
++  void OnObjectSignaled(HANDLE object) override {
++    if (on_exit_) {
++      std::move(on_exit_).Run();
++    }
++  }
++
++  base::Process process_;
++  base::OnceClosure on_exit_;
++  base::win::ObjectWatcher watcher_;
++};
++
++#endif
++
++}  // namespace
++
++// static
++std::unique_ptr<ProcessExitWatcher> ProcessExitWatcher::Create(
++    const base::Process& process,
++    base::OnceClosure on_exit) {
++  if (!process.IsValid()) {
++    return nullptr;
++  }
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_MAC)
++  base::ScopedFD fd = OpenExitFd(process.Pid());
++  if (!fd.is_valid()) {
++    PLOG(WARNING) << "browseros: Cannot watch PID " << process.Pid()
++                  << " for exit";
++    return nullptr;
++  }
++  return std::make_unique<FdProcessExitWatcher>(std::move(fd),
++                                                std::move(on_exit));
++#elif BUILDFLAG(IS_WIN)
++  auto watcher = std::make_unique<HandleProcessExitWatcher>(
++      process.Duplicate(), std::move(on_exit));
++  if (!watcher->Start()) {
++    LOG(WARNING) << "browseros: Cannot watch PID " << process.Pid()
++                 << " for exit";
++    return nullptr;
++  }
++  return watcher;
++#else
++  return nullptr;
++#endif
++}
++
++}  // namespace browseros
@@ -0,0 +1,44 @@
+diff --git a/chrome/browser/browseros/server/process_exit_watcher.h b/chrome/browser/browseros/server/process_exit_watcher.h
+new file mode 100644
+index 0000000000000..9f24c3695393e
+--- /dev/null
++++ b/chrome/browser/browseros/server/process_exit_watcher.h
+@@ -0,0 +1,38 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
++
++#include <memory>
++
++#include "base/functional/callback.h"
++#include "base/process/process.h"
++
++namespace browseros {
++
++// Notifies the creating sequence as soon as a process exits, without polling.
++// Linux watches a pidfd and macOS a kqueue EVFILT_PROC filter, both from a
++// ThreadPool sequence; Windows waits on the process handle. Destroying the
++// watcher cancels the notification.
++class ProcessExitWatcher {
++ public:
++  // Returns nullptr when exit notification is unavailable (e.g. the kernel
++  // lacks pidfd_open); callers should fall back to polling.
++  static std::unique_ptr<ProcessExitWatcher> Create(
++      const base::Process& process,
++      base::OnceClosure on_exit);
++
++  virtual ~ProcessExitWatcher() = default;
++
++  ProcessExitWatcher(const ProcessExitWatcher&) = delete;
++  ProcessExitWatcher& operator=(const ProcessExitWatcher&) = delete;
++
++ protected:
++  ProcessExitWatcher() = default;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
@@ -0,0 +1,57 @@
+diff --git a/chrome/browser/browseros/server/restart_scheduler.cc b/chrome/browser/browseros/server/restart_scheduler.cc
+new file mode 100644
+index 0000000000000..f256f1ca3183d
+--- /dev/null
++++ b/chrome/browser/browseros/server/restart_scheduler.cc
+@@ -0,0 +1,51 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/restart_scheduler.h"
++
++#include <algorithm>
++#include <cmath>
++
++#include "base/rand_util.h"
++
++namespace browseros {
++
++RestartScheduler::RestartScheduler() : RestartScheduler(Policy()) {}
++
++RestartScheduler::RestartScheduler(const Policy& policy) : policy_(policy) {}
++
++RestartScheduler::~RestartScheduler() = default;
++
++base::TimeDelta RestartScheduler::RecordFailure(base::TimeTicks now) {
++  Prune(now);
++  failures_.push_back(now);
++
++  int failures = static_cast<int>(failures_.size());
++  if (failures <= 1) {
++    return base::TimeDelta();
++  }
++
++  double factor = std::pow(policy_.multiplier, failures - 2);
++  base::TimeDelta delay =
++      std::min(policy_.initial_delay * factor, policy_.max_delay);
++
++  if (policy_.jitter > 0) {
++    delay *= 1.0 + policy_.jitter * (2.0 * base::RandDouble() - 1.0);
++  }
++  return delay;
++}
++
++int RestartScheduler::FailuresInWindow(base::TimeTicks now) {
++  Prune(now);
++  return static_cast<int>(failures_.size());
++}
++
++void RestartScheduler::Prune(base::TimeTicks now) {
++  while (!failures_.empty() &&
++         now - failures_.front() >= policy_.failure_window) {
++    failures_.pop_front();
++  }
++}
++
++}  // namespace browseros
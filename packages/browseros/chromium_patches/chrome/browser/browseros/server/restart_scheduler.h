@@ -0,0 +1,60 @@
+diff --git a/chrome/browser/browseros/server/restart_scheduler.h b/chrome/browser/browseros/server/restart_scheduler.h
+new file mode 100644
+index 0000000000000..c6f76d12274e7
+--- /dev/null
++++ b/chrome/browser/browseros/server/restart_scheduler.h
+@@ -0,0 +1,54 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_RESTART_SCHEDULER_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_RESTART_SCHEDULER_H_
++
++#include "base/containers/circular_deque.h"
++#include "base/time/time.h"
++
++namespace browseros {
++
++// Decides how long to wait before relaunching a failed server. Failures are
++// counted over a sliding window: the first failure in the window relaunches
++// immediately, each further one doubles the delay (with jitter) up to
++// |max_delay|. Once the window has passed without failures, the count drops
++// back to zero, so a server that crashes once a day is never throttled while
++// a crash loop settles at one attempt per |max_delay|.
++class RestartScheduler {
++ public:
++  struct Policy {
++    base::TimeDelta initial_delay = base::Seconds(1);
++    base::TimeDelta max_delay = base::Minutes(5);
++    double multiplier = 2.0;
++    // Fraction of the delay randomized in either direction, in [0, 1).
++    double jitter = 0.2;
++    base::TimeDelta failure_window = base::Minutes(10);
++  };
++
++  RestartScheduler();
++  explicit RestartScheduler(const Policy& policy);
++  ~RestartScheduler();
++
++  RestartScheduler(const RestartScheduler&) = delete;
++  RestartScheduler& operator=(const RestartScheduler&) = delete;
++
++  // Records a failure at |now| and returns the delay before relaunching.
++  base::TimeDelta RecordFailure(base::TimeTicks now);
++
++  // Number of failures within the window ending at |now|.
++  int FailuresInWindow(base::TimeTicks now);
++
++  const Policy& policy() const { return policy_; }
++
++ private:
++  void Prune(base::TimeTicks now);
++
++  const Policy policy_;
++  base::circular_deque<base::TimeTicks> failures_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_RESTART_SCHEDULER_H_
@@ -0,0 +1,84 @@
+diff --git a/chrome/browser/browseros/server/restart_scheduler_unittest.cc b/chrome/browser/browseros/server/restart_scheduler_unittest.cc
+new file mode 100644
+index 0000000000000..c2ce8b6dc7735
+--- /dev/null
++++ b/chrome/browser/browseros/server/restart_scheduler_unittest.cc
+@@ -0,0 +1,78 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/restart_scheduler.h"
++
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++RestartScheduler::Policy NoJitterPolicy() {
++  RestartScheduler::Policy policy;
++  policy.initial_delay = base::Seconds(1);
++  policy.max_delay = base::Seconds(10);
++  policy.jitter = 0;
++  policy.failure_window = base::Minutes(1);
++  return policy;
++}
++
++// =============================================================================
++// Backoff Tests
++// =============================================================================
++
++TEST(RestartSchedulerTest, FirstFailureRestartsImmediately) {
++  RestartScheduler scheduler(NoJitterPolicy());
++  EXPECT_EQ(base::TimeDelta(), scheduler.RecordFailure(base::TimeTicks()));
++}
++
++TEST(RestartSchedulerTest, BacksOffExponentiallyUpToMax) {
++  RestartScheduler scheduler(NoJitterPolicy());
++  base::TimeTicks now;
++
++  EXPECT_EQ(base::TimeDelta(), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(1), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(2), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(4), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(8), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(10), scheduler.RecordFailure(now));
++  EXPECT_EQ(base::Seconds(10), scheduler.RecordFailure(now));
++}
++
++TEST(RestartSchedulerTest, JitterStaysWithinBounds) {
++  RestartScheduler::Policy policy = NoJitterPolicy();
++  policy.jitter = 0.5;
++  RestartScheduler scheduler(policy);
++  base::TimeTicks now;
++
++  scheduler.RecordFailure(now);
++  for (int i = 0; i < 20; ++i) {
++    base::TimeDelta delay = scheduler.RecordFailure(now);
++    EXPECT_GE(delay, base::Milliseconds(500));
++    EXPECT_LE(delay, base::Seconds(15));
++  }
++}
++
++// =============================================================================
++// Sliding Window Tests
++// =============================================================================
++
++TEST(RestartSchedulerTest, FailuresOutsideWindowAreForgotten) {
++  RestartScheduler scheduler(NoJitterPolicy());
++  base::TimeTicks start;
++
++  scheduler.RecordFailure(start);
++  scheduler.RecordFailure(start + base::Seconds(10));
++  EXPECT_EQ(2, scheduler.FailuresInWindow(start + base::Seconds(30)));
++
++  // The first failure has aged out; the second still counts.
++  EXPECT_EQ(base::Seconds(1),
++            scheduler.RecordFailure(start + base::Seconds(65)));
++  EXPECT_EQ(0, scheduler.FailuresInWindow(start + base::Minutes(5)));
++  EXPECT_EQ(base::TimeDelta(),
++            scheduler.RecordFailure(start + base::Minutes(5)));
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,224 @@
+diff --git a/chrome/browser/browseros/server/server_heartbeat.cc b/chrome/browser/browseros/server/server_heartbeat.cc
+new file mode 100644
+index 0000000000000..a04388202b169
+--- /dev/null
++++ b/chrome/browser/browseros/server/server_heartbeat.cc
+@@ -0,0 +1,218 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/server_heartbeat.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics_recorder.h"
++#include "net/base/address_list.h"
++#include "net/base/io_buffer.h"
++#include "net/base/ip_address.h"
++#include "net/base/ip_endpoint.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_util.h"
++#include "net/log/net_log_source.h"
++#include "net/socket/tcp_client_socket.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kHeartbeatRequest[] =
++    "GET /health HTTP/1.1\r\n"
++    "Host: 127.0.0.1\r\n"
++    "Connection: keep-alive\r\n"
++    "\r\n";
++
++constexpr int kReadBufferSize = 4096;
++constexpr size_t kMaxResponseSize = 64 * 1024;
++
++net::NetworkTrafficAnnotationTag GetHeartbeatTrafficAnnotation() {
++  return net::DefineNetworkTrafficAnnotation("browseros_server_heartbeat", R"(
++    semantics {
++      sender: "BrowserOS Server Manager"
++      description:
++        "Sends GET /health to the local BrowserOS server over a persistent "
++        "keep-alive connection to detect a hung server quickly."
++      trigger: "Periodic heartbeat while the server is running."
++      data: "No user data sent, just an HTTP GET request."
++      destination: LOCAL
++    }
++    policy {
++      cookies_allowed: NO
++      setting: "This feature cannot be disabled by settings."
++      policy_exception_justification:
++        "Internal liveness probe for BrowserOS server functionality."
++    })");
++}
++
++}  // namespace
++
++ServerHeartbeat::ServerHeartbeat(int port,
++                                 base::TimeDelta interval,
++                                 base::TimeDelta deadline,
++                                 ResultCallback on_result)
++    : port_(port), deadline_(deadline), on_result_(std::move(on_result)) {
++  interval_timer_.Start(FROM_HERE, interval, this, &ServerHeartbeat::Beat);
++}
++
++ServerHeartbeat::~ServerHeartbeat() = default;
++
++void ServerHeartbeat::Beat() {
++  if (in_flight_) {
++    // The deadline timer already reports the outstanding beat.
++    return;
++  }
++  in_flight_ = true;
++  response_.clear();
++  deadline_timer_.Start(FROM_HERE, deadline_, this,
++                        &ServerHeartbeat::OnDeadline);
++
++  if (socket_ && socket_->IsConnectedAndIdle()) {
++    SendRequest();
++    return;
++  }
++  Connect();
++}
++
++void ServerHeartbeat::Connect() {
++  socket_ = std::make_unique<net::TCPClientSocket>(
++      net::AddressList(net::IPEndPoint(net::IPAddress::IPv4Localhost(), port_)),
++      nullptr, nullptr, nullptr, net::NetLogSource());
++  int result = socket_->Connect(base::BindOnce(
++      &ServerHeartbeat::OnConnected, weak_factory_.GetWeakPtr()));
++  if (result != net::ERR_IO_PENDING) {
++    OnConnected(result);
++  }
++}
++
++void ServerHeartbeat::OnConnected(int result) {
++  if (result != net::OK) {
++    VLOG(1) << "browseros: Heartbeat connect failed: "
++            << net::ErrorToString(result);
++    Finish(false, /*keep_connection=*/false);
++    return;
++  }
++  SendRequest();
++}
++
++void ServerHeartbeat::SendRequest() {
++  auto request = base::MakeRefCounted<net::StringIOBuffer>(
++      std::string(kHeartbeatRequest));
++  write_buffer_ = base::MakeRefCounted<net::DrainableIOBuffer>(
++      request, request->size());
++  OnWritten(0);
++}
++
++void ServerHeartbeat::OnWritten(int result) {
++  while (true) {
++    if (result < 0) {
++      Finish(false, /*keep_connection=*/false);
++      return;
++    }
++    write_buffer_->DidConsume(result);
++    if (write_buffer_->BytesRemaining() == 0) {
++      write_buffer_.reset();
++      ReadResponse();
++      return;
++    }
++    result = socket_->Write(
++        write_buffer_.get(), write_buffer_->BytesRemaining(),
++        base::BindOnce(&ServerHeartbeat::OnWritten,
++                       weak_factory_.GetWeakPtr()),
++        GetHeartbeatTrafficAnnotation());
++    if (result == net::ERR_IO_PENDING) {
++      return;
++    }
++  }
++}
++
++void ServerHeartbeat::ReadResponse() {
++  if (!read_buffer_) {
++    read_buffer_ = base::MakeRefCounted<net::IOBufferWithSize>(kReadBufferSize);
++  }
++  int result = socket_->Read(
++      read_buffer_.get(), read_buffer_->size(),
++      base::BindOnce(&ServerHeartbeat::OnRead, weak_factory_.GetWeakPtr()));
++  if (result != net::ERR_IO_PENDING) {
++    OnRead(result);
++  }
++}
++
++void ServerHeartbeat::OnRead(int result) {
++  if (result <= 0) {
++    Finish(false, /*keep_connection=*/false);
++    return;
++  }
++
++  response_.append(read_buffer_->data(), static_cast<size_t>(result));
++  if (response_.size() > kMaxResponseSize) {
++    Finish(false, /*keep_connection=*/false);
++    return;
++  }
++
++  size_t header_end = response_.find("\r\n\r\n");
++  if (header_end == std::string::npos) {
++    ReadResponse();
++    return;
++  }
++  header_end += 4;
++
++  auto headers = base::MakeRefCounted<net::HttpResponseHeaders>(
++      net::HttpUtil::AssembleRawHeaders(
++          std::string_view(response_).substr(0, header_end)));
++  int64_t content_length = headers->GetContentLength();
++  int64_t body_received = static_cast<int64_t>(response_.size() - header_end);
++  if (content_length > body_received) {
++    ReadResponse();
++    return;
++  }
++
++  // Without a Content-Length the message end is ambiguous; drop the
++  // connection rather than risk reading a stale body on the next beat.
++  bool keep_connection = headers->IsKeepAlive() && content_length >= 0 &&
++                         content_length == body_received;
++  Finish(headers->response_code() == 200, keep_connection);
++}
++
++void ServerHeartbeat::OnDeadline() {
++  VLOG(1) << "browseros: Heartbeat missed deadline of "
++          << deadline_.InMilliseconds() << "ms";
++  Finish(false, /*keep_connection=*/false);
++}
++
++void ServerHeartbeat::Finish(bool success, bool keep_connection) {
++  if (!in_flight_) {
++    return;
++  }
++  in_flight_ = false;
++  // The deadline timer has already fired if the beat timed out.
++  bool timed_out = !deadline_timer_.IsRunning();
++  deadline_timer_.Stop();
++  write_buffer_.reset();
++  response_.clear();
++
++  if (!keep_connection) {
++    // Dropping the socket also cancels any pending read/write callbacks.
++    socket_.reset();
++    weak_factory_.InvalidateWeakPtrs();
++  }
++
++  if (!success) {
++    static const browseros_metrics::MetricEventId kFailedEvent =
++        browseros_metrics::BrowserOSMetricsRecorder::Get().RegisterEvent(
++            "server.heartbeat.failed", {"timed_out", "deadline_ms"});
++    browseros_metrics::BrowserOSMetricsRecorder::Get().Record(
++        kFailedEvent, {timed_out, deadline_.InMilliseconds()});
++  }
++
++  on_result_.Run(success);
++}
++
++}  // namespace browseros
@@ -0,0 +1,81 @@
+diff --git a/chrome/browser/browseros/server/server_heartbeat.h b/chrome/browser/browseros/server/server_heartbeat.h
+new file mode 100644
+index 0000000000000..7c82f397f7d33
+--- /dev/null
++++ b/chrome/browser/browseros/server/server_heartbeat.h
+@@ -0,0 +1,75 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_SERVER_HEARTBEAT_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_SERVER_HEARTBEAT_H_
++
++#include <memory>
++#include <string>
++
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++
++namespace net {
++class DrainableIOBuffer;
++class IOBufferWithSize;
++class StreamSocket;
++}  // namespace net
++
++namespace browseros {
++
++// Lightweight liveness probe for the sidecar. Keeps one HTTP/1.1 keep-alive
++// connection to the backend port open and sends GET /health on it every
++// |interval|, reporting true on HTTP 200 within |deadline| and false on
++// timeout, error or any other status. A broken or timed-out connection is
++// dropped and re-opened on the next beat, so a hung server is detected
++// without creating a URL loader per probe.
++//
++// Threading: lives entirely on the IO thread (see HealthCheckerImpl).
++class ServerHeartbeat {
++ public:
++  using ResultCallback = base::RepeatingCallback<void(bool success)>;
++
++  ServerHeartbeat(int port,
++                  base::TimeDelta interval,
++                  base::TimeDelta deadline,
++                  ResultCallback on_result);
++  ~ServerHeartbeat();
++
++  ServerHeartbeat(const ServerHeartbeat&) = delete;
++  ServerHeartbeat& operator=(const ServerHeartbeat&) = delete;
++
++ private:
++  void Beat();
++  void Connect();
++  void OnConnected(int result);
++  void SendRequest();
++  void OnWritten(int result);
++  void ReadResponse();
++  void OnRead(int result);
++  void OnDeadline();
++  void Finish(bool success, bool keep_connection);
++
++  const int port_;
++  const base::TimeDelta deadline_;
++  ResultCallback on_result_;
++
++  std::unique_ptr<net::StreamSocket> socket_;
++  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
++  scoped_refptr<net::IOBufferWithSize> read_buffer_;
++  std::string response_;
++  bool in_flight_ = false;
++
++  base::RepeatingTimer interval_timer_;
++  base::OneShotTimer deadline_timer_;
++
++  base::WeakPtrFactory<ServerHeartbeat> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_SERVER_HEARTBEAT_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/test/mock_health_checker.h b/chrome/browser/browseros/server/test/mock_health_checker.h
 new file mode 100644
-index 0000000000000..e684d775ea25d
+index 0000000000000..d985a294c9573
 --- /dev/null
 +++ b/chrome/browser/browseros/server/test/mock_health_checker.h
-@@ -0,0 +1,33 @@
+@@ -0,0 +1,41 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -32,6 +32,14 @@ index 0000000000000..e684d775ea25d
 +              RequestShutdown,
 +              (int, base::OnceCallback<void(bool)>),
 +              (override));
++  MOCK_METHOD(void,
++              StartHeartbeat,
++              (int,
++               base::TimeDelta,
++               base::TimeDelta,
++               base::RepeatingCallback<void(bool)>),
++              (override));
++  MOCK_METHOD(void, StopHeartbeat, (), (override));
 +};
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/test/mock_process_controller.h b/chrome/browser/browseros/server/test/mock_process_controller.h
 new file mode 100644
-index 0000000000000..97fdf04282691
+index 0000000000000..a5282f645e519
 --- /dev/null
 +++ b/chrome/browser/browseros/server/test/mock_process_controller.h
-@@ -0,0 +1,38 @@
+@@ -0,0 +1,47 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..97fdf04282691
 +#define CHROME_BROWSER_BROWSEROS_SERVER_TEST_MOCK_PROCESS_CONTROLLER_H_
 +
 +#include "chrome/browser/browseros/server/process_controller.h"
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
 +#include "testing/gmock/include/gmock/gmock.h"
 +
 +namespace browseros {
@@ -37,6 +38,14 @@ index 0000000000000..97fdf04282691
 +  MOCK_METHOD(std::optional<int64_t>, GetCreationTime, (base::ProcessId),
 +              (override));
 +  MOCK_METHOD(bool, Kill, (base::ProcessId, base::TimeDelta), (override));
++  MOCK_METHOD(std::unique_ptr<ProcessExitWatcher>,
++              WatchForExit,
++              (const base::Process&, base::OnceClosure),
++              (override));
++  MOCK_METHOD(std::optional<server_utils::ProcessResourceUsage>,
++              GetResourceUsage,
++              (base::ProcessId),
++              (override));
 +};
 +
 +}  // namespace browseros
@@ -1,15 +1,16 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.cc b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
 new file mode 100644
-index 0000000000000..c08b705ef6869
+index 0000000000000..c8a44bd21e76d
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
-@@ -0,0 +1,1437 @@
+@@ -0,0 +1,1890 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api.h"
 +
++#include <algorithm>
 +#include <set>
 +#include <string>
 +
@@ -29,16 +30,23 @@ index 0000000000000..c08b705ef6869
 +#include "base/json/json_writer.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/system/sys_info.h"
 +#include "base/base64.h"
 +#include "base/time/time.h"
 +#include "base/values.h"
 +#include "base/version_info/version_info.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
++#include "chrome/browser/browseros/page_content/page_text_index.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
@@ -270,6 +278,58 @@ index 0000000000000..c08b705ef6869
 +  }
 +}
 +
++// Converts the IDL snapshot options, returning false with |error| set if
++// they are invalid.
++bool ParseSnapshotOptions(
++    const std::optional<browser_os::InteractiveSnapshotOptions>& params,
++    SnapshotOptions* options,
++    std::string* error) {
++  if (!params) {
++    return true;
++  }
++  if ((params->viewport_screens && *params->viewport_screens < 0) ||
++      (params->max_nodes && *params->max_nodes < 0) ||
++      (params->max_bytes && *params->max_bytes < 0)) {
++    *error = "Snapshot limits must not be negative";
++    return false;
++  }
++  if (params->viewport_screens) {
++    options->viewport_screens = *params->viewport_screens;
++  } else if (params->viewport_only.value_or(false)) {
++    options->viewport_screens = 0;
++  }
++  options->max_nodes = params->max_nodes.value_or(0);
++  options->max_bytes = params->max_bytes.value_or(0);
++  return true;
++}
++
++// Converts the IDL node query, returning false with |error| set if it is
++// invalid.
++bool ParseNodeQuery(const browser_os::NodeQuery& params,
++                    browseros::NodeQuery* query,
++                    std::string* error) {
++  if (params.max_results && *params.max_results < 0) {
++    *error = "maxResults must not be negative";
++    return false;
++  }
++  query->role = params.role.value_or(std::string());
++  query->name_contains = params.name.value_or(std::string());
++  query->name_pattern = params.name_pattern.value_or(std::string());
++  query->in_viewport = params.in_viewport;
++  query->near_text = params.near_text.value_or(std::string());
++  query->max_results = params.max_results.value_or(0);
++  if (params.attributes) {
++    for (const auto [key, value] : params.attributes->additional_properties) {
++      if (!value.is_string()) {
++        *error = "Attribute values must be strings";
++        return false;
++      }
++      query->attributes.emplace_back(key, value.GetString());
++    }
++  }
++  return true;
++}
++
 +}  // namespace
 +
 +// Static member initialization
@@ -365,6 +425,10 @@ index 0000000000000..c08b705ef6869
 +  // Store tab ID for mapping
 +  tab_id_ = tab_info->tab_id;
 +
++  if (!ParseSnapshotOptions(params->options, &options_, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++
 +  // Check frame stability before requesting snapshot
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
@@ -420,10 +484,12 @@ index 0000000000000..c08b705ef6869
 +  
 +  // Simple API layer - just delegates to the processor
 +  SnapshotProcessor::ProcessAccessibilityTree(
-+      tree_update,
++      std::move(tree_update),
 +      tab_id_,
 +      next_snapshot_id_++,
 +      web_contents_.get(),
++      options_,
++      SnapshotChunkCallback(),
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
 +          base::WrapRefCounted(this)));
@@ -435,6 +501,390 @@ index 0000000000000..c08b705ef6869
 +      browser_os::GetInteractiveSnapshot::Results::Create(result.snapshot)));
 +}
 +
++// Implementation of BrowserOSFindNodesFunction
++
++ExtensionFunction::ResponseAction BrowserOSFindNodesFunction::Run() {
++  std::optional<browser_os::FindNodes::Params> params =
++      browser_os::FindNodes::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  if (!GetNodeIdMappings().contains(tab_info->tab_id)) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++
++  browseros::NodeQuery query;
++  if (!ParseNodeQuery(params->query, &query, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++
++  std::vector<const browseros::QueryableNode*> matches;
++  if (!GetNodeQueryIndex(tab_info->tab_id)
++           .Find(query, &matches, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++
++  std::vector<browser_os::FoundNode> results;
++  results.reserve(matches.size());
++  for (const browseros::QueryableNode* match : matches) {
++    browser_os::FoundNode& found = results.emplace_back();
++    found.node_id = match->node_id;
++    found.rect.x = match->bounds.x();
++    found.rect.y = match->bounds.y();
++    found.rect.width = match->bounds.width();
++    found.rect.height = match->bounds.height();
++  }
++  return RespondNow(
++      ArgumentList(browser_os::FindNodes::Results::Create(results)));
++}
++
++// Implementation of the waitFor functions
++
++ExtensionFunction::ResponseAction BrowserOSWaitFunction::StartWait(
++    std::optional<int> tab_id,
++    const std::optional<browser_os::WaitOptions>& options,
++    BrowserOSPageWaiter::Params params) {
++  // Long enough for slow pages, short enough that a forgotten wait does not
++  // hold the caller for minutes.
++  constexpr int kDefaultTimeoutMs = 10000;
++  constexpr int kMaxTimeoutMs = 120000;
++  constexpr int kDefaultQuietMs = 500;
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  int timeout_ms = kDefaultTimeoutMs;
++  int quiet_ms = kDefaultQuietMs;
++  if (options) {
++    timeout_ms = options->timeout_ms.value_or(timeout_ms);
++    quiet_ms = options->quiet_ms.value_or(quiet_ms);
++  }
++  if (timeout_ms < 0 || timeout_ms > kMaxTimeoutMs || quiet_ms < 0) {
++    return RespondNow(Error("Wait times must be between 0 and 120000 ms"));
++  }
++  params.timeout = base::Milliseconds(timeout_ms);
++  params.quiet_period = base::Milliseconds(quiet_ms);
++
++  BrowserOSPageWaiter::Start(
++      tab_info->web_contents, std::move(params),
++      base::BindOnce(&BrowserOSWaitFunction::OnWaitFinished, this));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSWaitFunction::OnWaitFinished(
++    BrowserOSPageWaiter::Result result) {
++  browser_os::WaitResult response;
++  response.satisfied = result.satisfied;
++  response.elapsed_ms = static_cast<int>(result.elapsed.InMilliseconds());
++  if (!result.url.empty()) {
++    response.url = std::move(result.url);
++  }
++  base::Value::List args;
++  args.Append(response.ToValue());
++  Respond(ArgumentList(std::move(args)));
++}
++
++ExtensionFunction::ResponseAction BrowserOSWaitForNodeFunction::Run() {
++  std::optional<browser_os::WaitForNode::Params> params =
++      browser_os::WaitForNode::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Updates carry no viewport state or surrounding context to match.
++  if (params->query.in_viewport || params->query.near_text) {
++    return RespondNow(
++        Error("waitForNode does not support inViewport or nearText"));
++  }
++  BrowserOSPageWaiter::Params wait;
++  wait.condition = BrowserOSPageWaiter::Condition::kNode;
++  std::string error_message;
++  if (!ParseNodeQuery(params->query, &wait.query, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++  // Reject a bad pattern now rather than on every update.
++  if (!browseros::NodeQueryIndex::Validate(wait.query, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++  return StartWait(params->tab_id, params->options, std::move(wait));
++}
++
++ExtensionFunction::ResponseAction BrowserOSWaitForTextFunction::Run() {
++  std::optional<browser_os::WaitForText::Params> params =
++      browser_os::WaitForText::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->text.empty()) {
++    return RespondNow(Error("Text must not be empty"));
++  }
++  BrowserOSPageWaiter::Params wait;
++  wait.condition = BrowserOSPageWaiter::Condition::kText;
++  wait.text = params->text;
++  return StartWait(params->tab_id, params->options, std::move(wait));
++}
++
++ExtensionFunction::ResponseAction BrowserOSWaitForNavigationFunction::Run() {
++  std::optional<browser_os::WaitForNavigation::Params> params =
++      browser_os::WaitForNavigation::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  BrowserOSPageWaiter::Params wait;
++  wait.condition = BrowserOSPageWaiter::Condition::kNavigation;
++  return StartWait(params->tab_id, params->options, std::move(wait));
++}
++
++ExtensionFunction::ResponseAction BrowserOSWaitForNetworkIdleFunction::Run() {
++  std::optional<browser_os::WaitForNetworkIdle::Params> params =
++      browser_os::WaitForNetworkIdle::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  BrowserOSPageWaiter::Params wait;
++  wait.condition = BrowserOSPageWaiter::Condition::kNetworkIdle;
++  return StartWait(params->tab_id, params->options, std::move(wait));
++}
++
++// Implementation of BrowserOSGetInteractiveSnapshotsFunction
++
++BrowserOSGetInteractiveSnapshotsFunction::
++    BrowserOSGetInteractiveSnapshotsFunction() = default;
++BrowserOSGetInteractiveSnapshotsFunction::
++    ~BrowserOSGetInteractiveSnapshotsFunction() = default;
++
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractiveSnapshotsFunction::Run() {
++  std::optional<browser_os::GetInteractiveSnapshots::Params> params =
++      browser_os::GetInteractiveSnapshots::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  if (!ParseSnapshotOptions(params->options, &options_, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++
++  // Two snapshots of one tab would race over its node id mappings.
++  const std::vector<int>& tab_ids = params->tab_ids;
++  if (std::set<int>(tab_ids.begin(), tab_ids.end()).size() != tab_ids.size()) {
++    return RespondNow(Error("Duplicate tab id"));
++  }
++
++  // Resolve every tab before requesting any tree, so no reply can arrive
++  // while the count is still growing.
++  results_.resize(tab_ids.size());
++  std::vector<base::WeakPtr<content::WebContents>> tabs(tab_ids.size());
++  for (size_t i = 0; i < tab_ids.size(); ++i) {
++    results_[i].tab_id = tab_ids[i];
++    std::string tab_error;
++    auto tab_info = GetTabFromOptionalId(tab_ids[i], browser_context(),
++                                         include_incognito_information(),
++                                         &tab_error);
++    if (!tab_info) {
++      results_[i].error = tab_error;
++      continue;
++    }
++    content::RenderFrameHost* rfh =
++        tab_info->web_contents->GetPrimaryMainFrame();
++    if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++      results_[i].error = "Frame not ready for snapshot";
++      continue;
++    }
++    tabs[i] = tab_info->web_contents->GetWeakPtr();
++    ++pending_tabs_;
++  }
++
++  if (pending_tabs_ == 0) {
++    return RespondNow(ArgumentList(
++        browser_os::GetInteractiveSnapshots::Results::Create(results_)));
++  }
++
++  // Each tab keeps only its share of the cores busy, so its next batch
++  // queues behind the other tabs' rather than ahead of them.
++  options_.max_batches_in_flight = std::max<size_t>(
++      1, base::SysInfo::NumberOfProcessors() / pending_tabs_);
++
++  const base::TimeTicks request_time = base::TimeTicks::Now();
++  for (size_t i = 0; i < tabs.size(); ++i) {
++    if (!tabs[i]) {
++      continue;
++    }
++    tabs[i]->RequestAXTreeSnapshot(
++        base::BindOnce(
++            &BrowserOSGetInteractiveSnapshotsFunction::
++                OnAccessibilityTreeReceived,
++            this, i, tabs[i], request_time),
++        ui::AXMode(ui::AXMode::kWebContents |
++                   ui::AXMode::kExtendedProperties |
++                   ui::AXMode::kInlineTextBoxes),
++        /* max_nodes= */ 0,  // No limit
++        /* timeout= */ base::TimeDelta(),
++        content::WebContents::AXTreeSnapshotPolicy::kAll);
++  }
++
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnAccessibilityTreeReceived(
++    size_t index,
++    base::WeakPtr<content::WebContents> web_contents,
++    base::TimeTicks request_time,
++    ui::AXTreeUpdate& tree_update) {
++  results_[index].tree_time_ms = static_cast<int>(
++      (base::TimeTicks::Now() - request_time).InMilliseconds());
++
++  content::RenderFrameHost* rfh =
++      web_contents ? web_contents->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !rfh->IsRenderFrameLive()) {
++    results_[index].error = "Frame became unstable during snapshot";
++    OnTabDone();
++    return;
++  }
++
++  SnapshotProcessor::ProcessAccessibilityTree(
++      std::move(tree_update), results_[index].tab_id,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents.get(), options_, SnapshotChunkCallback(),
++      base::BindOnce(
++          &BrowserOSGetInteractiveSnapshotsFunction::OnSnapshotProcessed,
++          base::WrapRefCounted(this), index));
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnSnapshotProcessed(
++    size_t index,
++    SnapshotProcessingResult result) {
++  results_[index].processing_time_ms =
++      static_cast<int>(result.processing_time_ms);
++  results_[index].snapshot = std::move(result.snapshot);
++  OnTabDone();
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnTabDone() {
++  if (--pending_tabs_ > 0) {
++    return;
++  }
++  Respond(ArgumentList(
++      browser_os::GetInteractiveSnapshots::Results::Create(results_)));
++}
++
++// Implementation of BrowserOSStartInteractiveSnapshotStreamFunction
++
++ExtensionFunction::ResponseAction
++BrowserOSStartInteractiveSnapshotStreamFunction::Run() {
++  std::optional<browser_os::StartInteractiveSnapshotStream::Params> params =
++      browser_os::StartInteractiveSnapshotStream::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  SnapshotOptions options;
++  if (!ParseSnapshotOptions(params->options, &options, &error_message)) {
++    return RespondNow(Error(error_message));
++  }
++  options.viewport_first = true;
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++    return RespondNow(Error("Frame not ready for snapshot"));
++  }
++
++  int stream_id = SnapshotStream::Create(extension_id(), browser_context());
++  web_contents->RequestAXTreeSnapshot(
++      base::BindOnce(&BrowserOSStartInteractiveSnapshotStreamFunction::
++                         OnAccessibilityTreeReceived,
++                     stream_id, tab_info->tab_id, options,
++                     web_contents->GetWeakPtr()),
++      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
++                 ui::AXMode::kInlineTextBoxes),
++      /* max_nodes= */ 0,  // No limit
++      /* timeout= */ base::TimeDelta(),
++      content::WebContents::AXTreeSnapshotPolicy::kAll);
++
++  return RespondNow(ArgumentList(
++      browser_os::StartInteractiveSnapshotStream::Results::Create(stream_id)));
++}
++
++// static
++void BrowserOSStartInteractiveSnapshotStreamFunction::
++    OnAccessibilityTreeReceived(
++        int stream_id,
++        int tab_id,
++        SnapshotOptions options,
++        base::WeakPtr<content::WebContents> web_contents,
++        ui::AXTreeUpdate& tree_update) {
++  if (!SnapshotStream::IsOpen(stream_id)) {
++    return;
++  }
++
++  // If the page went away, end the stream with an empty summary.
++  content::RenderFrameHost* rfh =
++      web_contents ? web_contents->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !rfh->IsRenderFrameLive()) {
++    LOG(WARNING) << "[browseros] Frame became unstable during streamed "
++                    "AX snapshot";
++    SnapshotProcessingResult result;
++    result.snapshot.snapshot_id =
++        BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId();
++    SnapshotStream::Finish(stream_id, std::move(result));
++    return;
++  }
++
++  SnapshotProcessor::ProcessAccessibilityTree(
++      std::move(tree_update), tab_id,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents.get(), options,
++      base::BindRepeating(&SnapshotStream::AddChunk, stream_id),
++      base::BindOnce(&SnapshotStream::Finish, stream_id));
++}
++
++// Implementation of BrowserOSReadInteractiveSnapshotStreamFunction
++
++ExtensionFunction::ResponseAction
++BrowserOSReadInteractiveSnapshotStreamFunction::Run() {
++  std::optional<browser_os::ReadInteractiveSnapshotStream::Params> params =
++      browser_os::ReadInteractiveSnapshotStream::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Another extension's stream, or one started from another profile, is
++  // reported exactly like one that does not exist.
++  SnapshotStream* stream = SnapshotStream::FromId(
++      params->stream_id, extension_id(), browser_context());
++  if (!stream) {
++    return RespondNow(Error("Snapshot stream not found"));
++  }
++  if (stream->has_pending_read()) {
++    return RespondNow(Error("Snapshot stream already has a pending read"));
++  }
++
++  // May respond synchronously if a chunk is already queued.
++  stream->Read(base::BindOnce(
++      &BrowserOSReadInteractiveSnapshotStreamFunction::OnChunk, this));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSReadInteractiveSnapshotStreamFunction::OnChunk(
++    std::optional<browser_os::InteractiveSnapshotChunk> chunk) {
++  if (!chunk) {
++    Respond(Error("Snapshot stream was closed"));
++    return;
++  }
++  Respond(ArgumentList(
++      browser_os::ReadInteractiveSnapshotStream::Results::Create(*chunk)));
++}
++
 +// Implementation of BrowserOSClickFunction
 +
 +ExtensionFunction::ResponseAction BrowserOSClickFunction::Run() {
@@ -468,11 +918,13 @@ index 0000000000000..c08b705ef6869
 +  const NodeInfo& node_info = node_it->second;
 +  
 +  // Perform click with change detection
-+  bool change_detected = ClickWithDetection(web_contents, node_info);
++  ClickStrategy strategy;
++  bool change_detected = ClickWithDetection(web_contents, node_info, &strategy);
 +  
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
 +  response.success = change_detected;
++  response.strategy = ClickStrategyToString(strategy);
 +  
 +  return RespondNow(ArgumentList(
 +      browser_os::Click::Results::Create(response)));
@@ -753,9 +1205,11 @@ index 0000000000000..c08b705ef6869
 +  gfx::Rect viewport_bounds = rwhv->GetViewBounds();
 +  
 +  // Check if the node is already visible in the viewport
-+  // We consider it visible if any part of it is within the viewport
++  // We consider it visible if any part of it is within the viewport. Bounds
++  // of a stale node predate the latest snapshot, so always scroll those.
 +  bool is_in_view = false;
-+  if (node_info.bounds.y() < viewport_bounds.height() && 
++  if (!node_info.stale &&
++      node_info.bounds.y() < viewport_bounds.height() && 
 +      node_info.bounds.bottom() > 0 &&
 +      node_info.bounds.x() < viewport_bounds.width() &&
 +      node_info.bounds.right() > 0) {
@@ -764,16 +1218,8 @@ index 0000000000000..c08b705ef6869
 +  
 +  if (!is_in_view) {
 +    // Use accessibility action to scroll
-+    if (rfh) {
-+      ui::AXActionData action_data;
-+      action_data.action = ax::mojom::Action::kScrollToMakeVisible;
-+      action_data.target_node_id = node_info.ax_node_id;
-+      action_data.horizontal_scroll_alignment = ax::mojom::ScrollAlignment::kScrollAlignmentCenter;
-+      action_data.vertical_scroll_alignment = ax::mojom::ScrollAlignment::kScrollAlignmentCenter;
-+      action_data.scroll_behavior = ax::mojom::ScrollBehavior::kScrollIfVisible;
-+      
-+      rfh->AccessibilityPerformAction(action_data);
-+    }
++    AccessibilityScrollToMakeVisible(web_contents, node_info,
++                                     true /* center */);
 +  }
 +  
 +  return RespondNow(ArgumentList(
@@ -1029,28 +1475,27 @@ index 0000000000000..c08b705ef6869
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Request accessibility tree snapshot
-+  web_contents->RequestAXTreeSnapshot(
-+      base::BindOnce(&BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived,
-+                     this),
++
++  // Served from the per-tab cache when the document has not changed.
++  browseros::PageContentCache::GetIndex(
++      web_contents,
 +      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
-+      /* max_nodes= */ 0,  // No limit
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
 +      /* timeout= */ base::TimeDelta(),
-+      content::WebContents::AXTreeSnapshotPolicy::kAll);
-+  
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnPageIndexReady, this));
++
 +  return RespondLater();
 +}
 +
-+void BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& tree_update) {
++void BrowserOSGetSnapshotFunction::OnPageIndexReady(
++    scoped_refptr<const browseros::PageTextIndex> index) {
 +  if (!has_callback()) {
 +    return;
 +  }
 +
 +  // Extract page content using the processor
 +  base::Time start_time = base::Time::Now();
-+  auto items = ContentProcessor::ExtractPageContent(tree_update);
++  auto items = ContentProcessor::ExtractPageContent(*index);
 +
 +  // Build result
 +  browser_os::PageContent result;
@@ -1075,6 +1520,14 @@ index 0000000000000..c08b705ef6869
 +    return RespondNow(Error("Preference not found: " + params->name));
 +  }
 +
++  // The strategy record is written back lazily; dump what is in use.
++  if (params->name == browseros::prefs::kActionStrategies) {
++    if (BrowserOSStrategyCache* cache =
++            BrowserOSStrategyCacheFactory::GetForBrowserContext(profile)) {
++      cache->Flush();
++    }
++  }
++
 +  browser_os::PrefObject pref_obj;
 +  pref_obj.key = params->name;
 +
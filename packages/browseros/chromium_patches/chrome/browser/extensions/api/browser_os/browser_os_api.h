@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.h b/chrome/browser/extensions/api/browser_os/browser_os_api.h
 new file mode 100644
-index 0000000000000..2e2f5f0253f86
+index 0000000000000..0540cf331c7ef
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.h
-@@ -0,0 +1,369 @@
+@@ -0,0 +1,539 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,17 +11,26 @@ index 0000000000000..2e2f5f0253f86
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +
++#include <cstddef>
 +#include <cstdint>
++#include <vector>
 +
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "base/values.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_waiter.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +#include "extensions/browser/extension_function.h"
 +#include "third_party/skia/include/core/SkBitmap.h"
 +#include "ui/shell_dialogs/select_file_dialog.h"
 +
++namespace browseros {
++class PageTextIndex;
++}
++
 +namespace content {
 +class WebContents;
 +}
@@ -58,6 +67,9 @@ index 0000000000000..2e2f5f0253f86
 +
 +  BrowserOSGetInteractiveSnapshotFunction();
 +
++  // Returns a new snapshot id, shared with streamed snapshots.
++  static uint32_t AllocateSnapshotId() { return next_snapshot_id_++; }
++
 + protected:
 +  ~BrowserOSGetInteractiveSnapshotFunction() override;
 +
@@ -73,11 +85,169 @@ index 0000000000000..2e2f5f0253f86
 +  
 +  // Tab ID for storing mappings
 +  int tab_id_ = -1;
++
++  // Viewport and size limits requested by the caller
++  SnapshotOptions options_;
 +  
 +  // Web contents for processing and drawing
 +  base::WeakPtr<content::WebContents> web_contents_;
 +};
 +
++class BrowserOSFindNodesFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.findNodes", BROWSER_OS_FINDNODES)
++
++  BrowserOSFindNodesFunction() = default;
++
++ protected:
++  ~BrowserOSFindNodesFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++// Shared plumbing of the waitFor functions.
++class BrowserOSWaitFunction : public ExtensionFunction {
++ protected:
++  ~BrowserOSWaitFunction() override = default;
++
++  // Resolves the tab, applies |options| to |params| and starts the wait.
++  ResponseAction StartWait(std::optional<int> tab_id,
++                           const std::optional<browser_os::WaitOptions>& options,
++                           BrowserOSPageWaiter::Params params);
++
++ private:
++  void OnWaitFinished(BrowserOSPageWaiter::Result result);
++};
++
++class BrowserOSWaitForNodeFunction : public BrowserOSWaitFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForNode", BROWSER_OS_WAITFORNODE)
++
++  BrowserOSWaitForNodeFunction() = default;
++
++ protected:
++  ~BrowserOSWaitForNodeFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSWaitForTextFunction : public BrowserOSWaitFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForText", BROWSER_OS_WAITFORTEXT)
++
++  BrowserOSWaitForTextFunction() = default;
++
++ protected:
++  ~BrowserOSWaitForTextFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSWaitForNavigationFunction : public BrowserOSWaitFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForNavigation",
++                             BROWSER_OS_WAITFORNAVIGATION)
++
++  BrowserOSWaitForNavigationFunction() = default;
++
++ protected:
++  ~BrowserOSWaitForNavigationFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSWaitForNetworkIdleFunction : public BrowserOSWaitFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForNetworkIdle",
++                             BROWSER_OS_WAITFORNETWORKIDLE)
++
++  BrowserOSWaitForNetworkIdleFunction() = default;
++
++ protected:
++  ~BrowserOSWaitForNetworkIdleFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSGetInteractiveSnapshotsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getInteractiveSnapshots",
++                             BROWSER_OS_GETINTERACTIVESNAPSHOTS)
++
++  BrowserOSGetInteractiveSnapshotsFunction();
++
++ protected:
++  ~BrowserOSGetInteractiveSnapshotsFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnAccessibilityTreeReceived(
++      size_t index,
++      base::WeakPtr<content::WebContents> web_contents,
++      base::TimeTicks request_time,
++      ui::AXTreeUpdate& tree_update);
++  void OnSnapshotProcessed(size_t index, SnapshotProcessingResult result);
++
++  // Responds once every tab has its entry.
++  void OnTabDone();
++
++  // One entry per requested tab, in request order
++  std::vector<browser_os::TabInteractiveSnapshot> results_;
++  size_t pending_tabs_ = 0;
++
++  // Limits shared by every tab, plus its fair share of the thread pool
++  SnapshotOptions options_;
++};
++
++class BrowserOSStartInteractiveSnapshotStreamFunction
++    : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.startInteractiveSnapshotStream",
++                             BROWSER_OS_STARTINTERACTIVESNAPSHOTSTREAM)
++
++  BrowserOSStartInteractiveSnapshotStreamFunction() = default;
++
++ protected:
++  ~BrowserOSStartInteractiveSnapshotStreamFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Runs after this function has responded, so it only touches the stream.
++  static void OnAccessibilityTreeReceived(
++      int stream_id,
++      int tab_id,
++      SnapshotOptions options,
++      base::WeakPtr<content::WebContents> web_contents,
++      ui::AXTreeUpdate& tree_update);
++};
++
++class BrowserOSReadInteractiveSnapshotStreamFunction
++    : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.readInteractiveSnapshotStream",
++                             BROWSER_OS_READINTERACTIVESNAPSHOTSTREAM)
++
++  BrowserOSReadInteractiveSnapshotStreamFunction() = default;
++
++ protected:
++  ~BrowserOSReadInteractiveSnapshotStreamFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnChunk(std::optional<browser_os::InteractiveSnapshotChunk> chunk);
++};
++
 +class BrowserOSClickFunction : public ExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.click", BROWSER_OS_CLICK)
@@ -221,7 +391,7 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +
 + private:
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnPageIndexReady(scoped_refptr<const browseros::PageTextIndex> index);
 +};
 +
 +// Settings API functions
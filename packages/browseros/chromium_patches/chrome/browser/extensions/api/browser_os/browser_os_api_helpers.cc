@@ -1,22 +1,35 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
 new file mode 100644
-index 0000000000000..f40a2424641e1
+index 0000000000000..b8d6620e6951b
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
-@@ -0,0 +1,1073 @@
+@@ -0,0 +1,1052 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +
++#include <functional>
++#include <optional>
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/memory/weak_ptr.h"
++#include "base/notreached.h"
++#include "base/run_loop.h"
 +#include "base/strings/string_number_conversions.h"
-+#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/task/sequenced_task_runner.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_helper_library.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h"
 +#include "components/input/native_web_keyboard_event.h"
++#include "content/browser/renderer_host/render_frame_host_impl.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "content/browser/renderer_host/render_widget_host_impl.h"
 +#include "content/public/browser/render_widget_host.h"
@@ -34,14 +47,20 @@ index 0000000000000..f40a2424641e1
 +#include "ui/events/keycodes/dom/dom_code.h"
 +#include "ui/events/keycodes/dom/dom_key.h"
 +#include "ui/events/keycodes/keyboard_codes.h"
++#include "ui/gfx/geometry/point_conversions.h"
 +#include "ui/gfx/geometry/point_f.h"
 +#include "ui/gfx/range/range.h"
 +#include "ui/accessibility/ax_action_data.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/platform/ax_platform_tree_manager.h"
++#include "ui/accessibility/platform/browser_accessibility_manager.h"
 +
 +namespace extensions {
 +namespace api {
 +
++using browseros::HitTestResult;
++
 +// Compute CSS->widget scale matching DevTools InputHandler::ScaleFactor.
 +// We intentionally exclude device scale factor (DSF). Widget coordinates
 +// used by input are in DIPs; DSF is handled by the compositor. We also set
@@ -136,62 +155,10 @@ index 0000000000000..f40a2424641e1
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+    
-+  // Build the JavaScript to find and click the element
-+  std::u16string js_code = u"(function() {";
-+  
-+  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.click();";
-+    js_code += u"    return 'clicked by id';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
-+  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    // Split class names and create selector
-+    std::string class_selector = "." + class_it->second;
-+    // Replace spaces with dots for multiple classes
-+    for (size_t i = 0; i < class_selector.length(); ++i) {
-+      if (class_selector[i] == ' ') {
-+        class_selector[i] = '.';
-+      }
-+    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].click();";
-+    js_code += u"    return 'clicked by class and tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].click();";
-+    js_code += u"    return 'clicked by tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
-+  rfh->ExecuteJavaScriptForTests(
-+      js_code,
-+      base::NullCallback(),
-+      /*honor_js_content_settings=*/false);
++
++  BrowserOSHelperLibrary::Call(
++      rfh, "click",
++      base::Value::List().Append(BrowserOSHelperLibrary::TargetFor(node_info)));
 +}
 +
 +// Helper to perform HTML-based focus using JS (uses ID, class, or tag)
@@ -200,65 +167,10 @@ index 0000000000000..f40a2424641e1
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+    
-+  // Build the JavaScript to find and focus the element
-+  std::u16string js_code = u"(function() {";
-+  
-+  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.focus();";
-+    js_code += u"    if (element.select) element.select();";  // Select text if possible
-+    js_code += u"    return 'focused by id';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
-+  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    // Split class names and create selector
-+    std::string class_selector = "." + class_it->second;
-+    // Replace spaces with dots for multiple classes
-+    for (size_t i = 0; i < class_selector.length(); ++i) {
-+      if (class_selector[i] == ' ') {
-+        class_selector[i] = '.';
-+      }
-+    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].focus();";
-+    js_code += u"    if (elements[0].select) elements[0].select();";
-+    js_code += u"    return 'focused by class and tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].focus();";
-+    js_code += u"    if (elements[0].select) elements[0].select();";
-+    js_code += u"    return 'focused by tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
-+  rfh->ExecuteJavaScriptForTests(
-+      js_code,
-+      base::NullCallback(),
-+      /*honor_js_content_settings=*/false);
++
++  BrowserOSHelperLibrary::Call(
++      rfh, "focus",
++      base::Value::List().Append(BrowserOSHelperLibrary::TargetFor(node_info)));
 +}
 +
 +// Helper to perform scroll actions using mouse wheel events
@@ -480,67 +392,68 @@ index 0000000000000..f40a2424641e1
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+  
-+  // Build JavaScript to find element and set its value
-+  std::u16string js_code = u"(function() {";
-+  std::u16string escaped_text = base::UTF8ToUTF16(text);
-+  
-+  // Escape quotes in the text
-+  for (size_t i = 0; i < escaped_text.length(); ++i) {
-+    if (escaped_text[i] == u'\'') {
-+      escaped_text.insert(i, u"\\");
-+      i++;
-+    }
++
++  BrowserOSHelperLibrary::Call(
++      rfh, "type",
++      base::Value::List()
++          .Append(BrowserOSHelperLibrary::TargetFor(node_info))
++          .Append(text));
++}
++
++namespace {
++
++// Points |action_data| at |node_info|'s node in the main frame's live
++// accessibility tree. Snapshot AX ids are renumbered by the tree combiner and
++// mean nothing to the renderer, so the node is found by its DOM node id.
++// Returns false, and the action must not be sent, if renderer accessibility
++// is off or the node is gone.
++bool SetLiveAXTarget(content::WebContents* web_contents,
++                     const NodeInfo& node_info,
++                     ui::AXActionData* action_data) {
++  ui::AXNode* node = FindLiveAXNode(web_contents, node_info);
++  if (!node) {
++    LOG(WARNING) << "[browseros] No live accessibility node for DOM node "
++                 << node_info.dom_node_id;
++    return false;
 +  }
-+  
-+  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.value = '" + escaped_text + u"';";
-+    js_code += u"    element.dispatchEvent(new Event('input', {bubbles: true}));";
-+    js_code += u"    element.dispatchEvent(new Event('change', {bubbles: true}));";
-+    js_code += u"    return 'set by id';";
-+    js_code += u"  }";
++  action_data->target_node_id = node->id();
++  action_data->target_tree_id = node->tree()->GetAXTreeID();
++  return true;
++}
++
++}  // namespace
++
++ui::AXNode* FindLiveAXNode(content::WebContents* web_contents,
++                           const NodeInfo& node_info) {
++  if (node_info.dom_node_id == 0) {
++    return nullptr;
 +  }
-+  
-+  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
-+  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    std::string class_selector = "." + class_it->second;
-+    for (size_t i = 0; i < class_selector.length(); ++i) {
-+      if (class_selector[i] == ' ') {
-+        class_selector[i] = '.';
-+      }
++  auto* rfh = static_cast<content::RenderFrameHostImpl*>(
++      web_contents->GetPrimaryMainFrame());
++  // A node from another frame may share its DOM node id with an unrelated
++  // main-frame node, so it is never looked up here.
++  if (!rfh || node_info.frame_tree_id != rfh->GetAXTreeID()) {
++    return nullptr;
++  }
++  ui::BrowserAccessibilityManager* manager =
++      rfh->browser_accessibility_manager();
++  ui::AXNode* root = manager ? manager->GetRoot() : nullptr;
++  if (!root) {
++    return nullptr;
++  }
++  std::vector<ui::AXNode*> stack = {root};
++  while (!stack.empty()) {
++    ui::AXNode* node = stack.back();
++    stack.pop_back();
++    if (node->GetIntAttribute(ax::mojom::IntAttribute::kDOMNodeId) ==
++        node_info.dom_node_id) {
++      return node;
++    }
++    for (ui::AXNode* child : node->children()) {
++      stack.push_back(child);
 +    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    if (elements[0].value !== undefined) {";
-+    js_code += u"      elements[0].value = '" + escaped_text + u"';";
-+    js_code += u"    } else if (elements[0].isContentEditable) {";
-+    js_code += u"      elements[0].textContent = '" + escaped_text + u"';";
-+    js_code += u"    }";
-+    js_code += u"    elements[0].dispatchEvent(new Event('input', {bubbles: true}));";
-+    js_code += u"    elements[0].dispatchEvent(new Event('change', {bubbles: true}));";
-+    js_code += u"    return 'set by class and tag';";
-+    js_code += u"  }";
 +  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
-+  rfh->ExecuteJavaScriptForTests(
-+      js_code,
-+      base::NullCallback(),
-+      /*honor_js_content_settings=*/false);
++  return nullptr;
 +}
 +
 +// Helper to perform accessibility action: DoDefault (click)
@@ -554,11 +467,12 @@ index 0000000000000..f40a2424641e1
 +  
 +  ui::AXActionData action_data;
 +  action_data.action = ax::mojom::Action::kDoDefault;
-+  action_data.target_node_id = node_info.ax_node_id;
-+  action_data.target_tree_id = node_info.ax_tree_id;
++  if (!SetLiveAXTarget(web_contents, node_info, &action_data)) {
++    return false;
++  }
 +  
 +  LOG(INFO) << "[browseros] Performing AccessibilityDoDefault on node " 
-+            << node_info.ax_node_id;
++            << action_data.target_node_id;
 +  
 +  rfh->AccessibilityPerformAction(action_data);
 +  return true;
@@ -575,11 +489,12 @@ index 0000000000000..f40a2424641e1
 +  
 +  ui::AXActionData action_data;
 +  action_data.action = ax::mojom::Action::kFocus;
-+  action_data.target_node_id = node_info.ax_node_id;
-+  action_data.target_tree_id = node_info.ax_tree_id;
++  if (!SetLiveAXTarget(web_contents, node_info, &action_data)) {
++    return false;
++  }
 +  
 +  LOG(INFO) << "[browseros] Performing AccessibilityFocus on node " 
-+            << node_info.ax_node_id;
++            << action_data.target_node_id;
 +  
 +  rfh->AccessibilityPerformAction(action_data);
 +  return true;
@@ -597,8 +512,9 @@ index 0000000000000..f40a2424641e1
 +  
 +  ui::AXActionData action_data;
 +  action_data.action = ax::mojom::Action::kScrollToMakeVisible;
-+  action_data.target_node_id = node_info.ax_node_id;
-+  action_data.target_tree_id = node_info.ax_tree_id;
++  if (!SetLiveAXTarget(web_contents, node_info, &action_data)) {
++    return false;
++  }
 +  
 +  // Center the element in viewport for better visibility
 +  if (center_in_viewport) {
@@ -613,73 +529,262 @@ index 0000000000000..f40a2424641e1
 +  action_data.scroll_behavior = ax::mojom::ScrollBehavior::kScrollIfVisible;
 +  
 +  LOG(INFO) << "[browseros] Performing AccessibilityScrollToMakeVisible on node " 
-+            << node_info.ax_node_id;
++            << action_data.target_node_id;
 +  
 +  rfh->AccessibilityPerformAction(action_data);
 +  return true;
 +}
 +
++namespace {
++
++// How long a hit test may take before the click goes ahead without it.
++constexpr base::TimeDelta kHitTestTimeout = base::Milliseconds(50);
++
++// Collects one AccessibilityHitTest reply. Bound through a weak pointer so a
++// reply arriving after the timeout is dropped.
++class HitTestWaiter {
++ public:
++  HitTestWaiter(const NodeInfo& node_info,
++                ui::AXTreeID main_frame_tree_id,
++                base::OnceClosure quit)
++      : node_info_(node_info),
++        main_frame_tree_id_(main_frame_tree_id),
++        quit_(std::move(quit)) {}
++
++  HitTestResult result() const { return result_; }
++
++  void OnHitTest(ui::AXPlatformTreeManager* hit_manager,
++                 ui::AXNodeID hit_node_id) {
++    result_ = Classify(hit_manager, hit_node_id);
++    std::move(quit_).Run();
++  }
++
++  base::WeakPtr<HitTestWaiter> GetWeakPtr() {
++    return weak_factory_.GetWeakPtr();
++  }
++
++ private:
++  HitTestResult Classify(ui::AXPlatformTreeManager* hit_manager,
++                         ui::AXNodeID hit_node_id) const {
++    if (!hit_manager || hit_node_id == ui::kInvalidAXNodeID) {
++      return HitTestResult::kUnknown;
++    }
++    // The other helpers act on the main frame, so a point landing in a
++    // child frame (an embedded banner or dialog) does not reach the node.
++    if (hit_manager->GetTreeID() != main_frame_tree_id_) {
++      return HitTestResult::kObscured;
++    }
++    // The hit comes from the live tree, whose AX ids have nothing to do with
++    // the snapshot's, so the two are matched by DOM node id.
++    std::vector<int32_t> hit_dom_node_ids;
++    for (ui::AXNode* node = hit_manager->GetNode(hit_node_id); node;
++         node = node->parent()) {
++      hit_dom_node_ids.push_back(
++          node->GetIntAttribute(ax::mojom::IntAttribute::kDOMNodeId));
++    }
++    return browseros::ClassifyHit(node_info_.dom_node_id, hit_dom_node_ids);
++  }
++
++  const NodeInfo& node_info_;
++  const ui::AXTreeID main_frame_tree_id_;
++  base::OnceClosure quit_;
++  HitTestResult result_ = HitTestResult::kUnknown;
++  base::WeakPtrFactory<HitTestWaiter> weak_factory_{this};
++};
++
++// Picks where to click |node_info|: the center if it reaches the node,
++// otherwise the first inset point that does. Returns false if every
++// candidate is covered.
++bool FindClickPoint(content::WebContents* web_contents,
++                    const NodeInfo& node_info,
++                    gfx::PointF* point,
++                    bool* shifted) {
++  std::optional<browseros::ClickPoint> choice = browseros::ChooseClickPoint(
++      GetNodeCenterPoint(web_contents, node_info), node_info.bounds,
++      [&](const gfx::PointF& candidate) {
++        HitTestResult result = HitTestNode(web_contents, node_info, candidate);
++        if (result == HitTestResult::kObscured) {
++          VLOG(1) << "[browseros] Click point " << candidate.ToString()
++                  << " is covered by another element";
++        }
++        return result;
++      });
++  if (!choice) {
++    return false;
++  }
++  *point = choice->point;
++  *shifted = choice->shifted;
++  return true;
++}
++
++// Runs one strategy of |action| under change detection and tells the
++// strategy cache whether it changed the page.
++bool TryStrategy(content::WebContents* web_contents,
++                 StrategyAction action,
++                 const NodeInfo& node_info,
++                 const std::string& strategy,
++                 std::function<void()> run,
++                 base::TimeDelta timeout) {
++  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
++      web_contents, std::move(run), timeout);
++  BrowserOSStrategyCache::Record(web_contents, action, node_info, strategy,
++                                 changed);
++  return changed;
++}
++
++}  // namespace
++
++const char* ClickStrategyToString(ClickStrategy strategy) {
++  switch (strategy) {
++    case ClickStrategy::kPoint:
++      return "point";
++    case ClickStrategy::kShiftedPoint:
++      return "shiftedPoint";
++    case ClickStrategy::kAccessibility:
++      return "accessibility";
++    case ClickStrategy::kHtml:
++      return "html";
++  }
++  NOTREACHED();
++}
++
++HitTestResult HitTestNode(content::WebContents* web_contents,
++                          const NodeInfo& node_info,
++                          const gfx::PointF& point) {
++  auto* rfh = static_cast<content::RenderFrameHostImpl*>(
++      web_contents->GetPrimaryMainFrame());
++  // Hits are matched by DOM node id in the main frame, which says nothing
++  // about a node in another frame.
++  if (!rfh || node_info.frame_tree_id != rfh->GetAXTreeID()) {
++    return HitTestResult::kUnknown;
++  }
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  content::RenderWidgetHostView* rwhv = rwh ? rwh->GetView() : nullptr;
++  if (!rwhv) {
++    return HitTestResult::kUnknown;
++  }
++
++  // Unlike input events, AX hit tests take frame pixels, which include DSF.
++  const float scale =
++      CssToWidgetScale(web_contents, rwh) * rwhv->GetDeviceScaleFactor();
++  const gfx::Point frame_point =
++      gfx::ToRoundedPoint(gfx::ScalePoint(point, scale));
++
++  base::RunLoop run_loop(base::RunLoop::Type::kNestableTasksAllowed);
++  HitTestWaiter waiter(node_info, rfh->GetAXTreeID(), run_loop.QuitClosure());
++  rfh->AccessibilityHitTest(
++      frame_point, ax::mojom::Event::kNone, /*opt_request_id=*/0,
++      base::BindOnce(&HitTestWaiter::OnHitTest, waiter.GetWeakPtr()));
++
++  base::OneShotTimer timeout_timer;
++  timeout_timer.Start(FROM_HERE, kHitTestTimeout, run_loop.QuitClosure());
++  run_loop.Run();
++  return waiter.result();
++}
++
 +// Helper to perform a click with change detection and retrying
 +bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info) {
-+  // Check if node is out of viewport and needs scrolling
-+  auto viewport_it = node_info.attributes.find("in_viewport");
-+  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
-+                              viewport_it->second == "false");
-+  
-+  if (is_out_of_viewport) {
-+    LOG(INFO) << "[browseros] Node is out of viewport, scrolling to make visible";
++                        const NodeInfo& node_info,
++                        ClickStrategy* strategy) {
++  ClickStrategy used = ClickStrategy::kAccessibility;
++  bool changed = false;
++  bool accessibility_tried = false;
++  bool html_tried = false;
++
++  auto try_accessibility = [&]() {
++    accessibility_tried = true;
++    // Without a live node the action is never sent; that says nothing about
++    // whether accessibility clicks work on this site, so nothing is learned.
++    if (!FindLiveAXNode(web_contents, node_info)) {
++      return false;
++    }
++    used = ClickStrategy::kAccessibility;
++    return TryStrategy(
++        web_contents, StrategyAction::kClick, node_info,
++        ClickStrategyToString(used),
++        [&]() { AccessibilityDoDefault(web_contents, node_info); },
++        base::Milliseconds(300));
++  };
++  auto try_html = [&]() {
++    used = ClickStrategy::kHtml;
++    html_tried = true;
++    return TryStrategy(
++        web_contents, StrategyAction::kClick, node_info,
++        ClickStrategyToString(used),
++        [&]() { HtmlClick(web_contents, node_info); },
++        base::Milliseconds(200));
++  };
++
++  // On sites where pointer clicks never register, start with what worked
++  // there before instead of waiting out the pointer click first.
++  std::optional<std::string> learned = BrowserOSStrategyCache::GetPreferred(
++      web_contents, StrategyAction::kClick, node_info);
++  if (learned == ClickStrategyToString(ClickStrategy::kAccessibility)) {
++    LOG(INFO) << "[browseros] Accessibility click worked here before, trying it first";
++    changed = try_accessibility();
++  } else if (learned == ClickStrategyToString(ClickStrategy::kHtml)) {
++    LOG(INFO) << "[browseros] HTML click worked here before, trying it first";
++    changed = try_html();
++  }
++
++  // A stale node may have moved since its bounds were recorded, so reach it
++  // through the live accessibility tree, where its DOM node id still finds it
++  const bool reach_stale_via_accessibility =
++      node_info.stale && FindLiveAXNode(web_contents, node_info);
++  if (!changed && reach_stale_via_accessibility) {
++    LOG(INFO) << "[browseros] Node bounds are stale, clicking via accessibility";
 +    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
-+    // Wait for scroll to complete
 +    base::PlatformThread::Sleep(base::Milliseconds(300));
-+    
-+    // For out-of-viewport nodes, use AccessibilityDoDefault first (most reliable after scroll)
-+    // LOG(INFO) << "[browseros] Node was out of viewport, trying AccessibilityDoDefault click first";
-+    // bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+    //     web_contents,
-+    //     [&]() { AccessibilityDoDefault(web_contents, node_info); },
-+    //     base::Milliseconds(300));
-+    
-+    gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+    
-+    bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+        web_contents,
-+        [&]() { PointClick(web_contents, click_point); },
-+        base::Milliseconds(300));
-+    
-+    if (!changed) {
-+      // Skip coordinate click for out-of-viewport nodes (coordinates unreliable)
-+      // Go straight to HTML click
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
++    if (!accessibility_tried) {
++      changed = try_accessibility();
++    }
++  } else if (!changed) {
++    // Check if node is out of viewport and needs scrolling
++    auto viewport_it = node_info.attributes.find("in_viewport");
++    bool is_out_of_viewport = (viewport_it != node_info.attributes.end() &&
++                               viewport_it->second == "false");
++    if (is_out_of_viewport) {
++      LOG(INFO) << "[browseros] Node is out of viewport, scrolling to make visible";
++      AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
++      // Wait for scroll to complete
++      base::PlatformThread::Sleep(base::Milliseconds(300));
++    }
++
++    // Check what the click would land on before paying a detection window
++    // for it. An overlay or sticky header over the center would otherwise
++    // swallow the click and only the fallback would reach the node.
++    gfx::PointF click_point;
++    bool shifted = false;
++    if (FindClickPoint(web_contents, node_info, &click_point, &shifted)) {
++      used = shifted ? ClickStrategy::kShiftedPoint : ClickStrategy::kPoint;
++      LOG(INFO) << "[browseros] Clicking node at " << click_point.ToString()
++                << (shifted ? " (center is covered)" : "");
++      // Both point strategies are learned as one: it is the page, not the
++      // point, that decides whether pointer clicks register.
++      changed = TryStrategy(
++          web_contents, StrategyAction::kClick, node_info,
++          ClickStrategyToString(ClickStrategy::kPoint),
++          [&]() { PointClick(web_contents, click_point); },
++          base::Milliseconds(300));
++    } else if (!accessibility_tried) {
++      LOG(INFO) << "[browseros] Node is covered at every click point, "
++                << "clicking via accessibility";
++      changed = try_accessibility();
 +    }
-+    
-+    LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
-+    return changed;
 +  }
-+  
-+  // For in-viewport nodes, try coordinate click first (most natural)
-+  LOG(INFO) << "[browseros] Node is in viewport, trying coordinate click first";
-+  gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+  
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() { PointClick(web_contents, click_point); },
-+      base::Milliseconds(300));
-+  
++
 +  // If still no change, try HTML click as final fallback
-+  if (!changed) {
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
++  if (!changed && !html_tried) {
++    LOG(INFO) << "[browseros] No change from "
++              << ClickStrategyToString(used) << " click, trying HTML click";
++    changed = try_html();
++  }
++
++  LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change")
++            << " via " << ClickStrategyToString(used);
++  if (strategy) {
++    *strategy = used;
 +  }
-+  
-+  LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
 +  return changed;
 +}
 +
@@ -695,12 +800,13 @@ index 0000000000000..f40a2424641e1
 +  
 +  ui::AXActionData action_data;
 +  action_data.action = ax::mojom::Action::kSetValue;
-+  action_data.target_node_id = node_info.ax_node_id;
-+  action_data.target_tree_id = node_info.ax_tree_id;
++  if (!SetLiveAXTarget(web_contents, node_info, &action_data)) {
++    return false;
++  }
 +  action_data.value = text;
 +  
 +  LOG(INFO) << "[browseros] Performing AccessibilitySetValue on node " 
-+            << node_info.ax_node_id << " with text: " << text;
++            << action_data.target_node_id << " with text: " << text;
 +  
 +  rfh->AccessibilityPerformAction(action_data);
 +  return true;
@@ -715,7 +821,8 @@ index 0000000000000..f40a2424641e1
 +  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
 +                              viewport_it->second == "false");
 +  
-+  if (is_out_of_viewport) {
++  // A stale node's viewport state is unknown, so scroll it into view anyway
++  if (is_out_of_viewport || node_info.stale) {
 +    LOG(INFO) << "[browseros] Node is out of viewport for typing, scrolling to make visible";
 +    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
 +    // Wait for scroll to complete
@@ -728,22 +835,28 @@ index 0000000000000..f40a2424641e1
 +  // Small delay to ensure focus is set
 +  base::PlatformThread::Sleep(base::Milliseconds(50));
 +  
-+  // Try native typing first (most natural method)
-+  LOG(INFO) << "[browseros] Trying native typing";
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() {
-+        NativeType(web_contents, text);
-+      },
-+      base::Milliseconds(300));
-+  
-+  // If no change detected, try JavaScript typing as second fallback
-+  if (!changed) {
-+    LOG(INFO) << "[browseros] No change from native typing, trying JavaScript";
-+    changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+        web_contents,
++  auto try_native = [&]() {
++    LOG(INFO) << "[browseros] Trying native typing";
++    return TryStrategy(
++        web_contents, StrategyAction::kType, node_info, "native",
++        [&]() { NativeType(web_contents, text); }, base::Milliseconds(300));
++  };
++  auto try_script = [&]() {
++    LOG(INFO) << "[browseros] Trying JavaScript typing";
++    return TryStrategy(
++        web_contents, StrategyAction::kType, node_info, "script",
 +        [&]() { JavaScriptType(web_contents, node_info, text); },
 +        base::Milliseconds(200));
++  };
++
++  // Native typing first (most natural method), unless JavaScript typing
++  // is what has worked on this site before
++  bool changed;
++  if (BrowserOSStrategyCache::GetPreferred(web_contents, StrategyAction::kType,
++                                           node_info) == "script") {
++    changed = try_script() || try_native();
++  } else {
++    changed = try_native() || try_script();
 +  }
 +  
 +  // If still no change, try accessibility SetValue as final fallback
@@ -764,35 +877,41 @@ index 0000000000000..f40a2424641e1
 +// Helper to clear an input field with change detection
 +bool ClearWithDetection(content::WebContents* web_contents,
 +                       const NodeInfo& node_info) {
-+  // Use change detection with JavaScript clear
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() {
-+        content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+        if (!rfh) return;
-+        
-+        // First focus the element
-+        HtmlFocus(web_contents, node_info);
-+        
-+        // Then clear using JavaScript
-+        rfh->ExecuteJavaScriptForTests(
-+            u"(function() {"
-+            u"  var activeElement = document.activeElement;"
-+            u"  if (activeElement) {"
-+            u"    if (activeElement.value !== undefined) {"
-+            u"      activeElement.value = '';"
-+            u"    }"
-+            u"    if (activeElement.textContent !== undefined && activeElement.isContentEditable) {"
-+            u"      activeElement.textContent = '';"
-+            u"    }"
-+            u"    activeElement.dispatchEvent(new Event('input', {bubbles: true}));"
-+            u"    activeElement.dispatchEvent(new Event('change', {bubbles: true}));"
-+            u"  }"
-+            u"})();",
-+            base::NullCallback(),
-+            /*honor_js_content_settings=*/false);
-+      },
-+      base::Milliseconds(200));
++  auto try_script = [&]() {
++    return TryStrategy(
++        web_contents, StrategyAction::kClear, node_info, "script",
++        [&]() {
++          content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++          if (!rfh) return;
++
++          // Focuses the element, then clears it
++          BrowserOSHelperLibrary::Call(
++              rfh, "clear",
++              base::Value::List().Append(
++                  BrowserOSHelperLibrary::TargetFor(node_info)));
++        },
++        base::Milliseconds(200));
++  };
++  // The script resolves the element by id, class or tag and can pick the
++  // wrong one; SetValue goes to the node itself
++  auto try_accessibility = [&]() {
++    if (!FindLiveAXNode(web_contents, node_info)) {
++      return false;
++    }
++    return TryStrategy(
++        web_contents, StrategyAction::kClear, node_info, "accessibility",
++        [&]() { AccessibilitySetValue(web_contents, node_info, std::string()); },
++        base::Milliseconds(200));
++  };
++
++  bool changed;
++  if (BrowserOSStrategyCache::GetPreferred(web_contents,
++                                           StrategyAction::kClear,
++                                           node_info) == "accessibility") {
++    changed = try_accessibility() || try_script();
++  } else {
++    changed = try_script() || try_accessibility();
++  }
 +  
 +  LOG(INFO) << "[browseros] Clear result: " << (changed ? "changed" : "no change");
 +  return changed;
@@ -850,146 +969,28 @@ index 0000000000000..f40a2424641e1
 +  LOG(INFO) << "[browseros] Highlighting " << filtered_nodes.size() 
 +            << " interactive elements in viewport (out of " << node_mappings.size() << " total)";
 +  
-+  // Use the original drawing implementation but with filtered nodes
-+  
-+  // Build JavaScript to draw all bounding boxes at once
-+  std::string js_code = R"(
-+    (function() {
-+      // Remove any existing bounding boxes
-+      document.querySelectorAll('.browseros-bbox').forEach(e => e.remove());
-+      
-+      // Create container for all bounding boxes
-+      const container = document.createElement('div');
-+      container.className = 'browseros-bbox-container';
-+      container.style.cssText = `
-+        position: fixed;
-+        top: 0;
-+        left: 0;
-+        width: 100%;
-+        height: 100%;
-+        pointer-events: none;
-+        z-index: 2147483647;
-+      `;
-+      
-+      // Node data with bounds
-+      const nodes = [
-+  )";
-+  
-+  // Add filtered nodes with their bounds
-+  bool first = true;
++  base::Value::List nodes;
 +  for (const auto& [node_id, node_info] : filtered_nodes) {
-+    if (!first) js_code += ",";
-+    first = false;
-+    
 +    // Bounds are already in CSS pixels from SnapshotProcessor
-+    js_code += base::StringPrintf(
-+        R"(
-+        {
-+          id: %d,
-+          x: %f,
-+          y: %f,
-+          width: %f,
-+          height: %f,
-+          role: "%s"
-+        })",
-+        node_id,
-+        node_info.bounds.x(),
-+        node_info.bounds.y(),
-+        node_info.bounds.width(),
-+        node_info.bounds.height(),
-+        node_info.attributes.count("role") ? node_info.attributes.at("role").c_str() : "unknown"
-+    );
++    nodes.Append(base::Value::Dict()
++                     .Set("id", static_cast<int>(node_id))
++                     .Set("x", node_info.bounds.x())
++                     .Set("y", node_info.bounds.y())
++                     .Set("width", node_info.bounds.width())
++                     .Set("height", node_info.bounds.height()));
 +  }
-+  
-+  js_code += R"(
-+      ];
-+      
-+      // Draw bounding boxes for all nodes in parallel
-+      nodes.forEach(node => {
-+        if (node.width <= 0 || node.height <= 0) return;
-+        
-+        const box = document.createElement('div');
-+        box.className = 'browseros-bbox';
-+        box.dataset.nodeId = node.id;
-+        box.style.cssText = `
-+          position: absolute;
-+          left: ${node.x}px;
-+          top: ${node.y}px;
-+          width: ${node.width}px;
-+          height: ${node.height}px;
-+          border: 2px solid #1E40AF;
-+          background: transparent;
-+          box-sizing: border-box;
-+        `;
-+  )";
-+  
-+  if (show_labels) {
-+    js_code += R"(
-+        // Add label with node ID
-+        const label = document.createElement('div');
-+        label.style.cssText = `
-+          position: absolute;
-+          top: -22px;
-+          left: 0;
-+          background: #2563EB;
-+          color: #FFFFFF;
-+          padding: 3px 7px;
-+          font-size: 14px;
-+          font-family: monospace;
-+          border-radius: 3px;
-+          white-space: nowrap;
-+          opacity: 0.9;
-+        `;
-+        label.textContent = node.id;
-+        box.appendChild(label);
-+    )";
-+  }
-+  
-+  js_code += R"(
-+        container.appendChild(box);
-+      });
-+      
-+      document.body.appendChild(container);
-+      
-+      // Return count for verification
-+      return nodes.length;
-+    })();
-+  )";
-+  
-+  // Execute the JavaScript
-+  rfh->ExecuteJavaScriptForTests(
-+      base::UTF8ToUTF16(js_code),
-+      base::NullCallback(),
-+      false);
++
++  BrowserOSHelperLibrary::Call(
++      rfh, "showHighlights",
++      base::Value::List().Append(std::move(nodes)).Append(show_labels));
 +}
 +
 +// Helper to remove all bounding box highlights from the page
 +void RemoveHighlights(content::WebContents* web_contents) {
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh) return;
-+  
-+  // JavaScript to remove all bounding box containers
-+  std::string js_code = R"(
-+    (function() {
-+      // Remove all bounding box containers
-+      document.querySelectorAll('.browseros-bbox-container').forEach(e => e.remove());
-+      document.querySelectorAll('.browseros-bbox').forEach(e => e.remove());
-+      
-+      // Remove all highlight containers  
-+      document.querySelectorAll('.browseros-highlight-container').forEach(e => e.remove());
-+      document.querySelectorAll('.browseros-highlight').forEach(e => e.remove());
-+      
-+      // Remove any style elements we added
-+      document.querySelectorAll('#browseros-highlight-styles').forEach(e => e.remove());
-+      
-+      return true;
-+    })();
-+  )";
-+  
-+  rfh->ExecuteJavaScriptForTests(
-+      base::UTF8ToUTF16(js_code),
-+      base::NullCallback(),
-+      false);
++
++  BrowserOSHelperLibrary::Call(rfh, "removeHighlights", base::Value::List());
 +}
 +
 +// Helper to click at specific coordinates with change detection
@@ -1039,30 +1040,8 @@ index 0000000000000..f40a2424641e1
 +    // Execute JavaScript to find the focused element and set its value
 +    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +    if (rfh) {
-+      std::string js_code = base::StringPrintf(R"(
-+        (function() {
-+          var focused = document.activeElement;
-+          if (focused && (focused.tagName === 'INPUT' || 
-+                         focused.tagName === 'TEXTAREA' || 
-+                         focused.contentEditable === 'true')) {
-+            if (focused.contentEditable === 'true') {
-+              focused.textContent = '%s';
-+            } else {
-+              focused.value = '%s';
-+            }
-+            // Trigger input event
-+            focused.dispatchEvent(new Event('input', { bubbles: true }));
-+            focused.dispatchEvent(new Event('change', { bubbles: true }));
-+            return true;
-+          }
-+          return false;
-+        })();
-+      )", text.c_str(), text.c_str());
-+      
-+      rfh->ExecuteJavaScriptForTests(
-+          base::UTF8ToUTF16(js_code),
-+          base::NullCallback(),
-+          false);
++      BrowserOSHelperLibrary::Call(rfh, "typeFocused",
++                                   base::Value::List().Append(text));
 +      
 +      // Give it a moment to register
 +      base::PlatformThread::Sleep(base::Milliseconds(50));
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
 new file mode 100644
-index 0000000000000..2000fa3235290
+index 0000000000000..f8e47c40206ca
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
-@@ -0,0 +1,137 @@
+@@ -0,0 +1,173 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -15,6 +15,7 @@ index 0000000000000..2000fa3235290
 +#include <unordered_map>
 +
 +#include "base/functional/callback.h"
++#include "chrome/browser/browseros/page_content/click_points.h"
 +#include "ui/gfx/geometry/point_f.h"
 +
 +namespace content {
@@ -22,6 +23,10 @@ index 0000000000000..2000fa3235290
 +class RenderWidgetHost;
 +}  // namespace content
 +
++namespace ui {
++class AXNode;
++}  // namespace ui
++
 +namespace extensions {
 +namespace api {
 +
@@ -52,6 +57,14 @@ index 0000000000000..2000fa3235290
 +void HtmlFocus(content::WebContents* web_contents,
 +                      const NodeInfo& node_info);
 +
++// Finds |node_info|'s node in the main frame's live accessibility tree by its
++// DOM node id. Returns nullptr if the node has no DOM node id, belongs to
++// another frame, renderer accessibility is off, or the node no longer
++// exists. The Accessibility*
++// helpers below act on this node and send nothing when there is none.
++ui::AXNode* FindLiveAXNode(content::WebContents* web_contents,
++                           const NodeInfo& node_info);
++
 +// Helper to perform accessibility action: DoDefault (click)
 +// Returns true if action was sent successfully
 +bool AccessibilityDoDefault(content::WebContents* web_contents,
@@ -95,10 +108,33 @@ index 0000000000000..2000fa3235290
 +                    const NodeInfo& node_info,
 +                    const std::string& text);
 +
-+// Helper to perform a click with change detection and retrying
-+// Returns true if the click caused a change in the page
++// How ClickWithDetection reached a node.
++enum class ClickStrategy {
++  kPoint,          // Mouse click at the node center.
++  kShiftedPoint,   // Mouse click at another point of the node, because
++                   // something else covers the center.
++  kAccessibility,  // AX DoDefault, because no point reaches the node.
++  kHtml,           // JS element.click() fallback.
++};
++
++// Returns the name reported to the extension, e.g. "shiftedPoint".
++const char* ClickStrategyToString(ClickStrategy strategy);
++
++// Asks the renderer which accessibility node is at |point| (CSS pixels) and
++// compares it with |node_info| by DOM node id. Blocks for at most a few tens
++// of ms.
++browseros::HitTestResult HitTestNode(content::WebContents* web_contents,
++                          const NodeInfo& node_info,
++                          const gfx::PointF& point);
++
++// Helper to perform a click with change detection and retrying.
++// Hit tests before clicking so a covered node is clicked at a point that
++// reaches it, or through accessibility if none does. Returns true if the
++// click caused a change in the page. |strategy|, if given, receives the
++// strategy that caused the change, or the last one tried.
 +bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info);
++                        const NodeInfo& node_info,
++                        ClickStrategy* strategy = nullptr);
 +
 +// Helper to perform typing with change detection
 +// Returns true if the typing caused a change in the page
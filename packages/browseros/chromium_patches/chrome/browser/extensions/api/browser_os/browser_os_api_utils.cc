@@ -1,19 +1,22 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
 new file mode 100644
-index 0000000000000..0c3a060fc70de
+index 0000000000000..3d397f42f32f8
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
-@@ -0,0 +1,167 @@
+@@ -0,0 +1,228 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +
++#include <algorithm>
++
 +#include "base/hash/hash.h"
 +#include "base/no_destructor.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
@@ -42,11 +45,69 @@ index 0000000000000..0c3a060fc70de
 +  return *g_node_id_mappings;
 +}
 +
++std::unordered_map<int, browseros::StableNodeIds>& GetTabNodeIds() {
++  static base::NoDestructor<std::unordered_map<int, browseros::StableNodeIds>>
++      g_tab_node_ids;
++  return *g_tab_node_ids;
++}
++
++namespace {
++
++std::unordered_map<int, std::unique_ptr<browseros::NodeQueryIndex>>&
++GetNodeQueryIndexes() {
++  static base::NoDestructor<
++      std::unordered_map<int, std::unique_ptr<browseros::NodeQueryIndex>>>
++      g_node_query_indexes;
++  return *g_node_query_indexes;
++}
++
++}  // namespace
++
++const browseros::NodeQueryIndex& GetNodeQueryIndex(int tab_id) {
++  std::unique_ptr<browseros::NodeQueryIndex>& index =
++      GetNodeQueryIndexes()[tab_id];
++  if (index) {
++    return *index;
++  }
++
++  // Ids are handed out in the order nodes are first seen, so sorting by id
++  // gives results a stable, roughly document order.
++  std::vector<browseros::QueryableNode> nodes;
++  for (const auto& [node_id, info] : GetNodeIdMappings()[tab_id]) {
++    browseros::QueryableNode& node = nodes.emplace_back();
++    node.node_id = node_id;
++    auto role = info.attributes.find("role");
++    if (role != info.attributes.end()) {
++      node.role = role->second;
++    }
++    node.name = info.name;
++    node.attributes = info.attributes;
++    node.bounds = info.bounds;
++    // A stale node's viewport state predates the last snapshot.
++    node.in_viewport = info.in_viewport && !info.stale;
++  }
++  std::sort(nodes.begin(), nodes.end(),
++            [](const browseros::QueryableNode& a,
++               const browseros::QueryableNode& b) {
++              return a.node_id < b.node_id;
++            });
++  index = std::make_unique<browseros::NodeQueryIndex>(std::move(nodes));
++  return *index;
++}
++
++void InvalidateNodeQueryIndex(int tab_id) {
++  GetNodeQueryIndexes().erase(tab_id);
++}
++
 +std::optional<TabInfo> GetTabFromOptionalId(
 +    std::optional<int> tab_id_param,
 +    content::BrowserContext* browser_context,
 +    bool include_incognito_information,
 +    std::string* error_message) {
++  // Every page-acting browserOS call resolves its tab here, so this is where
++  // an agent task shows up as activity for the worker keepalive.
++  browseros::BrowserOSWorkerKeepalive::NotifyAgentActivity(browser_context);
++
 +  content::WebContents* web_contents = nullptr;
 +  int tab_id = -1;
 +  
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
 new file mode 100644
-index 0000000000000..f4fdcb73186cd
+index 0000000000000..318bfcd815e67
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
-@@ -0,0 +1,80 @@
+@@ -0,0 +1,104 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,12 +11,15 @@ index 0000000000000..f4fdcb73186cd
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_UTILS_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_UTILS_H_
 +
++#include <memory>
 +#include <optional>
 +#include <string>
 +#include <unordered_map>
 +
 +#include "base/memory/raw_ptr.h"
 +#include "base/values.h"
++#include "chrome/browser/browseros/page_content/node_query_index.h"
++#include "chrome/browser/browseros/page_content/stable_node_ids.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_tree_id.h"
@@ -52,18 +55,39 @@ index 0000000000000..f4fdcb73186cd
 +  NodeInfo(NodeInfo&&);
 +  NodeInfo& operator=(NodeInfo&&);
 +
++  // Id in the snapshot's combined tree. The combiner renumbers nodes on
++  // every snapshot, so this is not the renderer's id for the node; AX
++  // actions look the node up by |dom_node_id| instead.
 +  int32_t ax_node_id;
 +  ui::AXTreeID ax_tree_id;  // Tree ID for change detection
++  int32_t dom_node_id = 0;  // Blink DOM node id, 0 if the node has none
++  // Tree of the frame that owns the node. DOM node ids are only unique
++  // within a renderer, so live lookups are limited to the main frame's.
++  ui::AXTreeID frame_tree_id;
 +  gfx::RectF bounds;  // Absolute bounds in CSS pixels
 +  std::unordered_map<std::string, std::string> attributes;  // All computed attributes
 +  browser_os::InteractiveNodeType node_type;  // Cached node type to avoid recomputation
 +  bool in_viewport;  // Whether the node is currently visible in viewport
++  // Set when a later snapshot did not include the node. It is still alive,
++  // but its bounds and attributes may be out of date.
++  bool stale = false;
++  std::string name;  // Accessible name, for findNodes
 +};
 +
 +// Global node ID mappings storage
 +std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>& 
 +GetNodeIdMappings();
 +
++// Global stable node id storage, keyed by tab id
++std::unordered_map<int, browseros::StableNodeIds>& GetTabNodeIds();
++
++// Returns the findNodes index over |tab_id|'s node mappings, building it on
++// first use after the mappings changed.
++const browseros::NodeQueryIndex& GetNodeQueryIndex(int tab_id);
++
++// Drops |tab_id|'s findNodes index; called whenever its mappings change.
++void InvalidateNodeQueryIndex(int tab_id);
++
 +// Helper to get WebContents and tab ID from optional tab_id parameter
 +// Returns nullptr if tab is not found, with error message set
 +std::optional<TabInfo> GetTabFromOptionalId(
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
 new file mode 100644
-index 0000000000000..ea45bebcce461
+index 0000000000000..345774c77c32f
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
-@@ -0,0 +1,205 @@
+@@ -0,0 +1,208 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,6 +13,7 @@ index 0000000000000..ea45bebcce461
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/run_loop.h"
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
 +#include "content/public/browser/focused_node_details.h"
 +#include "content/public/browser/navigation_handle.h"
 +#include "content/public/browser/render_frame_host.h"
@@ -61,6 +62,7 @@ index 0000000000000..ea45bebcce461
 +  
 +  // Execute the action
 +  action();
++  browseros::PageContentCache::Invalidate(web_contents());
 +  
 +  // If change already detected (synchronously), return immediately
 +  if (change_detected_) {
@@ -98,6 +100,7 @@ index 0000000000000..ea45bebcce461
 +  
 +  // Execute the action
 +  action();
++  browseros::PageContentCache::Invalidate(web_contents());
 +  
 +  // If change already detected, notify immediately
 +  if (change_detected_) {
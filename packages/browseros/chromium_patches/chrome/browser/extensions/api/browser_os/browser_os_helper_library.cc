@@ -0,0 +1,277 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_helper_library.cc b/chrome/browser/extensions/api/browser_os/browser_os_helper_library.cc
+new file mode 100644
+index 0000000000000..8519704b8bd21
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_helper_library.cc
+@@ -0,0 +1,271 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_helper_library.h"
++
++#include <string>
++#include <utility>
++
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/common/chrome_isolated_world_ids.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Everything before and after the version number of the library script.
++// Installing is a no-op when the same version is already there.
++constexpr char kLibraryPrefix[] = R"((() => {
++  const VERSION = )";
++
++constexpr char kLibrarySuffix[] = R"(;
++  if (globalThis.__browserosHelpers?.version === VERSION) {
++    return;
++  }
++
++  // The element a snapshot node most likely is: the one with its id, else
++  // the tag/class candidate whose box is closest to the node's bounds.
++  function resolve(target) {
++    if (target.id) {
++      const element = document.getElementById(target.id);
++      if (element) {
++        return element;
++      }
++    }
++    if (!target.tag) {
++      return null;
++    }
++    let candidates = [];
++    if (target.className) {
++      let selector = CSS.escape(target.tag);
++      for (const name of target.className.split(/\s+/)) {
++        if (name) {
++          selector += '.' + CSS.escape(name);
++        }
++      }
++      candidates = document.querySelectorAll(selector);
++    }
++    if (candidates.length === 0) {
++      candidates = document.getElementsByTagName(target.tag);
++    }
++    if (candidates.length <= 1 || !target.bounds) {
++      return candidates[0] ?? null;
++    }
++    const b = target.bounds;
++    let best = null;
++    let bestDistance = Infinity;
++    for (const candidate of candidates) {
++      const r = candidate.getBoundingClientRect();
++      const distance = Math.abs(r.x - b.x) + Math.abs(r.y - b.y) +
++          Math.abs(r.width - b.width) + Math.abs(r.height - b.height);
++      if (distance < bestDistance) {
++        best = candidate;
++        bestDistance = distance;
++      }
++    }
++    return best;
++  }
++
++  function setText(element, text) {
++    if (element.value !== undefined) {
++      element.value = text;
++    } else if (element.isContentEditable) {
++      element.textContent = text;
++    }
++    element.dispatchEvent(new Event('input', {bubbles: true}));
++    element.dispatchEvent(new Event('change', {bubbles: true}));
++  }
++
++  function removeHighlights() {
++    document.querySelectorAll(
++        '.browseros-bbox-container, .browseros-bbox, ' +
++        '.browseros-highlight-container, .browseros-highlight, ' +
++        '#browseros-highlight-styles').forEach(e => e.remove());
++  }
++
++  globalThis.__browserosHelpers = {
++    version: VERSION,
++
++    click(target) {
++      const element = resolve(target);
++      if (!element) {
++        return 'no element found';
++      }
++      element.click();
++      return 'clicked';
++    },
++
++    focus(target) {
++      const element = resolve(target);
++      if (!element) {
++        return 'no element found';
++      }
++      element.focus();
++      if (element.select) {
++        element.select();
++      }
++      return 'focused';
++    },
++
++    type(target, text) {
++      const element = resolve(target);
++      if (!element) {
++        return 'no element found';
++      }
++      setText(element, text);
++      return 'set';
++    },
++
++    clear(target) {
++      const element = resolve(target);
++      if (!element) {
++        return 'no element found';
++      }
++      element.focus();
++      setText(element, '');
++      return 'cleared';
++    },
++
++    // Sets the text of the focused editable element, if there is one.
++    typeFocused(text) {
++      const element = document.activeElement;
++      if (!element || !(element.tagName === 'INPUT' ||
++                        element.tagName === 'TEXTAREA' ||
++                        element.isContentEditable)) {
++        return false;
++      }
++      setText(element, text);
++      return true;
++    },
++
++    // |nodes| holds {id, x, y, width, height} in CSS pixels.
++    showHighlights(nodes, showLabels) {
++      removeHighlights();
++      const container = document.createElement('div');
++      container.className = 'browseros-bbox-container';
++      container.style.cssText = `
++        position: fixed;
++        top: 0;
++        left: 0;
++        width: 100%;
++        height: 100%;
++        pointer-events: none;
++        z-index: 2147483647;
++      `;
++      for (const node of nodes) {
++        if (node.width <= 0 || node.height <= 0) {
++          continue;
++        }
++        const box = document.createElement('div');
++        box.className = 'browseros-bbox';
++        box.dataset.nodeId = node.id;
++        box.style.cssText = `
++          position: absolute;
++          left: ${node.x}px;
++          top: ${node.y}px;
++          width: ${node.width}px;
++          height: ${node.height}px;
++          border: 2px solid #1E40AF;
++          background: transparent;
++          box-sizing: border-box;
++        `;
++        if (showLabels) {
++          const label = document.createElement('div');
++          label.style.cssText = `
++            position: absolute;
++            top: -22px;
++            left: 0;
++            background: #2563EB;
++            color: #FFFFFF;
++            padding: 3px 7px;
++            font-size: 14px;
++            font-family: monospace;
++            border-radius: 3px;
++            white-space: nowrap;
++            opacity: 0.9;
++          `;
++          label.textContent = node.id;
++          box.appendChild(label);
++        }
++        container.appendChild(box);
++      }
++      document.body.appendChild(container);
++      return nodes.length;
++    },
++
++    removeHighlights() {
++      removeHighlights();
++      return true;
++    },
++  };
++})();
++)";
++
++}  // namespace
++
++DOCUMENT_USER_DATA_KEY_IMPL(BrowserOSHelperLibrary);
++
++BrowserOSHelperLibrary::BrowserOSHelperLibrary(content::RenderFrameHost* rfh)
++    : DocumentUserData(rfh) {}
++
++BrowserOSHelperLibrary::~BrowserOSHelperLibrary() = default;
++
++// static
++void BrowserOSHelperLibrary::Call(
++    content::RenderFrameHost* rfh,
++    std::string_view function,
++    base::Value::List args,
++    content::RenderFrameHost::JavaScriptResultCallback callback) {
++  GetOrCreateForCurrentDocument(rfh)->EnsureInjected();
++
++  std::string json_args;
++  base::JSONWriter::Write(args, &json_args);
++  // Optional chaining keeps a document that lost the library (a crashed
++  // and restored renderer) from throwing; the call is just dropped.
++  std::string call = base::StrCat(
++      {"globalThis.__browserosHelpers?.", function, "(...", json_args, ");"});
++  rfh->ExecuteJavaScriptInIsolatedWorld(base::UTF8ToUTF16(call),
++                                        std::move(callback),
++                                        ISOLATED_WORLD_ID_BROWSEROS);
++}
++
++// static
++base::Value::Dict BrowserOSHelperLibrary::TargetFor(const NodeInfo& node_info) {
++  base::Value::Dict target;
++  for (const auto& [attribute, key] :
++       {std::pair("id", "id"), std::pair("html-tag", "tag"),
++        std::pair("class", "className")}) {
++    auto it = node_info.attributes.find(attribute);
++    if (it != node_info.attributes.end() && !it->second.empty()) {
++      target.Set(key, it->second);
++    }
++  }
++  target.Set("bounds", base::Value::Dict()
++                           .Set("x", node_info.bounds.x())
++                           .Set("y", node_info.bounds.y())
++                           .Set("width", node_info.bounds.width())
++                           .Set("height", node_info.bounds.height()));
++  return target;
++}
++
++void BrowserOSHelperLibrary::EnsureInjected() {
++  if (injected_) {
++    return;
++  }
++  injected_ = true;
++  VLOG(1) << "[browseros] Injecting helper library v" << kVersion;
++  render_frame_host().ExecuteJavaScriptInIsolatedWorld(
++      base::UTF8ToUTF16(base::StrCat(
++          {kLibraryPrefix, base::NumberToString(kVersion), kLibrarySuffix})),
++      base::NullCallback(), ISOLATED_WORLD_ID_BROWSEROS);
++}
++
++}  // namespace api
++}  // namespace extensions
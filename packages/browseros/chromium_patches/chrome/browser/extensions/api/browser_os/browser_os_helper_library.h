@@ -0,0 +1,76 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_helper_library.h b/chrome/browser/extensions/api/browser_os/browser_os_helper_library.h
+new file mode 100644
+index 0000000000000..fce3bc107036f
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_helper_library.h
+@@ -0,0 +1,70 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_HELPER_LIBRARY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_HELPER_LIBRARY_H_
++
++#include <string_view>
++
++#include "base/values.h"
++#include "content/public/browser/document_user_data.h"
++#include "content/public/browser/render_frame_host.h"
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// The page-side half of the HTML fallbacks (click, focus, type, clear,
++// highlights). The script is compiled once per document, in an isolated
++// world, and each action then sends only a short call with JSON arguments:
++//   __browserosHelpers.click(...[{"id": "submit", "tag": "button", ...}])
++// The isolated world keeps the page from seeing or patching the helpers,
++// and the helpers from touching the page's globals, while the DOM and its
++// events are shared. Arguments go through base::WriteJson, so text and
++// selectors need no escaping on the C++ side.
++//
++// The page cannot be asked for an element by AX or DOM node id, so the
++// library resolves a snapshot node from its id attribute or, failing that,
++// picks the tag/class candidate whose box is closest to the node's bounds.
++class BrowserOSHelperLibrary
++    : public content::DocumentUserData<BrowserOSHelperLibrary> {
++ public:
++  // Bumped whenever the script changes. The script checks it itself, so
++  // installing the same version twice into one document is a no-op.
++  static constexpr int kVersion = 1;
++
++  ~BrowserOSHelperLibrary() override;
++
++  BrowserOSHelperLibrary(const BrowserOSHelperLibrary&) = delete;
++  BrowserOSHelperLibrary& operator=(const BrowserOSHelperLibrary&) = delete;
++
++  // Calls |function| of the library in |rfh|'s current document with
++  // |args|, injecting the library first if the document does not have it.
++  // Calls to one frame run in the order they are made.
++  static void Call(content::RenderFrameHost* rfh,
++                   std::string_view function,
++                   base::Value::List args,
++                   content::RenderFrameHost::JavaScriptResultCallback callback =
++                       base::NullCallback());
++
++  // The argument the library's resolve() takes for |node_info|.
++  static base::Value::Dict TargetFor(const NodeInfo& node_info);
++
++ private:
++  friend DocumentUserData;
++  DOCUMENT_USER_DATA_KEY_DECL();
++
++  explicit BrowserOSHelperLibrary(content::RenderFrameHost* rfh);
++
++  // Sends the library unless this document already got it.
++  void EnsureInjected();
++
++  bool injected_ = false;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_HELPER_LIBRARY_H_
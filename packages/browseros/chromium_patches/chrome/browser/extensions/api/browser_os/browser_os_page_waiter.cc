@@ -0,0 +1,230 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.cc
+new file mode 100644
+index 0000000000000..6ad0d62033768
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.cc
+@@ -0,0 +1,224 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_waiter.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_util.h"
++#include "chrome/browser/browseros/page_content/snapshot_context_index.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// What node and text waits need from the renderer's accessibility tree.
++constexpr ui::AXMode kWaitAXMode(ui::AXMode::kWebContents |
++                                 ui::AXMode::kExtendedProperties);
++
++bool WaitsForTree(BrowserOSPageWaiter::Condition condition) {
++  return condition == BrowserOSPageWaiter::Condition::kNode ||
++         condition == BrowserOSPageWaiter::Condition::kText;
++}
++
++}  // namespace
++
++BrowserOSPageWaiter::Params::Params() = default;
++BrowserOSPageWaiter::Params::~Params() = default;
++BrowserOSPageWaiter::Params::Params(Params&&) = default;
++BrowserOSPageWaiter::Params& BrowserOSPageWaiter::Params::operator=(
++    Params&&) = default;
++
++// static
++void BrowserOSPageWaiter::Start(content::WebContents* web_contents,
++                                Params params,
++                                Callback callback) {
++  // Owns itself until Finish().
++  auto* waiter = new BrowserOSPageWaiter(web_contents, std::move(params),
++                                         std::move(callback));
++  waiter->Begin();
++}
++
++BrowserOSPageWaiter::BrowserOSPageWaiter(content::WebContents* web_contents,
++                                         Params params,
++                                         Callback callback)
++    : content::WebContentsObserver(web_contents),
++      params_(std::move(params)),
++      folded_text_(base::ToLowerASCII(params_.text)),
++      callback_(std::move(callback)),
++      start_time_(base::TimeTicks::Now()) {}
++
++BrowserOSPageWaiter::~BrowserOSPageWaiter() = default;
++
++void BrowserOSPageWaiter::Begin() {
++  timeout_timer_.Start(FROM_HERE, params_.timeout,
++                       base::BindOnce(&BrowserOSPageWaiter::Finish,
++                                      weak_factory_.GetWeakPtr(), false,
++                                      std::string()));
++
++  switch (params_.condition) {
++    case Condition::kNode:
++    case Condition::kText:
++      // Updates cover what changes from here on; the snapshot covers what
++      // is already on the page.
++      accessibility_mode_ =
++          content::BrowserAccessibilityState::GetInstance()
++              ->CreateScopedModeForWebContents(web_contents(), kWaitAXMode);
++      web_contents()->RequestAXTreeSnapshot(
++          base::BindOnce(&BrowserOSPageWaiter::OnSnapshot,
++                         weak_factory_.GetWeakPtr()),
++          kWaitAXMode,
++          /* max_nodes= */ 0,  // No limit
++          /* timeout= */ base::TimeDelta(),
++          content::WebContents::AXTreeSnapshotPolicy::kAll);
++      break;
++    case Condition::kNavigation:
++      break;
++    case Condition::kNetworkIdle:
++      if (!web_contents()->IsLoading()) {
++        RestartQuietTimer();
++      }
++      break;
++  }
++}
++
++void BrowserOSPageWaiter::CheckNodes(
++    const std::vector<ui::AXNodeData>& nodes) {
++  if (params_.condition == Condition::kText) {
++    for (const ui::AXNodeData& node : nodes) {
++      if (node.IsInvisibleOrIgnored()) {
++        continue;
++      }
++      for (auto attribute : {ax::mojom::StringAttribute::kName,
++                             ax::mojom::StringAttribute::kValue}) {
++        if (base::ToLowerASCII(node.GetStringAttribute(attribute))
++                .find(folded_text_) != std::string::npos) {
++          Finish(true);
++          return;
++        }
++      }
++    }
++    return;
++  }
++
++  // Same matching as findNodes, over just these nodes.
++  std::vector<browseros::QueryableNode> candidates;
++  for (const ui::AXNodeData& node : nodes) {
++    if (node.IsInvisibleOrIgnored()) {
++      continue;
++    }
++    browseros::QueryableNode& candidate = candidates.emplace_back();
++    candidate.role = ui::ToString(node.role);
++    candidate.name = browseros::SanitizeSnapshotText(
++        node.GetStringAttribute(ax::mojom::StringAttribute::kName));
++    PopulateNodeAttributes(node, candidate.attributes);
++  }
++  if (candidates.empty()) {
++    return;
++  }
++  browseros::NodeQueryIndex index(std::move(candidates));
++  std::vector<const browseros::QueryableNode*> matches;
++  std::string error;
++  browseros::NodeQuery query = params_.query;
++  query.max_results = 1;
++  if (index.Find(query, &matches, &error) && !matches.empty()) {
++    Finish(true);
++  }
++}
++
++void BrowserOSPageWaiter::OnSnapshot(ui::AXTreeUpdate& tree_update) {
++  CheckNodes(tree_update.nodes);
++}
++
++void BrowserOSPageWaiter::RestartQuietTimer() {
++  quiet_timer_.Start(FROM_HERE, params_.quiet_period,
++                     base::BindOnce(&BrowserOSPageWaiter::OnQuietPeriodElapsed,
++                                    weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSPageWaiter::OnQuietPeriodElapsed() {
++  if (!web_contents() || web_contents()->IsLoading()) {
++    return;  // DidStopLoading restarts the timer.
++  }
++  Finish(true);
++}
++
++void BrowserOSPageWaiter::Finish(bool satisfied, std::string url) {
++  Result result;
++  result.satisfied = satisfied;
++  result.elapsed = base::TimeTicks::Now() - start_time_;
++  result.url = std::move(url);
++  VLOG(1) << "[browseros] Wait finished, satisfied=" << satisfied << " after "
++          << result.elapsed.InMilliseconds() << " ms";
++  std::move(callback_).Run(std::move(result));
++  delete this;
++}
++
++void BrowserOSPageWaiter::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!WaitsForTree(params_.condition)) {
++    return;
++  }
++  base::WeakPtr<BrowserOSPageWaiter> weak_this = weak_factory_.GetWeakPtr();
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    CheckNodes(update.nodes);
++    if (!weak_this) {
++      return;  // Finished; |this| is gone.
++    }
++  }
++}
++
++void BrowserOSPageWaiter::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (params_.condition != Condition::kNavigation ||
++      !navigation_handle->IsInPrimaryMainFrame() ||
++      !navigation_handle->HasCommitted()) {
++    return;
++  }
++  Finish(true, navigation_handle->GetURL().spec());
++}
++
++void BrowserOSPageWaiter::DidStartLoading() {
++  if (params_.condition == Condition::kNetworkIdle) {
++    quiet_timer_.Stop();
++  }
++}
++
++void BrowserOSPageWaiter::DidStopLoading() {
++  if (params_.condition == Condition::kNetworkIdle) {
++    RestartQuietTimer();
++  }
++}
++
++void BrowserOSPageWaiter::ResourceLoadComplete(
++    content::RenderFrameHost* render_frame_host,
++    const content::GlobalRequestID& request_id,
++    const blink::mojom::ResourceLoadInfo& resource_load_info) {
++  // Requests made after load (XHR, fetch, lazy images) push idle back.
++  if (params_.condition == Condition::kNetworkIdle &&
++      quiet_timer_.IsRunning()) {
++    RestartQuietTimer();
++  }
++}
++
++void BrowserOSPageWaiter::WebContentsDestroyed() {
++  Finish(false);
++}
++
++}  // namespace api
++}  // namespace extensions
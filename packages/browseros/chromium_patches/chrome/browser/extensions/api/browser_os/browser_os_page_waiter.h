@@ -0,0 +1,136 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.h b/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.h
+new file mode 100644
+index 0000000000000..9dc6100a06c08
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_waiter.h
+@@ -0,0 +1,130 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_WAITER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_WAITER_H_
++
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/browseros/page_content/node_query_index.h"
++#include "content/public/browser/global_request_id.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-forward.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++class WebContents;
++}  // namespace content
++
++namespace ui {
++struct AXNodeData;
++struct AXTreeUpdate;
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Waits for a page condition without polling. Node and text waits check one
++// accessibility snapshot up front and then only the nodes in each
++// accessibility update; navigation and network waits react to
++// WebContentsObserver notifications. Nothing runs between events.
++//
++// Like BrowserOSChangeDetector's async mode, a waiter owns itself and is
++// deleted right after its callback runs.
++class BrowserOSPageWaiter : public content::WebContentsObserver {
++ public:
++  enum class Condition {
++    kNode,         // A node matching |query| exists.
++    kText,         // A node's name or value contains |text|.
++    kNavigation,   // The primary main frame commits a navigation.
++    kNetworkIdle,  // No loading and no finished request for |quiet_period|.
++  };
++
++  struct Params {
++    Params();
++    ~Params();
++    Params(Params&&);
++    Params& operator=(Params&&);
++
++    Condition condition = Condition::kNavigation;
++    browseros::NodeQuery query;  // kNode only; viewport and context unused.
++    std::string text;            // kText only.
++    base::TimeDelta timeout;
++    base::TimeDelta quiet_period;  // kNetworkIdle only.
++  };
++
++  struct Result {
++    bool satisfied = false;  // False on timeout or when the tab went away.
++    base::TimeDelta elapsed;
++    std::string url;  // Committed URL, kNavigation only.
++  };
++
++  using Callback = base::OnceCallback<void(Result)>;
++
++  // Starts waiting on |web_contents|. |callback| runs exactly once.
++  static void Start(content::WebContents* web_contents,
++                    Params params,
++                    Callback callback);
++
++  ~BrowserOSPageWaiter() override;
++
++  BrowserOSPageWaiter(const BrowserOSPageWaiter&) = delete;
++  BrowserOSPageWaiter& operator=(const BrowserOSPageWaiter&) = delete;
++
++ private:
++  BrowserOSPageWaiter(content::WebContents* web_contents,
++                      Params params,
++                      Callback callback);
++
++  void Begin();
++
++  // Checks nodes from a snapshot or an accessibility update.
++  void CheckNodes(const std::vector<ui::AXNodeData>& nodes);
++  void OnSnapshot(ui::AXTreeUpdate& tree_update);
++
++  // (Re)starts the network quiet period.
++  void RestartQuietTimer();
++  void OnQuietPeriodElapsed();
++
++  // Runs the callback and deletes |this|.
++  void Finish(bool satisfied, std::string url = std::string());
++
++  // WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DidStartLoading() override;
++  void DidStopLoading() override;
++  void ResourceLoadComplete(
++      content::RenderFrameHost* render_frame_host,
++      const content::GlobalRequestID& request_id,
++      const blink::mojom::ResourceLoadInfo& resource_load_info) override;
++  void WebContentsDestroyed() override;
++
++  const Params params_;
++  const std::string folded_text_;  // Lowercased |params_.text|.
++  Callback callback_;
++  const base::TimeTicks start_time_;
++
++  // Keeps accessibility updates flowing while a node or text wait runs.
++  std::unique_ptr<content::ScopedAccessibilityMode> accessibility_mode_;
++
++  base::OneShotTimer timeout_timer_;
++  base::OneShotTimer quiet_timer_;
++
++  base::WeakPtrFactory<BrowserOSPageWaiter> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_WAITER_H_
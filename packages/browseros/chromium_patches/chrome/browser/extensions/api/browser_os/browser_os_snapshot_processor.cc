@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
 new file mode 100644
-index 0000000000000..885942336dcd6
+index 0000000000000..83525f7c1b9d3
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
-@@ -0,0 +1,648 @@
+@@ -0,0 +1,801 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,18 +16,22 @@ index 0000000000000..885942336dcd6
 +#include <functional>
 +#include <future>
 +#include <memory>
-+#include <queue>
++#include <optional>
++#include <set>
 +#include <sstream>
-+#include <unordered_set>
 +#include <utility>
 +
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/ref_counted.h"
++#include "base/strings/string_number_conversions.h"
 +#include "base/strings/string_util.h"
 +#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "chrome/browser/browseros/page_content/snapshot_context_index.h"
++#include "chrome/browser/browseros/page_content/snapshot_limits.h"
++#include "chrome/browser/browseros/page_content/stable_node_ids.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/render_widget_host_view.h"
@@ -44,6 +48,7 @@ index 0000000000000..885942336dcd6
 +#include "ui/gfx/geometry/rect.h"
 +#include "ui/gfx/geometry/rect_conversions.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size_f.h"
 +#include "ui/gfx/geometry/transform.h"
 +
 +namespace extensions {
@@ -103,22 +108,8 @@ index 0000000000000..885942336dcd6
 +
 +namespace {
 +
-+// Helper to sanitize strings to ensure valid UTF-8 by keeping only printable ASCII
-+std::string SanitizeStringForOutput(const std::string& input) {
-+  std::string output;
-+  output.reserve(input.size());
-+  
-+  for (char c : input) {
-+    // Only include printable ASCII and whitespace
-+    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
-+      output.push_back(c);
-+    } else {
-+      output.push_back(' ');  // Replace non-printable with space
-+    }
-+  }
-+  
-+  return output;
-+}
++// Nodes per thread pool task, and per chunk of a streamed snapshot.
++constexpr size_t kBatchSize = 100;
 +
 +// Helper to determine if a node should be skipped for the interactive snapshot
 +bool ShouldSkipNode(const ui::AXNodeData& node_data) {
@@ -136,24 +127,59 @@ index 0000000000000..885942336dcd6
 +  return false;
 +}
 +
++// Rough size of |node| once serialized to JSON for the caller. Only used to
++// enforce SnapshotOptions::max_bytes, so it errs on the high side.
++size_t EstimateSerializedSize(const browser_os::InteractiveNode& node) {
++  // nodeId, type, rect and punctuation.
++  size_t size = 96;
++  if (node.name) {
++    size += node.name->size();
++  }
++  if (node.attributes) {
++    for (const auto [key, value] : node.attributes->additional_properties) {
++      size += key.size() + 6;
++      size += value.is_string() ? value.GetString().size() : 8;
++    }
++  }
++  return size;
++}
++
++bool IsInViewport(const browser_os::InteractiveNode& node) {
++  if (!node.attributes) {
++    return false;
++  }
++  const std::string* in_viewport =
++      node.attributes->additional_properties.FindString("in_viewport");
++  return in_viewport && *in_viewport == "true";
++}
++
 +}  // namespace
 +
 +// Internal structure for managing async processing
 +struct SnapshotProcessor::ProcessingContext 
 +    : public base::RefCountedThreadSafe<ProcessingContext> {
 +  browser_os::InteractiveSnapshot snapshot;
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;  // child_id -> parent_id  
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;  // parent_id -> child_ids
-+  std::unique_ptr<ui::AXTree> ax_tree;  // AXTree for computing accurate bounds
++  std::vector<ui::AXNodeData> nodes;  // Nodes being processed, batch order
++  std::vector<NodeBounds> bounds;  // Bounds of each node, computed once
++  std::vector<uint32_t> node_ids;  // Stable agent-facing id of each node
++  std::vector<ui::AXTreeID> frame_tree_ids;  // Owning frame of each node
++  // Results by position in |nodes|, filled in as batches complete
++  std::vector<std::optional<browser_os::InteractiveNode>> elements;
++  std::unique_ptr<browseros::SnapshotContextIndex> context_index;
 +  int tab_id;
 +  ui::AXTreeID tree_id;  // Tree ID for change detection
-+  float device_scale_factor = 1.0f;  // For converting physical to CSS pixels
-+  gfx::Size viewport_size;  // For visibility checks
++  size_t max_bytes = 0;  // Serialized size budget, 0 for none
++  bool truncated = false;  // Set when a limit dropped nodes
++  // Streaming only: batches finished so far and the next one to emit
++  SnapshotChunkCallback chunk_callback;
++  std::vector<bool> batch_done;
++  size_t next_chunk = 0;
++  size_t streamed_bytes = 0;
 +  base::TimeTicks start_time;
 +  size_t total_nodes;
 +  size_t processed_batches;
 +  size_t total_batches;
++  size_t posted_batches = 0;
 +  base::OnceCallback<void(SnapshotProcessingResult)> callback;
 +  
 + private:
@@ -161,88 +187,6 @@ index 0000000000000..885942336dcd6
 +  ~ProcessingContext() = default;
 +};
 +
-+// Helper to collect text from a node's subtree
-+std::string CollectTextFromNode(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    int max_chars = 200) {
-+  
-+  auto node_it = node_map.find(node_id);
-+  if (node_it == node_map.end()) {
-+    return "";
-+  }
-+  
-+  std::vector<std::string> text_parts;
-+  
-+  // BFS to collect text from this node and its children
-+  std::queue<int32_t> queue;
-+  queue.push(node_id);
-+  int chars_collected = 0;
-+  
-+  while (!queue.empty() && chars_collected < max_chars) {
-+    int32_t current_id = queue.front();
-+    queue.pop();
-+    
-+    auto current_it = node_map.find(current_id);
-+    if (current_it == node_map.end()) continue;
-+    
-+    const ui::AXNodeData& current = current_it->second;
-+    
-+    // Collect text from this node
-+    if (current.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      std::string text = current.GetStringAttribute(ax::mojom::StringAttribute::kName);
-+      text = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
-+      if (!text.empty()) {
-+        std::string clean_text = SanitizeStringForOutput(text);
-+        if (!clean_text.empty()) {
-+          text_parts.push_back(clean_text);
-+          chars_collected += clean_text.length();
-+        }
-+      }
-+    }
-+    
-+    // Add children to queue
-+    for (int32_t child_id : current.child_ids) {
-+      queue.push(child_id);
-+    }
-+  }
-+  
-+  std::string result = base::JoinString(text_parts, " ");
-+  if (result.length() > static_cast<size_t>(max_chars)) {
-+    result = result.substr(0, max_chars - 3) + "...";
-+  }
-+  return result;
-+}
-+
-+// Helper to build path using offset_container_id and return depth
-+std::pair<std::string, int> BuildPathAndDepth(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map) {
-+  
-+  std::vector<std::string> path_parts;
-+  int32_t current_id = node_id;
-+  int depth = 0;
-+  const int max_depth = 10;
-+  
-+  while (current_id >= 0 && depth < max_depth) {
-+    auto node_it = node_map.find(current_id);
-+    if (node_it == node_map.end()) break;
-+    
-+    const ui::AXNodeData& node = node_it->second;
-+    
-+    // Just append the role
-+    path_parts.push_back(ui::ToString(node.role));
-+    
-+    // Move to offset container
-+    current_id = node.relative_bounds.offset_container_id;
-+    depth++;
-+  }
-+  
-+  // Reverse to get top-down path
-+  std::reverse(path_parts.begin(), path_parts.end());
-+  return std::make_pair(base::JoinString(path_parts, " > "), depth);
-+}
-+
 +// Helper to populate all attributes for a node
 +void PopulateNodeAttributes(
 +    const ui::AXNodeData& node_data,
@@ -254,7 +198,7 @@ index 0000000000000..885942336dcd6
 +  // Add value attribute for inputs
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
 +    std::string value = node_data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
-+    attributes["value"] = SanitizeStringForOutput(value);
++    attributes["value"] = browseros::SanitizeSnapshotText(value);
 +  }
 +  
 +  // Add HTML tag if available
@@ -265,77 +209,77 @@ index 0000000000000..885942336dcd6
 +  // Add role description
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kRoleDescription)) {
 +    std::string role_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kRoleDescription);
-+    attributes["role-description"] = SanitizeStringForOutput(role_desc);
++    attributes["role-description"] = browseros::SanitizeSnapshotText(role_desc);
 +  }
 +  
 +  // Add input type
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kInputType)) {
 +    std::string input_type = node_data.GetStringAttribute(ax::mojom::StringAttribute::kInputType);
-+    attributes["input-type"] = SanitizeStringForOutput(input_type);
++    attributes["input-type"] = browseros::SanitizeSnapshotText(input_type);
 +  }
 +  
 +  // Add tooltip
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kTooltip)) {
 +    std::string tooltip = node_data.GetStringAttribute(ax::mojom::StringAttribute::kTooltip);
-+    attributes["tooltip"] = SanitizeStringForOutput(tooltip);
++    attributes["tooltip"] = browseros::SanitizeSnapshotText(tooltip);
 +  }
 +  
 +  // Add placeholder for input fields
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kPlaceholder)) {
 +    std::string placeholder = node_data.GetStringAttribute(ax::mojom::StringAttribute::kPlaceholder);
-+    attributes["placeholder"] = SanitizeStringForOutput(placeholder);
++    attributes["placeholder"] = browseros::SanitizeSnapshotText(placeholder);
 +  }
 +  
 +  // Add description for more context
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kDescription)) {
 +    std::string description = node_data.GetStringAttribute(ax::mojom::StringAttribute::kDescription);
-+    attributes["description"] = SanitizeStringForOutput(description);
++    attributes["description"] = browseros::SanitizeSnapshotText(description);
 +  }
 +  
 +  // Add URL for links
 +  // if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kUrl)) {
 +  //   std::string url = node_data.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
-+  //   attributes["url"] = SanitizeStringForOutput(url);
++  //   attributes["url"] = browseros::SanitizeSnapshotText(url);
 +  // }
 +  
 +  // Add checked state description
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription)) {
 +    std::string checked_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription);
-+    attributes["checked-state"] = SanitizeStringForOutput(checked_desc);
++    attributes["checked-state"] = browseros::SanitizeSnapshotText(checked_desc);
 +  }
 +  
 +  // Add autocomplete hint
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kAutoComplete)) {
 +    std::string autocomplete = node_data.GetStringAttribute(ax::mojom::StringAttribute::kAutoComplete);
-+    attributes["autocomplete"] = SanitizeStringForOutput(autocomplete);
++    attributes["autocomplete"] = browseros::SanitizeSnapshotText(autocomplete);
 +  }
 +  
 +  // Add HTML ID for form associations
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlId)) {
 +    std::string html_id = node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlId);
-+    attributes["id"] = SanitizeStringForOutput(html_id);
++    attributes["id"] = browseros::SanitizeSnapshotText(html_id);
 +  }
 +  
 +  // Add HTML class names
 +  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kClassName)) {
 +    std::string class_name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kClassName);
-+    attributes["class"] = SanitizeStringForOutput(class_name);
++    attributes["class"] = browseros::SanitizeSnapshotText(class_name);
 +  }
 +}
 +
 +// Process a batch of nodes
 +std::vector<SnapshotProcessor::ProcessedNode> SnapshotProcessor::ProcessNodeBatch(
-+    const std::vector<ui::AXNodeData>& nodes_to_process,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    ui::AXTree* ax_tree,
-+    uint32_t start_node_id,
-+    float device_scale_factor) {
++    base::span<const ui::AXNodeData> nodes_to_process,
++    base::span<const NodeBounds> node_bounds,
++    base::span<const uint32_t> node_ids,
++    size_t first_index,
++    const browseros::SnapshotContextIndex* context_index) {
 +  std::vector<ProcessedNode> results;
 +  results.reserve(nodes_to_process.size());
 +  
-+  uint32_t current_node_id = start_node_id;
-+  
-+  for (const auto& node_data : nodes_to_process) {
++  for (size_t i = 0; i < nodes_to_process.size(); ++i) {
++    const ui::AXNodeData& node_data = nodes_to_process[i];
++
 +    // Skip invisible, ignored, or non-interactive elements
 +    if (ShouldSkipNode(node_data)) {
 +      continue;
@@ -351,68 +295,44 @@ index 0000000000000..885942336dcd6
 +    
 +    ProcessedNode data;
 +    data.node_data = &node_data;
-+    data.node_id = current_node_id++;
++    data.node_id = node_ids[i];
++    data.index = first_index + i;
 +    data.node_type = node_type;
 +    
 +    // Get accessible name
 +    if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
 +      std::string name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kName);
-+      data.name = SanitizeStringForOutput(name);
++      data.name = browseros::SanitizeSnapshotText(name);
 +    }
 +
-+    // Compute bounds using AXTree
-+    bool is_offscreen = false;
-+    if (ax_tree) {
-+      ui::AXNode* ax_node = ax_tree->GetFromId(node_data.id);
-+      if (ax_node) {
-+        // GetNodeBounds now returns CSS pixels directly
-+        data.absolute_bounds = GetNodeBounds(
-+            ax_tree, 
-+            ax_node,
-+            ui::AXCoordinateSystem::kFrame,
-+            // Use clipped bounds so the center lies within the visible area of
-+            // scrolled/clip containers. This matches how clicks should target
-+            // on-screen rects.
-+            ui::AXClippingBehavior::kClipped,
-+            device_scale_factor,  // Pass DSF for CSS pixel conversion
-+            &is_offscreen);
-+        
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " CSS bounds: " << data.absolute_bounds.ToString()
-+                << " offscreen: " << is_offscreen;
-+      } else {
-+        // Node not found in AXTree, skip bounds computation
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " not found in AXTree, skipping bounds";
-+      }
-+    } else {
-+      // No AXTree available
-+      LOG(WARNING) << "[browseros] No AXTree available for bounds computation";
-+    }
-+    
++    // Bounds were computed before dispatch, for the snapshot options.
++    const NodeBounds& bounds = node_bounds[i];
++    data.absolute_bounds = bounds.bounds;
++
 +    // Populate all attributes using helper function
 +    PopulateNodeAttributes(node_data, data.attributes);
 +    
 +    // Add context from parent node
 +    int32_t parent_id = node_data.relative_bounds.offset_container_id;
 +    if (parent_id >= 0) {
-+      std::string context = CollectTextFromNode(parent_id, node_map, 200);
++      std::string context = context_index->GetSubtreeText(parent_id);
 +      if (!context.empty()) {
-+        data.attributes["context"] = context;
++        data.attributes["context"] = std::move(context);
 +      }
 +    }
 +    
-+    // Add path and depth using offset_container_id chain
-+    auto [path, depth] = BuildPathAndDepth(node_data.id, node_map);
++    // Add path and depth along the offset_container_id chain
++    const std::string& path = context_index->GetPath(node_data.id);
 +    if (!path.empty()) {
 +      data.attributes["path"] = path;
 +    }
-+    data.attributes["depth"] = std::to_string(depth);
++    data.attributes["depth"] =
++        base::NumberToString(context_index->GetDepth(node_data.id));
 +    
 +    // Set viewport status based on offscreen flag
 +    // Note: offscreen=false means the node IS in viewport (at least partially visible)
 +    // offscreen=true means the node is NOT in viewport (completely hidden)
-+    data.attributes["in_viewport"] = is_offscreen ? "false" : "true";
++    data.attributes["in_viewport"] = bounds.offscreen ? "false" : "true";
 +    
 +    results.push_back(std::move(data));
 +  }
@@ -420,19 +340,225 @@ index 0000000000000..885942336dcd6
 +  return results;
 +}
 +
++// What ProcessAccessibilityTree computes on the thread pool before any
++// batch is dispatched.
++struct SnapshotProcessor::PreparedSnapshot {
++  // Frame-qualified DOM node ids of every node in the tree, for pruning
++  // stable ids.
++  std::set<browseros::StableNodeKey> live_keys;
++  // Nodes kept by the snapshot options, in dispatch order, their bounds and
++  // the tree of the frame each belongs to.
++  std::vector<ui::AXNodeData> nodes;
++  std::vector<NodeBounds> bounds;
++  std::vector<ui::AXTreeID> frame_tree_ids;
++  std::unique_ptr<browseros::SnapshotContextIndex> context_index;
++  size_t candidate_count = 0;  // Interactive nodes before the options
++  bool truncated = false;
++};
++
++// static
++std::unique_ptr<SnapshotProcessor::PreparedSnapshot>
++SnapshotProcessor::PrepareSnapshot(ui::AXTreeUpdate tree_update,
++                                   gfx::Size viewport_size,
++                                   float device_scale_factor,
++                                   SnapshotOptions options) {
++  auto prepared = std::make_unique<PreparedSnapshot>();
++  // The update merges in out-of-process iframes, whose renderers allocate
++  // DOM node ids independently, so ids are qualified by the owning frame.
++  const std::vector<ui::AXTreeID> owning_tree_ids =
++      browseros::GetOwningTreeIds(tree_update);
++  for (size_t i = 0; i < tree_update.nodes.size(); ++i) {
++    if (int32_t dom_node_id = tree_update.nodes[i].GetIntAttribute(
++            ax::mojom::IntAttribute::kDOMNodeId)) {
++      prepared->live_keys.insert({owning_tree_ids[i], dom_node_id});
++    }
++  }
++
++  // The tree is only needed for bounds, and every bound is computed here.
++  ui::AXTree ax_tree(tree_update);
++  VLOG(1) << "[browseros] Created AXTree with " << tree_update.nodes.size()
++          << " nodes for bounds computation";
++
++  // Viewport in CSS pixels; frame bounds are relative to its top-left.
++  const gfx::RectF viewport{gfx::SizeF(viewport_size)};
++  // Distances of offscreen nodes matter only to options that rank or
++  // filter by them.
++  const bool need_distance = options.viewport_screens.value_or(0) > 0 ||
++                             options.viewport_first || options.max_nodes > 0;
++
++  std::vector<size_t> candidates;
++  std::vector<NodeBounds> candidate_bounds;
++  std::vector<browseros::NodePlacement> placements;
++  for (size_t node_index = 0; node_index < tree_update.nodes.size();
++       ++node_index) {
++    const ui::AXNodeData& node = tree_update.nodes[node_index];
++    // Skip invisible, ignored, or non-interactive nodes
++    if (ShouldSkipNode(node)) {
++      continue;
++    }
++
++    NodeBounds bounds;
++    browseros::NodePlacement placement;
++    if (ui::AXNode* ax_node = ax_tree.GetFromId(node.id)) {
++      // Use clipped bounds so the center lies within the visible area of
++      // scrolled/clip containers. This matches how clicks should target
++      // on-screen rects.
++      bounds.bounds = GetNodeBounds(
++          &ax_tree, ax_node, ui::AXCoordinateSystem::kFrame,
++          ui::AXClippingBehavior::kClipped, device_scale_factor,
++          &bounds.offscreen);
++      placement.placed = true;
++      placement.offscreen = bounds.offscreen;
++      placement.distance = browseros::VerticalDistance(bounds.bounds, viewport);
++      if (bounds.offscreen && need_distance) {
++        // Clipping pins a node that is entirely outside its container to
++        // the container's edge, so measure it unclipped.
++        placement.distance = browseros::VerticalDistance(
++            GetNodeBounds(&ax_tree, ax_node, ui::AXCoordinateSystem::kFrame,
++                          ui::AXClippingBehavior::kUnclipped,
++                          device_scale_factor),
++            viewport);
++      }
++      VLOG(3) << "[browseros] Node " << node.id
++              << " CSS bounds: " << bounds.bounds.ToString()
++              << " offscreen: " << bounds.offscreen;
++    } else {
++      VLOG(3) << "[browseros] Node " << node.id
++              << " not found in AXTree, skipping bounds";
++    }
++    candidates.push_back(node_index);
++    candidate_bounds.push_back(bounds);
++    placements.push_back(placement);
++  }
++
++  // Apply viewport and node limits before dispatch so off-screen nodes
++  // never reach the batches.
++  browseros::ViewportLimits limits;
++  limits.viewport_screens = options.viewport_screens;
++  limits.max_nodes = options.max_nodes;
++  limits.viewport_first = options.viewport_first;
++  browseros::ViewportSelection selection =
++      browseros::SelectNodesNearViewport(placements, viewport.height(), limits);
++
++  prepared->candidate_count = candidates.size();
++  prepared->truncated = selection.capped;
++  prepared->nodes.reserve(selection.kept.size());
++  prepared->bounds.reserve(selection.kept.size());
++  prepared->frame_tree_ids.reserve(selection.kept.size());
++  for (size_t index : selection.kept) {
++    prepared->nodes.push_back(tree_update.nodes[candidates[index]]);
++    prepared->bounds.push_back(candidate_bounds[index]);
++    prepared->frame_tree_ids.push_back(owning_tree_ids[candidates[index]]);
++  }
++
++  // Context text, path and depth for every node in two passes over the
++  // tree, so batches only do lookups.
++  if (!prepared->nodes.empty()) {
++    prepared->context_index =
++        std::make_unique<browseros::SnapshotContextIndex>(tree_update.nodes);
++  }
++  return prepared;
++}
++
++// static
++bool SnapshotProcessor::ApplyByteBudget(ProcessingContext& context,
++                                        size_t max_bytes) {
++  std::vector<browser_os::InteractiveNode>& elements =
++      context.snapshot.elements;
++  std::vector<browseros::BudgetedNode> budgeted;
++  budgeted.reserve(elements.size());
++  for (const browser_os::InteractiveNode& element : elements) {
++    budgeted.push_back({EstimateSerializedSize(element), IsInViewport(element)});
++  }
++  std::vector<bool> keep;
++  if (!browseros::FitByteBudget(budgeted, max_bytes, &keep)) {
++    return false;
++  }
++
++  // Dropped nodes keep their mappings; they were just refreshed.
++  std::vector<browser_os::InteractiveNode> kept;
++  for (size_t i = 0; i < elements.size(); ++i) {
++    if (keep[i]) {
++      kept.push_back(std::move(elements[i]));
++    }
++  }
++  elements = std::move(kept);
++  return true;
++}
++
++// static
++void SnapshotProcessor::EmitChunk(ProcessingContext& context,
++                                  size_t batch_index) {
++  size_t begin = batch_index * kBatchSize;
++  size_t end = std::min(begin + kBatchSize, context.elements.size());
++  std::vector<browser_os::InteractiveNode> chunk;
++  for (size_t i = begin; i < end; ++i) {
++    if (!context.elements[i]) {
++      continue;
++    }
++    // Nodes arrive nearest-first, so once the budget runs out the rest of
++    // the page is dropped, as ApplyByteBudget would.
++    if (context.max_bytes > 0) {
++      size_t size = EstimateSerializedSize(*context.elements[i]);
++      if (context.truncated ||
++          context.streamed_bytes + size > context.max_bytes) {
++        context.truncated = true;
++        continue;
++      }
++      context.streamed_bytes += size;
++    }
++    chunk.push_back(std::move(*context.elements[i]));
++    context.elements[i].reset();
++  }
++  if (!chunk.empty()) {
++    context.chunk_callback.Run(std::move(chunk));
++  }
++}
++
++// static
++void SnapshotProcessor::PostNextBatch(
++    scoped_refptr<ProcessingContext> context) {
++  base::span<const ui::AXNodeData> nodes(context->nodes);
++  base::span<const NodeBounds> bounds(context->bounds);
++  base::span<const uint32_t> node_ids(context->node_ids);
++  size_t batch_index = context->posted_batches++;
++  size_t begin = batch_index * kBatchSize;
++  size_t end = std::min(begin + kBatchSize, nodes.size());
++
++  // Post task to ThreadPool and handle result on UI thread
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&SnapshotProcessor::ProcessNodeBatch,
++                     nodes.subspan(begin, end - begin),
++                     bounds.subspan(begin, end - begin),
++                     node_ids.subspan(begin, end - begin),
++                     begin,
++                     context->context_index.get()),
++      base::BindOnce(&SnapshotProcessor::OnBatchProcessed,
++                     context, batch_index));
++}
++
 +// Helper to handle batch processing results
 +void SnapshotProcessor::OnBatchProcessed(
 +    scoped_refptr<ProcessingContext> context,
++    size_t batch_index,
 +    std::vector<ProcessedNode> batch_results) {
++  InvalidateNodeQueryIndex(context->tab_id);
++
 +  // Process batch results
 +  for (const auto& node_data : batch_results) {
 +    // Store mapping from our nodeId to AX node ID, bounds, and attributes
 +    NodeInfo info;
 +    info.ax_node_id = node_data.node_data->id;
 +    info.ax_tree_id = context->tree_id;  // Store tree ID for change detection
++    info.dom_node_id = node_data.node_data->GetIntAttribute(
++        ax::mojom::IntAttribute::kDOMNodeId);
++    info.frame_tree_id = context->frame_tree_ids[node_data.index];
 +    info.bounds = node_data.absolute_bounds;
 +    info.attributes = node_data.attributes;  // Store all computed attributes
 +    info.node_type = node_data.node_type;  // Store node type for efficient filtering
++    info.name = node_data.name;
 +    // Extract in_viewport from attributes (stored as "true"/"false" string)
 +    auto viewport_it = node_data.attributes.find("in_viewport");
 +    info.in_viewport = (viewport_it != node_data.attributes.end() && viewport_it->second == "true");
@@ -469,20 +595,39 @@ index 0000000000000..885942336dcd6
 +      interactive_node.attributes = std::move(attributes);
 +    }
 +    
-+    context->snapshot.elements.push_back(std::move(interactive_node));
++    context->elements[node_data.index] = std::move(interactive_node);
 +  }
 +  
 +  context->processed_batches++;
++  if (context->posted_batches < context->total_batches) {
++    PostNextBatch(context);
++  }
++
++  // Streamed batches go out in order as soon as all earlier ones are done.
++  if (context->chunk_callback) {
++    context->batch_done[batch_index] = true;
++    while (context->next_chunk < context->total_batches &&
++           context->batch_done[context->next_chunk]) {
++      EmitChunk(*context, context->next_chunk++);
++    }
++  }
 +  
 +  // Check if all batches are complete
 +  if (context->processed_batches == context->total_batches) {
-+    // Sort elements by node_id to maintain consistent ordering
-+    std::sort(context->snapshot.elements.begin(), 
-+              context->snapshot.elements.end(),
-+              [](const browser_os::InteractiveNode& a, 
-+                 const browser_os::InteractiveNode& b) {
-+                return a.node_id < b.node_id;
-+              });
++    if (!context->chunk_callback) {
++      // Node ids no longer follow the page, so keep document order instead
++      for (auto& element : context->elements) {
++        if (element) {
++          context->snapshot.elements.push_back(std::move(*element));
++        }
++      }
++
++      if (context->max_bytes > 0 &&
++          ApplyByteBudget(*context, context->max_bytes)) {
++        context->truncated = true;
++      }
++    }
++    context->snapshot.truncated = context->truncated;
 +
 +    // Leave hierarchical_structure empty for now as requested
 +    context->snapshot.hierarchical_structure = "";
@@ -499,6 +644,7 @@ index 0000000000000..885942336dcd6
 +    result.snapshot = std::move(context->snapshot);
 +    result.nodes_processed = context->total_nodes;
 +    result.processing_time_ms = processing_time.InMilliseconds();
++    result.truncated = context->truncated;
 +    
 +    // Run callback (context will be deleted when last ref is released)
 +    std::move(context->callback).Run(std::move(result));
@@ -532,123 +678,130 @@ index 0000000000000..885942336dcd6
 +}
 +
 +void SnapshotProcessor::ProcessAccessibilityTree(
-+    const ui::AXTreeUpdate& tree_update,
++    ui::AXTreeUpdate tree_update,
 +    int tab_id,
 +    uint32_t snapshot_id,
 +    content::WebContents* web_contents,
++    const SnapshotOptions& options,
++    SnapshotChunkCallback chunk_callback,
 +    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
 +  base::TimeTicks start_time = base::TimeTicks::Now();
 +  
 +  // Extract viewport info from WebContents on UI thread
 +  auto [viewport_size, device_scale_factor] = ExtractViewportInfo(web_contents);
 +  
-+  // Build node ID map, parent map and children map for efficient lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;
-+  
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
-+    // Build parent and children relationships
-+    for (int32_t child_id : node.child_ids) {
-+      parent_map[child_id] = node.id;
-+      children_map[node.id].push_back(child_id);
-+    }
-+  }
-+  
-+  // Clear previous mappings for this tab
-+  GetNodeIdMappings()[tab_id].clear();
++  ui::AXTreeID tree_id = tree_update.has_tree_data
++                             ? tree_update.tree_data.tree_id
++                             : ui::AXTreeIDUnknown();
 +
-+  // Create an AXTree from the tree update for accurate bounds computation
-+  std::unique_ptr<ui::AXTree> ax_tree = std::make_unique<ui::AXTree>(tree_update);
-+  
-+  if (!ax_tree) {
-+    LOG(ERROR) << "[browseros] Failed to create AXTree from update";
-+    SnapshotProcessingResult result;
-+    result.nodes_processed = 0;
-+    result.processing_time_ms = 0;
-+    std::move(callback).Run(std::move(result));
-+    return;
-+  }
-+  
-+  LOG(INFO) << "[browseros] Created AXTree with " << tree_update.nodes.size() 
-+            << " nodes for bounds computation";
-+  
 +  // Prepare processing context using RefCounted
 +  auto context = base::MakeRefCounted<ProcessingContext>();
 +  context->snapshot.snapshot_id = snapshot_id;
 +  context->snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  context->tab_id = tab_id;
-+  context->node_map = std::move(node_map);
-+  context->parent_map = std::move(parent_map); 
-+  context->children_map = std::move(children_map);
-+  context->ax_tree = std::move(ax_tree);  // Store AXTree for bounds computation
-+  context->device_scale_factor = device_scale_factor;  // For CSS pixel conversion
-+  context->viewport_size = viewport_size;  // For visibility checks
++  context->max_bytes = options.max_bytes;
 +  context->start_time = start_time;
 +  
 +  // Store the tree ID for change detection
-+  if (tree_update.has_tree_data) {
-+    context->tree_id = tree_update.tree_data.tree_id;
-+  }
++  context->tree_id = tree_id;
 +  
-+  // Viewport size is passed in but not currently used for viewport bounds calculation
-+  // TODO: Implement proper viewport detection if needed
 +  context->callback = std::move(callback);
++  context->chunk_callback = std::move(chunk_callback);
 +  context->processed_batches = 0;
-+  
-+  // Collect all nodes to process and filter
-+  std::vector<ui::AXNodeData> nodes_to_process;
-+  for (const auto& node : tree_update.nodes) {
-+    // Skip invisible, ignored, or non-interactive nodes
-+    if (ShouldSkipNode(node)) {
-+      continue;
-+    }
-+    nodes_to_process.push_back(node);
++
++  // Everything that scales with the document (the AXTree, bounds, the
++  // viewport limits and the context index) is done on the thread pool;
++  // batches are dispatched once it is ready.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&SnapshotProcessor::PrepareSnapshot,
++                     std::move(tree_update), viewport_size,
++                     device_scale_factor, options),
++      base::BindOnce(&SnapshotProcessor::DispatchBatches, context,
++                     options.max_batches_in_flight));
++}
++
++// static
++void SnapshotProcessor::DispatchBatches(
++    scoped_refptr<ProcessingContext> context,
++    size_t max_batches_in_flight,
++    std::unique_ptr<PreparedSnapshot> prepared) {
++  // Keep the ids of nodes that are still alive and forget the rest. The
++  // survivors stay stale until one of this snapshot's batches refreshes them.
++  // Nodes are matched by frame and DOM node id; AX ids are renumbered per
++  // snapshot. Per-tab id state is only touched on the UI thread.
++  browseros::StableNodeIds& tab_node_ids = GetTabNodeIds()[context->tab_id];
++  auto& mappings = GetNodeIdMappings()[context->tab_id];
++  for (uint32_t released : tab_node_ids.Prune(prepared->live_keys)) {
++    mappings.erase(released);
 +  }
-+  
-+  context->total_nodes = nodes_to_process.size();
++  for (auto& [node_id, info] : mappings) {
++    info.stale = true;
++  }
++  InvalidateNodeQueryIndex(context->tab_id);
++
++  if (prepared->nodes.size() != prepared->candidate_count) {
++    VLOG(1) << "[browseros] Snapshot options kept " << prepared->nodes.size()
++            << " of " << prepared->candidate_count << " nodes";
++  }
++  context->truncated = prepared->truncated;
++  context->total_nodes = prepared->nodes.size();
 +  
 +  // Handle empty case
-+  if (nodes_to_process.empty()) {
-+    base::TimeDelta processing_time = base::TimeTicks::Now() - start_time;
++  if (prepared->nodes.empty()) {
++    base::TimeDelta processing_time =
++        base::TimeTicks::Now() - context->start_time;
 +    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
++    context->snapshot.truncated = context->truncated;
 +    
 +    SnapshotProcessingResult result;
 +    result.snapshot = std::move(context->snapshot);
 +    result.nodes_processed = 0;
++    result.truncated = context->truncated;
 +    result.processing_time_ms = processing_time.InMilliseconds();
 +    std::move(context->callback).Run(std::move(result));
 +    return;
 +  }
-+  
-+  // Process nodes in batches using ThreadPool
-+  const size_t batch_size = 100;  // Process 100 nodes per batch
-+  size_t num_batches = (nodes_to_process.size() + batch_size - 1) / batch_size;
++
++  // Batches share the nodes, bounds and index by pointer; |context|
++  // outlives them because every reply holds a ref.
++  context->nodes = std::move(prepared->nodes);
++  context->bounds = std::move(prepared->bounds);
++  context->context_index = std::move(prepared->context_index);
++  context->frame_tree_ids = std::move(prepared->frame_tree_ids);
++  base::span<const ui::AXNodeData> nodes(context->nodes);
++
++  context->node_ids.reserve(nodes.size());
++  for (size_t i = 0; i < nodes.size(); ++i) {
++    const ui::AXNodeData& node = nodes[i];
++    uint32_t replaced_id = 0;
++    context->node_ids.push_back(tab_node_ids.GetOrAllocate(
++        {context->frame_tree_ids[i],
++         node.GetIntAttribute(ax::mojom::IntAttribute::kDOMNodeId)},
++        static_cast<int32_t>(node.role),
++        node.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag),
++        &replaced_id));
++    // The element changed kind; its old id must not resolve to it.
++    if (replaced_id) {
++      mappings.erase(replaced_id);
++    }
++  }
++  context->elements.resize(nodes.size());
++
++  // Process nodes in batches using ThreadPool; each completed batch posts
++  // the next one while any remain.
++  size_t num_batches = (nodes.size() + kBatchSize - 1) / kBatchSize;
 +  context->total_batches = num_batches;
-+  
-+  for (size_t i = 0; i < nodes_to_process.size(); i += batch_size) {
-+    size_t end = std::min(i + batch_size, nodes_to_process.size());
-+    std::vector<ui::AXNodeData> batch(
-+        std::make_move_iterator(nodes_to_process.begin() + i),
-+        std::make_move_iterator(nodes_to_process.begin() + end));
-+    uint32_t start_node_id = i + 1;  // Node IDs start at 1
-+    
-+    // Post task to ThreadPool and handle result on UI thread
-+    base::ThreadPool::PostTaskAndReplyWithResult(
-+        FROM_HERE,
-+        {base::TaskPriority::USER_VISIBLE},
-+        base::BindOnce(&SnapshotProcessor::ProcessNodeBatch, 
-+                       std::move(batch), 
-+                       context->node_map,
-+                       context->ax_tree.get(),  // Pass AXTree pointer for bounds computation
-+                       start_node_id,
-+                       context->device_scale_factor),  // Pass DSF for CSS pixel conversion
-+        base::BindOnce(&SnapshotProcessor::OnBatchProcessed,
-+                       context));
++  context->batch_done.resize(num_batches);
++
++  size_t initial_batches = num_batches;
++  if (max_batches_in_flight > 0) {
++    initial_batches = std::min(initial_batches, max_batches_in_flight);
++  }
++  for (size_t i = 0; i < initial_batches; ++i) {
++    PostNextBatch(context);
 +  }
 +}
 +
-+
 +}  // namespace api
 +}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
 new file mode 100644
-index 0000000000000..5c85cd73b26f3
+index 0000000000000..dcc4292345c19
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
-@@ -0,0 +1,111 @@
+@@ -0,0 +1,202 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,15 +11,24 @@ index 0000000000000..5c85cd73b26f3
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +
++#include <cstddef>
 +#include <cstdint>
++#include <memory>
++#include <optional>
 +#include <string>
 +#include <unordered_map>
 +#include <vector>
 +
++#include "base/containers/span.h"
 +#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace browseros {
++class SnapshotContextIndex;
++}  // namespace browseros
 +
 +namespace content {
 +class WebContents;
@@ -37,13 +46,49 @@ index 0000000000000..5c85cd73b26f3
 +namespace extensions {
 +namespace api {
 +
++// Limits applied to an interactive snapshot. Viewport filtering and the node
++// cap run before any batch is dispatched, so their cost scales with the
++// region kept rather than the whole document.
++struct SnapshotOptions {
++  // Keep only nodes within this many viewport heights above or below the
++  // visible area; 0 keeps only nodes in the viewport. Unset keeps the whole
++  // document.
++  std::optional<int> viewport_screens;
++  // Maximum number of nodes returned; 0 means no limit. Nodes closest to the
++  // viewport are kept.
++  size_t max_nodes = 0;
++  // Approximate cap on the serialized size of the returned elements, in
++  // bytes; 0 means no limit. In-viewport nodes are kept first.
++  size_t max_bytes = 0;
++  // Order nodes nearest the viewport first instead of in document order.
++  // Streamed snapshots set this so the visible region is delivered first.
++  bool viewport_first = false;
++  // Batches of this snapshot queued on the thread pool at once; 0 queues all
++  // of them up front. Snapshots of several tabs set this so each tab's next
++  // batch queues behind the others' instead of one tab filling the pool.
++  size_t max_batches_in_flight = 0;
++};
++
++// Receives one chunk of a streamed snapshot. Chunks arrive in order, on the
++// UI thread, before the final SnapshotProcessingResult.
++using SnapshotChunkCallback =
++    base::RepeatingCallback<void(std::vector<browser_os::InteractiveNode>)>;
++
 +// Result of snapshot processing
 +struct SnapshotProcessingResult {
 +  browser_os::InteractiveSnapshot snapshot;
 +  int nodes_processed = 0;
 +  int64_t processing_time_ms = 0;
++  // True if max_nodes or max_bytes dropped nodes.
++  bool truncated = false;
 +};
 +
++// Fills |attributes| with the snapshot attributes of |node_data| (role,
++// value, html-tag and so on), as reported in InteractiveNode.attributes.
++void PopulateNodeAttributes(
++    const ui::AXNodeData& node_data,
++    std::unordered_map<std::string, std::string>& attributes);
++
 +// Processes accessibility trees into interactive snapshots with parallel processing
 +class SnapshotProcessor {
 + public:
@@ -58,6 +103,8 @@ index 0000000000000..5c85cd73b26f3
 +    
 +    raw_ptr<const ui::AXNodeData> node_data;
 +    uint32_t node_id;
++    // Position of the node in document order within the snapshot
++    size_t index = 0;
 +    browser_os::InteractiveNodeType node_type;
 +    std::string name;
 +    gfx::RectF absolute_bounds;
@@ -65,6 +112,14 @@ index 0000000000000..5c85cd73b26f3
 +    std::unordered_map<std::string, std::string> attributes;
 +  };
 +
++  // Bounds of a node in CSS pixels, computed once before its batch runs.
++  struct NodeBounds {
++    gfx::RectF bounds;
++    // Whether the node lies entirely outside the viewport or a clipping
++    // container; reported as in_viewport.
++    bool offscreen = false;
++  };
++
 +  SnapshotProcessor() = default;
 +  ~SnapshotProcessor() = default;
 +
@@ -72,26 +127,34 @@ index 0000000000000..5c85cd73b26f3
 +  // This function processes the accessibility tree into an interactive snapshot
 +  // using parallel processing on the thread pool. Extracts viewport info from
 +  // web_contents on UI thread before processing.
++  // If chunk_callback is set, elements are handed to it as batches complete
++  // instead of being collected into the result's snapshot.
 +  static void ProcessAccessibilityTree(
-+      const ui::AXTreeUpdate& tree_update,
++      ui::AXTreeUpdate tree_update,
 +      int tab_id,
 +      uint32_t snapshot_id,
 +      content::WebContents* web_contents,
++      const SnapshotOptions& options,
++      SnapshotChunkCallback chunk_callback,
 +      base::OnceCallback<void(SnapshotProcessingResult)> callback);
 +
 +  // Process a batch of nodes (exposed for testing)
-+  // The ax_tree is used to compute accurate bounds for each node
-+  // device_scale_factor is used to convert physical pixels to CSS pixels
++  // node_bounds and node_ids hold the bounds and stable id of each node;
++  // first_index is the position of the batch's first node in document order
++  // context_index supplies each node's context text, path and depth
 +  static std::vector<ProcessedNode> ProcessNodeBatch(
-+      const std::vector<ui::AXNodeData>& nodes_to_process,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      ui::AXTree* ax_tree,
-+      uint32_t start_node_id,
-+      float device_scale_factor = 1.0f);
++      base::span<const ui::AXNodeData> nodes_to_process,
++      base::span<const NodeBounds> node_bounds,
++      base::span<const uint32_t> node_ids,
++      size_t first_index,
++      const browseros::SnapshotContextIndex* context_index);
 +
 + private:
 +  // Internal processing context
 +  struct ProcessingContext;
++
++  // The part of a snapshot computed on the thread pool before dispatch.
++  struct PreparedSnapshot;
 +  
 +  // Compute absolute bounds for a node using AXTree and convert to CSS pixels
 +  // This implements the same logic as BrowserAccessibility::GetBoundsRect
@@ -103,8 +166,36 @@ index 0000000000000..5c85cd73b26f3
 +                                   float device_scale_factor = 1.0f,
 +                                   bool* out_offscreen = nullptr);
 +  
++  // Builds an AXTree from |tree_update|, computes the bounds of every
++  // interactive node, applies the viewport and node-count limits of
++  // |options| and builds the context index. Runs on the thread pool.
++  static std::unique_ptr<PreparedSnapshot> PrepareSnapshot(
++      ui::AXTreeUpdate tree_update,
++      gfx::Size viewport_size,
++      float device_scale_factor,
++      SnapshotOptions options);
++
++  // Drops elements past |max_bytes| of estimated serialized size, keeping
++  // in-viewport elements first. Returns true if any element was dropped.
++  static bool ApplyByteBudget(ProcessingContext& context, size_t max_bytes);
++
++  // Hands the elements of batch |batch_index| to the chunk callback, within
++  // what is left of the byte budget.
++  static void EmitChunk(ProcessingContext& context, size_t batch_index);
++
++  // Takes the result of PrepareSnapshot, prunes the tab's node ids,
++  // allocates ids for the kept nodes and posts the first batches of
++  // |context|. Runs on the UI thread.
++  static void DispatchBatches(scoped_refptr<ProcessingContext> context,
++                              size_t max_batches_in_flight,
++                              std::unique_ptr<PreparedSnapshot> prepared);
++
++  // Posts the next batch of |context| to the thread pool.
++  static void PostNextBatch(scoped_refptr<ProcessingContext> context);
++
 +  // Batch processing callback
 +  static void OnBatchProcessed(scoped_refptr<ProcessingContext> context,
++                               size_t batch_index,
 +                               std::vector<ProcessedNode> batch_results);
 +
 +  SnapshotProcessor(const SnapshotProcessor&) = delete;
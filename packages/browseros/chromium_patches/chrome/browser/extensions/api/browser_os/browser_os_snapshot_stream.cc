@@ -0,0 +1,170 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.cc
+new file mode 100644
+index 0000000000000..b9f0b30def191
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.cc
+@@ -0,0 +1,164 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.h"
++
++#include <algorithm>
++#include <map>
++#include <memory>
++#include <utility>
++
++#include "base/check.h"
++#include "base/logging.h"
++#include "base/memory/ptr_util.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "content/public/browser/browser_context.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Streams nobody finishes reading are dropped oldest first once one owner
++// has this many open. The limit is per owner so that one extension cannot
++// close another's streams by opening its own.
++constexpr size_t kMaxOpenStreams = 8;
++
++// Ordered by id, which is also creation order.
++std::map<int, std::unique_ptr<SnapshotStream>>& GetStreams() {
++  static base::NoDestructor<std::map<int, std::unique_ptr<SnapshotStream>>>
++      g_streams;
++  return *g_streams;
++}
++
++int g_next_stream_id = 1;
++
++}  // namespace
++
++// static
++int SnapshotStream::Create(const ExtensionId& extension_id,
++                           content::BrowserContext* browser_context) {
++  auto& streams = GetStreams();
++  std::string owner = browser_context->UniqueId();
++  auto is_owned = [&](const auto& entry) {
++    return entry.second->extension_id_ == extension_id &&
++           entry.second->browser_context_id_ == owner;
++  };
++  size_t owned = std::ranges::count_if(streams, is_owned);
++  for (auto it = streams.begin();
++       owned >= kMaxOpenStreams && it != streams.end();) {
++    if (!is_owned(*it)) {
++      ++it;
++      continue;
++    }
++    LOG(WARNING) << "[browseros] Dropping unread snapshot stream "
++                 << it->first;
++    it = streams.erase(it);
++    --owned;
++  }
++  int stream_id = g_next_stream_id++;
++  streams.emplace(stream_id,
++                  base::WrapUnique(new SnapshotStream(
++                      stream_id, extension_id, std::move(owner))));
++  return stream_id;
++}
++
++// static
++SnapshotStream* SnapshotStream::FromId(
++    int stream_id,
++    const ExtensionId& extension_id,
++    content::BrowserContext* browser_context) {
++  SnapshotStream* stream = FromIdUnchecked(stream_id);
++  if (!stream || stream->extension_id_ != extension_id ||
++      stream->browser_context_id_ != browser_context->UniqueId()) {
++    return nullptr;
++  }
++  return stream;
++}
++
++// static
++bool SnapshotStream::IsOpen(int stream_id) {
++  return FromIdUnchecked(stream_id) != nullptr;
++}
++
++// static
++SnapshotStream* SnapshotStream::FromIdUnchecked(int stream_id) {
++  auto& streams = GetStreams();
++  auto it = streams.find(stream_id);
++  return it == streams.end() ? nullptr : it->second.get();
++}
++
++// static
++void SnapshotStream::AddChunk(
++    int stream_id,
++    std::vector<browser_os::InteractiveNode> elements) {
++  SnapshotStream* stream = FromIdUnchecked(stream_id);
++  if (!stream) {
++    return;
++  }
++  browser_os::InteractiveSnapshotChunk chunk;
++  chunk.done = false;
++  stream->element_count_ += static_cast<int>(elements.size());
++  chunk.elements = std::move(elements);
++  stream->Push(std::move(chunk));
++}
++
++// static
++void SnapshotStream::Finish(int stream_id, SnapshotProcessingResult result) {
++  SnapshotStream* stream = FromIdUnchecked(stream_id);
++  if (!stream) {
++    return;
++  }
++  browser_os::InteractiveSnapshotChunk chunk;
++  chunk.done = true;
++  chunk.snapshot_id = static_cast<int>(result.snapshot.snapshot_id);
++  chunk.element_count = stream->element_count_;
++  chunk.truncated = result.truncated;
++  chunk.processing_time_ms = static_cast<int>(result.processing_time_ms);
++  stream->Push(std::move(chunk));
++}
++
++SnapshotStream::SnapshotStream(int stream_id,
++                               ExtensionId extension_id,
++                               std::string owner)
++    : stream_id_(stream_id),
++      extension_id_(std::move(extension_id)),
++      browser_context_id_(std::move(owner)) {}
++
++SnapshotStream::~SnapshotStream() {
++  if (pending_read_) {
++    std::move(pending_read_).Run(std::nullopt);
++  }
++}
++
++void SnapshotStream::Read(ReadCallback callback) {
++  DCHECK(!pending_read_);
++  pending_read_ = std::move(callback);
++  MaybeDeliver();
++}
++
++void SnapshotStream::Push(browser_os::InteractiveSnapshotChunk chunk) {
++  chunk.stream_id = stream_id_;
++  chunk.sequence = next_sequence_++;
++  queue_.push_back(std::move(chunk));
++  MaybeDeliver();
++}
++
++void SnapshotStream::MaybeDeliver() {
++  if (!pending_read_ || queue_.empty()) {
++    return;
++  }
++  browser_os::InteractiveSnapshotChunk chunk = std::move(queue_.front());
++  queue_.pop_front();
++  const bool done = chunk.done;
++  std::move(pending_read_).Run(std::move(chunk));
++  if (done) {
++    // Deletes |this|.
++    GetStreams().erase(stream_id_);
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
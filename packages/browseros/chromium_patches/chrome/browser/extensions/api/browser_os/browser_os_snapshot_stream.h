@@ -0,0 +1,102 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.h
+new file mode 100644
+index 0000000000000..818e6017145a5
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_stream.h
+@@ -0,0 +1,96 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_STREAM_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_STREAM_H_
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/circular_deque.h"
++#include "base/functional/callback.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "extensions/common/extension_id.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++struct SnapshotProcessingResult;
++
++// An interactive snapshot handed out in ordered chunks while the processor is
++// still working on the rest of the page. The processor pushes chunks and a
++// final summary; the caller pulls them one read at a time, so delivery order
++// is the processing order and nothing is sent that is not asked for.
++//
++// Streams live in a global registry keyed by id and are only touched on the
++// UI thread. Ids are small and guessable, so each stream records the
++// extension and browser context that started it and is invisible to any
++// other. A stream is removed once its final chunk has been read, or when its
++// owner has too many streams open and it is the oldest.
++class SnapshotStream {
++ public:
++  // Called with the next chunk, or nullopt if the stream was closed first.
++  using ReadCallback = base::OnceCallback<void(
++      std::optional<browser_os::InteractiveSnapshotChunk>)>;
++
++  // Registers a new stream owned by |extension_id| in |browser_context| and
++  // returns its id.
++  static int Create(const ExtensionId& extension_id,
++                    content::BrowserContext* browser_context);
++
++  // Returns the open stream with |stream_id| if |extension_id| in
++  // |browser_context| owns it, or nullptr.
++  static SnapshotStream* FromId(int stream_id,
++                                const ExtensionId& extension_id,
++                                content::BrowserContext* browser_context);
++
++  // Whether |stream_id| is still open. For the code that feeds a stream,
++  // which only ever holds ids it created.
++  static bool IsOpen(int stream_id);
++
++  // Processor callbacks. Do nothing if the stream was closed meanwhile.
++  static void AddChunk(int stream_id,
++                       std::vector<browser_os::InteractiveNode> elements);
++  static void Finish(int stream_id, SnapshotProcessingResult result);
++
++  ~SnapshotStream();
++
++  SnapshotStream(const SnapshotStream&) = delete;
++  SnapshotStream& operator=(const SnapshotStream&) = delete;
++
++  bool has_pending_read() const { return !pending_read_.is_null(); }
++
++  // Hands out the next chunk, now if one is queued or else once it arrives.
++  // At most one read may be pending.
++  void Read(ReadCallback callback);
++
++ private:
++  SnapshotStream(int stream_id, ExtensionId extension_id, std::string owner);
++
++  // Returns the open stream with |stream_id| whoever owns it, or nullptr.
++  static SnapshotStream* FromIdUnchecked(int stream_id);
++
++  void Push(browser_os::InteractiveSnapshotChunk chunk);
++  void MaybeDeliver();
++
++  const int stream_id_;
++  const ExtensionId extension_id_;
++  // BrowserContext::UniqueId() of the owner, which unlike the pointer
++  // cannot be reused by a later profile.
++  const std::string browser_context_id_;
++  int next_sequence_ = 0;
++  int element_count_ = 0;
++  base::circular_deque<browser_os::InteractiveSnapshotChunk> queue_;
++  ReadCallback pending_read_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_STREAM_H_
@@ -0,0 +1,281 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.cc
+new file mode 100644
+index 0000000000000..006233f6d54f0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.cc
+@@ -0,0 +1,275 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h"
++
++#include <cmath>
++#include <utility>
++#include <vector>
++
++#include "base/auto_reset.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/notreached.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr char kUpdatedKey[] = "updated";
++constexpr char kElementsKey[] = "elements";
++constexpr char kScoreKey[] = "score";
++
++// A strategy needs at least this much net success to be tried first.
++constexpr double kMinPreferredScore = 0.5;
++
++// Entries decayed below this are forgotten.
++constexpr double kForgetScore = 0.05;
++
++const char* ActionName(StrategyAction action) {
++  switch (action) {
++    case StrategyAction::kClick:
++      return "click";
++    case StrategyAction::kType:
++      return "type";
++    case StrategyAction::kClear:
++      return "clear";
++  }
++  NOTREACHED();
++}
++
++// The origin's key, or an empty string for origins not worth remembering
++// (opaque, file://, about:blank).
++std::string OriginKey(content::WebContents* web_contents) {
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return std::string();
++  }
++  const url::Origin& origin = rfh->GetLastCommittedOrigin();
++  if (origin.opaque() || origin.host().empty()) {
++    return std::string();
++  }
++  return origin.Serialize();
++}
++
++// "click:button/div" for a clicked button rendered as a <div>.
++std::string ElementKey(StrategyAction action, const NodeInfo& node_info) {
++  std::string key = ActionName(action);
++  key += ':';
++  auto role = node_info.attributes.find("role");
++  if (role != node_info.attributes.end()) {
++    key += role->second;
++  }
++  key += '/';
++  auto tag = node_info.attributes.find("html-tag");
++  if (tag != node_info.attributes.end()) {
++    key += tag->second;
++  }
++  return key;
++}
++
++}  // namespace
++
++BrowserOSStrategyCache::BrowserOSStrategyCache(PrefService* prefs)
++    : prefs_(prefs),
++      origins_(prefs->GetDict(browseros::prefs::kActionStrategies).Clone()) {
++  pref_change_registrar_.Init(prefs_);
++  pref_change_registrar_.Add(
++      browseros::prefs::kActionStrategies,
++      base::BindRepeating(&BrowserOSStrategyCache::OnPrefChanged,
++                          base::Unretained(this)));
++}
++
++BrowserOSStrategyCache::~BrowserOSStrategyCache() = default;
++
++// static
++std::optional<std::string> BrowserOSStrategyCache::GetPreferred(
++    content::WebContents* web_contents,
++    StrategyAction action,
++    const NodeInfo& node_info) {
++  const std::string origin = OriginKey(web_contents);
++  if (origin.empty()) {
++    return std::nullopt;
++  }
++  BrowserOSStrategyCache* cache =
++      BrowserOSStrategyCacheFactory::GetForBrowserContext(
++          web_contents->GetBrowserContext());
++  if (!cache) {
++    return std::nullopt;
++  }
++  return cache->GetPreferredForOrigin(origin, ElementKey(action, node_info));
++}
++
++// static
++void BrowserOSStrategyCache::Record(content::WebContents* web_contents,
++                                    StrategyAction action,
++                                    const NodeInfo& node_info,
++                                    const std::string& strategy,
++                                    bool succeeded) {
++  const std::string origin = OriginKey(web_contents);
++  if (origin.empty()) {
++    return;
++  }
++  BrowserOSStrategyCache* cache =
++      BrowserOSStrategyCacheFactory::GetForBrowserContext(
++          web_contents->GetBrowserContext());
++  if (!cache) {
++    return;
++  }
++  cache->RecordForOrigin(origin, ElementKey(action, node_info), strategy,
++                         succeeded);
++}
++
++// static
++double BrowserOSStrategyCache::DecayedScore(const base::Value::Dict& entry,
++                                            base::Time now) {
++  const double score = entry.FindDouble(kScoreKey).value_or(0);
++  const base::Time updated = base::Time::FromSecondsSinceUnixEpoch(
++      entry.FindDouble(kUpdatedKey).value_or(0));
++  const base::TimeDelta age = now - updated;
++  if (!age.is_positive()) {
++    return score;
++  }
++  return score * std::exp2(-(age / kHalfLife));
++}
++
++// static
++std::optional<std::string> BrowserOSStrategyCache::GetPreferredStrategy(
++    const base::Value::Dict& origin_dict,
++    const std::string& element_key,
++    base::Time now) {
++  const base::Value::Dict* elements = origin_dict.FindDict(kElementsKey);
++  const base::Value::Dict* strategies =
++      elements ? elements->FindDict(element_key) : nullptr;
++  if (!strategies) {
++    return std::nullopt;
++  }
++
++  std::optional<std::string> best;
++  double best_score = kMinPreferredScore;
++  for (const auto [strategy, entry] : *strategies) {
++    if (!entry.is_dict()) {
++      continue;
++    }
++    const double score = DecayedScore(entry.GetDict(), now);
++    if (score >= best_score) {
++      best = strategy;
++      best_score = score;
++    }
++  }
++  return best;
++}
++
++// static
++void BrowserOSStrategyCache::RecordResult(base::Value::Dict& origin_dict,
++                                          const std::string& element_key,
++                                          const std::string& strategy,
++                                          bool succeeded,
++                                          base::Time now) {
++  const double now_seconds = now.InSecondsFSinceUnixEpoch();
++  origin_dict.Set(kUpdatedKey, now_seconds);
++  base::Value::Dict* strategies =
++      origin_dict.EnsureDict(kElementsKey)->EnsureDict(element_key);
++
++  base::Value::Dict* entry = strategies->EnsureDict(strategy);
++  const double score = DecayedScore(*entry, now) + (succeeded ? 1 : -1);
++  entry->Set(kScoreKey, score);
++  entry->Set(kUpdatedKey, now_seconds);
++
++  // Drop whatever has decayed to nothing so the record stays small.
++  std::vector<std::string> forgotten;
++  for (const auto [other, other_entry] : *strategies) {
++    if (!other_entry.is_dict() ||
++        std::abs(DecayedScore(other_entry.GetDict(), now)) < kForgetScore) {
++      forgotten.push_back(other);
++    }
++  }
++  for (const std::string& other : forgotten) {
++    strategies->Remove(other);
++  }
++}
++
++// static
++void BrowserOSStrategyCache::EvictOrigins(base::Value::Dict& origins,
++                                          size_t max_origins) {
++  while (origins.size() > max_origins) {
++    std::string oldest;
++    double oldest_updated = 0;
++    for (const auto [key, value] : origins) {
++      const double updated =
++          value.is_dict() ? value.GetDict().FindDouble(kUpdatedKey).value_or(0)
++                          : 0;
++      if (oldest.empty() || updated < oldest_updated) {
++        oldest = key;
++        oldest_updated = updated;
++      }
++    }
++    origins.Remove(oldest);
++  }
++}
++
++void BrowserOSStrategyCache::Flush() {
++  if (persist_timer_.IsRunning()) {
++    persist_timer_.Stop();
++    Persist();
++  }
++}
++
++void BrowserOSStrategyCache::Shutdown() {
++  Flush();
++  pref_change_registrar_.RemoveAll();
++}
++
++std::optional<std::string> BrowserOSStrategyCache::GetPreferredForOrigin(
++    const std::string& origin,
++    const std::string& element_key) const {
++  const base::Value::Dict* origin_dict = origins_.FindDict(origin);
++  if (!origin_dict) {
++    return std::nullopt;
++  }
++  return GetPreferredStrategy(*origin_dict, element_key, base::Time::Now());
++}
++
++void BrowserOSStrategyCache::RecordForOrigin(const std::string& origin,
++                                             const std::string& element_key,
++                                             const std::string& strategy,
++                                             bool succeeded) {
++  RecordResult(*origins_.EnsureDict(origin), element_key, strategy, succeeded,
++               base::Time::Now());
++  EvictOrigins(origins_, kMaxOrigins);
++  VLOG(1) << "[browseros] Strategy " << strategy << " for " << element_key
++          << " on " << origin << (succeeded ? " worked" : " did not work");
++
++  if (!persist_timer_.IsRunning()) {
++    persist_timer_.Start(FROM_HERE, kPersistDelay, this,
++                         &BrowserOSStrategyCache::Persist);
++  }
++}
++
++void BrowserOSStrategyCache::Persist() {
++  base::AutoReset<bool> persisting(&persisting_, true);
++  prefs_->SetDict(browseros::prefs::kActionStrategies, origins_.Clone());
++}
++
++void BrowserOSStrategyCache::OnPrefChanged() {
++  if (persisting_) {
++    return;
++  }
++  // Written from outside, e.g. cleared through browserOS.setPref. That wins
++  // over whatever was recorded since the last write.
++  persist_timer_.Stop();
++  origins_ = prefs_->GetDict(browseros::prefs::kActionStrategies).Clone();
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,152 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h
+new file mode 100644
+index 0000000000000..6002900298748
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h
+@@ -0,0 +1,146 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_H_
++
++#include <optional>
++#include <string>
++
++#include "base/memory/raw_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "components/keyed_service/core/keyed_service.h"
++#include "components/prefs/pref_change_registrar.h"
++
++class PrefService;
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// Actions whose strategy order is learned.
++enum class StrategyAction {
++  kClick,
++  kType,
++  kClear,
++};
++
++// Remembers, per origin, which strategy of an action changed the page for
++// which kind of element, so the next attempt can start with it instead of
++// paying a detection timeout for a strategy that never works there.
++//
++// Kept in the browseros.action_strategies profile pref:
++//   {
++//     "https://example.com": {
++//       "updated": <seconds since epoch>,
++//       "elements": {
++//         "click:button/div": {
++//           "html": {"score": 2.7, "updated": <seconds since epoch>},
++//           "point": {"score": -1.0, "updated": <seconds since epoch>}
++//         }
++//       }
++//     }
++//   }
++// A success adds 1 to a strategy's score and a failure subtracts 1. Scores
++// halve every kHalfLife, so what a site did a month ago weighs little and a
++// site that changes is relearned.
++//
++// One instance per profile holds the record in memory and writes it back to
++// the pref at most every kPersistDelay and at shutdown, so a burst of
++// actions costs one pref write. A write from elsewhere, such as a reset
++// through browserOS.setPref, replaces the in-memory record. Off-the-record
++// profiles get their own instance over their in-memory prefs.
++class BrowserOSStrategyCache : public KeyedService {
++ public:
++  static constexpr base::TimeDelta kHalfLife = base::Days(7);
++
++  // Origins kept; the least recently updated one is dropped first.
++  static constexpr size_t kMaxOrigins = 500;
++
++  static constexpr base::TimeDelta kPersistDelay = base::Seconds(30);
++
++  explicit BrowserOSStrategyCache(PrefService* prefs);
++  ~BrowserOSStrategyCache() override;
++
++  BrowserOSStrategyCache(const BrowserOSStrategyCache&) = delete;
++  BrowserOSStrategyCache& operator=(const BrowserOSStrategyCache&) = delete;
++
++  // Returns the strategy to try first for |action| on |node_info| in
++  // |web_contents|' current origin, or nullopt to keep the default order.
++  static std::optional<std::string> GetPreferred(
++      content::WebContents* web_contents,
++      StrategyAction action,
++      const NodeInfo& node_info);
++
++  // Records whether |strategy| changed the page.
++  static void Record(content::WebContents* web_contents,
++                     StrategyAction action,
++                     const NodeInfo& node_info,
++                     const std::string& strategy,
++                     bool succeeded);
++
++  // The same, for a serialized origin and an element key such as
++  // "click:button/div".
++  std::optional<std::string> GetPreferredForOrigin(
++      const std::string& origin,
++      const std::string& element_key) const;
++  void RecordForOrigin(const std::string& origin,
++                       const std::string& element_key,
++                       const std::string& strategy,
++                       bool succeeded);
++
++  // The record itself, as pure functions over the pref's dicts.
++
++  // |entry|'s score decayed from its last update to |now|.
++  static double DecayedScore(const base::Value::Dict& entry, base::Time now);
++
++  // The strategy with the highest decayed score for |element_key| in
++  // |origin_dict|, if any is high enough to be worth trying first.
++  static std::optional<std::string> GetPreferredStrategy(
++      const base::Value::Dict& origin_dict,
++      const std::string& element_key,
++      base::Time now);
++
++  // Scores |strategy| for |element_key| in |origin_dict| and forgets the
++  // element's strategies that have decayed to nothing.
++  static void RecordResult(base::Value::Dict& origin_dict,
++                           const std::string& element_key,
++                           const std::string& strategy,
++                           bool succeeded,
++                           base::Time now);
++
++  // Drops the least recently updated origins until at most |max_origins|
++  // are left.
++  static void EvictOrigins(base::Value::Dict& origins, size_t max_origins);
++
++  // Writes a record not yet persisted to the pref now, so a dump of the
++  // pref matches what is in use.
++  void Flush();
++
++  // KeyedService:
++  void Shutdown() override;
++
++ private:
++  void Persist();
++  void OnPrefChanged();
++
++  raw_ptr<PrefService> prefs_;
++  base::Value::Dict origins_;
++  base::OneShotTimer persist_timer_;
++  PrefChangeRegistrar pref_change_registrar_;
++  // Set while Persist() writes, so OnPrefChanged() skips our own writes.
++  bool persisting_ = false;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_H_
@@ -0,0 +1,59 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.cc b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.cc
+new file mode 100644
+index 0000000000000..2f080d47c882b
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.cc
+@@ -0,0 +1,53 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h"
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/keyed_service/content/browser_context_dependency_manager.h"
++#include "content/public/browser/browser_context.h"
++
++namespace extensions {
++namespace api {
++
++// static
++BrowserOSStrategyCache* BrowserOSStrategyCacheFactory::GetForBrowserContext(
++    content::BrowserContext* context) {
++  return static_cast<BrowserOSStrategyCache*>(
++      GetInstance()->GetServiceForBrowserContext(context, true));
++}
++
++// static
++BrowserOSStrategyCacheFactory* BrowserOSStrategyCacheFactory::GetInstance() {
++  static base::NoDestructor<BrowserOSStrategyCacheFactory> instance;
++  return instance.get();
++}
++
++BrowserOSStrategyCacheFactory::BrowserOSStrategyCacheFactory()
++    : BrowserContextKeyedServiceFactory(
++          "BrowserOSStrategyCache",
++          BrowserContextDependencyManager::GetInstance()) {}
++
++BrowserOSStrategyCacheFactory::~BrowserOSStrategyCacheFactory() = default;
++
++content::BrowserContext* BrowserOSStrategyCacheFactory::GetBrowserContextToUse(
++    content::BrowserContext* context) const {
++  // Incognito learns in its own instance, over prefs that are never written
++  // to disk.
++  return context;
++}
++
++std::unique_ptr<KeyedService>
++BrowserOSStrategyCacheFactory::BuildServiceInstanceForBrowserContext(
++    content::BrowserContext* context) const {
++  return std::make_unique<BrowserOSStrategyCache>(
++      Profile::FromBrowserContext(context)->GetPrefs());
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,59 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h
+new file mode 100644
+index 0000000000000..6621c37e8b243
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_factory.h
+@@ -0,0 +1,53 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_FACTORY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_FACTORY_H_
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++class BrowserOSStrategyCache;
++
++// Factory for the per-profile BrowserOSStrategyCache. Off-the-record
++// profiles get their own instance.
++class BrowserOSStrategyCacheFactory : public BrowserContextKeyedServiceFactory {
++ public:
++  BrowserOSStrategyCacheFactory(const BrowserOSStrategyCacheFactory&) = delete;
++  BrowserOSStrategyCacheFactory& operator=(
++      const BrowserOSStrategyCacheFactory&) = delete;
++
++  // Returns the BrowserOSStrategyCache for |context|, creating one if needed.
++  static BrowserOSStrategyCache* GetForBrowserContext(
++      content::BrowserContext* context);
++
++  // Returns the singleton factory instance.
++  static BrowserOSStrategyCacheFactory* GetInstance();
++
++ private:
++  friend base::NoDestructor<BrowserOSStrategyCacheFactory>;
++
++  BrowserOSStrategyCacheFactory();
++  ~BrowserOSStrategyCacheFactory() override;
++
++  // BrowserContextKeyedServiceFactory:
++  content::BrowserContext* GetBrowserContextToUse(
++      content::BrowserContext* context) const override;
++  std::unique_ptr<KeyedService> BuildServiceInstanceForBrowserContext(
++      content::BrowserContext* context) const override;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_STRATEGY_CACHE_FACTORY_H_
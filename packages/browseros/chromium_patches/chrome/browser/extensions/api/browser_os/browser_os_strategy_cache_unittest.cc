@@ -0,0 +1,255 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_unittest.cc b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_unittest.cc
+new file mode 100644
+index 0000000000000..4c9728ea75fed
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_strategy_cache_unittest.cc
+@@ -0,0 +1,249 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_strategy_cache.h"
++
++#include <string>
++
++#include "base/strings/string_number_conversions.h"
++#include "base/test/bind.h"
++#include "base/test/task_environment.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "components/prefs/pref_change_registrar.h"
++#include "components/prefs/pref_registry_simple.h"
++#include "components/prefs/testing_pref_service.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace extensions {
++namespace api {
++namespace {
++
++using Cache = BrowserOSStrategyCache;
++
++constexpr char kElement[] = "click:button/div";
++
++base::Time Now() {
++  return base::Time::FromSecondsSinceUnixEpoch(1'700'000'000);
++}
++
++base::Value::Dict Entry(double score, base::Time updated) {
++  return base::Value::Dict()
++      .Set("score", score)
++      .Set("updated", updated.InSecondsFSinceUnixEpoch());
++}
++
++const base::Value::Dict* Strategies(const base::Value::Dict& origin_dict) {
++  const base::Value::Dict* elements = origin_dict.FindDict("elements");
++  return elements ? elements->FindDict(kElement) : nullptr;
++}
++
++// =============================================================================
++// Decay
++// =============================================================================
++
++TEST(BrowserOSStrategyCacheTest, ScoreHalvesEveryHalfLife) {
++  EXPECT_DOUBLE_EQ(4, Cache::DecayedScore(Entry(4, Now()), Now()));
++  EXPECT_DOUBLE_EQ(
++      2, Cache::DecayedScore(Entry(4, Now() - Cache::kHalfLife), Now()));
++  EXPECT_DOUBLE_EQ(
++      -1, Cache::DecayedScore(Entry(-4, Now() - 2 * Cache::kHalfLife), Now()));
++}
++
++TEST(BrowserOSStrategyCacheTest, FutureTimestampIsNotInflated) {
++  EXPECT_DOUBLE_EQ(
++      3, Cache::DecayedScore(Entry(3, Now() + base::Days(1)), Now()));
++}
++
++TEST(BrowserOSStrategyCacheTest, SuccessesAccumulateWithDecay) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "html", true, Now() - Cache::kHalfLife);
++  Cache::RecordResult(origin, kElement, "html", true, Now());
++
++  EXPECT_DOUBLE_EQ(1.5, Cache::DecayedScore(
++                            *Strategies(origin)->FindDict("html"), Now()));
++}
++
++// =============================================================================
++// Preference
++// =============================================================================
++
++TEST(BrowserOSStrategyCacheTest, PrefersHighestScoringStrategy) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "point", false, Now());
++  Cache::RecordResult(origin, kElement, "html", true, Now());
++  Cache::RecordResult(origin, kElement, "accessibility", true, Now());
++  Cache::RecordResult(origin, kElement, "accessibility", true, Now());
++
++  EXPECT_EQ("accessibility",
++            Cache::GetPreferredStrategy(origin, kElement, Now()));
++  EXPECT_EQ(std::nullopt,
++            Cache::GetPreferredStrategy(origin, "type:textbox/div", Now()));
++}
++
++TEST(BrowserOSStrategyCacheTest, DecayedSuccessIsNoLongerPreferred) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "html", true, Now());
++
++  EXPECT_EQ("html", Cache::GetPreferredStrategy(origin, kElement, Now()));
++  EXPECT_EQ(std::nullopt,
++            Cache::GetPreferredStrategy(origin, kElement,
++                                        Now() + 2 * Cache::kHalfLife));
++}
++
++TEST(BrowserOSStrategyCacheTest, FailuresAloneAreNeverPreferred) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "point", false, Now());
++
++  EXPECT_EQ(std::nullopt, Cache::GetPreferredStrategy(origin, kElement, Now()));
++}
++
++// =============================================================================
++// Forgetting
++// =============================================================================
++
++TEST(BrowserOSStrategyCacheTest, DecayedStrategiesAreForgotten) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "point", false,
++                      Now() - 10 * Cache::kHalfLife);
++  Cache::RecordResult(origin, kElement, "html", true,
++                      Now() - Cache::kHalfLife);
++  Cache::RecordResult(origin, kElement, "accessibility", true, Now());
++
++  const base::Value::Dict* strategies = Strategies(origin);
++  ASSERT_TRUE(strategies);
++  EXPECT_FALSE(strategies->contains("point"));
++  EXPECT_TRUE(strategies->contains("html"));
++  EXPECT_TRUE(strategies->contains("accessibility"));
++}
++
++TEST(BrowserOSStrategyCacheTest, CancelledOutScoreIsForgotten) {
++  base::Value::Dict origin;
++  Cache::RecordResult(origin, kElement, "html", true, Now());
++  Cache::RecordResult(origin, kElement, "html", false, Now());
++
++  EXPECT_FALSE(Strategies(origin)->contains("html"));
++}
++
++// =============================================================================
++// Eviction
++// =============================================================================
++
++TEST(BrowserOSStrategyCacheTest, EvictsLeastRecentlyUpdatedOrigins) {
++  base::Value::Dict origins;
++  for (size_t i = 0; i <= Cache::kMaxOrigins; ++i) {
++    // Origin 7 is the oldest; the rest are in insertion order.
++    base::Time updated =
++        i == 7 ? Now() - base::Days(365) : Now() + base::Seconds(i);
++    Cache::RecordResult(
++        *origins.EnsureDict("https://site" + base::NumberToString(i) + ".test"),
++        kElement, "html", true, updated);
++  }
++  ASSERT_EQ(Cache::kMaxOrigins + 1, origins.size());
++
++  Cache::EvictOrigins(origins, Cache::kMaxOrigins);
++
++  EXPECT_EQ(Cache::kMaxOrigins, origins.size());
++  EXPECT_FALSE(origins.contains("https://site7.test"));
++  EXPECT_TRUE(origins.contains("https://site0.test"));
++
++  Cache::EvictOrigins(origins, 2);
++  EXPECT_EQ(2u, origins.size());
++  EXPECT_TRUE(origins.contains(
++      "https://site" + base::NumberToString(Cache::kMaxOrigins) + ".test"));
++}
++
++// =============================================================================
++// Persistence
++// =============================================================================
++
++class BrowserOSStrategyCachePersistenceTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    prefs_.registry()->RegisterDictionaryPref(
++        browseros::prefs::kActionStrategies);
++    registrar_.Init(&prefs_);
++    registrar_.Add(browseros::prefs::kActionStrategies,
++                   base::BindLambdaForTesting([&]() { ++writes_; }));
++  }
++
++  const base::Value::Dict& Stored() {
++    return prefs_.GetDict(browseros::prefs::kActionStrategies);
++  }
++
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
++  TestingPrefServiceSimple prefs_;
++  PrefChangeRegistrar registrar_;
++  int writes_ = 0;
++};
++
++TEST_F(BrowserOSStrategyCachePersistenceTest, BatchesWritesToPrefs) {
++  Cache cache(&prefs_);
++  for (int i = 0; i < 10; ++i) {
++    cache.RecordForOrigin("https://a.test", kElement, "html", true);
++  }
++  cache.RecordForOrigin("https://b.test", kElement, "point", false);
++
++  // Served from memory before anything is written.
++  EXPECT_EQ("html", cache.GetPreferredForOrigin("https://a.test", kElement));
++  EXPECT_EQ(0, writes_);
++
++  task_environment_.FastForwardBy(Cache::kPersistDelay);
++  EXPECT_EQ(1, writes_);
++  EXPECT_TRUE(Stored().contains("https://a.test"));
++  EXPECT_TRUE(Stored().contains("https://b.test"));
++
++  // Nothing new, nothing written.
++  task_environment_.FastForwardBy(Cache::kPersistDelay);
++  cache.Shutdown();
++  EXPECT_EQ(1, writes_);
++}
++
++TEST_F(BrowserOSStrategyCachePersistenceTest, ShutdownWritesPendingRecord) {
++  {
++    Cache cache(&prefs_);
++    cache.RecordForOrigin("https://a.test", kElement, "html", true);
++    cache.Shutdown();
++  }
++  EXPECT_EQ(1, writes_);
++
++  // A later session starts from what was written.
++  Cache cache(&prefs_);
++  EXPECT_EQ("html", cache.GetPreferredForOrigin("https://a.test", kElement));
++}
++
++TEST_F(BrowserOSStrategyCachePersistenceTest, FlushWritesPendingRecordNow) {
++  Cache cache(&prefs_);
++  cache.RecordForOrigin("https://a.test", kElement, "html", true);
++
++  cache.Flush();
++  EXPECT_EQ(1, writes_);
++  EXPECT_TRUE(Stored().contains("https://a.test"));
++
++  // Nothing left for the timer to write.
++  task_environment_.FastForwardBy(Cache::kPersistDelay);
++  EXPECT_EQ(1, writes_);
++}
++
++TEST_F(BrowserOSStrategyCachePersistenceTest, ExternalResetClearsRecord) {
++  Cache cache(&prefs_);
++  cache.RecordForOrigin("https://a.test", kElement, "html", true);
++  task_environment_.FastForwardBy(Cache::kPersistDelay);
++  cache.RecordForOrigin("https://b.test", kElement, "html", true);
++
++  prefs_.SetDict(browseros::prefs::kActionStrategies, base::Value::Dict());
++  EXPECT_FALSE(cache.GetPreferredForOrigin("https://a.test", kElement));
++  EXPECT_FALSE(cache.GetPreferredForOrigin("https://b.test", kElement));
++
++  // The record made before the reset is not written back over it.
++  task_environment_.FastForwardBy(Cache::kPersistDelay);
++  cache.Shutdown();
++  EXPECT_TRUE(Stored().empty());
++}
++
++}  // namespace
++}  // namespace api
++}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
 new file mode 100644
-index 0000000000000..b9cbddf65327e
+index 0000000000000..53f82f8d42cee
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
-@@ -0,0 +1,71 @@
+@@ -0,0 +1,56 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -22,36 +22,21 @@ index 0000000000000..b9cbddf65327e
 +// Extracts structured text content from accessibility tree snapshots for
 +// BrowserOS LLM features (LLM Chat, Clash of GPTs).
 +//
-+// Uses depth-first search (DFS) with semantic boundary detection to extract
-+// clean, structured text without duplication. Formats output as markdown-like
-+// text optimized for LLM consumption.
-+//
-+// Extraction Strategy:
++// Thin wrapper over the markdown format of browseros::PageTextIndex, which
++// owns the extraction rules:
 +//   - Navigation/Banner: Extracted with spacing to separate from content
 +//   - Headings: Formatted as markdown (# ## ### etc.)
 +//   - Links: Text extracted only (URLs skipped to avoid clutter)
 +//   - Images: Alt text extracted as [Image: description]
-+//   - Lists: Formatted with proper indentation using tabs
-+//   - List items: Indented based on nesting depth
++//   - Lists: List items indented with tabs by nesting depth
 +//   - Paragraphs: Separated with double newlines
-+//   - Text nodes: Extracted with appropriate spacing
 +//
-+// Semantic Boundary Detection:
-+//   The extractor stops recursion at headings, links, and images to prevent
-+//   extracting their child text multiple times, which would otherwise appear
-+//   as duplicates in the output.
++// Callers that start from a WebContents should prefer
++// browseros::PageContentCache, which avoids re-snapshotting unchanged pages.
 +//
 +// Thread Safety:
 +//   All methods are static and stateless. Safe to call from any thread.
 +//
-+// Example usage:
-+//   active_contents->RequestAXTreeSnapshot(
-+//       base::BindOnce([](ui::AXTreeUpdate& update) {
-+//         std::u16string text = side_panel::BrowserOSSimplePageExtractor
-+//             ::ExtractStructuredText(update);
-+//         // Use extracted text...
-+//       }), ...);
-+//
 +class BrowserOSSimplePageExtractor {
 + public:
 +  // Extracts structured text from an accessibility tree update.
@@ -1,18 +1,24 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
 new file mode 100644
-index 0000000000000..9e1c6dc9fe8a1
+index 0000000000000..b1c9be984ec25
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
-@@ -0,0 +1,568 @@
+@@ -0,0 +1,1027 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
++#include <algorithm>
++#include <map>
++#include <set>
++
 +#include "base/check.h"
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
++#include "base/memory/memory_pressure_listener.h"
++#include "base/process/process.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
@@ -32,13 +38,19 @@ index 0000000000000..9e1c6dc9fe8a1
 +#include "components/prefs/pref_service.h"
 +#include "components/prefs/scoped_user_pref_update.h"
 +#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/site_instance.h"
 +#include "content/public/browser/web_contents.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
 +#include "ui/base/clipboard/clipboard.h"
 +#include "ui/base/clipboard/scoped_clipboard_writer.h"
-+#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_mode.h"
 +#include "ui/events/keycodes/keyboard_codes.h"
 +#include "third_party/blink/public/common/input/web_input_event.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
++#include "chrome/browser/browseros/page_content/page_text_index.h"
 +
 +namespace {
 +
@@ -46,6 +58,31 @@ index 0000000000000..9e1c6dc9fe8a1
 +const char kClashOfGptsPaneProvidersPref[] = "browseros.clash_of_gpts.pane_providers";  // Per-pane selections
 +const char kClashOfGptsLastUrlsPref[] = "browseros.clash_of_gpts.last_urls";
 +const char kClashOfGptsPaneCountPref[] = "browseros.clash_of_gpts.pane_count";
++const char kClashOfGptsProcessPolicyPref[] =
++    "browseros.clash_of_gpts.process_policy";
++
++// A hidden pane is frozen after kFreezeDelay and, once it is no longer
++// attached to the window, discarded after a further kDiscardDelay.
++constexpr base::TimeDelta kFreezeDelay = base::Minutes(5);
++constexpr base::TimeDelta kDiscardDelay = base::Minutes(30);
++
++// Pane memory is also sampled whenever a pane finishes loading, which is
++// when it changes most; the timer only catches slow growth.
++constexpr base::TimeDelta kMemoryReportInterval = base::Minutes(1);
++
++// Formats extracted page text for pasting into an LLM, leaving the prompt
++// section for the user (or the broadcast prompt) to fill in.
++std::u16string FormatPageContent(const std::u16string& title,
++                                 const GURL& url,
++                                 const std::u16string& text) {
++  std::u16string formatted_output =
++      u"----------- WEB PAGE CONTENT -----------\n\n";
++  formatted_output += u"TITLE: " + title + u"\n\n";
++  formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
++  formatted_output += u"CONTENT:\n\n" + text;
++  formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
++  return formatted_output;
++}
 +
 +// Shared provider list preference (from third_party_llm)
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
@@ -68,6 +105,10 @@ index 0000000000000..9e1c6dc9fe8a1
 +  pane_provider_indices_[2] = 2;
 +
 +  LoadState();
++
++  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
++      FROM_HERE, base::BindRepeating(&ClashOfGptsCoordinator::OnMemoryPressure,
++                                     base::Unretained(this)));
 +}
 +
 +ClashOfGptsCoordinator::~ClashOfGptsCoordinator() {
@@ -82,16 +123,31 @@ index 0000000000000..9e1c6dc9fe8a1
 +    widget_->Show();
 +    widget_->Activate();
 +    browseros_metrics::BrowserOSMetrics::Log("llmhub.shown");
++
++    memory_report_timer_.Start(
++        FROM_HERE, kMemoryReportInterval,
++        base::BindRepeating(&ClashOfGptsCoordinator::RequestPaneMemoryReport,
++                            base::Unretained(this)));
++    RequestPaneMemoryReport();
 +  }
 +}
 +
 +void ClashOfGptsCoordinator::Close() {
++  memory_report_timer_.Stop();
 +  if (widget_) {
 +    // Following Chromium style guide: destroy widget by resetting unique_ptr
 +    widget_.reset();
 +  }
 +  window_.reset();
 +  view_ = nullptr;
++
++  // The panes outlive the window so reopening is instant; they freeze and
++  // are eventually discarded while it stays closed.
++  for (PaneSlot& pane : panes_) {
++    if (pane.web_contents) {
++      pane.web_contents->WasHidden();
++    }
++  }
 +}
 +
 +bool ClashOfGptsCoordinator::IsShowing() const {
@@ -128,28 +184,24 @@ index 0000000000000..9e1c6dc9fe8a1
 +  std::u16string page_title = active_contents->GetTitle();
 +  GURL page_url = active_contents->GetVisibleURL();
 +
-+  // Request accessibility tree snapshot (similar to the side panel implementation)
-+  active_contents->RequestAXTreeSnapshot(
-+      base::BindOnce([](std::u16string title, GURL url, ui::AXTreeUpdate& update) {
-+        // Extract text from accessibility tree
-+        std::u16string extracted_text;
-+        // TODO: Implement text extraction similar to third_party_llm_panel_coordinator.cc
-+        
-+        // Format the output for comparison across LLMs
-+        std::u16string formatted_output = u"----------- WEB PAGE CONTENT -----------\n\n";
-+        formatted_output += u"TITLE: " + title + u"\n\n";
-+        formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
-+        formatted_output += u"CONTENT:\n\n" + extracted_text;
-+        formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
-+
-+        // Copy to clipboard
-+        ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+        clipboard_writer.WriteText(formatted_output);
-+      }, page_title, page_url),
-+      ui::AXMode::kWebContents,
-+      0,  // max_nodes (0 = no limit)
++  // Same extraction and per-tab cache as the LLM chat side panel
++  browseros::PageContentCache::GetIndex(
++      active_contents, ui::AXMode::kWebContents,
++      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants,
 +      base::Seconds(5),  // timeout
-+      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++      base::BindOnce(
++          [](std::u16string title, GURL url,
++             scoped_refptr<const browseros::PageTextIndex> index) {
++            // Format the output for comparison across LLMs
++            std::u16string formatted_output =
++                FormatPageContent(title, url, index->GetPlainText());
++
++            // Copy to clipboard
++            ui::ScopedClipboardWriter clipboard_writer(
++                ui::ClipboardBuffer::kCopyPaste);
++            clipboard_writer.WriteText(formatted_output);
++          },
++          page_title, page_url));
 +
 +  // Show feedback in the UI
 +  if (view_) {
@@ -157,6 +209,113 @@ index 0000000000000..9e1c6dc9fe8a1
 +  }
 +}
 +
++void ClashOfGptsCoordinator::BroadcastPrompt(const std::u16string& prompt,
++                                             bool include_page_content) {
++  if (!include_page_content) {
++    if (!prompt.empty()) {
++      StartBroadcast(prompt, /*includes_page_content=*/false);
++    }
++    return;
++  }
++
++  content::WebContents* active_contents =
++      GetBrowser().tab_strip_model()->GetActiveWebContents();
++  if (!active_contents) {
++    return;
++  }
++
++  // Extract once, however many panes receive it.
++  browseros::PageContentCache::GetIndex(
++      active_contents, ui::AXMode::kWebContents,
++      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants,
++      base::Seconds(5),  // timeout
++      base::BindOnce(
++          [](base::WeakPtr<ClashOfGptsCoordinator> coordinator,
++             std::u16string title, GURL url, std::u16string prompt,
++             scoped_refptr<const browseros::PageTextIndex> index) {
++            if (coordinator) {
++              coordinator->StartBroadcast(
++                  FormatPageContent(title, url, index->GetPlainText()) +
++                      prompt,
++                  /*includes_page_content=*/true);
++            }
++          },
++          weak_factory_.GetWeakPtr(), active_contents->GetTitle(),
++          active_contents->GetVisibleURL(), prompt));
++}
++
++void ClashOfGptsCoordinator::StartBroadcast(std::u16string text,
++                                            bool includes_page_content) {
++  std::vector<ClashOfGptsPromptBroadcaster::PaneTarget> targets;
++  for (int i = 0; i < current_pane_count_; ++i) {
++    PaneSlot& pane = panes_[i];
++    // Unloaded panes are listed without a page so the feedback counts them
++    // as skipped rather than leaving them out.
++    if (!pane.web_contents || pane.lifecycle == PaneLifecycle::kUnloaded) {
++      targets.push_back({i, nullptr});
++      continue;
++    }
++    if (pane.lifecycle == PaneLifecycle::kFrozen) {
++      pane.web_contents->SetPageFrozen(false);
++      pane.lifecycle = PaneLifecycle::kActive;
++      // Still hidden, so it freezes again once the reply has had time.
++      pane.idle_timer.Start(
++          FROM_HERE, kFreezeDelay,
++          base::BindOnce(&ClashOfGptsCoordinator::FreezePane,
++                         base::Unretained(this), i));
++    }
++    targets.push_back({i, pane.web_contents.get()});
++  }
++
++  broadcaster_ = std::make_unique<ClashOfGptsPromptBroadcaster>(
++      targets, std::move(text),
++      base::BindOnce(&ClashOfGptsCoordinator::OnBroadcastDone,
++                     base::Unretained(this), includes_page_content));
++  broadcaster_->Start();
++}
++
++void ClashOfGptsCoordinator::OnBroadcastDone(
++    bool includes_page_content,
++    std::vector<ClashOfGptsPromptBroadcaster::PaneResult> results) {
++  std::ranges::sort(results, {},
++                    &ClashOfGptsPromptBroadcaster::PaneResult::pane_index);
++
++  int submitted = 0;
++  base::TimeDelta max_latency;
++  std::u16string details;
++  for (const auto& result : results) {
++    details += u"  •  Pane " + base::NumberToString16(result.pane_index + 1) +
++               u": ";
++    if (result.submitted) {
++      ++submitted;
++      max_latency = std::max(max_latency, result.latency);
++      details += base::NumberToString16(result.latency.InMilliseconds()) +
++                 u" ms";
++    } else {
++      details += base::UTF8ToUTF16(result.outcome);
++    }
++  }
++
++  browseros_metrics::BrowserOSMetrics::Log(
++      "llmhub.broadcast",
++      {{"panes", base::Value(static_cast<int>(results.size()))},
++       {"submitted", base::Value(submitted)},
++       {"max_latency_ms",
++        base::Value(static_cast<int>(max_latency.InMilliseconds()))},
++       {"page_content", base::Value(includes_page_content)}});
++
++  if (view_) {
++    view_->ShowFeedback(u"Sent to " + base::NumberToString16(submitted) +
++                        u"/" + base::NumberToString16(results.size()) +
++                        u" panes" + details);
++  }
++
++  // Destroy the finished broadcaster asynchronously; we are inside its
++  // callback.
++  base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
++      FROM_HERE, std::move(broadcaster_));
++}
++
 +std::vector<LlmProviderInfo> ClashOfGptsCoordinator::GetDefaultProviders() const {
 +  std::vector<LlmProviderInfo> defaults;
 +  defaults.push_back({u"ChatGPT", GURL("https://chatgpt.com")});
@@ -234,28 +393,22 @@ index 0000000000000..9e1c6dc9fe8a1
 +  }
 +
 +  // Save the current URL for this pane/provider combo
-+  if (view_) {
-+    if (content::WebContents* web_contents = view_->GetWebContentsForPane(pane_index)) {
-+      GURL current_url = web_contents->GetURL();
-+      if (current_url.is_valid()) {
-+        last_urls_[{pane_index, pane_provider_indices_[pane_index]}] = current_url;
-+      }
-+    }
-+  }
++  SaveUrlForPane(pane_index);
 +
 +  pane_provider_indices_[pane_index] = provider_index;
 +  SaveState();
 +
-+  // Navigate to the new provider URL
-+  if (view_) {
-+    GURL provider_url;
-+    auto it = last_urls_.find({pane_index, provider_index});
-+    if (it != last_urls_.end() && it->second.is_valid()) {
-+      provider_url = it->second;
-+    } else {
-+      provider_url = providers_[provider_index].url;
++  // Navigate to the new provider URL. Panes that have not loaded yet pick
++  // it up when they are first shown.
++  PaneSlot& pane = panes_[pane_index];
++  if (pane.web_contents && pane.lifecycle != PaneLifecycle::kUnloaded) {
++    if (pane.lifecycle == PaneLifecycle::kFrozen) {
++      pane.web_contents->SetPageFrozen(false);
++      pane.lifecycle = PaneLifecycle::kActive;
 +    }
-+    view_->NavigatePaneToUrl(pane_index, provider_url);
++    pane.web_contents->GetController().LoadURL(
++        GetRestoreUrlForPane(pane_index), content::Referrer(),
++        ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
 +  }
 +}
 +
@@ -275,6 +428,14 @@ index 0000000000000..9e1c6dc9fe8a1
 +    view_->UpdatePaneCount(count);
 +  }
 +
++  // Collapsed panes keep their WebContents for a quick expand, but idle
++  // towards freeze/discard like any hidden pane.
++  for (int i = count; i < kMaxPanes; ++i) {
++    if (panes_[i].web_contents) {
++      panes_[i].web_contents->WasHidden();
++    }
++  }
++
 +  // Resize window based on new pane count
 +  if (widget_ && widget_->IsVisible()) {
 +    // int window_width = current_pane_count_ == 2 ? 1000 : 1400;
@@ -481,63 +642,361 @@ index 0000000000000..9e1c6dc9fe8a1
 +  registry->RegisterListPref(kClashOfGptsPaneProvidersPref);
 +  registry->RegisterDictionaryPref(kClashOfGptsLastUrlsPref);
 +  registry->RegisterIntegerPref(kClashOfGptsPaneCountPref, kDefaultPaneCount);
++  registry->RegisterIntegerPref(
++      kClashOfGptsProcessPolicyPref,
++      static_cast<int>(ProcessPolicy::kIsolated));
 +}
 +
 +
 +// PaneWebContentsObserver implementation
 +ClashOfGptsCoordinator::PaneWebContentsObserver::PaneWebContentsObserver(
-+    ClashOfGptsCoordinator* coordinator, content::WebContents* web_contents)
++    ClashOfGptsCoordinator* coordinator,
++    int pane_index,
++    content::WebContents* web_contents)
 +    : content::WebContentsObserver(web_contents),
-+      coordinator_(coordinator) {}
++      coordinator_(coordinator),
++      pane_index_(pane_index) {}
 +
 +ClashOfGptsCoordinator::PaneWebContentsObserver::~PaneWebContentsObserver() = default;
 +
 +void ClashOfGptsCoordinator::PaneWebContentsObserver::DidFinishLoad(
 +    content::RenderFrameHost* render_frame_host,
 +    const GURL& validated_url) {
-+  // Nothing to do on page load
++  if (render_frame_host->IsInPrimaryMainFrame()) {
++    coordinator_->OnPaneLoaded(pane_index_);
++  }
 +}
 +
++void ClashOfGptsCoordinator::PaneWebContentsObserver::OnVisibilityChanged(
++    content::Visibility visibility) {
++  coordinator_->OnPaneVisibilityChanged(pane_index_, visibility);
++}
++
++ClashOfGptsCoordinator::PaneSlot::PaneSlot() = default;
++ClashOfGptsCoordinator::PaneSlot::~PaneSlot() = default;
++
 +content::WebContents* ClashOfGptsCoordinator::GetOrCreateWebContentsForPane(int pane_index) {
 +  if (pane_index < 0 || pane_index >= kMaxPanes) {
 +    return nullptr;
 +  }
 +
-+  if (!owned_web_contents_[pane_index]) {
++  PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents) {
 +    content::WebContents::CreateParams params(GetBrowser().profile());
-+    owned_web_contents_[pane_index] = content::WebContents::Create(params);
++    // Stay hidden until a visible WebView shows the pane; LoadPane()
++    // navigates then, so collapsed or never-shown panes cost no renderer.
++    params.initially_hidden = true;
++    if (GetProcessPolicy() == ProcessPolicy::kShareSameSite) {
++      params.site_instance =
++          FindSharedSiteInstance(pane_index, GetRestoreUrlForPane(pane_index));
++    }
++    pane.web_contents = content::WebContents::Create(params);
++    pane.lifecycle = PaneLifecycle::kUnloaded;
 +
 +    // Set this as the delegate to handle keyboard events
-+    owned_web_contents_[pane_index]->SetDelegate(this);
++    pane.web_contents->SetDelegate(this);
 +
 +    // Create observer for this pane
-+    pane_observers_[pane_index] = std::make_unique<PaneWebContentsObserver>(
-+        this, owned_web_contents_[pane_index].get());
++    pane.observer = std::make_unique<PaneWebContentsObserver>(
++        this, pane_index, pane.web_contents.get());
++  }
++
++  return pane.web_contents.get();
++}
++
++GURL ClashOfGptsCoordinator::GetRestoreUrlForPane(int pane_index) const {
++  size_t provider_index = pane_provider_indices_[pane_index];
++  auto it = last_urls_.find({pane_index, provider_index});
++  if (it != last_urls_.end() && it->second.is_valid()) {
++    return it->second;
++  }
++  if (provider_index < providers_.size()) {
++    return providers_[provider_index].url;
++  }
++  return GURL();
++}
++
++void ClashOfGptsCoordinator::SaveUrlForPane(int pane_index) {
++  const PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents || pane.lifecycle == PaneLifecycle::kUnloaded) {
++    return;
++  }
++  GURL current_url = pane.web_contents->GetURL();
++  if (current_url.is_valid() && current_url.SchemeIsHTTPOrHTTPS()) {
++    last_urls_[{pane_index, pane_provider_indices_[pane_index]}] = current_url;
++  }
++}
++
++void ClashOfGptsCoordinator::OnPaneVisibilityChanged(
++    int pane_index,
++    content::Visibility visibility) {
++  PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents) {
++    return;
++  }
++
++  if (visibility == content::Visibility::VISIBLE) {
++    pane.idle_timer.Stop();
++    if (pane.lifecycle == PaneLifecycle::kUnloaded) {
++      LoadPane(pane_index);
++    } else if (pane.lifecycle == PaneLifecycle::kFrozen) {
++      pane.web_contents->SetPageFrozen(false);
++      pane.lifecycle = PaneLifecycle::kActive;
++    }
++    return;
++  }
++
++  if (pane.lifecycle == PaneLifecycle::kActive &&
++      !pane.idle_timer.IsRunning()) {
++    pane.idle_timer.Start(
++        FROM_HERE, kFreezeDelay,
++        base::BindOnce(&ClashOfGptsCoordinator::FreezePane,
++                       base::Unretained(this), pane_index));
++  }
++}
++
++void ClashOfGptsCoordinator::LoadPane(int pane_index) {
++  PaneSlot& pane = panes_[pane_index];
++  GURL url = GetRestoreUrlForPane(pane_index);
++  if (!url.is_valid()) {
++    return;
++  }
++
++  pane.web_contents->GetController().LoadURL(
++      url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++      std::string());
++  pane.lifecycle = PaneLifecycle::kActive;
++}
++
++void ClashOfGptsCoordinator::FreezePane(int pane_index) {
++  PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents || pane.lifecycle != PaneLifecycle::kActive ||
++      pane.web_contents->GetVisibility() == content::Visibility::VISIBLE) {
++    return;
++  }
++
++  // Like tab freezing, leave pages that are playing audio alone.
++  if (pane.web_contents->IsCurrentlyAudible()) {
++    pane.idle_timer.Start(
++        FROM_HERE, kFreezeDelay,
++        base::BindOnce(&ClashOfGptsCoordinator::FreezePane,
++                       base::Unretained(this), pane_index));
++    return;
 +  }
 +
-+  return owned_web_contents_[pane_index].get();
++  pane.web_contents->SetPageFrozen(true);
++  pane.lifecycle = PaneLifecycle::kFrozen;
++  pane.idle_timer.Start(
++      FROM_HERE, kDiscardDelay,
++      base::BindOnce(&ClashOfGptsCoordinator::DiscardIdlePane,
++                     base::Unretained(this), pane_index));
++}
++
++void ClashOfGptsCoordinator::DiscardIdlePane(int pane_index) {
++  PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents || pane.lifecycle != PaneLifecycle::kFrozen) {
++    return;
++  }
++  if (CanDiscardPane(pane_index)) {
++    DiscardPane(pane_index);
++    return;
++  }
++  // Frozen while its window was open; keep checking so it is dropped once
++  // the window closes, not only under memory pressure.
++  pane.idle_timer.Start(
++      FROM_HERE, kDiscardDelay,
++      base::BindOnce(&ClashOfGptsCoordinator::DiscardIdlePane,
++                     base::Unretained(this), pane_index));
++}
++
++void ClashOfGptsCoordinator::DiscardPane(int pane_index) {
++  PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents) {
++    return;
++  }
++
++  SaveUrlForPane(pane_index);
++  SaveState();
++
++  pane.idle_timer.Stop();
++  pane.observer.reset();
++  pane.web_contents.reset();
++  pane.lifecycle = PaneLifecycle::kUnloaded;
++
++  browseros_metrics::BrowserOSMetrics::Log("llmhub.pane.discarded");
++}
++
++bool ClashOfGptsCoordinator::CanDiscardPane(int pane_index) const {
++  return !view_ || pane_index >= current_pane_count_;
++}
++
++ClashOfGptsCoordinator::ProcessPolicy
++ClashOfGptsCoordinator::GetProcessPolicy() const {
++  PrefService* prefs = GetBrowser().profile()->GetPrefs();
++  if (prefs && prefs->GetInteger(kClashOfGptsProcessPolicyPref) ==
++                   static_cast<int>(ProcessPolicy::kShareSameSite)) {
++    return ProcessPolicy::kShareSameSite;
++  }
++  return ProcessPolicy::kIsolated;
++}
++
++scoped_refptr<content::SiteInstance>
++ClashOfGptsCoordinator::FindSharedSiteInstance(int pane_index,
++                                               const GURL& url) const {
++  if (!url.is_valid()) {
++    return nullptr;
++  }
++  for (int i = 0; i < kMaxPanes; ++i) {
++    const PaneSlot& other = panes_[i];
++    if (i == pane_index || !other.web_contents ||
++        other.lifecycle == PaneLifecycle::kUnloaded) {
++      continue;
++    }
++    content::SiteInstance* instance =
++        other.web_contents->GetPrimaryMainFrame()->GetSiteInstance();
++    if (instance->IsSameSiteWithURL(url)) {
++      return instance;
++    }
++  }
++  return nullptr;
++}
++
++void ClashOfGptsCoordinator::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
++    return;
++  }
++
++  // Moderate pressure drops panes that are already frozen; critical pressure
++  // drops every pane the user cannot currently see.
++  bool critical =
++      level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL;
++  for (int i = 0; i < kMaxPanes; ++i) {
++    const PaneSlot& pane = panes_[i];
++    if (!pane.web_contents || !CanDiscardPane(i)) {
++      continue;
++    }
++    if (critical || pane.lifecycle == PaneLifecycle::kFrozen) {
++      DiscardPane(i);
++    }
++  }
++}
++
++base::ProcessId ClashOfGptsCoordinator::GetPaneProcessId(
++    int pane_index) const {
++  const PaneSlot& pane = panes_[pane_index];
++  if (!pane.web_contents || pane.lifecycle != PaneLifecycle::kActive) {
++    return base::kNullProcessId;
++  }
++  const base::Process& process =
++      pane.web_contents->GetPrimaryMainFrame()->GetProcess()->GetProcess();
++  return process.IsValid() ? process.Pid() : base::kNullProcessId;
++}
++
++void ClashOfGptsCoordinator::OnPaneLoaded(int pane_index) {
++  if (view_ && pane_index < current_pane_count_) {
++    RequestPaneMemoryReport();
++  }
++}
++
++void ClashOfGptsCoordinator::RequestPaneMemoryReport() {
++  if (!view_) {
++    memory_report_timer_.Stop();
++    return;
++  }
++
++  std::set<base::ProcessId> pids;
++  for (int i = 0; i < current_pane_count_; ++i) {
++    base::ProcessId pid = GetPaneProcessId(i);
++    if (pid != base::kNullProcessId) {
++      pids.insert(pid);
++    }
++  }
++  std::erase_if(pane_footprint_kb_, [&pids](const auto& entry) {
++    return !pids.contains(entry.first);
++  });
++  UpdatePaneStatuses();
++
++  auto* instrumentation =
++      memory_instrumentation::MemoryInstrumentation::GetInstance();
++  if (!instrumentation) {
++    return;
++  }
++  // kNullProcessId would dump every process in the browser.
++  for (base::ProcessId pid : pids) {
++    instrumentation->RequestPrivateMemoryFootprint(
++        pid, base::BindOnce(&ClashOfGptsCoordinator::OnPaneMemoryReport,
++                            weak_factory_.GetWeakPtr(), pid));
++  }
++}
++
++void ClashOfGptsCoordinator::OnPaneMemoryReport(
++    base::ProcessId pid,
++    bool success,
++    std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump) {
++  if (!view_) {
++    return;
++  }
++  if (!success || !dump) {
++    pane_footprint_kb_.erase(pid);
++    UpdatePaneStatuses();
++    return;
++  }
++  for (const auto& process_dump : dump->process_dumps()) {
++    if (process_dump.pid() == pid) {
++      pane_footprint_kb_[pid] = process_dump.os_dump().private_footprint_kb;
++    }
++  }
++  UpdatePaneStatuses();
++}
++
++void ClashOfGptsCoordinator::UpdatePaneStatuses() {
++  // Panes sharing a renderer report the same process, so flag them.
++  std::map<base::ProcessId, int> panes_per_process;
++  std::array<base::ProcessId, kMaxPanes> pane_pids = {};
++  for (int i = 0; i < current_pane_count_; ++i) {
++    pane_pids[i] = GetPaneProcessId(i);
++    if (pane_pids[i] != base::kNullProcessId) {
++      ++panes_per_process[pane_pids[i]];
++    }
++  }
++
++  for (int i = 0; i < current_pane_count_; ++i) {
++    const PaneSlot& pane = panes_[i];
++    std::u16string status;
++    if (!pane.web_contents || pane.lifecycle == PaneLifecycle::kUnloaded) {
++      status = u"Not loaded";
++    } else if (pane.lifecycle == PaneLifecycle::kFrozen) {
++      status = u"Frozen";
++    } else if (auto it = pane_footprint_kb_.find(pane_pids[i]);
++               it != pane_footprint_kb_.end()) {
++      status = base::UTF8ToUTF16(base::StringPrintf(
++          "%u MB%s", it->second / 1024,
++          panes_per_process[pane_pids[i]] > 1 ? " (shared)" : ""));
++    }
++    view_->SetPaneStatus(i, status);
++  }
 +}
 +
 +void ClashOfGptsCoordinator::CleanupWebContents() {
++  memory_report_timer_.Stop();
++  broadcaster_.reset();
++
 +  // Save any URLs before cleanup
-+  if (view_) {
-+    for (int i = 0; i < current_pane_count_; ++i) {
-+      if (content::WebContents* web_contents = view_->GetWebContentsForPane(i)) {
-+        GURL current_url = web_contents->GetURL();
-+        if (current_url.is_valid()) {
-+          last_urls_[{i, pane_provider_indices_[i]}] = current_url;
-+        }
-+      }
-+    }
++  for (int i = 0; i < kMaxPanes; ++i) {
++    SaveUrlForPane(i);
 +  }
 +
 +  // Clear all WebContents first
-+  for (int i = 0; i < kMaxPanes; ++i) {
++  for (PaneSlot& pane : panes_) {
++    pane.idle_timer.Stop();
++
 +    // Clear the observer first
-+    pane_observers_[i].reset();
++    pane.observer.reset();
 +
 +    // Then destroy the WebContents
-+    owned_web_contents_[i].reset();
++    pane.web_contents.reset();
++    pane.lifecycle = PaneLifecycle::kUnloaded;
 +  }
 +
 +  // Remove view observation before widget cleanup
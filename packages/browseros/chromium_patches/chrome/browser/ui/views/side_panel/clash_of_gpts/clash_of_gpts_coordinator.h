@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
 new file mode 100644
-index 0000000000000..80c7895b1e08b
+index 0000000000000..cb56aca5b64f5
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
-@@ -0,0 +1,214 @@
+@@ -0,0 +1,329 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,13 +17,19 @@ index 0000000000000..80c7895b1e08b
 +#include <string>
 +#include <vector>
 +
++#include "base/memory/memory_pressure_listener.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/process/process_handle.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
++#include "base/timer/timer.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
 +#include "chrome/browser/profiles/profile_observer.h"
++#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.h"
 +#include "content/public/browser/web_contents_delegate.h"
++#include "content/public/browser/visibility.h"
 +#include "content/public/browser/web_contents_observer.h"
 +#include "third_party/blink/public/mojom/window_features/window_features.mojom-forward.h"
 +#include "ui/base/window_open_disposition.h"
@@ -40,6 +46,7 @@ index 0000000000000..80c7895b1e08b
 +class SidePanelRegistry;
 +
 +namespace content {
++class SiteInstance;
 +class WebContents;
 +}  // namespace content
 +
@@ -47,6 +54,10 @@ index 0000000000000..80c7895b1e08b
 +struct NativeWebKeyboardEvent;
 +}  // namespace input
 +
++namespace memory_instrumentation {
++class GlobalMemoryDump;
++}  // namespace memory_instrumentation
++
 +namespace user_prefs {
 +class PrefRegistrySyncable;
 +}  // namespace user_prefs
@@ -70,6 +81,16 @@ index 0000000000000..80c7895b1e08b
 +  static constexpr int kMaxPanes = 3;
 +  static constexpr int kDefaultPaneCount = 3;
 +
++  // How pane WebContents are mapped onto renderer processes. Stored as an
++  // integer in the browseros.clash_of_gpts.process_policy pref.
++  enum class ProcessPolicy {
++    // Every pane starts in its own browsing instance.
++    kIsolated = 0,
++    // A pane created for the same site as another live pane joins that
++    // pane's SiteInstance, so both share one renderer process.
++    kShareSameSite = 1,
++  };
++
 +  explicit ClashOfGptsCoordinator(Browser* browser);
 +  ~ClashOfGptsCoordinator() override;
 +
@@ -88,6 +109,12 @@ index 0000000000000..80c7895b1e08b
 +  // Copies content from active tab to all panes
 +  void CopyContentToAll();
 +
++  // Types |prompt| into the chat input of every shown pane and submits it,
++  // without going through the clipboard. With |include_page_content| the
++  // active tab is extracted once and sent ahead of the prompt.
++  void BroadcastPrompt(const std::u16string& prompt,
++                       bool include_page_content);
++
 +  // Gets the current provider index for a pane
 +  size_t GetProviderIndexForPane(int pane_index) const;
 +
@@ -109,7 +136,8 @@ index 0000000000000..80c7895b1e08b
 +  // Creates and registers a side panel entry
 +  void CreateAndRegisterEntry(SidePanelRegistry* registry);
 +
-+  // Gets or creates WebContents for a specific pane
++  // Gets or creates WebContents for a specific pane. New WebContents start
++  // hidden and blank; the pane navigates the first time it becomes visible.
 +  content::WebContents* GetOrCreateWebContentsForPane(int pane_index);
 +
 +  // content::WebContentsDelegate:
@@ -155,19 +183,98 @@ index 0000000000000..80c7895b1e08b
 +  // Clean up WebContents early to avoid shutdown crashes
 +  void CleanupWebContents();
 +
++  // Pane lifecycle, modelled on tab freezing/discarding: a pane loads on
++  // first show, is frozen after staying hidden for a while, and is discarded
++  // (WebContents destroyed, URL kept in |last_urls_|) once it is also not
++  // attached to the window.
++  enum class PaneLifecycle {
++    kUnloaded,
++    kActive,
++    kFrozen,
++  };
++
++  // URL a pane should show for its provider: the last URL seen for that
++  // pane/provider pair, or the provider's home page.
++  GURL GetRestoreUrlForPane(int pane_index) const;
++
++  // Records the pane's current URL in |last_urls_|.
++  void SaveUrlForPane(int pane_index);
++
++  void OnPaneVisibilityChanged(int pane_index, content::Visibility visibility);
++  void LoadPane(int pane_index);
++  void FreezePane(int pane_index);
++  // Discards a frozen pane once nothing shows it, checking again after
++  // kDiscardDelay while its window is still open.
++  void DiscardIdlePane(int pane_index);
++  void DiscardPane(int pane_index);
++
++  // True if the pane has no WebView in the window, so destroying its
++  // WebContents is invisible to the user.
++  bool CanDiscardPane(int pane_index) const;
++
++  ProcessPolicy GetProcessPolicy() const;
++
++  // Returns the SiteInstance of another live pane on the same site as |url|,
++  // or null.
++  scoped_refptr<content::SiteInstance> FindSharedSiteInstance(
++      int pane_index,
++      const GURL& url) const;
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level);
++
++  // Fans |text| out to the loaded panes; replaces any broadcast in flight.
++  void StartBroadcast(std::u16string text, bool includes_page_content);
++  void OnBroadcastDone(
++      bool includes_page_content,
++      std::vector<ClashOfGptsPromptBroadcaster::PaneResult> results);
++
++  // Per-pane renderer memory shown in the window header. Dumps only the
++  // panes' renderers, one request per process, never the whole browser.
++  void RequestPaneMemoryReport();
++  void OnPaneMemoryReport(
++      base::ProcessId pid,
++      bool success,
++      std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump);
++  void UpdatePaneStatuses();
++
++  // The renderer of an active (loaded, unfrozen) pane, or kNullProcessId.
++  base::ProcessId GetPaneProcessId(int pane_index) const;
++
++  // Called when a pane finished loading, which is when its memory changes.
++  void OnPaneLoaded(int pane_index);
++
 +  // WebContents observer for a specific pane
 +  class PaneWebContentsObserver : public content::WebContentsObserver {
 +   public:
 +    PaneWebContentsObserver(ClashOfGptsCoordinator* coordinator,
-+                           content::WebContents* web_contents);
++                            int pane_index,
++                            content::WebContents* web_contents);
 +    ~PaneWebContentsObserver() override;
 +
 +    // content::WebContentsObserver:
 +    void DidFinishLoad(content::RenderFrameHost* render_frame_host,
 +                       const GURL& validated_url) override;
++    void OnVisibilityChanged(content::Visibility visibility) override;
 +
 +   private:
 +    raw_ptr<ClashOfGptsCoordinator> coordinator_;
++    const int pane_index_;
++  };
++
++  // Everything the coordinator owns for one pane.
++  struct PaneSlot {
++    PaneSlot();
++    ~PaneSlot();
++
++    // We need to own the WebContents because WebView doesn't take ownership
++    // when we call SetWebContents with externally created WebContents
++    std::unique_ptr<content::WebContents> web_contents;
++    std::unique_ptr<PaneWebContentsObserver> observer;
++    PaneLifecycle lifecycle = PaneLifecycle::kUnloaded;
++
++    // Freezes, then discards, the pane while it stays hidden.
++    base::OneShotTimer idle_timer;
 +  };
 +
 +  // Shared provider list (loaded from preferences)
@@ -191,12 +298,20 @@ index 0000000000000..80c7895b1e08b
 +  // Weak pointer to the view (owned by the window)
 +  raw_ptr<ClashOfGptsView> view_ = nullptr;
 +
-+  // WebContents observers for each pane (sized for max panes)
-+  std::array<std::unique_ptr<PaneWebContentsObserver>, kMaxPanes> pane_observers_;
++  // WebContents and lifecycle state for each pane (sized for max panes)
++  std::array<PaneSlot, kMaxPanes> panes_;
++
++  // Prompt fan-out currently in flight, if any.
++  std::unique_ptr<ClashOfGptsPromptBroadcaster> broadcaster_;
++
++  // Refreshes per-pane memory in the window while it is open.
++  base::RepeatingTimer memory_report_timer_;
++
++  // Last private footprint of each pane renderer, in KB.
++  std::map<base::ProcessId, uint32_t> pane_footprint_kb_;
 +
-+  // We need to own the WebContents for each pane because WebView doesn't take ownership
-+  // when we call SetWebContents with externally created WebContents
-+  std::array<std::unique_ptr<content::WebContents>, kMaxPanes> owned_web_contents_;
++  // Discards hidden panes when the system is low on memory.
++  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 +
 +  // Observe lifetime of UI views
 +  base::ScopedMultiSourceObservation<views::View, views::ViewObserver>
@@ -0,0 +1,218 @@
+diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.cc
+new file mode 100644
+index 0000000000000..59932580f19cc
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.cc
+@@ -0,0 +1,212 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/utf_string_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/common/chrome_isolated_world_ids.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++
++namespace {
++
++// Give the provider app time to react to the input event (enable its send
++// button, resize the composer) before submitting.
++constexpr base::TimeDelta kSubmitDelay = base::Milliseconds(150);
++
++// Panes that have not reported by then are marked as timed out.
++constexpr base::TimeDelta kBroadcastTimeout = base::Seconds(10);
++
++// Finds the visible chat composer, preferring the focused one, and inserts
++// the text through the editing pipeline so framework-controlled inputs
++// (React, ProseMirror) update their state. Followed by the JSON-encoded text
++// and ");".
++constexpr char kInjectScriptPrefix[] = R"JS((function(text) {
++  const visible = (e) => {
++    const r = e.getBoundingClientRect();
++    return r.width > 0 && r.height > 0;
++  };
++  const candidates = Array.from(document.querySelectorAll(
++      'textarea, [contenteditable="true"], [contenteditable=""], ' +
++      'input[type="text"]'))
++      .filter((e) => visible(e) && !e.disabled && !e.readOnly);
++  const input = candidates.includes(document.activeElement) ?
++      document.activeElement : candidates[candidates.length - 1];
++  if (!input) {
++    return 'no-input';
++  }
++  input.focus();
++  if (input.isContentEditable) {
++    document.execCommand('selectAll', false, null);
++    document.execCommand('insertText', false, text);
++  } else {
++    const setter = Object.getOwnPropertyDescriptor(
++        Object.getPrototypeOf(input), 'value').set;
++    setter.call(input, text);
++    input.dispatchEvent(new Event('input', {bubbles: true}));
++  }
++  return 'typed';
++})()JS";
++
++// Clicks the composer's send button, falling back to an Enter key press.
++constexpr char16_t kSubmitScript[] = uR"JS((function() {
++  const input = document.activeElement;
++  const scope = (input && input.closest('form')) || document;
++  const button = scope.querySelector(
++      'button[data-testid*="send" i]:not([disabled]),' +
++      'button[aria-label*="send" i]:not([disabled]),' +
++      'button[aria-label*="submit" i]:not([disabled]),' +
++      'button[type="submit"]:not([disabled])');
++  if (button) {
++    button.click();
++    return 'button';
++  }
++  if (!input || input === document.body) {
++    return 'no-input';
++  }
++  for (const type of ['keydown', 'keypress', 'keyup']) {
++    input.dispatchEvent(new KeyboardEvent(type, {
++      key: 'Enter', code: 'Enter', keyCode: 13, which: 13,
++      bubbles: true, cancelable: true}));
++  }
++  return 'enter';
++})();)JS";
++
++std::string OutcomeFromResult(const base::Value& result) {
++  const std::string* outcome = result.GetIfString();
++  return outcome ? *outcome : "no-input";
++}
++
++}  // namespace
++
++ClashOfGptsPromptBroadcaster::ClashOfGptsPromptBroadcaster(
++    const std::vector<PaneTarget>& panes,
++    std::u16string text,
++    DoneCallback done)
++    : text_(std::move(text)), done_(std::move(done)) {
++  for (const PaneTarget& target : panes) {
++    PendingPane& pane = panes_.emplace_back();
++    pane.pane_index = target.pane_index;
++    if (target.web_contents) {
++      pane.web_contents = target.web_contents->GetWeakPtr();
++    } else {
++      pane.skipped = true;
++    }
++  }
++}
++
++ClashOfGptsPromptBroadcaster::~ClashOfGptsPromptBroadcaster() = default;
++
++void ClashOfGptsPromptBroadcaster::Start() {
++  start_time_ = base::TimeTicks::Now();
++  if (panes_.empty()) {
++    std::move(done_).Run({});
++    return;
++  }
++
++  std::string encoded_text;
++  base::JSONWriter::Write(base::Value(base::UTF16ToUTF8(text_)),
++                          &encoded_text);
++  std::u16string inject_script = base::UTF8ToUTF16(
++      std::string(kInjectScriptPrefix) + encoded_text + ");");
++
++  timeout_timer_.Start(FROM_HERE, kBroadcastTimeout,
++                       base::BindOnce(&ClashOfGptsPromptBroadcaster::OnTimeout,
++                                      weak_factory_.GetWeakPtr()));
++
++  // Fire all injections before waiting on any of them, so panes run in
++  // parallel and total time is that of the slowest pane. A synchronous
++  // FinishPane() for the last pane may destroy us.
++  auto weak_this = weak_factory_.GetWeakPtr();
++  for (size_t slot = 0; weak_this && slot < panes_.size(); ++slot) {
++    if (panes_[slot].skipped) {
++      FinishPane(slot, false, "skipped");
++      continue;
++    }
++    RunScript(slot, inject_script, &ClashOfGptsPromptBroadcaster::OnInjected);
++  }
++}
++
++void ClashOfGptsPromptBroadcaster::RunScript(
++    size_t slot,
++    const std::u16string& script,
++    void (ClashOfGptsPromptBroadcaster::*reply)(size_t, base::Value)) {
++  content::WebContents* web_contents = panes_[slot].web_contents.get();
++  if (!web_contents || !web_contents->GetPrimaryMainFrame()) {
++    FinishPane(slot, false, "closed");
++    return;
++  }
++  // The DOM is shared with the page, so the input and key events the
++  // scripts dispatch still reach the app's handlers.
++  web_contents->GetPrimaryMainFrame()->ExecuteJavaScriptInIsolatedWorld(
++      script, base::BindOnce(reply, weak_factory_.GetWeakPtr(), slot),
++      ISOLATED_WORLD_ID_BROWSEROS);
++}
++
++void ClashOfGptsPromptBroadcaster::OnInjected(size_t slot,
++                                              base::Value result) {
++  std::string outcome = OutcomeFromResult(result);
++  if (outcome != "typed") {
++    FinishPane(slot, false, outcome);
++    return;
++  }
++
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&ClashOfGptsPromptBroadcaster::Submit,
++                     weak_factory_.GetWeakPtr(), slot),
++      kSubmitDelay);
++}
++
++void ClashOfGptsPromptBroadcaster::Submit(size_t slot) {
++  RunScript(slot, kSubmitScript, &ClashOfGptsPromptBroadcaster::OnSubmitted);
++}
++
++void ClashOfGptsPromptBroadcaster::OnSubmitted(size_t slot,
++                                               base::Value result) {
++  std::string outcome = OutcomeFromResult(result);
++  FinishPane(slot, outcome != "no-input", outcome);
++}
++
++void ClashOfGptsPromptBroadcaster::FinishPane(size_t slot,
++                                              bool submitted,
++                                              std::string outcome) {
++  PendingPane& pane = panes_[slot];
++  if (pane.finished) {
++    return;
++  }
++  pane.finished = true;
++
++  PaneResult result;
++  result.pane_index = pane.pane_index;
++  result.submitted = submitted;
++  result.outcome = std::move(outcome);
++  result.latency = base::TimeTicks::Now() - start_time_;
++  VLOG(1) << "[browseros] Broadcast to pane " << result.pane_index << ": "
++          << result.outcome << " in " << result.latency.InMilliseconds()
++          << "ms";
++  results_.push_back(std::move(result));
++
++  if (results_.size() == panes_.size()) {
++    timeout_timer_.Stop();
++    // |done_| may destroy this object.
++    std::move(done_).Run(std::move(results_));
++  }
++}
++
++void ClashOfGptsPromptBroadcaster::OnTimeout() {
++  // Copy the weak pointer first: the last FinishPane() may destroy us.
++  auto weak_this = weak_factory_.GetWeakPtr();
++  for (size_t slot = 0; weak_this && slot < panes_.size(); ++slot) {
++    if (!panes_[slot].finished) {
++      FinishPane(slot, false, "timeout");
++    }
++  }
++}
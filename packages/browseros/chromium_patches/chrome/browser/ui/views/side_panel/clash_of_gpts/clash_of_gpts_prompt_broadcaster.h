@@ -0,0 +1,98 @@
+diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.h
+new file mode 100644
+index 0000000000000..d95326cb8f684
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_prompt_broadcaster.h
+@@ -0,0 +1,92 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_CLASH_OF_GPTS_CLASH_OF_GPTS_PROMPT_BROADCASTER_H_
++#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_CLASH_OF_GPTS_CLASH_OF_GPTS_PROMPT_BROADCASTER_H_
++
++#include <string>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++// Types one prompt into the chat input of several LLM panes concurrently and
++// submits it, reporting per-pane latency. Each pane goes through two steps:
++// the text is inserted into the page's composer (textarea or contenteditable)
++// so the app's own input handlers see it, then, after the app has had a
++// moment to enable its send button, the button is clicked (or Enter is
++// dispatched when no button is found). Both scripts run in an isolated
++// world, so the page's own scripts cannot see or tamper with them.
++class ClashOfGptsPromptBroadcaster {
++ public:
++  struct PaneResult {
++    int pane_index = 0;
++    bool submitted = false;
++    // "button", "enter", "no-input", "skipped", "closed" or "timeout".
++    std::string outcome;
++    // Time from Start() until the pane submitted or failed.
++    base::TimeDelta latency;
++  };
++
++  struct PaneTarget {
++    int pane_index = 0;
++    // Null for a pane that has no page loaded; it is reported as "skipped".
++    raw_ptr<content::WebContents> web_contents = nullptr;
++  };
++
++  using DoneCallback =
++      base::OnceCallback<void(std::vector<PaneResult> results)>;
++
++  ClashOfGptsPromptBroadcaster(const std::vector<PaneTarget>& panes,
++                               std::u16string text,
++                               DoneCallback done);
++  ~ClashOfGptsPromptBroadcaster();
++
++  ClashOfGptsPromptBroadcaster(const ClashOfGptsPromptBroadcaster&) = delete;
++  ClashOfGptsPromptBroadcaster& operator=(const ClashOfGptsPromptBroadcaster&) =
++      delete;
++
++  // Injects into every pane at once. |done| runs when all panes have
++  // reported or the overall timeout fires.
++  void Start();
++
++ private:
++  struct PendingPane {
++    int pane_index;
++    base::WeakPtr<content::WebContents> web_contents;
++    bool skipped = false;
++    bool finished = false;
++  };
++
++  // Runs |script| in the isolated world of the pane's main frame.
++  void RunScript(size_t slot,
++                 const std::u16string& script,
++                 void (ClashOfGptsPromptBroadcaster::*reply)(size_t,
++                                                              base::Value));
++  void OnInjected(size_t slot, base::Value result);
++  void Submit(size_t slot);
++  void OnSubmitted(size_t slot, base::Value result);
++  void FinishPane(size_t slot, bool submitted, std::string outcome);
++  void OnTimeout();
++
++  std::vector<PendingPane> panes_;
++  std::u16string text_;
++  DoneCallback done_;
++
++  base::TimeTicks start_time_;
++  std::vector<PaneResult> results_;
++  base::OneShotTimer timeout_timer_;
++
++  base::WeakPtrFactory<ClashOfGptsPromptBroadcaster> weak_factory_{this};
++};
++
++#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_CLASH_OF_GPTS_CLASH_OF_GPTS_PROMPT_BROADCASTER_H_
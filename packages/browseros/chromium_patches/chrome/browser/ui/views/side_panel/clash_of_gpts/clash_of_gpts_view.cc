@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
 new file mode 100644
-index 0000000000000..24eefea8b8860
+index 0000000000000..bcc0003313a45
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
-@@ -0,0 +1,474 @@
+@@ -0,0 +1,546 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -35,12 +35,18 @@ index 0000000000000..24eefea8b8860
 +#include "ui/base/ui_base_features.h"
 +#include "ui/color/color_id.h"
 +#include "ui/color/color_provider.h"
++#include "ui/views/accessibility/view_accessibility.h"
 +#include "ui/views/background.h"
++#include "ui/events/event.h"
++#include "ui/events/keycodes/keyboard_codes.h"
++#include "ui/views/controls/button/checkbox.h"
 +#include "ui/views/controls/button/image_button.h"
++#include "ui/views/controls/button/md_text_button.h"
 +#include "ui/views/controls/button/radio_button.h"
 +#include "ui/views/controls/combobox/combobox.h"
 +#include "ui/views/controls/label.h"
 +#include "ui/views/controls/separator.h"
++#include "ui/views/controls/textfield/textfield.h"
 +#include "ui/views/controls/webview/webview.h"
 +#include "ui/views/layout/box_layout.h"
 +#include "ui/views/layout/flex_layout.h"
@@ -151,6 +157,32 @@ index 0000000000000..24eefea8b8860
 +  copy_feedback_label_->SetVisible(false);
 +  copy_feedback_label_->SetEnabledColor(ui::kColorLabelForegroundSecondary);
 +
++  // Create prompt row for sending one prompt to every pane
++  auto* prompt_row = AddChildView(std::make_unique<views::View>());
++  auto* prompt_layout =
++      prompt_row->SetLayoutManager(std::make_unique<views::BoxLayout>(
++          views::BoxLayout::Orientation::kHorizontal,
++          gfx::Insets::TLBR(0, 12, 8, 12), 8));
++  prompt_layout->set_cross_axis_alignment(
++      views::BoxLayout::CrossAxisAlignment::kCenter);
++
++  prompt_field_ =
++      prompt_row->AddChildView(std::make_unique<views::Textfield>());
++  prompt_field_->SetPlaceholderText(u"Ask all panes…");
++  prompt_field_->GetViewAccessibility().SetName(u"Prompt for all panes");
++  prompt_field_->set_controller(this);
++  prompt_layout->SetFlexForView(prompt_field_, 1);
++
++  include_page_checkbox_ = prompt_row->AddChildView(
++      std::make_unique<views::Checkbox>(u"Include page"));
++  include_page_checkbox_->SetTooltipText(
++      u"Send the current tab's content ahead of the prompt");
++
++  prompt_row->AddChildView(std::make_unique<views::MdTextButton>(
++      base::BindRepeating(&ClashOfGptsView::OnSendPrompt,
++                          base::Unretained(this)),
++      u"Send to all"));
++
 +  // Add separator
 +  AddChildView(std::make_unique<views::Separator>());
 +
@@ -219,8 +251,12 @@ index 0000000000000..24eefea8b8860
 +}
 +
 +void ClashOfGptsView::ShowCopyFeedback() {
++  ShowFeedback(u"Content copied to clipboard");
++}
++
++void ClashOfGptsView::ShowFeedback(const std::u16string& message) {
 +  if (copy_feedback_label_) {
-+    copy_feedback_label_->SetText(u"Content copied to clipboard");
++    copy_feedback_label_->SetText(message);
 +    copy_feedback_label_->SetVisible(true);
 +
 +    // Cancel any existing timer
@@ -236,6 +272,15 @@ index 0000000000000..24eefea8b8860
 +}
 +
 +
++void ClashOfGptsView::SetPaneStatus(int pane_index,
++                                    const std::u16string& status) {
++  if (pane_index < 0 || pane_index >= static_cast<int>(panes_.size()) ||
++      !panes_[pane_index].status_label) {
++    return;
++  }
++  panes_[pane_index].status_label->SetText(status);
++}
++
 +void ClashOfGptsView::OnThemeChanged() {
 +  views::View::OnThemeChanged();
 +  
@@ -278,6 +323,10 @@ index 0000000000000..24eefea8b8860
 +      pane.pane_label->SetEnabledColor(
 +          color_provider->GetColor(ui::kColorLabelForegroundSecondary));
 +    }
++    if (pane.status_label) {
++      pane.status_label->SetEnabledColor(
++          color_provider->GetColor(ui::kColorLabelForegroundSecondary));
++    }
 +    
 +    // Force combobox to repaint with new theme
 +    if (pane.provider_selector) {
@@ -331,6 +380,14 @@ index 0000000000000..24eefea8b8860
 +  static_cast<views::BoxLayout*>(header->GetLayoutManager())
 +      ->SetFlexForView(spacer, 1);
 +
++  // Add renderer memory / lifecycle status, filled in by the coordinator
++  panes_[pane_index].status_label = header->AddChildView(
++      std::make_unique<views::Label>(u""));
++  panes_[pane_index].status_label->SetEnabledColor(
++      ui::kColorLabelForegroundSecondary);
++  panes_[pane_index].status_label->SetFontList(
++      panes_[pane_index].status_label->font_list().DeriveWithSizeDelta(-1));
++
 +  // Add open in new tab button
 +  auto* open_button = header->AddChildView(
 +      std::make_unique<views::ImageButton>(base::BindRepeating(
@@ -352,21 +409,11 @@ index 0000000000000..24eefea8b8860
 +      views::FlexSpecification(views::MinimumFlexSizeRule::kScaleToZero,
 +                               views::MaximumFlexSizeRule::kUnbounded));
 +
-+  // Get WebContents from coordinator (it owns them)
++  // Get WebContents from coordinator (it owns them). The coordinator
++  // navigates the pane, restoring its last URL, once it becomes visible, so
++  // an existing pane keeps its page when the panes are rebuilt.
 +  content::WebContents* web_contents = coordinator_->GetOrCreateWebContentsForPane(pane_index);
 +  if (web_contents) {
-+    // Navigate to initial provider URL
-+    size_t provider_index = coordinator_->GetProviderIndexForPane(pane_index);
-+    const auto& providers = coordinator_->GetProviders();
-+    if (provider_index < providers.size()) {
-+      GURL provider_url = providers[provider_index].url;
-+      web_contents->GetController().LoadURL(
-+          provider_url,
-+          content::Referrer(),
-+          ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
-+          std::string());
-+    }
-+
 +    // Set the WebContents in the WebView (WebView does NOT take ownership)
 +    panes_[pane_index].web_view->SetWebContents(web_contents);
 +    panes_[pane_index].web_view->SetVisible(true);
@@ -414,6 +461,31 @@ index 0000000000000..24eefea8b8860
 +  coordinator_->CopyContentToAll();
 +}
 +
++void ClashOfGptsView::OnSendPrompt() {
++  if (!prompt_field_) {
++    return;
++  }
++  bool include_page =
++      include_page_checkbox_ && include_page_checkbox_->GetChecked();
++  std::u16string prompt = prompt_field_->GetText();
++  if (prompt.empty() && !include_page) {
++    return;
++  }
++  coordinator_->BroadcastPrompt(prompt, include_page);
++  prompt_field_->SetText(std::u16string());
++}
++
++bool ClashOfGptsView::HandleKeyEvent(views::Textfield* sender,
++                                     const ui::KeyEvent& key_event) {
++  if (sender == prompt_field_ &&
++      key_event.type() == ui::EventType::kKeyPressed &&
++      key_event.key_code() == ui::VKEY_RETURN) {
++    OnSendPrompt();
++    return true;
++  }
++  return false;
++}
++
 +void ClashOfGptsView::HideFeedbackLabel() {
 +  if (copy_feedback_label_ && copy_feedback_label_->GetWidget()) {
 +    copy_feedback_label_->SetVisible(false);
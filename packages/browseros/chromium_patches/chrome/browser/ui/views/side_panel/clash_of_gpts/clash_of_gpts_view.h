@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
 new file mode 100644
-index 0000000000000..e9bc398177fe3
+index 0000000000000..9d9fd511943a8
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
-@@ -0,0 +1,112 @@
+@@ -0,0 +1,134 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,6 +18,7 @@ index 0000000000000..e9bc398177fe3
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "ui/base/metadata/metadata_header_macros.h"
++#include "ui/views/controls/textfield/textfield_controller.h"
 +#include "ui/views/view.h"
 +
 +class ClashOfGptsCoordinator;
@@ -31,15 +32,18 @@ index 0000000000000..e9bc398177fe3
 +}  // namespace content
 +
 +namespace views {
++class Checkbox;
 +class Combobox;
 +class Label;
 +class RadioButton;
++class Textfield;
 +class WebView;
 +}  // namespace views
 +
 +// ClashOfGptsView is the main view containing multiple split WebViews for comparing
 +// LLM responses side-by-side. Supports 2 or 3 panes dynamically.
-+class ClashOfGptsView : public views::View {
++class ClashOfGptsView : public views::View,
++                        public views::TextfieldController {
 + public:
 +  METADATA_HEADER(ClashOfGptsView, views::View)
 +  
@@ -55,9 +59,19 @@ index 0000000000000..e9bc398177fe3
 +  // Shows copy feedback message
 +  void ShowCopyFeedback();
 +
++  // Shows a transient message in the header
++  void ShowFeedback(const std::u16string& message);
++
++  // Sets the status text (memory use, frozen, ...) shown in a pane header
++  void SetPaneStatus(int pane_index, const std::u16string& status);
++
 +  // views::View:
 +  void OnThemeChanged() override;
 +
++  // views::TextfieldController:
++  bool HandleKeyEvent(views::Textfield* sender,
++                      const ui::KeyEvent& key_event) override;
++
 +  // Updates the view to show the specified number of panes
 +  void UpdatePaneCount(int new_count);
 +
@@ -68,6 +82,7 @@ index 0000000000000..e9bc398177fe3
 +    raw_ptr<views::Combobox> provider_selector = nullptr;
 +    raw_ptr<views::WebView> web_view = nullptr;
 +    raw_ptr<views::Label> pane_label = nullptr;
++    raw_ptr<views::Label> status_label = nullptr;
 +  };
 +
 +  // Creates the UI for a single pane
@@ -82,6 +97,9 @@ index 0000000000000..e9bc398177fe3
 +  // Copies content from the active tab
 +  void OnCopyContent();
 +
++  // Sends the typed prompt (and optionally the page) to every pane
++  void OnSendPrompt();
++
 +  // Hides the feedback label after a delay
 +  void HideFeedbackLabel();
 +
@@ -105,6 +123,10 @@ index 0000000000000..e9bc398177fe3
 +  raw_ptr<views::RadioButton> two_panes_radio_ = nullptr;
 +  raw_ptr<views::RadioButton> three_panes_radio_ = nullptr;
 +
++  // Prompt box and options for sending to all panes at once
++  raw_ptr<views::Textfield> prompt_field_ = nullptr;
++  raw_ptr<views::Checkbox> include_page_checkbox_ = nullptr;
++
 +  // Global copy feedback label
 +  raw_ptr<views::Label> copy_feedback_label_ = nullptr;
 +
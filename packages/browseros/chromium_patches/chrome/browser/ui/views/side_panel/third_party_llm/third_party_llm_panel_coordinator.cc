@@ -1,15 +1,16 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
 new file mode 100644
-index 0000000000000..ea3e4207ee029
+index 0000000000000..0e90f16f6e620
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
-@@ -0,0 +1,1187 @@
+@@ -0,0 +1,1180 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h"
 +
++#include <algorithm>
 +#include <memory>
 +#include <vector>
 +
@@ -17,9 +18,12 @@ index 0000000000000..ea3e4207ee029
 +#include "base/check_deref.h"
 +#include "build/build_config.h"
 +#include "base/functional/callback.h"
++#include "base/memory/memory_pressure_listener.h"
 +#include "ui/views/controls/menu/menu_runner.h"
 +#include "ui/base/mojom/menu_source_type.mojom.h"
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_view.h"
++#include "chrome/browser/browseros/page_content/page_content_cache.h"
++#include "chrome/browser/browseros/page_content/page_text_index.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/ui/browser.h"
@@ -32,6 +36,7 @@ index 0000000000000..ea3e4207ee029
 +#include "chrome/browser/ui/views/side_panel/side_panel_registry.h"
 +#include "chrome/browser/ui/views/side_panel/side_panel_ui.h"
 +#include "chrome/grit/generated_resources.h"
++#include "content/public/browser/visibility.h"
 +#include "content/public/browser/web_contents.h"
 +#include "ui/base/l10n/l10n_util.h"
 +#include "ui/base/models/combobox_model.h"
@@ -53,10 +58,7 @@ index 0000000000000..ea3e4207ee029
 +#include "chrome/browser/ui/browser_navigator_params.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
 +#include "content/public/browser/browser_accessibility_state.h"
-+#include "ui/accessibility/ax_node.h"
-+#include "ui/accessibility/ax_node_data.h"
-+#include "ui/accessibility/ax_enums.mojom.h"
-+#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_mode.h"
 +#include "ui/base/clipboard/clipboard.h"
 +#include "ui/base/clipboard/scoped_clipboard_writer.h"
 +#include "chrome/browser/ui/browser_commands.h"
@@ -83,6 +85,13 @@ index 0000000000000..ea3e4207ee029
 +// Preference names
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
 +const char kThirdPartyLlmSelectedProviderPref[] = "browseros.third_party_llm.selected_provider";
++const char kThirdPartyLlmWarmPoolSizePref[] =
++    "browseros.third_party_llm.warm_pool_size";
++
++// Number of providers kept alive by default. Provider apps are heavy SPAs, so
++// a handful covers typical back-and-forth switching without holding every
++// configured provider in memory.
++constexpr int kDefaultWarmPoolSize = 3;
 +
 +bool IsRestorableProviderUrl(const GURL& url) {
 +  return url.is_valid() && url.SchemeIsHTTPOrHTTPS();
@@ -123,6 +132,11 @@ index 0000000000000..ea3e4207ee029
 +  browser_list_observation_.Observe(BrowserList::GetInstance());
 +  profile_observation_.Observe(&profile_.get());
 +
++  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
++      FROM_HERE,
++      base::BindRepeating(&ThirdPartyLlmPanelCoordinator::OnMemoryPressure,
++                          base::Unretained(this)));
++
 +  // Load providers from preferences
 +  LoadProvidersFromPrefs();
 +}
@@ -149,13 +163,8 @@ index 0000000000000..ea3e4207ee029
 +    SidePanelEntryScope& scope) {
 +  // Save current state before reloading preferences
 +  size_t previous_size = providers_.size();
-+  if (owned_web_contents_) {
-+    GURL current_url = owned_web_contents_->GetURL();
-+    if (current_url.is_valid()) {
-+      if (IsRestorableProviderUrl(current_url)) {
-+        last_urls_[current_provider_index_] = current_url;
-+      }
-+    }
++  for (const PooledContents& entry : contents_pool_) {
++    SaveProviderUrl(entry);
 +  }
 +
 +  // Reload providers from preferences
@@ -170,6 +179,9 @@ index 0000000000000..ea3e4207ee029
 +    if (PrefService* prefs = GetProfile()->GetPrefs()) {
 +      prefs->SetInteger(kThirdPartyLlmSelectedProviderPref, 0);
 +    }
++    // Pooled entries are keyed by index, which no longer maps to the same
++    // provider.
++    CleanupWebContents();
 +  }
 +
 +  // Cancel any pending timer callbacks before resetting UI pointers
@@ -320,47 +332,15 @@ index 0000000000000..ea3e4207ee029
 +  // Observe UI elements so we can reset pointers when they are destroyed.
 +  view_observation_.AddObservation(web_view_);
 +  
-+  // Create WebContents if we don't have one yet
-+  if (!owned_web_contents_) {
-+    content::WebContents::CreateParams params(GetProfile());
-+    owned_web_contents_ = content::WebContents::Create(params);
-+
-+    // Set this as the delegate to handle keyboard events
-+    owned_web_contents_->SetDelegate(this);
-+  }
-+
-+  // Navigate to initial provider (use last URL if available)
-+  GURL provider_url;
-+  if (current_provider_index_ < providers_.size()) {
-+    auto it = last_urls_.find(current_provider_index_);
-+    if (it != last_urls_.end()) {
-+      if (IsRestorableProviderUrl(it->second)) {
-+        provider_url = it->second;
-+      }
-+    } else {
-+      provider_url = providers_[current_provider_index_].url;
-+    }
-+  }
-+
-+  if (provider_url.is_valid()) {
-+    owned_web_contents_->GetController().LoadURL(
-+        provider_url,
-+        content::Referrer(),
-+        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
-+        std::string());
-+  }
-+
-+  // Set the WebContents in the WebView (WebView does NOT take ownership)
-+  // We pass the raw pointer but retain ownership via owned_web_contents_
-+  web_view_->SetWebContents(owned_web_contents_.get());
++  // Reuse the pooled WebContents for the current provider, or create one
++  // navigated to its last URL. WebView does NOT take ownership; the pool
++  // retains it.
++  AttachContents(ActivateProviderContents(current_provider_index_));
 +  web_view_->SetVisible(true);
-+  
++
 +  // Tell our custom container about the WebView for proper cleanup
 +  container->SetWebView(web_view_);
 +
-+  // Observe the WebContents
-+  Observe(owned_web_contents_.get());
-+
 +  // Enable focus for the WebView to handle keyboard events properly
 +  web_view_->SetFocusBehavior(views::View::FocusBehavior::ALWAYS);
 +
@@ -513,15 +493,6 @@ index 0000000000000..ea3e4207ee029
 +
 +  browseros_metrics::BrowserOSMetrics::Log("llmchat.provider.changed");
 +
-+  if (owned_web_contents_) {
-+    GURL current_url = owned_web_contents_->GetURL();
-+    if (current_url.is_valid()) {
-+      if (IsRestorableProviderUrl(current_url)) {
-+        last_urls_[current_provider_index_] = current_url;
-+      }
-+    }
-+  }
-+
 +  current_provider_index_ = new_provider_index;
 +
 +  // Persist preference.
@@ -529,28 +500,146 @@ index 0000000000000..ea3e4207ee029
 +    prefs->SetInteger(kThirdPartyLlmSelectedProviderPref, static_cast<int>(current_provider_index_));
 +  }
 +
-+  // Determine URL to load.
++  // Swap in the provider's warm WebContents instead of navigating. Only do
++  // so while the panel is showing; otherwise the next
++  // CreateThirdPartyLlmWebView() activates it. Either way the selection is
++  // now the most recently used entry, so trimming keeps it.
++  bool warm = PromotePooledContents(current_provider_index_);
++  if (web_view_) {
++    AttachContents(ActivateProviderContents(current_provider_index_));
++    base::Value::Dict props;
++    props.Set("warm", warm);
++    props.Set("pool_size", static_cast<int>(contents_pool_.size()));
++    browseros_metrics::BrowserOSMetrics::Log("llmchat.provider.activated",
++                                             std::move(props));
++  }
++
++  provider_change_in_progress_ = false;
++}
++
++content::WebContents* ThirdPartyLlmPanelCoordinator::GetActiveContents()
++    const {
++  if (contents_pool_.empty() ||
++      contents_pool_.front().provider_index != current_provider_index_) {
++    return nullptr;
++  }
++  return contents_pool_.front().contents.get();
++}
++
++bool ThirdPartyLlmPanelCoordinator::PromotePooledContents(
++    size_t provider_index) {
++  auto it = std::ranges::find(contents_pool_, provider_index,
++                              &PooledContents::provider_index);
++  if (it == contents_pool_.end()) {
++    return false;
++  }
++  contents_pool_.splice(contents_pool_.begin(), contents_pool_, it);
++  return true;
++}
++
++content::WebContents* ThirdPartyLlmPanelCoordinator::ActivateProviderContents(
++    size_t provider_index) {
++  if (PromotePooledContents(provider_index)) {
++    return contents_pool_.front().contents.get();
++  }
++
++  content::WebContents::CreateParams params(GetProfile());
++  std::unique_ptr<content::WebContents> contents =
++      content::WebContents::Create(params);
++
++  // Set this as the delegate to handle keyboard events
++  contents->SetDelegate(this);
++
++  // Navigate to the provider (use last URL if available)
 +  GURL provider_url;
-+  auto it = last_urls_.find(current_provider_index_);
-+  if (it != last_urls_.end()) {
-+    if (IsRestorableProviderUrl(it->second)) {
-+      provider_url = it->second;
++  auto last = last_urls_.find(provider_index);
++  if (last != last_urls_.end() && IsRestorableProviderUrl(last->second)) {
++    provider_url = last->second;
++  } else if (provider_index < providers_.size()) {
++    provider_url = providers_[provider_index].url;
++  }
++  if (provider_url.is_valid()) {
++    contents->GetController().LoadURL(provider_url, content::Referrer(),
++                                      ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++                                      std::string());
++  }
++
++  contents_pool_.push_front({provider_index, std::move(contents)});
++  TrimPool(GetPoolSize());
++  return contents_pool_.front().contents.get();
++}
++
++void ThirdPartyLlmPanelCoordinator::AttachContents(
++    content::WebContents* contents) {
++  if (web_view_) {
++    web_view_->SetWebContents(contents);
++  }
++  Observe(contents);
++
++  // Detaching a WebContents from the WebView does not hide it; do so
++  // explicitly so warm providers stop rendering and get background priority.
++  for (const PooledContents& entry : contents_pool_) {
++    if (entry.contents.get() != contents &&
++        entry.contents->GetVisibility() != content::Visibility::HIDDEN) {
++      entry.contents->WasHidden();
 +    }
 +  }
-+  if (!provider_url.is_valid()) {
-+    provider_url = providers_[current_provider_index_].url;
++}
++
++size_t ThirdPartyLlmPanelCoordinator::TrimPool(size_t max_entries) {
++  size_t discarded = 0;
++  while (contents_pool_.size() > std::max<size_t>(max_entries, 1)) {
++    SaveProviderUrl(contents_pool_.back());
++    contents_pool_.pop_back();
++    ++discarded;
 +  }
++  return discarded;
++}
 +
-+  if (owned_web_contents_) {
-+    owned_web_contents_->GetController().LoadURL(
-+        provider_url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
++void ThirdPartyLlmPanelCoordinator::SaveProviderUrl(
++    const PooledContents& entry) {
++  GURL url = entry.contents->GetLastCommittedURL();
++  if (IsRestorableProviderUrl(url)) {
++    last_urls_[entry.provider_index] = url;
 +  }
++}
 +
-+  provider_change_in_progress_ = false;
++size_t ThirdPartyLlmPanelCoordinator::GetPoolSize() const {
++  int size = kDefaultWarmPoolSize;
++  if (PrefService* prefs = GetProfile()->GetPrefs()) {
++    size = prefs->GetInteger(kThirdPartyLlmWarmPoolSizePref);
++  }
++  return std::min(static_cast<size_t>(std::max(size, 1)),
++                  std::max<size_t>(providers_.size(), 1));
++}
++
++void ThirdPartyLlmPanelCoordinator::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
++    return;
++  }
++
++  // Keep only the provider on screen; the others reload from their last URL
++  // the next time they are selected.
++  size_t discarded = TrimPool(1);
++  if (discarded == 0) {
++    return;
++  }
++
++  LOG(INFO) << "[browseros] Discarded " << discarded
++            << " warm LLM provider(s) under memory pressure";
++  base::Value::Dict props;
++  props.Set("discarded", static_cast<int>(discarded));
++  props.Set("critical",
++            level ==
++                base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL);
++  browseros_metrics::BrowserOSMetrics::Log("llmchat.pool.discarded",
++                                           std::move(props));
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnRefreshContent() {
-+  if (!owned_web_contents_ || current_provider_index_ >= providers_.size()) {
++  content::WebContents* contents = GetActiveContents();
++  if (!contents || current_provider_index_ >= providers_.size()) {
 +    return;
 +  }
 +
@@ -558,7 +647,7 @@ index 0000000000000..ea3e4207ee029
 +  GURL provider_url = providers_[current_provider_index_].url;
 +
 +  // Navigate to the default URL
-+  owned_web_contents_->GetController().LoadURL(
++  contents->GetController().LoadURL(
 +      provider_url,
 +      content::Referrer(),
 +      ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
@@ -569,11 +658,12 @@ index 0000000000000..ea3e4207ee029
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnOpenInNewTab() {
-+  if (!owned_web_contents_) {
++  content::WebContents* contents = GetActiveContents();
++  if (!contents) {
 +    return;
 +  }
 +
-+  GURL current_url = owned_web_contents_->GetURL();
++  GURL current_url = contents->GetURL();
 +  if (!current_url.is_valid()) {
 +    return;
 +  }
@@ -607,14 +697,14 @@ index 0000000000000..ea3e4207ee029
 +  page_title_ = active_contents->GetTitle();
 +  page_url_ = active_contents->GetVisibleURL();
 +  
-+  // Request accessibility tree snapshot
-+  active_contents->RequestAXTreeSnapshot(
-+      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived,
-+                     weak_factory_.GetWeakPtr()),
-+      ui::AXMode::kWebContents,  // Request web contents mode
-+      0,  // max_nodes (0 = no limit)
++  // Request the page text; repeated copies of an unchanged page are served
++  // from the per-tab cache.
++  browseros::PageContentCache::GetIndex(
++      active_contents, ui::AXMode::kWebContents,
++      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants,
 +      base::Seconds(5),  // timeout
-+      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnPageIndexReady,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnScreenshotContent() {
@@ -693,33 +783,16 @@ index 0000000000000..ea3e4207ee029
 +  }
 +}
 +
-+void ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& update) {
-+  // Build a map of node IDs to node data for easy lookup
-+  std::map<ui::AXNodeID, const ui::AXNodeData*> node_map;
-+  for (const auto& node_data : update.nodes) {
-+    node_map[node_data.id] = &node_data;
-+  }
-+  
-+  // Find the root node
-+  ui::AXNodeID root_id = update.root_id;
-+  if (node_map.find(root_id) == node_map.end()) {
-+    LOG(ERROR) << "Root node not found in tree update";
++void ThirdPartyLlmPanelCoordinator::OnPageIndexReady(
++    scoped_refptr<const browseros::PageTextIndex> index) {
++  if (index->empty()) {
++    LOG(ERROR) << "Accessibility snapshot is empty";
 +    return;
 +  }
-+  
-+  // Extract text from the accessibility tree recursively
-+  std::u16string extracted_text;
-+  ExtractTextFromNodeData(node_map[root_id], node_map, &extracted_text);
-+  
-+  // Clean up text - remove excessive whitespace
++
++  const std::u16string& extracted_text = index->GetPlainText();
++
 +  if (!extracted_text.empty()) {
-+    // Simple cleanup of multiple spaces
-+    size_t pos = 0;
-+    while ((pos = extracted_text.find(u"  ", pos)) != std::u16string::npos) {
-+      extracted_text.replace(pos, 2, u" ");
-+    }
-+    
 +    // Format the final output
 +    std::u16string formatted_output = u"----------- WEB PAGE -----------\n\n";
 +    formatted_output += u"TITLE: " + page_title_ + u"\n\n";
@@ -794,91 +867,6 @@ index 0000000000000..ea3e4207ee029
 +}
 +
 +
-+void ThirdPartyLlmPanelCoordinator::ExtractTextFromNodeData(
-+    const ui::AXNodeData* node,
-+    const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+    std::u16string* output) {
-+  if (!node || !output) {
-+    return;
-+  }
-+  
-+  // Skip UI elements and navigation
-+  if (node->role == ax::mojom::Role::kButton ||
-+      node->role == ax::mojom::Role::kNavigation ||
-+      node->role == ax::mojom::Role::kBanner ||
-+      node->role == ax::mojom::Role::kComplementary ||
-+      node->role == ax::mojom::Role::kContentInfo ||
-+      node->role == ax::mojom::Role::kForm ||
-+      node->role == ax::mojom::Role::kSearch ||
-+      node->role == ax::mojom::Role::kMenu ||
-+      node->role == ax::mojom::Role::kMenuBar ||
-+      node->role == ax::mojom::Role::kMenuItem ||
-+      node->role == ax::mojom::Role::kToolbar) {
-+    // For these elements, still traverse children but don't extract their text
-+    for (ui::AXNodeID child_id : node->child_ids) {
-+      auto it = node_map.find(child_id);
-+      if (it != node_map.end()) {
-+        ExtractTextFromNodeData(it->second, node_map, output);
-+      }
-+    }
-+    return;
-+  }
-+  
-+  // Check if this is a text-containing element
-+  bool is_text_element = (node->role == ax::mojom::Role::kStaticText ||
-+                         node->role == ax::mojom::Role::kInlineTextBox);
-+  
-+  // Extract text if this is a text element
-+  if (is_text_element) {
-+    std::u16string text;
-+    if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kName);
-+    }
-+    
-+    if (text.empty() && node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kValue);
-+    }
-+    
-+    if (!text.empty()) {
-+      // Add appropriate spacing
-+      if (!output->empty() && output->back() != ' ' && output->back() != '\n') {
-+        *output += u" ";
-+      }
-+      *output += text;
-+    }
-+  }
-+  
-+  // Handle line breaks
-+  if (node->role == ax::mojom::Role::kLineBreak) {
-+    *output += u"\n";
-+  }
-+  
-+  // Add paragraph breaks for block-level elements
-+  bool needs_paragraph_break = (node->role == ax::mojom::Role::kParagraph ||
-+                               node->role == ax::mojom::Role::kHeading ||
-+                               node->role == ax::mojom::Role::kListItem ||
-+                               node->role == ax::mojom::Role::kBlockquote ||
-+                               node->role == ax::mojom::Role::kArticle ||
-+                               node->role == ax::mojom::Role::kSection);
-+  
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+  
-+  // Recursively process children for all elements
-+  for (ui::AXNodeID child_id : node->child_ids) {
-+    auto it = node_map.find(child_id);
-+    if (it != node_map.end()) {
-+      ExtractTextFromNodeData(it->second, node_map, output);
-+    }
-+  }
-+  
-+  // Add paragraph break after block-level elements if they had content
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+}
-+
 +bool ThirdPartyLlmPanelCoordinator::HandleKeyboardEvent(
 +    content::WebContents* source,
 +    const input::NativeWebKeyboardEvent& event) {
@@ -1069,11 +1057,14 @@ index 0000000000000..ea3e4207ee029
 +    web_view_->SetWebContents(nullptr);
 +  }
 +
-+  // Destroy the WebContents we own
-+  owned_web_contents_.reset();
-+
-+  // Stop observing
++  // Stop observing before the observed WebContents goes away
 +  Observe(nullptr);
++
++  // Destroy the pooled WebContents we own, keeping their URLs for restore
++  for (const PooledContents& entry : contents_pool_) {
++    SaveProviderUrl(entry);
++  }
++  contents_pool_.clear();
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnBrowserRemoved(Browser* browser) {
@@ -1190,4 +1181,6 @@ index 0000000000000..ea3e4207ee029
 +    user_prefs::PrefRegistrySyncable* registry) {
 +  registry->RegisterListPref(kThirdPartyLlmProvidersPref);
 +  registry->RegisterIntegerPref(kThirdPartyLlmSelectedProviderPref, 0);
++  registry->RegisterIntegerPref(kThirdPartyLlmWarmPoolSizePref,
++                                kDefaultWarmPoolSize);
 +}
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
 new file mode 100644
-index 0000000000000..ef7c13f156ea7
+index 0000000000000..c0412b4a75349
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
-@@ -0,0 +1,237 @@
+@@ -0,0 +1,279 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,11 +11,15 @@ index 0000000000000..ef7c13f156ea7
 +#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_THIRD_PARTY_LLM_THIRD_PARTY_LLM_PANEL_COORDINATOR_H_
 +#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_THIRD_PARTY_LLM_THIRD_PARTY_LLM_PANEL_COORDINATOR_H_
 +
++#include <list>
 +#include <map>
++#include <memory>
 +#include <string>
 +
++#include "base/memory/memory_pressure_listener.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/raw_ref.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
@@ -29,7 +33,6 @@ index 0000000000000..ef7c13f156ea7
 +#include "third_party/blink/public/mojom/choosers/file_chooser.mojom.h"
 +#include "third_party/blink/public/mojom/mediastream/media_stream.mojom.h"
 +#include "third_party/blink/public/mojom/window_features/window_features.mojom.h"
-+#include "ui/accessibility/ax_node_id_forward.h"
 +#include "ui/base/window_open_disposition.h"
 +#include "ui/views/controls/webview/unhandled_keyboard_event_handler.h"
 +#include "url/gurl.h"
@@ -60,10 +63,9 @@ index 0000000000000..ef7c13f156ea7
 +class WebContents;
 +}  // namespace content
 +
-+namespace ui {
-+struct AXNodeData;
-+struct AXTreeUpdate;
-+}  // namespace ui
++namespace browseros {
++class PageTextIndex;
++}  // namespace browseros
 +
 +namespace views {
 +class Combobox;
@@ -164,12 +166,8 @@ index 0000000000000..ef7c13f156ea7
 +  void OnOpenInNewTab();
 +  void OnCopyContent();
 +  void OnScreenshotContent();
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& update);
++  void OnPageIndexReady(scoped_refptr<const browseros::PageTextIndex> index);
 +  void OnScreenshotCaptured(const gfx::Image& image);
-+  void ExtractTextFromNodeData(
-+      const ui::AXNodeData* node,
-+      const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+      std::u16string* output);
 +  void HideFeedbackLabel();
 +  void ShowOptionsMenu();
 +
@@ -186,6 +184,46 @@ index 0000000000000..ef7c13f156ea7
 +  // Clean up WebContents early to avoid shutdown crashes.
 +  void CleanupWebContents();
 +
++  // Warm provider pool. Each provider that was shown recently keeps its own
++  // WebContents so switching back swaps the attached view instead of
++  // reloading the provider's app. The front entry is the active provider.
++  struct PooledContents {
++    size_t provider_index;
++    std::unique_ptr<content::WebContents> contents;
++  };
++
++  // Returns the WebContents currently shown in the panel, or nullptr.
++  content::WebContents* GetActiveContents() const;
++
++  // Moves the pool entry for |provider_index| to the front if it is pooled,
++  // so the pool's LRU order tracks selection even while the panel is closed.
++  // Returns whether it was pooled.
++  bool PromotePooledContents(size_t provider_index);
++
++  // Moves the pool entry for |provider_index| to the front, creating and
++  // navigating a new WebContents if the provider is not pooled, then trims
++  // the pool to the configured size.
++  content::WebContents* ActivateProviderContents(size_t provider_index);
++
++  // Attaches |contents| to the WebView and starts observing it. The other
++  // pool entries are marked hidden so their renderers throttle in the
++  // background while staying warm.
++  void AttachContents(content::WebContents* contents);
++
++  // Destroys cold entries from the back of the pool until at most
++  // |max_entries| remain, remembering their URLs in |last_urls_|. The active
++  // entry is never discarded. Returns the number of discarded entries.
++  size_t TrimPool(size_t max_entries);
++
++  // Remembers the current URL of a pooled provider for later restore.
++  void SaveProviderUrl(const PooledContents& entry);
++
++  // Pool capacity from prefs, clamped to [1, number of providers].
++  size_t GetPoolSize() const;
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level);
++
 +  const raw_ref<Profile> profile_;
 +  const raw_ref<TabStripModel> tab_strip_model_;
 +
@@ -200,8 +238,12 @@ index 0000000000000..ef7c13f156ea7
 +  raw_ptr<views::ImageButton> menu_button_ = nullptr;
 +
 +  // We need to own the WebContents because WebView doesn't take ownership
-+  // when we call SetWebContents with externally created WebContents
-+  std::unique_ptr<content::WebContents> owned_web_contents_;
++  // when we call SetWebContents with externally created WebContents.
++  // Most recently used first; see PooledContents.
++  std::list<PooledContents> contents_pool_;
++
++  // Discards cold pool entries when the system is low on memory.
++  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 +
 +  // Store the last URL for each provider to restore state
 +  std::map<size_t, GURL> last_urls_;
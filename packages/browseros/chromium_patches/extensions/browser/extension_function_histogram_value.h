@@ -2,7 +2,7 @@ diff --git a/extensions/browser/extension_function_histogram_value.h b/extension
 index 6d9bd29ae220f..f84c951ebeacb 100644
 --- a/extensions/browser/extension_function_histogram_value.h
 +++ b/extensions/browser/extension_function_histogram_value.h
-@@ -2011,6 +2011,31 @@ enum HistogramValue {
+@@ -2011,6 +2011,39 @@ enum HistogramValue {
    DEVELOPERPRIVATE_SHOWSITESETTINGS = 1948,
    ACCESSIBILITY_PRIVATE_PROCESSPENDINGSPOKENFEEDBACKEVENT = 1949,
    ACCESSIBILITY_PRIVATE_ENABLESPOKENFEEDBACKMV3KEYHANDLING = 1950,
@@ -31,6 +31,14 @@ index 6d9bd29ae220f..f84c951ebeacb 100644
 +  SIDEPANEL_BROWSEROSISOPEN = 1973,
 +  BROWSER_OS_GETBROWSEROSVERSIONNUMBER = 1974,
 +  BROWSER_OS_CHOOSEPATH = 1975,
++  BROWSER_OS_STARTINTERACTIVESNAPSHOTSTREAM = 1976,
++  BROWSER_OS_READINTERACTIVESNAPSHOTSTREAM = 1977,
++  BROWSER_OS_GETINTERACTIVESNAPSHOTS = 1978,
++  BROWSER_OS_FINDNODES = 1979,
++  BROWSER_OS_WAITFORNODE = 1980,
++  BROWSER_OS_WAITFORTEXT = 1981,
++  BROWSER_OS_WAITFORNAVIGATION = 1982,
++  BROWSER_OS_WAITFORNETWORKIDLE = 1983,
    // Last entry: Add new entries above, then run:
    // tools/metrics/histograms/update_extension_histograms.py
    ENUM_BOUNDARY